@@ -0,0 +1,160 @@
+/*
+ * One generator per entity (e.g. a particle), allocated one by one on the heap compared to
+ * initialized in place in one array of the caller. Measures the time to initialize all
+ * generators and the time per number of a sweep, which draws one number of every entity.
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+
+#include "bench.h"
+#include "config.h"
+#include "f2lin.h"
+#include "mpi.h"
+
+#define SEED 12323456
+
+typedef struct data data;
+struct data {
+    double init_heap;
+    double sweep_heap;
+    double init_array;
+    double sweep_array;
+};
+
+static
+void write_results(char exec_name[static 1], size_t N,
+                   unsigned long long entities[N], data results[N]) {
+    char* fname;
+    FILE* f;
+
+    asprintf(&fname, "%s.csv", exec_name);
+    f = fopen(fname, "w");
+    fprintf(f, "entities,init_heap,sweep_heap,init_array,sweep_array\n");
+
+    for (size_t i = 0; i < N; ++i) {
+        data p = results[i];
+        fprintf(f, "%llu,%5.2e,%5.2e,%5.2e,%5.2e\n", entities[i],
+                p.init_heap, p.sweep_heap, p.init_array, p.sweep_array);
+    }
+    fclose(f);
+    free(fname);
+}
+
+// the sum of the numbers is returned, so the sweeps can't be dropped
+static
+uint64_t sweep(size_t iterations, size_t n, F2LinRngGeneric* rngs[n]) {
+    uint64_t sum = 0;
+
+    for (size_t i = 0; i < iterations; ++i) {
+        for (size_t e = 0; e < n; ++e) sum += f2lin_next_unsigned(rngs[e]);
+    }
+    return sum;
+}
+
+// the generators are found by their offset in the array instead of by a pointer
+static
+uint64_t sweep_in_place(size_t iterations, size_t n, char* array, size_t size) {
+    uint64_t sum = 0;
+
+    for (size_t i = 0; i < iterations; ++i) {
+        for (size_t e = 0; e < n; ++e) {
+            sum += f2lin_next_unsigned((F2LinRngGeneric*) (array + e * size));
+        }
+    }
+    return sum;
+}
+
+static
+void bench(size_t iterations, size_t repetitions, size_t n, data* r) {
+    const size_t size = f2lin_rng_state_size(RNG_TYPE);
+    F2LinBMPI init_heap = f2lin_bench_bmpi_init(repetitions);
+    F2LinBMPI sweep_heap = f2lin_bench_bmpi_init(repetitions);
+    F2LinBMPI init_array = f2lin_bench_bmpi_init(repetitions);
+    F2LinBMPI sweep_array = f2lin_bench_bmpi_init(repetitions);
+    F2LinRngGeneric** rngs = malloc(n * sizeof(F2LinRngGeneric*));
+    uint64_t sum = 0;
+    double times[3];
+
+    for (size_t rep = 0; rep < repetitions; ++rep) {
+        char* array;
+
+        times[0] = MPI_Wtime();
+        for (size_t e = 0; e < n; ++e) rngs[e] = f2lin_rng_init_type(RNG_TYPE, SEED + e);
+        times[1] = MPI_Wtime();
+        sum += sweep(iterations, n, rngs);
+        times[2] = MPI_Wtime();
+        f2lin_bench_bmpi_update(&init_heap, rep, times[1] - times[0]);
+        f2lin_bench_bmpi_update(&sweep_heap, rep, times[2] - times[1]);
+
+        for (size_t e = 0; e < n; ++e) f2lin_rng_destroy(rngs[e]);
+
+        // the array itself is one allocation, made before the generators are initialized
+        array = aligned_alloc(f2lin_rng_state_align(RNG_TYPE), n * size);
+        times[0] = MPI_Wtime();
+        for (size_t e = 0; e < n; ++e) f2lin_rng_init_at(RNG_TYPE, SEED + e, array + e * size);
+        times[1] = MPI_Wtime();
+        sum += sweep_in_place(iterations, n, array, size);
+        times[2] = MPI_Wtime();
+        f2lin_bench_bmpi_update(&init_array, rep, times[1] - times[0]);
+        f2lin_bench_bmpi_update(&sweep_array, rep, times[2] - times[1]);
+
+        free(array);
+    }
+
+    r->init_heap = f2lin_bench_bmpi_eval(&init_heap);
+    r->sweep_heap = f2lin_bench_bmpi_eval(&sweep_heap) / (double) (iterations * n);
+    r->init_array = f2lin_bench_bmpi_eval(&init_array);
+    r->sweep_array = f2lin_bench_bmpi_eval(&sweep_array) / (double) (iterations * n);
+
+    if (sum == 1) printf("\n");
+
+    f2lin_bench_bmpi_destroy(&init_heap);
+    f2lin_bench_bmpi_destroy(&sweep_heap);
+    f2lin_bench_bmpi_destroy(&init_array);
+    f2lin_bench_bmpi_destroy(&sweep_array);
+    free(rngs);
+}
+
+int main(int argc, char* argv[argc + 1]) {
+    MPI_Init(&argc, &argv);
+
+    unsigned long long buf[BUF_MAX];
+    size_t iterations, repetitions, n_sizes = argc - 3;
+    int rank;
+
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+
+    if (argc < 3) {
+        printf("Usage: mpirun -np x b_entity_streams iterations repetitions "
+               "[entities1, entities2, ...]\n");
+        printf("Iterations: sweeps over all entities between two time measurements\n");
+        MPI_Finalize();
+        return EXIT_FAILURE;
+    }
+    if (argc > BUF_MAX + 3) return EXIT_FAILURE;
+
+    iterations = strtoul(argv[1], 0, 10);
+    repetitions = strtoul(argv[2], 0, 10);
+
+    if (iterations == -1 || repetitions == -1) return EXIT_FAILURE;
+
+    f2lin_bench_parse_argv(argc, &argv[3], buf);
+    data results[n_sizes];
+
+    for (size_t i = 0; i < n_sizes; ++i) {
+        data* r = &results[i];
+
+        bench(iterations, repetitions, buf[i], r);
+        if (rank == 0) {
+            printf("entities: %llu\tinit heap: %5.2e\tsweep heap: %5.2e\t"
+                   "init array: %5.2e\tsweep array: %5.2e\n",
+                   buf[i], r->init_heap, r->sweep_heap, r->init_array, r->sweep_array);
+        }
+    }
+
+    if (rank == 0) write_results(argv[0], n_sizes, buf, results);
+
+    MPI_Finalize();
+    return EXIT_SUCCESS;
+}
@@ -9,6 +9,7 @@
 #include "flint/nmod_poly.h"
 
 #include "rng_generic/rng_generic.h"
+#include "f2poly.h"
 #include "bench.h"
 #include "tools.h"
 
@@ -17,6 +18,7 @@ typedef struct data data;
 struct data {
     double init;
     double jp;
+    double native;
 };
 
 static 
@@ -30,15 +32,15 @@ void write_results(char exec_name[static 1], size_t N, unsigned long long jumps[
     asprintf(&mpname, "%s_mp.csv", exec_name);
 
     f = fopen(fname, "w");
-    fprintf(f, "jump,jumppoly\n");
+    fprintf(f, "jump,jumppoly,native\n");
 
     for (size_t i = 0; i < N; ++i) {
-        fprintf(f, "%llu,%5.2e\n", jumps[i], results[i].jp);
+        fprintf(f, "%llu,%5.2e,%5.2e\n", jumps[i], results[i].jp, results[i].native);
     }
 
     freopen(mpname, "w", f);
     fprintf(f, "state_size,minpoly,minpoly_seq\n");
-    fprintf(f, "%zu,%5.2e,%5.2e\n", f2lin_rng_generic_state_size(), minpoly, seq);
+    fprintf(f, "%zu,%5.2e,%5.2e\n", f2lin_rng_generic_state_size(RNG_TYPE), minpoly, seq);
 
     free(fname);
     free(mpname);
@@ -47,8 +49,8 @@ void write_results(char exec_name[static 1], size_t N, unsigned long long jumps[
 
 static
 void init_p_min(nmod_berlekamp_massey_t B) {
-    F2LinRngGeneric* rng = f2lin_rng_generic_init();
-    size_t state_size = f2lin_rng_generic_state_size();
+    F2LinRngGeneric* rng = f2lin_rng_generic_init(RNG_TYPE);
+    size_t state_size = f2lin_rng_generic_state_size(RNG_TYPE);
     mp_limb_t a[state_size * 2];
     
     for (size_t i = 0; i < state_size * 2; ++i) {
@@ -74,14 +76,26 @@ void init_p_jump(const nmod_poly_t p_min, size_t jump) {
     nmod_poly_clear(p_jump);
 }
 
+// same as init_p_jump(), but with the native arithmetic from f2poly.h
+static
+void init_p_jump_native(const F2LinPoly* p_min, size_t jump) {
+    F2LinPoly* p_jump = f2lin_poly_init();
+    F2LinPolyMod* p_min_mod = f2lin_poly_mod_init(p_min);
+
+    f2lin_poly_power_x_mod(p_jump, jump, p_min_mod);
+
+    f2lin_poly_mod_destroy(p_min_mod);
+    f2lin_poly_destroy(p_jump);
+}
+
 static
 double benchmark_minimal_polynomial_seq(size_t iterations, size_t repetitions) {
     nmod_berlekamp_massey_t B[iterations];
     F2LinBMPI bmpi = f2lin_bench_bmpi_init(repetitions);
 
     double times[2];
-    F2LinRngGeneric* rng = f2lin_rng_generic_init();
-    size_t state_size = f2lin_rng_generic_state_size();
+    F2LinRngGeneric* rng = f2lin_rng_generic_init(RNG_TYPE);
+    size_t state_size = f2lin_rng_generic_state_size(RNG_TYPE);
     mp_limb_t seq[state_size * 2];
 
     for (size_t rep = 0; rep < repetitions; ++rep) {
@@ -121,7 +135,7 @@ double benchmark_minimal_polynomial(size_t iterations, size_t repetitions) {
     F2LinBMPI bmpi = f2lin_bench_bmpi_init(repetitions);
 
     double times[2];
-    F2LinRngGeneric* rng = f2lin_rng_generic_init();
+    F2LinRngGeneric* rng = f2lin_rng_generic_init(RNG_TYPE);
 
     for (size_t rep = 0; rep < repetitions; ++rep) {
         // initialize
@@ -210,6 +224,30 @@ double benchmark_jump_polynomial(size_t iterations, size_t repetitions, size_t j
     return avg;
 }
 
+static 
+double benchmark_jump_polynomial_native(size_t iterations, size_t repetitions, size_t jump) {
+    F2LinBMPI bmpi = f2lin_bench_bmpi_init(repetitions);
+    double times[2];
+    F2LinPoly* p_min = f2lin_poly_init_from_string(f2lin_rng_generic_min_poly(RNG_TYPE));
+
+    for (size_t rep = 0; rep < repetitions; ++rep) {
+        times[0] = MPI_Wtime();
+        for (size_t i = 0; i < iterations; ++i) {
+            init_p_jump_native(p_min, jump);
+        }
+        times[1] = MPI_Wtime();
+        
+        f2lin_bench_bmpi_update(&bmpi, rep, times[1] - times[0]);
+    }
+
+    double avg = f2lin_bench_bmpi_eval(&bmpi) / (double) iterations;
+
+    f2lin_poly_destroy(p_min);
+    f2lin_bench_bmpi_destroy(&bmpi);
+
+    return avg;
+}
+
 int main(int argc, char* argv[argc + 1]) {
     MPI_Init(&argc, &argv);
     size_t iterations, repetitions, n_jumps = argc - 3;
@@ -232,8 +270,9 @@ int main(int argc, char* argv[argc + 1]) {
     for (size_t i = 0; i < n_jumps; ++i) {
         results[i].jp = benchmark_jump_polynomial(iterations, repetitions, jumps[i]);
         results[i].init = benchmark_jump_polynomial_init(iterations, repetitions, jumps[i]);
-        if (rank == 0) printf("jump: %llu\tinit: %5.2e\tjp: %5.2e\n", 
-                              jumps[i], results[i].init, results[i].jp);
+        results[i].native = benchmark_jump_polynomial_native(iterations, repetitions, jumps[i]);
+        if (rank == 0) printf("jump: %llu\tinit: %5.2e\tjp: %5.2e\tnative: %5.2e\n", 
+                              jumps[i], results[i].init, results[i].jp, results[i].native);
     }
 
     double minpoly = benchmark_minimal_polynomial(iterations, repetitions);
@@ -241,7 +280,7 @@ int main(int argc, char* argv[argc + 1]) {
 
     if (rank == 0) { 
         printf("state size: %zu\tminpoly: %5.2e\tminpoly_seq: %5.2e\n",
-                f2lin_rng_generic_state_size(), minpoly, seq);
+                f2lin_rng_generic_state_size(RNG_TYPE), minpoly, seq);
         write_results(argv[0], n_jumps, jumps, results, minpoly, seq);
     }
 
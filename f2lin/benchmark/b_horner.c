@@ -7,6 +7,9 @@
  * "q" values. Q is the degree of the decomposition polynomials used in those two algorithms.
  * Accepted values for q are in the range from 1 to 10.
  * 1 behaves exactly as just running horners algorithm.
+ *
+ * horner is also compared to evaluating the polynomial one coefficient at a time through 
+ * GF2X_coeff(), which is how it was done before the jump polynomials were packed.
  */
 
 #include <limits.h>
@@ -20,6 +23,7 @@
 #include "tools.h"
 #include "bench.h"
 #include "jump_ahead.h"
+#include "jump_cache.h"
 #include "poly_decomp.h"
 #include "rng_generic/rng_generic.h"
 #include "gf2x_wrapper.h"
@@ -46,6 +50,7 @@ typedef struct data data;
 struct data {
     size_t deg;
     double h;
+    double hc;
 };
 
 static
@@ -59,10 +64,10 @@ void write_results(char exec_name[static 1], size_t N, unsigned long long buf[N]
         
         printf("writing to %s\n", fname);
 
-        fprintf(f, "deg,horner,\n");
+        fprintf(f, "deg,horner,horner_coeff,\n");
 
         for (size_t i = 0; i < N; ++i) {
-            fprintf(f, "%llu,%5.2e,\n", buf[i], results[i].h);
+            fprintf(f, "%llu,%5.2e,%5.2e,\n", buf[i], results[i].h, results[i].hc);
         }
         fclose(f);
         free(fname);
@@ -73,12 +78,13 @@ double exec(unsigned long long poly_deg, F2LinConfig* cfg, size_t iterations, si
     double avg;
     F2LinBMPI bmpi = f2lin_bench_bmpi_init(repetitions);
 
-    F2LinRngGeneric* rng = f2lin_rng_generic_init();
-    F2LinJump* jp = f2lin_jump_ahead_init(poly_deg, cfg);
+    F2LinRngGeneric* rng = f2lin_rng_generic_init(RNG_TYPE);
+    F2LinJump* jp = f2lin_jump_ahead_init(RNG_TYPE, poly_deg, cfg);
     GF2X* rand = f2lin_poly_rand_init(poly_deg);
 
-    GF2X_zero_destroy(jp->jp.horner);
-    jp->jp.horner = rand;
+    f2lin_poly_destroy(jp->jp.horner);
+    jp->jp.horner = GF2X_pack(rand);
+    GF2X_zero_destroy(rand);
     
     for (size_t rep = 0; rep < repetitions; ++rep) {
         double start, end;
@@ -99,6 +105,57 @@ double exec(unsigned long long poly_deg, F2LinConfig* cfg, size_t iterations, si
     return avg;
 }
 
+// horner's method reading one coefficient at a time, as in jump_ahead.c before packing
+static 
+F2LinRngGeneric* horner_coeff(F2LinRngGeneric* rng, const GF2X* jump_poly) {
+    F2LinRngGeneric* tmp = f2lin_rng_generic_init_zero(RNG_TYPE);  
+    int i = GF2X_deg(jump_poly);
+
+    f2lin_rng_generic_copy(tmp, rng);
+
+    if (i > 0) {
+        f2lin_rng_generic_next_state(tmp);
+        --i;
+        for(; i > 0; --i) {
+            if(GF2X_coeff(jump_poly, i) != 0) f2lin_rng_generic_add(tmp, rng);
+            f2lin_rng_generic_next_state(tmp);
+        }
+
+        if(GF2X_coeff(jump_poly, 0) != 0) f2lin_rng_generic_add(tmp, rng);
+    }
+
+    f2lin_rng_generic_copy(rng, tmp);
+    f2lin_rng_generic_destroy(tmp);
+    return rng;
+}
+
+static 
+double exec_coeff(unsigned long long poly_deg, size_t iterations, size_t repetitions) {
+    double avg;
+    F2LinBMPI bmpi = f2lin_bench_bmpi_init(repetitions);
+
+    F2LinRngGeneric* rng = f2lin_rng_generic_init(RNG_TYPE);
+    GF2X* rand = f2lin_poly_rand_init(poly_deg);
+
+    for (size_t rep = 0; rep < repetitions; ++rep) {
+        double start, end;
+        start = MPI_Wtime();
+        for (size_t i = 0; i < iterations; ++i) {
+            horner_coeff(rng, rand);
+        }
+        end = MPI_Wtime();
+        f2lin_bench_bmpi_update(&bmpi, rep, end - start);
+    }
+
+    avg = f2lin_bench_bmpi_eval(&bmpi) / (double) iterations;
+
+    GF2X_zero_destroy(rand);
+    f2lin_rng_generic_destroy(rng);
+    f2lin_bench_bmpi_destroy(&bmpi);
+
+    return avg;
+}
+
 int main(int argc, char* argv[argc + 1]) {  
     MPI_Init(&argc, &argv);
 
@@ -119,6 +176,9 @@ int main(int argc, char* argv[argc + 1]) {
 
     MPI_Comm_rank(MPI_COMM_WORLD, &grank);
 
+    // the jump polynomials are replaced by random ones, so they can't be shared
+    f2lin_jump_cache_set_limit(0);
+
     if (argc > BUF_MAX + 3) {
         fprintf(stderr, "Too many arguments, only support a maximum of %d.\n", BUF_MAX);
         return EXIT_FAILURE;
@@ -131,7 +191,9 @@ int main(int argc, char* argv[argc + 1]) {
 
     for (size_t i = 0; i < n_deg; ++i) {
         results[i].h  = exec(buf[i], &cfg, iterations, repetitions);
-        if (grank == 0) printf("polydeg: %llu\thorner:%5.2e\n", buf[i], results[i].h);
+        results[i].hc = exec_coeff(buf[i], iterations, repetitions);
+        if (grank == 0) printf("polydeg: %llu\thorner:%5.2e\thorner_coeff:%5.2e\n", 
+                               buf[i], results[i].h, results[i].hc);
     }
 
     /* write the results */
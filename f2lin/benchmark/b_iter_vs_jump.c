@@ -1,5 +1,6 @@
 /*
- * Test how long it takes to jump n numbers in comparison to calculate them iteratively.
+ * Test how long it takes to jump n numbers in comparison to calculate them iteratively,
+ * and to f2lin_advance(), which chooses between both.
  */
 
 #include <stdlib.h>
@@ -10,11 +11,14 @@
 #include "mpi.h"
 #include "unistd.h"
 
+#define SEED 12323456
+
 typedef struct data data;
 struct data {
     double ji;
     double jni;
     double iter;
+    double advance;
 };
 
 static
@@ -25,11 +29,12 @@ void write_results(char exec_name[static 1], size_t N,
 
     asprintf(&fname, "%s.csv", exec_name);
     f = fopen(fname, "w");
-    fprintf(f, "jump,jump_with_init,jump_no_init,iterative\n");
+    fprintf(f, "jump,jump_with_init,jump_no_init,iterative,advance\n");
 
     for (size_t i = 0; i < N; ++i) {
         data p = results[i];
-        fprintf(f, "%llu,%5.2e,%5.2e,%5.2e\n", jumps[i], p.ji, p.jni, p.iter);
+        fprintf(f, "%llu,%5.2e,%5.2e,%5.2e,%5.2e\n", jumps[i], p.ji, p.jni, p.iter, 
+                p.advance);
 
     }
     fclose(f);
@@ -38,7 +43,7 @@ void write_results(char exec_name[static 1], size_t N,
 
 static
 double bench_iter(size_t iterations, size_t repetitions, unsigned long long jump_size) {
-    F2LinRngGeneric* rng = f2lin_rng_init(); 
+    F2LinRngGeneric* rng = f2lin_rng_init_type(RNG_TYPE, SEED); 
     F2LinBMPI bmpi = f2lin_bench_bmpi_init(repetitions);
     double times[2];
 
@@ -63,8 +68,8 @@ double bench_iter(size_t iterations, size_t repetitions, unsigned long long jump
 
 static
 double bench_jump_no_init(size_t iterations, size_t repetitions, unsigned long long jump_size) {
-    F2LinRngGeneric* rng = f2lin_rng_init();
-    F2LinJump* jump = f2lin_jump_init(jump_size, 0);
+    F2LinRngGeneric* rng = f2lin_rng_init_type(RNG_TYPE, SEED);
+    F2LinJump* jump = f2lin_jump_init_type(RNG_TYPE, jump_size, 0);
     F2LinBMPI bmpi = f2lin_bench_bmpi_init(repetitions);
     double times[2];
 
@@ -86,8 +91,34 @@ double bench_jump_no_init(size_t iterations, size_t repetitions, unsigned long l
     return avg;
 }
 
+// the first advance calibrates the cost model and may initialize a jump, it isn't measured
+static
+double bench_advance(size_t iterations, size_t repetitions, unsigned long long jump_size) {
+    F2LinRngGeneric* rng = f2lin_rng_init_type(RNG_TYPE, SEED);
+    F2LinBMPI bmpi = f2lin_bench_bmpi_init(repetitions);
+    double times[2];
+
+    f2lin_advance(rng, jump_size);
+
+    for (size_t rep = 0; rep < repetitions; ++rep) {
+        times[0] = MPI_Wtime();
+        for (size_t i = 0; i < iterations; ++i) {
+            f2lin_advance(rng, jump_size);
+        }
+        times[1] = MPI_Wtime();
+        f2lin_bench_bmpi_update(&bmpi, rep, times[1] - times[0]);
+    }
+
+    double avg = f2lin_bench_bmpi_eval(&bmpi) / (double) iterations;
+
+    f2lin_bench_bmpi_destroy(&bmpi);
+    f2lin_rng_destroy(rng);
+
+    return avg;
+}
+
 double bench_jump_with_init(size_t iterations, size_t repetitions, unsigned long long jump_size) {
-    F2LinRngGeneric* rng = f2lin_rng_init();
+    F2LinRngGeneric* rng = f2lin_rng_init_type(RNG_TYPE, SEED);
     F2LinBMPI bmpi = f2lin_bench_bmpi_init(repetitions);
     F2LinJump* jumps[iterations];
     double times[2];
@@ -95,7 +126,7 @@ double bench_jump_with_init(size_t iterations, size_t repetitions, unsigned long
     for (size_t rep = 0; rep < repetitions; ++rep) {
         times[0] = MPI_Wtime();
         for (size_t i = 0; i < iterations; ++i) {
-            jumps[i] = f2lin_jump_init(jump_size, 0);
+            jumps[i] = f2lin_jump_init_type(RNG_TYPE, jump_size, 0);
             f2lin_jump(rng, jumps[i]);
         }
         times[1] = MPI_Wtime();
@@ -140,9 +171,11 @@ int main(int argc, char* argv[argc + 1]) {
         results[i].ji = bench_jump_with_init(iterations, repetitions, buf[i]);
         results[i].jni = bench_jump_no_init(iterations, repetitions, buf[i]);
         results[i].iter = bench_iter(iterations, repetitions, buf[i]);
+        results[i].advance = bench_advance(iterations, repetitions, buf[i]);
         
-        if (rank == 0) printf("jump: %llu\tji: %5.2e\tjni: %5.2e\titer: %5.2e\n",
-                              buf[i], results[i].ji, results[i].jni, results[i].iter);
+        if (rank == 0) printf("jump: %llu\tji: %5.2e\tjni: %5.2e\titer: %5.2e\tadv: %5.2e\n",
+                              buf[i], results[i].ji, results[i].jni, results[i].iter,
+                              results[i].advance);
     }
 
     if (rank == 0) write_results(argv[0], n_jumps, buf, results);
@@ -3,6 +3,9 @@
  * algorithm. 
  * Important here are the initialization of the decomposition polynomial, and the 
  * calculation of the jump polynomial.
+ * The jump polynomial is calculated by exponentiation (PowerMod) and by composing it from 
+ * the table of x^(2^k) mod p. Building the table is measured separately, since it is only
+ * done once per generator.
  */
 #include <stdio.h>
 #include <stdlib.h>
@@ -12,6 +15,8 @@
 #include "bench.h"
 #include "poly_decomp.h"
 #include "poly_rand.h"
+#include "jump_poly.h"
+#include "config.h"
 
 #define N_DEG 7
 
@@ -20,6 +25,8 @@ struct data {
     size_t deg; 
     size_t jump;
     double jp; 
+    double tp; 
+    double tinit; 
     double dp; 
 };
 
@@ -31,29 +38,24 @@ void write_results(char exec_name[static 1], size_t N, data results[N]) {
     asprintf(&fname, "%s.csv", exec_name);
     f = fopen(fname, "w");
 
-    fprintf(f, "deg,jump,jumppoly,decomppoly\n");
+    fprintf(f, "deg,jump,jumppoly,tablepoly,tableinit,decomppoly\n");
 
     for (size_t i = 0; i < N; ++i) {
         data *p = &results[i];
-        fprintf(f, "%zu,%zu,%5.2e,%5.2e\n", 
-                p->deg,p->jump,p->jp,p->dp);
+        fprintf(f, "%zu,%zu,%5.2e,%5.2e,%5.2e,%5.2e\n", 
+                p->deg,p->jump,p->jp,p->tp,p->tinit,p->dp);
     }
 
     fclose(f);
     free(fname);
 }
 
-/* This implementation is exactly copied from "jump_ahead.c" */
 static GF2X* init_jump_poly(const GF2X* min_poly, const size_t jump_size) {
-    GF2X* jump_poly = GF2X_zero_init();
-    GF2X* x = GF2X_zero_init();
-    GF2X_SetCoeff(x, 1, 1);
     GF2XModulus* minimal_poly_mod = GF2XModulus_zero_init();
 
     GF2XModulus_build(minimal_poly_mod, min_poly);
-    GF2X_PowerMod(jump_poly, x, jump_size, minimal_poly_mod);
+    GF2X* jump_poly = f2lin_jump_poly_power_mod(minimal_poly_mod, jump_size);
     
-    GF2X_zero_destroy(x);
     GF2XModulus_destroy(minimal_poly_mod);
 
     return jump_poly;
@@ -86,17 +88,19 @@ double bench_decomp_poly(size_t deg, size_t jump_size, size_t iterations, size_t
     return res_init_decomp_poly;
 }
 
+// the modulus is built outside of the measurement, since it is built once per generator
 static
 double bench_jump_poly(size_t deg, size_t jump_size, size_t iterations, size_t repetitions) {
     F2LinBMPI bmpi = f2lin_bench_bmpi_init(repetitions);
     GF2X* min_poly = f2lin_poly_rand_init(deg);
-    GF2X* p = init_jump_poly(min_poly, jump_size);
+    GF2XModulus* min_poly_mod = GF2XModulus_zero_init();
+    GF2XModulus_build(min_poly_mod, min_poly);
 
     for (size_t rep = 0; rep < repetitions; ++rep) {
-        double start, end, time, times[2];
+        double times[2];
         times[0] = MPI_Wtime();
         for (size_t i = 0; i < iterations; ++i) {
-            GF2X* p = init_jump_poly(min_poly, jump_size);
+            GF2X* p = f2lin_jump_poly_power_mod(min_poly_mod, jump_size);
             GF2X_zero_destroy(p);
         }
         times[1] = MPI_Wtime();
@@ -104,15 +108,52 @@ double bench_jump_poly(size_t deg, size_t jump_size, size_t iterations, size_t r
         f2lin_bench_bmpi_update(&bmpi, rep, (times[1] - times[0]));
     }
 
-    double res_init_jump_poly = f2lin_bench_bmpi_eval(&bmpi);
+    double res_init_jump_poly = f2lin_bench_bmpi_eval(&bmpi) / (double) iterations;
 
     f2lin_bench_bmpi_destroy(&bmpi);
-    GF2X_zero_destroy(p);
+    GF2XModulus_destroy(min_poly_mod);
     GF2X_zero_destroy(min_poly);
 
     return res_init_jump_poly;
 }
 
+// like for PowerMod, the modulus is built outside of the measurement
+static
+double bench_table_poly(size_t deg, size_t jump_size, size_t iterations, size_t repetitions,
+                        double* table_init) {
+    F2LinBMPI bmpi = f2lin_bench_bmpi_init(repetitions);
+    F2LinBMPI bmpi_init = f2lin_bench_bmpi_init(repetitions);
+    GF2X* min_poly = f2lin_poly_rand_init(deg);
+    GF2XModulus* min_poly_mod = GF2XModulus_zero_init();
+    GF2XModulus_build(min_poly_mod, min_poly);
+
+    for (size_t rep = 0; rep < repetitions; ++rep) {
+        double times[3];
+        times[0] = MPI_Wtime();
+        F2LinPow2Table* table = f2lin_jump_poly_pow2_table_init(min_poly_mod, POW2_TABLE_SIZE);
+        times[1] = MPI_Wtime();
+        for (size_t i = 0; i < iterations; ++i) {
+            GF2X* p = f2lin_jump_poly_compose(table, jump_size);
+            GF2X_zero_destroy(p);
+        }
+        times[2] = MPI_Wtime();
+
+        f2lin_bench_bmpi_update(&bmpi_init, rep, (times[1] - times[0]));
+        f2lin_bench_bmpi_update(&bmpi, rep, (times[2] - times[1]));
+        f2lin_jump_poly_pow2_table_destroy(table);
+    }
+
+    double res_table_poly = f2lin_bench_bmpi_eval(&bmpi) / (double) iterations;
+    *table_init = f2lin_bench_bmpi_eval(&bmpi_init);
+
+    f2lin_bench_bmpi_destroy(&bmpi);
+    f2lin_bench_bmpi_destroy(&bmpi_init);
+    GF2XModulus_destroy(min_poly_mod);
+    GF2X_zero_destroy(min_poly);
+
+    return res_table_poly;
+}
+
 int main(int argc, char* argv[argc + 1]) {
     MPI_Init(&argc, &argv);
     unsigned long long iterations, repetitions;
@@ -149,6 +190,9 @@ int main(int argc, char* argv[argc + 1]) {
         for (size_t j = 0; j < N_JUMPS; ++j) {
             double avg_jp = bench_jump_poly(minpoly_sizes[i], jumps[j], 
                                             iterations, repetitions);
+            double avg_tinit;
+            double avg_tp = bench_table_poly(minpoly_sizes[i], jumps[j], 
+                                             iterations, repetitions, &avg_tinit);
             double avg_dp = bench_decomp_poly(minpoly_sizes[i], jumps[j], 
                                               iterations, repetitions);
             if (rank == root) {
@@ -156,10 +200,13 @@ int main(int argc, char* argv[argc + 1]) {
                     .deg = minpoly_sizes[i],
                     .jump = jumps[j],
                     .jp = avg_jp,
+                    .tp = avg_tp,
+                    .tinit = avg_tinit,
                     .dp = avg_dp
                 };
-                printf("jump: %llu, jumppoly: %5.2es\t, decomppoly: %5.2es\n",
-                        jumps[j], avg_jp, avg_dp);
+                printf("jump: %llu, jumppoly: %5.2es\t, tablepoly: %5.2es\t, "
+                       "tableinit: %5.2es\t, decomppoly: %5.2es\n",
+                        jumps[j], avg_jp, avg_tp, avg_tinit, avg_dp);
             }
         }
     }
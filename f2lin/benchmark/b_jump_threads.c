@@ -0,0 +1,175 @@
+/*
+ * Time until every thread of a rank did one jump, when the threads share one jump and jump
+ * generators of their own. The scratch space of a jump is allocated and freed for every
+ * jump (as every jump did before workspaces), taken from the workspace of the thread, or 
+ * initialized once in an arena of the caller. The difference between the first and the 
+ * other columns is the cost of malloc, including the contention on its locks.
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <pthread.h>
+
+#include "bench.h"
+#include "config.h"
+#include "jump_ahead.h"
+#include "simd.h"
+#include "rng_generic/rng_generic.h"
+#include "mpi.h"
+
+#define THREADS_MAX 256
+
+enum Mode {
+    ALLOC, THREAD, ARENA,
+};
+
+typedef struct data data;
+struct data {
+    double alloc;
+    double thread;
+    double arena;
+};
+
+/* the jumps of one thread, the arena is only used in mode ARENA */
+typedef struct ThreadArgs ThreadArgs;
+struct ThreadArgs {
+    const F2LinJump* jump;
+    enum Mode mode;
+    size_t iterations;
+    void* arena;
+};
+
+static
+void write_results(char exec_name[static 1], size_t threads, size_t N,
+                   unsigned long long jumps[N], data results[N]) {
+    char* fname;
+    FILE* f;
+
+    asprintf(&fname, "%s_%zu.csv", exec_name, threads);
+    f = fopen(fname, "w");
+    fprintf(f, "jump,alloc,thread,arena\n");
+
+    for (size_t i = 0; i < N; ++i) {
+        fprintf(f, "%llu,%5.2e,%5.2e,%5.2e\n",
+                jumps[i], results[i].alloc, results[i].thread, results[i].arena);
+    }
+    fclose(f);
+    free(fname);
+}
+
+static
+void* jump_thread(void* arg) {
+    const ThreadArgs* t = arg;
+    F2LinRngGeneric* rng = f2lin_rng_generic_init(RNG_TYPE);
+    const int q = f2lin_jump_ahead_work_q(t->jump);
+    F2LinJumpWork* arena_work = 0;
+
+    if (t->arena) arena_work = f2lin_jump_ahead_work_init_at(RNG_TYPE, q, t->arena);
+
+    for (size_t i = 0; i < t->iterations; ++i) {
+        switch (t->mode) {
+            case ALLOC: {
+                F2LinJumpWork* work = f2lin_jump_ahead_work_init(RNG_TYPE, q);
+                f2lin_jump_ahead_jump_work(t->jump, rng, work);
+                f2lin_jump_ahead_work_destroy(work);
+                break;
+            }
+            case THREAD:
+                f2lin_jump_ahead_jump(t->jump, rng);
+                break;
+            default:
+                f2lin_jump_ahead_jump_work(t->jump, rng, arena_work);
+        }
+    }
+
+    f2lin_rng_generic_destroy(rng);
+    return 0;
+}
+
+static
+double bench_mode(size_t threads, size_t iterations, size_t repetitions,
+                  const F2LinJump* jump, enum Mode mode) {
+    const int q = f2lin_jump_ahead_work_q(jump);
+    const size_t arena_size = f2lin_jump_ahead_work_size(RNG_TYPE, q);
+    F2LinBMPI bmpi = f2lin_bench_bmpi_init(repetitions);
+    pthread_t tids[THREADS_MAX];
+    ThreadArgs args[THREADS_MAX];
+    double times[2];
+
+    for (size_t t = 0; t < threads; ++t) {
+        args[t] = (ThreadArgs) {
+            jump, mode, iterations, mode == ARENA ? f2lin_simd_alloc(arena_size) : 0
+        };
+    }
+
+    for (size_t rep = 0; rep < repetitions; ++rep) {
+        MPI_Barrier(MPI_COMM_WORLD);
+        times[0] = MPI_Wtime();
+        for (size_t t = 0; t < threads; ++t) pthread_create(&tids[t], 0, jump_thread, &args[t]);
+        for (size_t t = 0; t < threads; ++t) pthread_join(tids[t], 0);
+        times[1] = MPI_Wtime();
+        f2lin_bench_bmpi_update(&bmpi, rep, times[1] - times[0]);
+    }
+
+    double avg = f2lin_bench_bmpi_eval(&bmpi) / (double) iterations;
+
+    for (size_t t = 0; t < threads; ++t) free(args[t].arena);
+    f2lin_bench_bmpi_destroy(&bmpi);
+
+    return avg;
+}
+
+int main(int argc, char* argv[argc + 1]) {
+    MPI_Init(&argc, &argv);
+
+    unsigned long long buf[BUF_MAX];
+    size_t threads, iterations, repetitions, n_jumps = argc - 4;
+    int rank;
+    F2LinConfig cfg = { .algorithm = SLIDING_WINDOW_DECOMP, .q = Q_DEFAULT };
+
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+
+    if (argc < 4) {
+        printf("Usage: mpirun -np x b_jump_threads threads iterations repetitions "
+               "[jump1, jump2, ...]\n");
+        printf("Threads: threads per rank sharing one jump\n");
+        printf("Iterations: jumps per thread between two time measurements\n");
+        MPI_Finalize();
+        return EXIT_FAILURE;
+    }
+    if (argc > BUF_MAX + 4) return EXIT_FAILURE;
+
+    threads = strtoul(argv[1], 0, 10);
+    iterations = strtoul(argv[2], 0, 10);
+    repetitions = strtoul(argv[3], 0, 10);
+
+    if (threads == -1 || iterations == -1 || repetitions == -1) return EXIT_FAILURE;
+    if (threads < 1 || threads > THREADS_MAX) {
+        fprintf(stderr, "Threads have to be between 1 and %d\n", THREADS_MAX);
+        MPI_Finalize();
+        return EXIT_FAILURE;
+    }
+
+    f2lin_bench_parse_argv(argc - 1, &argv[4], buf);
+    data results[n_jumps];
+
+    for (size_t i = 0; i < n_jumps; ++i) {
+        F2LinJump* jump = f2lin_jump_ahead_init(RNG_TYPE, buf[i], &cfg);
+        data* r = &results[i];
+
+        r->alloc = bench_mode(threads, iterations, repetitions, jump, ALLOC);
+        r->thread = bench_mode(threads, iterations, repetitions, jump, THREAD);
+        r->arena = bench_mode(threads, iterations, repetitions, jump, ARENA);
+
+        if (rank == 0) {
+            printf("threads: %zu\tjump: %llu\talloc: %5.2e\tthread: %5.2e\tarena: %5.2e\n",
+                   threads, buf[i], r->alloc, r->thread, r->arena);
+        }
+        f2lin_jump_ahead_destroy(jump);
+    }
+
+    if (rank == 0) write_results(argv[0], threads, n_jumps, buf, results);
+
+    MPI_Finalize();
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,138 @@
+/*
+ * Throughput of the multi-lane xoshiro256++ in comparison to the single stream bulk 
+ * generation, in GB/s of generated numbers.
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+
+#include "bench.h"
+#include "f2lin_lanes.h"
+#include "rng_generic/rng_generic.h"
+#include "mpi.h"
+
+#define SUBSTREAM_SIZE (1ull << 50)
+
+typedef struct data data;
+struct data {
+    double single;
+    double substreams;
+    double interleaved;
+};
+
+static
+void write_results(char exec_name[static 1], size_t N, 
+                   unsigned long long sizes[N], data results[N]) {
+    char* fname;
+    FILE* f;
+
+    asprintf(&fname, "%s.csv", exec_name);
+    f = fopen(fname, "w");
+    fprintf(f, "numbers,single_gbs,substreams_gbs,interleaved_gbs\n");
+
+    for (size_t i = 0; i < N; ++i) {
+        fprintf(f, "%llu,%5.2f,%5.2f,%5.2f\n", sizes[i], results[i].single, 
+                results[i].substreams, results[i].interleaved);
+    }
+    fclose(f);
+    free(fname);
+}
+
+static
+double gbs(size_t iterations, size_t n, double seconds) {
+    return seconds > 0 ? iterations * n * sizeof(uint64_t) / seconds * 1e-9 : 0;
+}
+
+static
+double bench_single(size_t iterations, size_t repetitions, size_t n, uint64_t buf[n]) {
+    F2LinRngGeneric* rng = f2lin_rng_generic_init(F2LIN_XOSHIRO256PP);
+    F2LinBMPI bmpi = f2lin_bench_bmpi_init(repetitions);
+    double times[2];
+
+    for (size_t rep = 0; rep < repetitions; ++rep) {
+        times[0] = MPI_Wtime();
+        for (size_t i = 0; i < iterations; ++i) {
+            f2lin_rng_generic_gen_n_numbers(rng, n, buf);
+        }
+        times[1] = MPI_Wtime();
+        f2lin_bench_bmpi_update(&bmpi, rep, times[1] - times[0]);
+    }
+
+    double med = f2lin_bench_bmpi_eval(&bmpi);
+
+    f2lin_rng_generic_destroy(rng);
+    f2lin_bench_bmpi_destroy(&bmpi);
+
+    return gbs(iterations, n, med);
+}
+
+static
+double bench_lanes(size_t iterations, size_t repetitions, size_t n, uint64_t buf[n], 
+                   enum F2LinLanesMode mode) {
+    F2LinRngGeneric* rng = f2lin_rng_generic_init(F2LIN_XOSHIRO256PP);
+    F2LinLanes* lanes = f2lin_lanes_init(rng, 0, mode, SUBSTREAM_SIZE);
+    F2LinBMPI bmpi = f2lin_bench_bmpi_init(repetitions);
+    double times[2];
+
+    for (size_t rep = 0; rep < repetitions; ++rep) {
+        times[0] = MPI_Wtime();
+        for (size_t i = 0; i < iterations; ++i) {
+            f2lin_lanes_fill_u64(lanes, n, buf);
+        }
+        times[1] = MPI_Wtime();
+        f2lin_bench_bmpi_update(&bmpi, rep, times[1] - times[0]);
+    }
+
+    double med = f2lin_bench_bmpi_eval(&bmpi);
+
+    f2lin_lanes_destroy(lanes);
+    f2lin_rng_generic_destroy(rng);
+    f2lin_bench_bmpi_destroy(&bmpi);
+
+    return gbs(iterations, n, med);
+}
+
+int main(int argc, char* argv[argc + 1]) {
+    MPI_Init(&argc, &argv);
+
+    unsigned long long sizes[BUF_MAX];
+    size_t iterations, repetitions, n_sizes = argc - 3;
+    int rank;
+
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+
+    if (argc < 3) {
+        printf("Usage: mpirun -np x b_lanes iterations repetitions [n1, n2, ...]\n");
+        printf("Iterations: number of buffers filled between two time measurements\n");
+        printf("Repetitions: Number of datapoints collected per process\n");
+        printf("n: numbers generated per buffer\n");
+        return EXIT_FAILURE;
+    }
+    if (argc > BUF_MAX + 3) return EXIT_FAILURE;
+
+    iterations = strtoul(argv[1], 0, 10);
+    repetitions = strtoul(argv[2], 0, 10);
+
+    if (iterations == -1 || repetitions == -1) return EXIT_FAILURE;
+
+    f2lin_bench_parse_argv(argc, &argv[3], sizes);
+    data results[n_sizes];
+
+    for (size_t i = 0; i < n_sizes; ++i) {
+        uint64_t* buf = malloc(sizes[i] * sizeof(uint64_t));
+
+        results[i].single = bench_single(iterations, repetitions, sizes[i], buf);
+        results[i].substreams = bench_lanes(iterations, repetitions, sizes[i], buf, SUBSTREAMS);
+        results[i].interleaved = bench_lanes(iterations, repetitions, sizes[i], buf, INTERLEAVED);
+        free(buf);
+
+        if (rank == 0) printf("n: %llu\tsingle: %5.2f GB/s\tsubstreams: %5.2f GB/s\t"
+                              "interleaved: %5.2f GB/s\n", sizes[i], results[i].single, 
+                              results[i].substreams, results[i].interleaved);
+    }
+
+    if (rank == 0) write_results(argv[0], n_sizes, sizes, results);
+
+    MPI_Finalize();
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,145 @@
+/*
+ * Compare jumping with MATRIX to SLIDING_WINDOW_DECOMP. MATRIX is more expensive to 
+ * initialize, but cheaper to jump with, so it pays off after a number of jumps with the 
+ * same parameters, which is written as the crossover.
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+
+#include "bench.h"
+#include "config.h"
+#include "jump_ahead.h"
+#include "jump_cache.h"
+#include "rng_generic/rng_generic.h"
+#include "mpi.h"
+#include "unistd.h"
+
+typedef struct data data;
+struct data {
+    double init_swd;
+    double jump_swd;
+    double init_matrix;
+    double jump_matrix;
+    double crossover;
+};
+
+static
+void write_results(char exec_name[static 1], size_t N, 
+                   unsigned long long jumps[N], data results[N]) {
+    char* fname;
+    FILE* f;
+
+    asprintf(&fname, "%s.csv", exec_name);
+    f = fopen(fname, "w");
+    fprintf(f, "jump,init_swd,jump_swd,init_matrix,jump_matrix,crossover\n");
+
+    for (size_t i = 0; i < N; ++i) {
+        data p = results[i];
+        fprintf(f, "%llu,%5.2e,%5.2e,%5.2e,%5.2e,%5.2e\n", 
+                jumps[i], p.init_swd, p.jump_swd, p.init_matrix, p.jump_matrix, p.crossover);
+    }
+    fclose(f);
+    free(fname);
+}
+
+static
+double bench_init(size_t iterations, size_t repetitions, unsigned long long jump_size,
+                  F2LinConfig* cfg) {
+    F2LinBMPI bmpi = f2lin_bench_bmpi_init(repetitions);
+    F2LinJump* jumps[iterations];
+    double times[2];
+
+    for (size_t rep = 0; rep < repetitions; ++rep) {
+        times[0] = MPI_Wtime();
+        for (size_t i = 0; i < iterations; ++i) jumps[i] = f2lin_jump_ahead_init(RNG_TYPE, jump_size, cfg);
+        times[1] = MPI_Wtime();
+        f2lin_bench_bmpi_update(&bmpi, rep, times[1] - times[0]);
+
+        for (size_t i = 0; i < iterations; ++i) f2lin_jump_ahead_destroy(jumps[i]);
+    }
+
+    double avg = f2lin_bench_bmpi_eval(&bmpi) / (double) iterations;
+    f2lin_bench_bmpi_destroy(&bmpi);
+
+    return avg;
+}
+
+static
+double bench_jump(size_t iterations, size_t repetitions, unsigned long long jump_size,
+                  F2LinConfig* cfg) {
+    F2LinRngGeneric* rng = f2lin_rng_generic_init(RNG_TYPE);
+    F2LinJump* jump = f2lin_jump_ahead_init(RNG_TYPE, jump_size, cfg);
+    F2LinBMPI bmpi = f2lin_bench_bmpi_init(repetitions);
+    double times[2];
+
+    for (size_t rep = 0; rep < repetitions; ++rep) {
+        times[0] = MPI_Wtime();
+        for (size_t i = 0; i < iterations; ++i) f2lin_jump_ahead_jump(jump, rng);
+        times[1] = MPI_Wtime();
+        f2lin_bench_bmpi_update(&bmpi, rep, times[1] - times[0]);
+    }
+
+    double avg = f2lin_bench_bmpi_eval(&bmpi) / (double) iterations;
+
+    f2lin_bench_bmpi_destroy(&bmpi);
+    f2lin_rng_generic_destroy(rng);
+    f2lin_jump_ahead_destroy(jump);
+
+    return avg;
+}
+
+int main(int argc, char* argv[argc + 1]) {
+    MPI_Init(&argc, &argv);
+
+    unsigned long long buf[BUF_MAX];
+    size_t iterations, repetitions, n_jumps = argc - 3;
+    int rank;
+    F2LinConfig swd = { .algorithm = SLIDING_WINDOW_DECOMP, .q = Q_DEFAULT };
+    F2LinConfig matrix = { .algorithm = MATRIX, .q = Q_DEFAULT };
+
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+
+    if (argc < 3) {
+        printf("Usage: mpirun -np x b_matrix iterations repetitions [jump1, jump2, ...]\n");
+        return EXIT_FAILURE;
+    }
+    if (argc > BUF_MAX + 3) return EXIT_FAILURE;
+
+    iterations = strtoul(argv[1], 0, 10);
+    repetitions = strtoul(argv[2], 0, 10);
+
+    if (iterations == -1 || repetitions == -1) return EXIT_FAILURE;
+
+    // initialization should compute the parameters every time
+    f2lin_jump_cache_set_limit(0);
+
+    f2lin_bench_parse_argv(argc, &argv[3], buf);
+    data results[n_jumps];
+
+    for (size_t i = 0; i < n_jumps; ++i) {
+        data* r = &results[i];
+
+        r->init_swd = bench_init(iterations, repetitions, buf[i], &swd);
+        r->jump_swd = bench_jump(iterations, repetitions, buf[i], &swd);
+        r->init_matrix = bench_init(iterations, repetitions, buf[i], &matrix);
+        r->jump_matrix = bench_jump(iterations, repetitions, buf[i], &matrix);
+
+        // number of jumps with the same parameters, after which MATRIX is faster
+        r->crossover = r->jump_swd > r->jump_matrix 
+            ? (r->init_matrix - r->init_swd) / (r->jump_swd - r->jump_matrix) 
+            : -1;
+        
+        if (rank == 0) {
+            printf("jump: %llu\tinit swd: %5.2e\tjump swd: %5.2e\t"
+                   "init matrix: %5.2e\tjump matrix: %5.2e\tcrossover: %5.2e\n",
+                   buf[i], r->init_swd, r->jump_swd, r->init_matrix, r->jump_matrix, 
+                   r->crossover);
+        }
+    }
+
+    if (rank == 0) write_results(argv[0], n_jumps, buf, results);
+
+    MPI_Finalize();
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,178 @@
+#include <limits.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <unistd.h>
+
+#include "mpi.h"
+
+#include "tools.h"
+#include "f2lin.h"
+#include "f2lin_mpi.h"
+#include "jump_cache.h"
+#include "rng_generic/rng_generic.h"
+
+#define SEED 12323456
+
+/**
+ * Measures the time until every rank has jumped to its offset rank * jump_size, 
+ * when every rank computes its own jump parameters compared to computing them once 
+ * and distributing them with f2lin_mpi, or positioning the generators with 
+ * f2lin_mpi_exscan_position().
+ *
+ * The time of a repetition is the time of the slowest rank.
+ */
+
+static int rank;
+static int gsize;
+static MPI_Comm comm = MPI_COMM_WORLD;
+
+enum Mode {
+    LOCAL, SHARED, BCAST, EXSCAN,
+};
+
+static
+F2LinRngGeneric* init_rng(size_t jump_size, enum Mode mode) {
+    F2LinRngGeneric* rng = f2lin_rng_init_type(RNG_TYPE, SEED);
+
+    if (mode == LOCAL) {
+        F2LinJump* jump = f2lin_jump_init_type(RNG_TYPE, rank * jump_size, 0);
+        f2lin_jump(rng, jump);
+        f2lin_jump_destroy(jump);
+    } else if (mode == EXSCAN) {
+        f2lin_mpi_exscan_position(comm, jump_size, rng);
+    } else {
+        F2LinMPIJumpTable* table = 
+            f2lin_mpi_jump_table_init(RNG_TYPE, jump_size, 0, mode == SHARED ? SHARED_WINDOW : BROADCAST, 
+                                      comm);
+        f2lin_mpi_jump_rank(rng, table);
+        f2lin_mpi_jump_table_destroy(table);
+    }
+
+    return rng;
+}
+
+static
+double exec(size_t jump_size, enum Mode mode, size_t repetitions) {
+    double* measurements = calloc(sizeof(double), repetitions);
+    double avg;
+
+    for (size_t rep = 0; rep < repetitions; ++rep) {
+        double start, end, local;
+
+        MPI_Barrier(comm);
+        start = MPI_Wtime();
+        f2lin_rng_destroy(init_rng(jump_size, mode));
+        end = MPI_Wtime();
+
+        local = end - start;
+        MPI_Allreduce(&local, &measurements[rep], 1, MPI_DOUBLE, MPI_MAX, comm);
+    }
+
+    avg = f2lin_tools_get_result(repetitions, measurements, MED);
+    free(measurements);
+
+    return avg;
+}
+
+static
+int verify(size_t jump_size) {
+    int ok, all_ok;
+    F2LinRngGeneric* local = init_rng(jump_size, LOCAL);
+    F2LinRngGeneric* shared = init_rng(jump_size, SHARED);
+    F2LinRngGeneric* bcast = init_rng(jump_size, BCAST);
+    F2LinRngGeneric* exscan = init_rng(jump_size, EXSCAN);
+
+    ok = f2lin_rng_generic_compare_state(local, shared) && 
+         f2lin_rng_generic_compare_state(local, bcast) &&
+         f2lin_rng_generic_compare_state(local, exscan);
+
+    // uneven counts, the first ranks get one more number like in b_strong_scaling
+    // and some get a lot more, so the difference is jumped instead of iterated
+    {
+        const size_t count = jump_size + (rank < gsize / 2) + (rank % 3 == 1 ? 10000 : 0);
+        size_t position = 0;
+        F2LinJump* jump;
+
+        for (int r = 0; r < rank; ++r) {
+            position += jump_size + (r < gsize / 2) + (r % 3 == 1 ? 10000 : 0);
+        }
+
+        jump = f2lin_jump_init_type(RNG_TYPE, position, 0);
+        f2lin_rng_destroy(local);
+        local = f2lin_rng_init_type(RNG_TYPE, SEED);
+        f2lin_jump(local, jump);
+        f2lin_jump_destroy(jump);
+
+        f2lin_rng_destroy(exscan);
+        exscan = f2lin_rng_init_type(RNG_TYPE, SEED);
+        f2lin_mpi_exscan_position(comm, count, exscan);
+        ok = ok && f2lin_rng_generic_compare_state(local, exscan);
+    }
+
+    MPI_Allreduce(&ok, &all_ok, 1, MPI_INT, MPI_LAND, comm);
+
+    f2lin_rng_destroy(local);
+    f2lin_rng_destroy(shared);
+    f2lin_rng_destroy(bcast);
+    f2lin_rng_destroy(exscan);
+
+    return all_ok;
+}
+
+int main(int argc, char* argv[argc + 1]) {
+    MPI_Init(&argc, &argv);
+
+    if (argc < 3) {
+        printf("Usage: mpirun -np x b_mpi_init repetitions jump_size\n");
+        printf("Repetitions: Number of datapoints collected\n");
+        printf("Jump size: distance between the offsets of two ranks\n");
+        MPI_Finalize();
+        return EXIT_FAILURE;
+    }
+
+    size_t repetitions = strtoull(argv[1], 0, 10), jump_size = strtoull(argv[2], 0, 10);
+    double results[4];
+
+    if (repetitions == ULLONG_MAX || jump_size == ULLONG_MAX) {
+        fprintf(stderr, "Got non numberical value for repetitions or jump size"); 
+        return EXIT_FAILURE;
+    }
+
+    MPI_Comm_rank(comm, &rank);
+    MPI_Comm_size(comm, &gsize);
+
+    // every repetition should compute the parameters again
+    f2lin_jump_cache_set_limit(0);
+
+    if (!verify(jump_size)) {
+        if (rank == 0) fprintf(stderr, "Distributed jump parameters give wrong results\n");
+        MPI_Finalize();
+        return EXIT_FAILURE;
+    }
+
+    results[LOCAL] = exec(jump_size, LOCAL, repetitions);
+    results[SHARED] = exec(jump_size, SHARED, repetitions);
+    results[BCAST] = exec(jump_size, BCAST, repetitions);
+    results[EXSCAN] = exec(jump_size, EXSCAN, repetitions);
+
+    if (rank == 0) {
+        char* fname;
+        FILE* f;
+
+        asprintf(&fname, "%s_%zu.csv", argv[0], jump_size);
+        printf("writing to: %s\n", fname);
+
+        f = fopen(fname, "a");
+        fprintf(f, "%d,%5.2e,%5.2e,%5.2e,%5.2e\n", 
+                gsize, results[LOCAL], results[SHARED], results[BCAST], results[EXSCAN]);
+        printf("ranks: %d\tlocal: %5.2e\tshared: %5.2e\tbcast: %5.2e\texscan: %5.2e\n", 
+               gsize, results[LOCAL], results[SHARED], results[BCAST], results[EXSCAN]);
+
+        fclose(f);
+        free(fname);
+    }
+
+    MPI_Finalize();
+
+    return EXIT_SUCCESS;
+}
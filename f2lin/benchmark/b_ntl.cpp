@@ -7,6 +7,7 @@
 #include "NTL/GF2X.h"
 
 #include "rng_generic/rng_generic.h"
+#include "f2poly.h"
 #include "bench.h"
 #include "tools.h"
 
@@ -14,7 +15,7 @@ using namespace NTL;
 
 static 
 void write_results(char* exec_name, size_t N, unsigned long long *jumps, double *results, 
-                   double minpoly, double minpoly_seq) {
+                   double *native, double minpoly, double minpoly_seq) {
     char* fname;
     FILE* f;
     char* mpname;
@@ -22,15 +23,15 @@ void write_results(char* exec_name, size_t N, unsigned long long *jumps, double
     asprintf(&fname, "%s.csv", exec_name);
     asprintf(&mpname, "%s_mp.csv", exec_name);
     f = fopen(fname, "w");
-    fprintf(f, "jump,jumppoly\n");
+    fprintf(f, "jump,jumppoly,native\n");
 
     for (size_t i = 0; i < N; ++i) {
-        fprintf(f, "%llu,%5.2e\n", jumps[i], results[i]);
+        fprintf(f, "%llu,%5.2e,%5.2e\n", jumps[i], results[i], native[i]);
     }
 
     freopen(mpname, "w", f);
     fprintf(f, "state_size,minpoly,minpoly_seq\n");
-    fprintf(f, "%zu,%5.2e,%5.2e\n", f2lin_rng_generic_state_size(), minpoly, minpoly_seq);
+    fprintf(f, "%zu,%5.2e,%5.2e\n", f2lin_rng_generic_state_size(RNG_TYPE), minpoly, minpoly_seq);
 
     free(fname);
     free(mpname);
@@ -39,12 +40,12 @@ void write_results(char* exec_name, size_t N, unsigned long long *jumps, double
 
 static
 GF2X init_p_min() {
-    const int state_size = f2lin_rng_generic_state_size();
+    const int state_size = f2lin_rng_generic_state_size(RNG_TYPE);
     const size_t seq_len = 2 * state_size ;
 
     GF2X p_min;
     vec_GF2 seq(NTL::INIT_SIZE, seq_len);
-    F2LinRngGeneric* rng = f2lin_rng_generic_init();
+    F2LinRngGeneric* rng = f2lin_rng_generic_init(RNG_TYPE);
 
     for (size_t i = 0; i < seq_len; ++i) {
         seq[i] = f2lin_rng_generic_next_state(rng) & 0x01ul;
@@ -65,12 +66,24 @@ void init_p_jump(const GF2X p_min, size_t jump) {
     PowerMod(p_jump, x, jump, p_min_mod);
 }
 
+// same as init_p_jump(), but with the native arithmetic from f2poly.h
+static
+void init_p_jump_native(const F2LinPoly* p_min, size_t jump) {
+    F2LinPoly* p_jump = f2lin_poly_init();
+    F2LinPolyMod* p_min_mod = f2lin_poly_mod_init(p_min);
+
+    f2lin_poly_power_x_mod(p_jump, jump, p_min_mod);
+
+    f2lin_poly_mod_destroy(p_min_mod);
+    f2lin_poly_destroy(p_jump);
+}
+
 static
 double benchmark_minimal_polynomial_seq(size_t iterations, size_t repetitions) {
     F2LinBMPI bmpi = f2lin_bench_bmpi_init(repetitions);
     double times[2];
-    F2LinRngGeneric* rng = f2lin_rng_generic_init();
-    size_t state_size = f2lin_rng_generic_state_size();
+    F2LinRngGeneric* rng = f2lin_rng_generic_init(RNG_TYPE);
+    size_t state_size = f2lin_rng_generic_state_size(RNG_TYPE);
     vec_GF2 seq(NTL::INIT_SIZE, state_size * 2);
  
     for (size_t rep = 0; rep < repetitions; ++rep) {
@@ -139,6 +152,29 @@ double benchmark_jump_polynomial(size_t iterations, size_t repetitions, size_t j
     return jump_avg;
 }
 
+static 
+double benchmark_jump_polynomial_native(size_t iterations, size_t repetitions, size_t jump) {
+    F2LinBMPI bmpi = f2lin_bench_bmpi_init(repetitions);
+    double times[2];
+    F2LinPoly* p_min = f2lin_poly_init_from_string(f2lin_rng_generic_min_poly(RNG_TYPE));
+
+    for (size_t rep = 0; rep < repetitions; ++rep) {
+        times[0] = MPI_Wtime();
+        for (size_t i = 0; i < iterations; ++i) {
+            init_p_jump_native(p_min, jump);
+        }
+        times[1] = MPI_Wtime();
+        
+        f2lin_bench_bmpi_update(&bmpi, rep, times[1] - times[0]);
+    }
+
+    double jump_avg = f2lin_bench_bmpi_eval(&bmpi) / (double) iterations;
+
+    f2lin_poly_destroy(p_min);
+    f2lin_bench_bmpi_destroy(&bmpi);
+    return jump_avg;
+}
+
 int main(int argc, char** argv) {
     MPI_Init(&argc, &argv);
     size_t iterations, repetitions, n_jumps = argc - 3;
@@ -156,19 +192,22 @@ int main(int argc, char** argv) {
     f2lin_bench_parse_argv(argc, &argv[3], jumps);
     MPI_Comm_rank(MPI_COMM_WORLD,&rank);
     double results[n_jumps];
+    double native[n_jumps];
 
     for (size_t i = 0; i < n_jumps; ++i) {
         results[i] = benchmark_jump_polynomial(iterations, repetitions, jumps[i]);
+        native[i] = benchmark_jump_polynomial_native(iterations, repetitions, jumps[i]);
 
-        if (rank == 0) printf("jump:%llu\tjumppoly:%5.2e\n", jumps[i], results[i]); 
+        if (rank == 0) printf("jump:%llu\tjumppoly:%5.2e\tnative:%5.2e\n", 
+                              jumps[i], results[i], native[i]); 
     }
 
     double minpoly = benchmark_minimal_polynomial(iterations, repetitions);
     double minpoly_seq = benchmark_minimal_polynomial_seq(iterations, repetitions);
     if (rank == 0) {
         printf("statesize: %zu\tminpoly:%5.2e\tminpoly_seq:%5.2e\n", 
-                f2lin_rng_generic_state_size(), minpoly, minpoly_seq);
-        write_results(argv[0], n_jumps, jumps, results, minpoly, minpoly_seq);
+                f2lin_rng_generic_state_size(RNG_TYPE), minpoly, minpoly_seq);
+        write_results(argv[0], n_jumps, jumps, results, native, minpoly, minpoly_seq);
     }
     MPI_Finalize();
     return EXIT_SUCCESS;
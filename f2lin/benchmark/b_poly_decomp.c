@@ -8,6 +8,8 @@
  * only be useful to compare it to horners rule, which never calls these anywayk when 
  * jumping ahead.
  *
+ * The decomposition of the packed polynomial is compared to building it one coefficient
+ * at a time through GF2X_coeff(), which is how it was done before packing.
  */
 #include <stdio.h>
 #include <stdlib.h>
@@ -16,11 +18,13 @@
 #include "tools.h"
 #include "poly_decomp.h"
 #include "poly_rand.h"
+#include "f2poly.h"
 #include "bench.h"
 
 typedef struct data data;
 struct data {
     double p[9];
+    double c[9];
 };
 
 static
@@ -30,15 +34,20 @@ void write_results(char exec_name[static 1], size_t N, unsigned long long degs[N
 
         asprintf(&fname, "%s.csv", exec_name);
         f = fopen(fname, "w");
-        fprintf(f, "deg,2,3,4,5,6,7,8,9,10\n");
+        fprintf(f, "deg,2,3,4,5,6,7,8,9,10,");
+        fprintf(f, "coeff2,coeff3,coeff4,coeff5,coeff6,coeff7,coeff8,coeff9,coeff10\n");
 
         for (size_t i = 0; i < N; ++i) {
             double *d = results[i].p;
+            double *c = results[i].c;
             fprintf(f, "%llu,", degs[i]);
 
             for (size_t j = 0; j < 9; ++j) {
                 fprintf(f, "%5.2e,", d[j]);
             }
+            for (size_t j = 0; j < 9; ++j) {
+                fprintf(f, "%5.2e,", c[j]);
+            }
             fprintf(f, "\n");
 
         }
@@ -46,7 +55,31 @@ void write_results(char exec_name[static 1], size_t N, unsigned long long degs[N
         free(fname);
 }
 
-double compute_poly_decomp(size_t deg, int q, size_t iterations, size_t repetitions) {
+// the decomposition reading one coefficient at a time, as in poly_decomp.c before packing
+static
+F2LinPolyDecomp* poly_decomp_coeff(const GF2X* jump_poly, const int Q) {
+    int i = GF2X_deg(jump_poly);
+    F2LinPolyDecomp* dp = calloc(sizeof(F2LinPolyDecomp), 1);
+
+    dp->cap = i > Q ? i / Q : 0;
+    dp->h = (uint16_t*) calloc(sizeof(uint16_t), dp->cap);
+    dp->d = (size_t*) calloc(sizeof(size_t), dp->cap);
+
+    for (; i >= Q; --i) {
+        if (GF2X_coeff(jump_poly, i) == 0) continue;
+        dp->h[dp->m] = 0;
+        for (int j = 0; j < Q; ++j) dp->h[dp->m] = (dp->h[dp->m] << 1) ^ GF2X_coeff(jump_poly, i - j - 1);
+        i -= Q;
+        dp->d[dp->m] = i;
+        ++dp->m;
+    }
+    dp->hm1 = 0;
+    for (int j = 0; j <= i; ++j) dp->hm1 = (dp->hm1 << 1) ^ GF2X_coeff(jump_poly, i - j);
+
+    return dp;
+}
+
+double compute_poly_decomp_coeff(size_t deg, int q, size_t iterations, size_t repetitions) {
     GF2X* poly = f2lin_poly_rand_init(deg);
     F2LinBMPI bmpi = f2lin_bench_bmpi_init(repetitions);
 
@@ -55,7 +88,7 @@ double compute_poly_decomp(size_t deg, int q, size_t iterations, size_t repetiti
         F2LinPolyDecomp* pds[iterations];
         start = MPI_Wtime();
         for (size_t i = 0; i < iterations; ++i) {
-            pds[i] = f2lin_poly_decomp_init_from_gf2x(poly, q);
+            pds[i] = poly_decomp_coeff(poly, q);
         }
         end = MPI_Wtime();
 
@@ -76,6 +109,38 @@ double compute_poly_decomp(size_t deg, int q, size_t iterations, size_t repetiti
     return res;
 }
 
+double compute_poly_decomp(size_t deg, int q, size_t iterations, size_t repetitions) {
+    GF2X* rand = f2lin_poly_rand_init(deg);
+    F2LinPoly* poly = GF2X_pack(rand);
+    F2LinBMPI bmpi = f2lin_bench_bmpi_init(repetitions);
+
+    for (size_t rep = 0; rep < repetitions; ++rep) {
+        double start, end, time;
+        F2LinPolyDecomp* pds[iterations];
+        start = MPI_Wtime();
+        for (size_t i = 0; i < iterations; ++i) {
+            pds[i] = f2lin_poly_decomp_init_from_poly(poly, q);
+        }
+        end = MPI_Wtime();
+
+        for (size_t i = 0; i < iterations; ++i) {
+            f2lin_poly_decomp_destroy(pds[i]);
+        }
+    
+        time = (end - start) / (double) iterations;
+         
+        f2lin_bench_bmpi_update(&bmpi, rep, time);
+    }
+
+    double res = f2lin_bench_bmpi_eval(&bmpi);
+
+    f2lin_bench_bmpi_destroy(&bmpi);
+    f2lin_poly_destroy(poly);
+    GF2X_zero_destroy(rand);
+    
+    return res;
+}
+
 int main(int argc, char* argv[argc + 1]) {
     MPI_Init(&argc, &argv);
 
@@ -102,8 +167,10 @@ int main(int argc, char* argv[argc + 1]) {
         if (rank == 0) printf("deg poly: %7llu\t", degs[i]);
         for (size_t q = 2; q <= 10; ++q) {
             double avg = compute_poly_decomp(degs[i], q, 100, 100);
+            double avg_coeff = compute_poly_decomp_coeff(degs[i], q, 100, 100);
             results[i].p[q - 2] = avg;
-            if (rank == 0) printf("pd%2zu: %5.2e\t", q, avg); 
+            results[i].c[q - 2] = avg_coeff;
+            if (rank == 0) printf("pd%2zu: %5.2e (coeff: %5.2e)\t", q, avg, avg_coeff); 
         }
         if (rank == 0) printf("\n");
     }
@@ -9,6 +9,7 @@
 #include "tools.h"
 #include "bench.h"
 #include "jump_ahead.h"
+#include "jump_cache.h"
 #include "poly_decomp.h"
 #include "rng_generic/rng_generic.h"
 #include "config.h"
@@ -26,6 +27,8 @@ typedef struct data data;
 struct data {
     size_t deg;
     double swd[10];
+    double swd_auto;
+    int q_auto;
 };
 
 static
@@ -39,12 +42,14 @@ void write_results(char exec_name[static 1], size_t N, unsigned long long buf[N]
         f = fopen(fname, "w");
         fprintf(f, "deg,");
         for (size_t i = Q_START; i <= Q_END; ++i) fprintf(f, "%zu,", i);
+        fprintf(f, "auto,auto_q,");
         fprintf(f, "\n");
 
 
         for (size_t i = 0; i < N; ++i) {
             fprintf(f, "%llu,", buf[i]);
             for (size_t j = Q_START; j <= Q_END; ++j) fprintf(f, "%5.2e,", results[i].swd[j - 1]);
+            fprintf(f, "%5.2e,%d,", results[i].swd_auto, results[i].q_auto);
             fprintf(f, "\n");
         }
         fclose(f);
@@ -56,8 +61,8 @@ double exec(unsigned long long poly_deg, F2LinConfig* cfg, size_t iterations, si
     double avg;
     F2LinBMPI bmpi = f2lin_bench_bmpi_init(repetitions);
 
-    F2LinRngGeneric* rng = f2lin_rng_generic_init();
-    F2LinJump* jp = f2lin_jump_ahead_init(poly_deg, cfg);
+    F2LinRngGeneric* rng = f2lin_rng_generic_init(RNG_TYPE);
+    F2LinJump* jp = f2lin_jump_ahead_init(RNG_TYPE, poly_deg, cfg);
     GF2X* rand = f2lin_poly_rand_init(poly_deg);
 
     f2lin_poly_decomp_destroy(jp->jp.swd.pd);
@@ -103,6 +108,9 @@ int main(int argc, char* argv[argc + 1]) {
 
     MPI_Comm_rank(MPI_COMM_WORLD, &grank);
 
+    // the jump polynomials are replaced by random ones, so they can't be shared
+    f2lin_jump_cache_set_limit(0);
+
     if (argc > BUF_MAX + 3) {
         fprintf(stderr, "Too many arguments, only support a maximum of %d.\n", BUF_MAX);
         return EXIT_FAILURE;
@@ -110,7 +118,7 @@ int main(int argc, char* argv[argc + 1]) {
 
     f2lin_bench_parse_argv(argc, &argv[3], buf);
 
-    F2LinConfig cfg;
+    F2LinConfig cfg = { 0 };
     data results[n_deg];
 
     for (size_t i = 0; i < n_deg; ++i) {
@@ -123,6 +131,14 @@ int main(int argc, char* argv[argc + 1]) {
 
             if (grank == 0) printf("%zu: %5.2e\t", q, results[i].swd[q - 1]);
         }
+
+        // q chosen from the state size and cache sizes, should be close to the best above
+        cfg.q = Q_AUTO;
+        cfg.algorithm = SLIDING_WINDOW_DECOMP;
+        results[i].swd_auto = exec(buf[i], &cfg, iterations, repetitions);
+        results[i].q_auto = cfg.q;
+
+        if (grank == 0) printf("auto (%d): %5.2e\t", results[i].q_auto, results[i].swd_auto);
         if (grank == 0) printf("\n");
     }
 
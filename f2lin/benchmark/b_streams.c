@@ -0,0 +1,161 @@
+#include <limits.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <unistd.h>
+
+#include "mpi.h"
+
+#include "tools.h"
+#include "f2lin.h"
+#include "jump_cache.h"
+#include "rng_generic/rng_generic.h"
+
+#define SEED 12323456
+
+/* jump size used for verifying the jumps on streams against stepping */
+#define VERIFY_SIZE 123457
+
+/**
+ * Measures the time until every rank has a generator of its own, when every rank uses
+ * the tinymt stream of its rank compared to jumping one stream to the offset
+ * rank * jump_size. The third column is the cost of the first jump on a stream, which
+ * includes computing the minimal polynomial of its parameters. Every repetition uses
+ * other streams for it, as the polynomials stay cached for the whole process.
+ *
+ * The time of a repetition is the time of the slowest rank.
+ */
+
+static int rank;
+static int gsize;
+static MPI_Comm comm = MPI_COMM_WORLD;
+
+enum Mode {
+    STREAM, PARTITION, STREAM_JUMP,
+};
+
+static
+F2LinRngGeneric* init_rng(size_t jump_size, enum Mode mode, size_t rep) {
+    const size_t streams = f2lin_rng_streams(F2LIN_TINYMT64);
+    F2LinRngGeneric* rng;
+    F2LinJump* jump;
+
+    if (mode == STREAM) return f2lin_rng_init_stream(F2LIN_TINYMT64, rank % streams, SEED);
+
+    if (mode == PARTITION) {
+        rng = f2lin_rng_init_type(F2LIN_TINYMT64, SEED);
+        jump = f2lin_jump_init_type(F2LIN_TINYMT64, rank * jump_size, 0);
+    } else {
+        rng = f2lin_rng_init_stream(F2LIN_TINYMT64, (rep * gsize + rank) % streams, SEED);
+        jump = f2lin_jump_init_rng(rng, jump_size, 0);
+    }
+
+    f2lin_jump(rng, jump);
+    f2lin_jump_destroy(jump);
+    return rng;
+}
+
+static
+double exec(size_t jump_size, enum Mode mode, size_t repetitions) {
+    double* measurements = calloc(sizeof(double), repetitions);
+    double avg;
+
+    for (size_t rep = 0; rep < repetitions; ++rep) {
+        double start, end, local;
+
+        MPI_Barrier(comm);
+        start = MPI_Wtime();
+        f2lin_rng_destroy(init_rng(jump_size, mode, rep));
+        end = MPI_Wtime();
+
+        local = end - start;
+        MPI_Allreduce(&local, &measurements[rep], 1, MPI_DOUBLE, MPI_MAX, comm);
+    }
+
+    avg = f2lin_tools_get_result(repetitions, measurements, MED);
+    free(measurements);
+
+    return avg;
+}
+
+static
+int verify() {
+    const size_t streams = f2lin_rng_streams(F2LIN_TINYMT64);
+    F2LinRngGeneric* jumped = init_rng(VERIFY_SIZE, STREAM_JUMP, 0);
+    F2LinRngGeneric* stepped = f2lin_rng_init_stream(F2LIN_TINYMT64, rank % streams, SEED);
+    uint64_t first, prev;
+    int ok, all_ok;
+
+    f2lin_rng_generic_next_state_n(stepped, VERIFY_SIZE);
+    ok = f2lin_rng_generic_compare_state(jumped, stepped);
+
+    // neighbouring ranks have to draw different numbers from the same seed
+    first = f2lin_next_unsigned(stepped);
+    MPI_Sendrecv(&first, 1, MPI_UINT64_T, (rank + 1) % gsize, 0,
+                 &prev, 1, MPI_UINT64_T, (rank + gsize - 1) % gsize, 0, comm,
+                 MPI_STATUS_IGNORE);
+    ok = ok && (gsize == 1 || first != prev);
+
+    MPI_Allreduce(&ok, &all_ok, 1, MPI_INT, MPI_LAND, comm);
+
+    f2lin_rng_destroy(jumped);
+    f2lin_rng_destroy(stepped);
+
+    return all_ok;
+}
+
+int main(int argc, char* argv[argc + 1]) {
+    MPI_Init(&argc, &argv);
+
+    if (argc < 3) {
+        printf("Usage: mpirun -np x b_streams repetitions jump_size\n");
+        printf("Repetitions: Number of datapoints collected\n");
+        printf("Jump size: distance between the offsets of two ranks when partitioning\n");
+        MPI_Finalize();
+        return EXIT_FAILURE;
+    }
+
+    size_t repetitions = strtoull(argv[1], 0, 10), jump_size = strtoull(argv[2], 0, 10);
+    double results[3];
+
+    if (repetitions == ULLONG_MAX || jump_size == ULLONG_MAX) {
+        fprintf(stderr, "Got non numberical value for repetitions or jump size");
+        return EXIT_FAILURE;
+    }
+
+    MPI_Comm_rank(comm, &rank);
+    MPI_Comm_size(comm, &gsize);
+
+    // every repetition should compute the jump parameters again
+    f2lin_jump_cache_set_limit(0);
+
+    if (!verify()) {
+        if (rank == 0) fprintf(stderr, "Streams give wrong results\n");
+        MPI_Finalize();
+        return EXIT_FAILURE;
+    }
+
+    results[STREAM] = exec(jump_size, STREAM, repetitions);
+    results[PARTITION] = exec(jump_size, PARTITION, repetitions);
+    results[STREAM_JUMP] = exec(jump_size, STREAM_JUMP, repetitions);
+
+    if (rank == 0) {
+        char* fname;
+        FILE* f;
+
+        asprintf(&fname, "%s_%zu.csv", argv[0], jump_size);
+        printf("writing to: %s\n", fname);
+
+        f = fopen(fname, "a");
+        fprintf(f, "%d,%5.2e,%5.2e,%5.2e\n",
+                gsize, results[STREAM], results[PARTITION], results[STREAM_JUMP]);
+        printf("ranks: %d\tstream: %5.2e\tpartition: %5.2e\tstream + jump: %5.2e\n",
+               gsize, results[STREAM], results[PARTITION], results[STREAM_JUMP]);
+
+        fclose(f);
+        free(fname);
+    }
+
+    MPI_Finalize();
+
+    return EXIT_SUCCESS;
+}
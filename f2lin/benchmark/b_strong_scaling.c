@@ -1,11 +1,15 @@
 #include <stdlib.h>
 #include <stdio.h>
+#include <string.h>
 #include "unistd.h"
 #include "mpi.h"
 
 #include "f2lin.h"
+#include "f2lin_mpi.h"
 #include "tools.h"
 
+#define SEED 12323456
+
 int rank;
 int gsize;
 MPI_Comm comm = MPI_COMM_WORLD;
@@ -18,12 +22,22 @@ size_t determine_ppsize(size_t psize) {
     return ppsize;
 }
 
+/**
+ * Usage: mpirun -np x b_strong_scaling repetitions iterations psize 
+ *                                     [local|shared|bcast|exscan]
+ *
+ * With local every rank computes the parameters for its own offset, with shared and bcast
+ * they are computed once and distributed with f2lin_mpi. exscan passes the generators on
+ * with f2lin_mpi_exscan_position().
+ */
 int main(int argc, char* argv[argc + 1]) {
     MPI_Init(&argc, &argv);    
 
     size_t repetitions, iterations, psize, ppsize, jump_size; 
     double times[2], *measurements, *total;
     const int root = 0;
+    const char* mode = argc > 4 ? argv[4] : "local";
+    int local = !strcmp(mode, "local");
 
     if (argc < 4) return EXIT_FAILURE;
 
@@ -43,15 +57,31 @@ int main(int argc, char* argv[argc + 1]) {
 
         times[0] = MPI_Wtime();
         for (size_t i = 0; i < iterations; ++i) {
-            F2LinRngGeneric *rng = f2lin_rng_init(); 
-            F2LinJump *jump = f2lin_jump_init(jump_size, 0);
-
-            f2lin_jump(rng, jump);
+            F2LinRngGeneric *rng = f2lin_rng_init_type(RNG_TYPE, SEED); 
+
+            if (!strcmp(mode, "exscan")) {
+                f2lin_mpi_exscan_position(comm, ppsize, rng);
+            } else if (local) {
+                F2LinJump *jump = f2lin_jump_init_type(RNG_TYPE, jump_size, 0);
+                f2lin_jump(rng, jump);
+                f2lin_jump_destroy(jump);
+            } else {
+                F2LinMPIJumpTable* table = 
+                    f2lin_mpi_jump_table_init(RNG_TYPE, psize / gsize, 0, 
+                                              strcmp(mode, "bcast") ? SHARED_WINDOW : BROADCAST, 
+                                              comm);
+                f2lin_mpi_jump_rank(rng, table);
+                f2lin_mpi_jump_table_destroy(table);
+
+                // the first psize % gsize ranks have one more element, see determine_ppsize
+                if (ppsize > psize / gsize) {
+                    for (size_t j = 0; j < rank; ++j) f2lin_next_double(rng);
+                }
+            }
 
             for (size_t j = 0; j < ppsize; ++j) f2lin_next_double(rng);
 
             f2lin_rng_destroy(rng);
-            f2lin_jump_destroy(jump);
         }
         times[1] = MPI_Wtime();
         measurements[rep] = times[1] - times[0];
@@ -69,7 +99,8 @@ int main(int argc, char* argv[argc + 1]) {
         double avg = 
             f2lin_tools_get_result(repetitions * gsize, total, MED) / (double) iterations;
 
-        asprintf(&fname, "%s_%zu.csv", argv[0], psize);
+        if (local) asprintf(&fname, "%s_%zu.csv", argv[0], psize);
+        else asprintf(&fname, "%s_%s_%zu.csv", argv[0], mode, psize);
 
         f = fopen(fname, "a");
 
@@ -0,0 +1,187 @@
+/*
+ * Throughput of generating numbers one at a time with gen64, in comparison to the bulk 
+ * generation with gen_n_numbers, in GB/s of generated numbers. 
+ * The same for doubles, with f2lin_next_double and f2lin_fill_double.
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+
+#include "bench.h"
+#include "rng_generic/rng_generic.h"
+#include "f2lin.h"
+#include "mpi.h"
+
+#define SEED 12323456
+
+typedef struct data data;
+struct data {
+    double scalar;
+    double bulk;
+    double next_double;
+    double fill_double;
+};
+
+static
+void write_results(char exec_name[static 1], size_t N, 
+                   unsigned long long sizes[N], data results[N]) {
+    char* fname;
+    FILE* f;
+
+    asprintf(&fname, "%s.csv", exec_name);
+    f = fopen(fname, "w");
+    fprintf(f, "numbers,scalar_gbs,bulk_gbs,next_double_gbs,fill_double_gbs\n");
+
+    for (size_t i = 0; i < N; ++i) {
+        fprintf(f, "%llu,%5.2f,%5.2f,%5.2f,%5.2f\n", sizes[i], results[i].scalar, 
+                results[i].bulk, results[i].next_double, results[i].fill_double);
+    }
+    fclose(f);
+    free(fname);
+}
+
+static
+double gbs(size_t iterations, size_t n, double seconds) {
+    return seconds > 0 ? iterations * n * sizeof(uint64_t) / seconds * 1e-9 : 0;
+}
+
+static
+double bench_scalar(size_t iterations, size_t repetitions, size_t n, uint64_t buf[n]) {
+    F2LinRngGeneric* rng = f2lin_rng_generic_init(RNG_TYPE);
+    F2LinBMPI bmpi = f2lin_bench_bmpi_init(repetitions);
+    double times[2];
+
+    for (size_t rep = 0; rep < repetitions; ++rep) {
+        times[0] = MPI_Wtime();
+        for (size_t i = 0; i < iterations; ++i) {
+            for (size_t j = 0; j < n; ++j) buf[j] = f2lin_rng_generic_gen64(rng);
+        }
+        times[1] = MPI_Wtime();
+        f2lin_bench_bmpi_update(&bmpi, rep, times[1] - times[0]);
+    }
+
+    double med = f2lin_bench_bmpi_eval(&bmpi);
+
+    f2lin_rng_generic_destroy(rng);
+    f2lin_bench_bmpi_destroy(&bmpi);
+
+    return gbs(iterations, n, med);
+}
+
+static
+double bench_bulk(size_t iterations, size_t repetitions, size_t n, uint64_t buf[n]) {
+    F2LinRngGeneric* rng = f2lin_rng_generic_init(RNG_TYPE);
+    F2LinBMPI bmpi = f2lin_bench_bmpi_init(repetitions);
+    double times[2];
+
+    for (size_t rep = 0; rep < repetitions; ++rep) {
+        times[0] = MPI_Wtime();
+        for (size_t i = 0; i < iterations; ++i) {
+            f2lin_rng_generic_gen_n_numbers(rng, n, buf);
+        }
+        times[1] = MPI_Wtime();
+        f2lin_bench_bmpi_update(&bmpi, rep, times[1] - times[0]);
+    }
+
+    double med = f2lin_bench_bmpi_eval(&bmpi);
+
+    f2lin_rng_generic_destroy(rng);
+    f2lin_bench_bmpi_destroy(&bmpi);
+
+    return gbs(iterations, n, med);
+}
+
+static
+double bench_next_double(size_t iterations, size_t repetitions, size_t n, double buf[n]) {
+    F2LinRngGeneric* rng = f2lin_rng_init_type(RNG_TYPE, SEED);
+    F2LinBMPI bmpi = f2lin_bench_bmpi_init(repetitions);
+    double times[2];
+
+    for (size_t rep = 0; rep < repetitions; ++rep) {
+        times[0] = MPI_Wtime();
+        for (size_t i = 0; i < iterations; ++i) {
+            for (size_t j = 0; j < n; ++j) buf[j] = f2lin_next_double(rng);
+        }
+        times[1] = MPI_Wtime();
+        f2lin_bench_bmpi_update(&bmpi, rep, times[1] - times[0]);
+    }
+
+    double med = f2lin_bench_bmpi_eval(&bmpi);
+
+    f2lin_rng_destroy(rng);
+    f2lin_bench_bmpi_destroy(&bmpi);
+
+    return gbs(iterations, n, med);
+}
+
+static
+double bench_fill_double(size_t iterations, size_t repetitions, size_t n, double buf[n]) {
+    F2LinRngGeneric* rng = f2lin_rng_init_type(RNG_TYPE, SEED);
+    F2LinBMPI bmpi = f2lin_bench_bmpi_init(repetitions);
+    double times[2];
+
+    for (size_t rep = 0; rep < repetitions; ++rep) {
+        times[0] = MPI_Wtime();
+        for (size_t i = 0; i < iterations; ++i) {
+            f2lin_fill_double(rng, n, buf);
+        }
+        times[1] = MPI_Wtime();
+        f2lin_bench_bmpi_update(&bmpi, rep, times[1] - times[0]);
+    }
+
+    double med = f2lin_bench_bmpi_eval(&bmpi);
+
+    f2lin_rng_destroy(rng);
+    f2lin_bench_bmpi_destroy(&bmpi);
+
+    return gbs(iterations, n, med);
+}
+
+int main(int argc, char* argv[argc + 1]) {
+    MPI_Init(&argc, &argv);
+
+    unsigned long long sizes[BUF_MAX];
+    size_t iterations, repetitions, n_sizes = argc - 3;
+    int rank;
+
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+
+    if (argc < 3) {
+        printf("Usage: mpirun -np x b_throughput iterations repetitions [n1, n2, ...]\n");
+        printf("Iterations: number of buffers filled between two time measurements\n");
+        printf("Repetitions: Number of datapoints collected per process\n");
+        printf("n: numbers generated per buffer\n");
+        return EXIT_FAILURE;
+    }
+    if (argc > BUF_MAX + 3) return EXIT_FAILURE;
+
+    iterations = strtoul(argv[1], 0, 10);
+    repetitions = strtoul(argv[2], 0, 10);
+
+    if (iterations == -1 || repetitions == -1) return EXIT_FAILURE;
+
+    f2lin_bench_parse_argv(argc, &argv[3], sizes);
+    data results[n_sizes];
+
+    for (size_t i = 0; i < n_sizes; ++i) {
+        uint64_t* buf = malloc(sizes[i] * sizeof(uint64_t));
+        double* dbuf = malloc(sizes[i] * sizeof(double));
+
+        results[i].scalar = bench_scalar(iterations, repetitions, sizes[i], buf);
+        results[i].bulk = bench_bulk(iterations, repetitions, sizes[i], buf);
+        results[i].next_double = bench_next_double(iterations, repetitions, sizes[i], dbuf);
+        results[i].fill_double = bench_fill_double(iterations, repetitions, sizes[i], dbuf);
+        free(buf);
+        free(dbuf);
+
+        if (rank == 0) printf("n: %llu\tscalar: %5.2f GB/s\tbulk: %5.2f GB/s\t"
+                              "next_double: %5.2f GB/s\tfill_double: %5.2f GB/s\n",
+                              sizes[i], results[i].scalar, results[i].bulk, 
+                              results[i].next_double, results[i].fill_double);
+    }
+
+    if (rank == 0) write_results(argv[0], n_sizes, sizes, results);
+
+    MPI_Finalize();
+    return EXIT_SUCCESS;
+}
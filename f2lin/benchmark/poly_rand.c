@@ -6,7 +6,7 @@
 GF2X* f2lin_poly_rand_init(size_t deg) {
     GF2X* p = GF2X_zero_init();
 
-    F2LinRngGeneric* rng = f2lin_rng_generic_init();
+    F2LinRngGeneric* rng = f2lin_rng_generic_init(RNG_TYPE_DEFAULT);
     GF2X_SetCoeff(p, 0, 1);
     GF2X_SetCoeff(p, deg, 1);
     for (size_t i = 1; i < deg; ++i) {
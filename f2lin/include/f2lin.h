@@ -1,18 +1,27 @@
 #ifndef PXORSHIFT_H
 #define PXORSHIFT_H
 
+#ifdef __cplusplus
+extern "C" {
+#endif
+
 #include <stdlib.h>
 #include <stdint.h>
 #include <inttypes.h>
 #include "config.h"
 
+/* alignment of the memory given to f2lin_jump_work_init_at(), one cache line */
+#define F2LIN_JUMP_WORK_ALIGN 64
+
 /* Opaque pointer definitions to hide implementation details */
 typedef struct F2LinJump F2LinJump;
+typedef struct F2LinJumpWork F2LinJumpWork;
+typedef struct F2LinSubstreamTable F2LinSubstreamTable;
 typedef struct F2LinRngGeneric F2LinRngGeneric;
 
 /**
  * Initialize the Random number generator and return a pointer to it. 
- * The seed will be predefined.
+ * The seed will be predefined, the generator is of type RNG_TYPE_DEFAULT.
  *
  * A generator created from this function must be destroyed with f2lin_rng_destroy()
  * at the end of the application.
@@ -22,6 +31,7 @@ F2LinRngGeneric* f2lin_rng_init();
 
 /**
  * Initialize Random number generator with @param seed and return a pointer to it.
+ * The generator is of type RNG_TYPE_DEFAULT.
  *
  * A generator created from this function must be destroyed with f2lin_rng_destroy()
  * at the end of the application.
@@ -30,8 +40,116 @@ F2LinRngGeneric* f2lin_rng_init();
 F2LinRngGeneric*  f2lin_rng_init_seed(const uint64_t seed);
 
 /**
- * Initialize the jump parameters for the random number generator to a jump size of 
- * @param jump_size. 
+ * Initialize a generator of @param type (see enum F2LinRngType) with @param seed and 
+ * return a pointer to it. All generators are contained in the library, so generators of 
+ * different types can be used side by side.
+ *
+ * Returns 0 if @param type is invalid. A generator created from this function must be 
+ * destroyed with f2lin_rng_destroy() at the end of the application.
+ */
+F2LinRngGeneric* f2lin_rng_init_type(enum F2LinRngType type, const uint64_t seed);
+
+/**
+ * Initialize a generator of @param type on its stream @param stream, seeded with 
+ * @param seed. The streams of a type use different parameters of its transition, e.g. 
+ * mat1, mat2 and tmat of tinymt, so every process or thread can draw from a stream of its
+ * own without jumping. Generators on the same stream with different seeds are not 
+ * independent, they are parts of one sequence.
+ *
+ * The parameter sets are bundled with the library. All of them have the maximal period 
+ * 2^127 - 1 and an optimal equidistribution, see src/tinymt_params.c. Stream 0 of tinymt 
+ * is the set of check64.out.txt of its reference implementation, which differs from the
+ * parameters of the generators of f2lin_rng_init_type(): their characteristic polynomial
+ * is reducible, so f2lin_rng_init_type(F2LIN_TINYMT64, seed) isn't on any stream. Jumps 
+ * for a stream are initialized with f2lin_jump_init_rng().
+ *
+ * Returns 0 if @param type is invalid or @param stream isn't less than 
+ * f2lin_rng_streams(). A generator created from this function must be destroyed with 
+ * f2lin_rng_destroy() at the end of the application.
+ */
+F2LinRngGeneric* f2lin_rng_init_stream(enum F2LinRngType type, size_t stream, 
+                                       const uint64_t seed);
+
+/**
+ * Returns the number of streams of @param type, 0 for generators whose transition has no
+ * parameters (all but tinymt), or if @param type is invalid.
+ */
+size_t f2lin_rng_streams(enum F2LinRngType type);
+
+/**
+ * Size and alignment in bytes of a generator of @param type, 0 if @param type is invalid.
+ * The size is a multiple of the alignment, so arrays of generators, or structs containing
+ * them, can be allocated by the caller, e.g. one stream per particle.
+ *
+ * Generators contain no pointers, they can be copied and moved with memcpy().
+ */
+size_t f2lin_rng_state_size(enum F2LinRngType type);
+size_t f2lin_rng_state_align(enum F2LinRngType type);
+
+/**
+ * Like f2lin_rng_init_type(), but in @param mem, which has to hold f2lin_rng_state_size()
+ * bytes aligned to f2lin_rng_state_align(). Nothing is allocated, and generators 
+ * initialized in place are used like any other one. Jumping them with f2lin_jump() 
+ * allocates only the workspace of the thread on its first jump, or nothing at all with 
+ * f2lin_jump_with_work() and a workspace of f2lin_jump_work_init_at().
+ *
+ * Returns 0 if @param type is invalid or @param mem isn't aligned. The generator must not
+ * be destroyed with f2lin_rng_destroy(), the memory belongs to the caller.
+ */
+F2LinRngGeneric* f2lin_rng_init_at(enum F2LinRngType type, const uint64_t seed, void* mem);
+
+/**
+ * Like f2lin_rng_init_stream(), but in @param mem, see f2lin_rng_init_at().
+ */
+F2LinRngGeneric* f2lin_rng_init_stream_at(enum F2LinRngType type, size_t stream, 
+                                          const uint64_t seed, void* mem);
+
+/**
+ * Initialize a generator like f2lin_rng_init_type(), which tracks its position in the 
+ * stream: the number of numbers it moved ahead since it was seeded, as a 128 bit counter
+ * (see F2LinPosition). Generating numbers with the functions below, f2lin_jump() and
+ * f2lin_advance() keep the position up to date, and f2lin_seek_abs() moves the generator
+ * to any position. Tracking costs one branch per call and f2lin_rng_tracked_size() bytes 
+ * per generator instead of f2lin_rng_state_size(), as it holds a copy of its state as 
+ * checkpoint.
+ *
+ * Returns 0 if @param type is invalid. A generator created from this function must be 
+ * destroyed with f2lin_rng_destroy() at the end of the application.
+ */
+F2LinRngGeneric* f2lin_rng_init_tracked(enum F2LinRngType type, const uint64_t seed);
+
+/**
+ * Size in bytes of a tracked generator of @param type, 0 if @param type is invalid. 
+ * The alignment is f2lin_rng_state_align(). A tracked generator contains no pointers 
+ * either, it is copied and moved with memcpy() of this many bytes.
+ */
+size_t f2lin_rng_tracked_size(enum F2LinRngType type);
+
+/**
+ * Initializes a tracked copy of @param rng in @param mem, which has to hold 
+ * f2lin_rng_tracked_size() bytes aligned to f2lin_rng_state_align(), e.g. a generator of 
+ * a stream (see f2lin_rng_init_stream()) or substream (see f2lin_substream()). The copy is
+ * at position 0, unless @param rng is tracked itself, whose position and checkpoint are 
+ * copied with it.
+ *
+ * Returns 0 if @param mem isn't aligned. The generator must not be destroyed with 
+ * f2lin_rng_destroy(), the memory belongs to the caller.
+ */
+F2LinRngGeneric* f2lin_rng_track_at(const F2LinRngGeneric* rng, void* mem);
+
+/**
+ * Returns the type of @param rng.
+ */
+enum F2LinRngType f2lin_rng_type(const F2LinRngGeneric* rng);
+
+/**
+ * Returns the name of @param type, e.g. "mt19937-64", or 0 if @param type is invalid.
+ */
+const char* f2lin_rng_type_name(enum F2LinRngType type);
+
+/**
+ * Initialize the jump parameters for generators of type RNG_TYPE_DEFAULT to a jump size of 
+ * @param jump_size, see f2lin_jump_init_type() for the other types.
  *
  * The returned pointer must be destroyed by a call to f2lin_jump_destroy().
  *
@@ -41,35 +159,286 @@ F2LinRngGeneric*  f2lin_rng_init_seed(const uint64_t seed);
  *
  * Optionally @param cfg can be used to configure the application. 
  *
- * @param cfg is a struct containing two fields: 
+ * @param cfg is a struct containing three fields: 
  * -jump_algorithm: enum JumpAlgorithm
  *  The algorithm used for jumping. Possible values are:
- *      1. HORNER, 2. SLIDING_WINDOW, 3. SLIDING_WINDOW_DECOMP. 
- * -q: size_t
+ *      1. HORNER, 2. SLIDING_WINDOW, 3. SLIDING_WINDOW_DECOMP, 4. MATRIX.
+ *  MATRIX is only available for generators with at most MATRIX_STATE_MAX state bits 
+ *  (xorshift64, tinymt and xoshiro256). It precomputes the jump as lookup tables, which
+ *  makes initializing more expensive but jumping much cheaper.
+ * -q: int
  * Only has an effect if jump_algorithm is SLIDING_WINDOW and SLIDING_WINDOW_DECOMP
  * This sets the size of the decomposition polynomials, when decomposing the jump polynomial.
  * Depending on the jump polynomial, different sizes for q can influence the performance.
- * has to be in the range of 1 - 10.
+ * has to be in the range of 1 - Q_MAX (10), or Q_AUTO (-1) to choose q from the state size
+ * of the generator and the L1 and L2 cache sizes. Other values, like the 0 of a 
+ * zero-initialized config, print an error and are replaced by Q_DEFAULT.
+ *
+ * -poly_method: enum F2LinJumpPolyMethod
+ * How the jump polynomial is calculated. POWER_MOD exponentiates for every jump size,
+ * POW2_TABLE composes it from a table of x^(2^k) mod p, which is computed once per 
+ * generator. Composing is cheaper for jump sizes with few bits set, e.g. rank * 2^n.
  *
  * See http://www.math.sci.hiroshima-u.ac.jp/m-mat/MT/ARTICLES/jumpf2-printed.pdf for a
  * detailed description of what these parameters are.
  *
- * @param cfg can also be set to 0. In this, the default values will be used. These are:
+ * @param cfg can also be set to 0. If a tuning profile is loaded (see f2lin_tune()), the 
+ * fastest algorithm and q measured for the bit length of @param jump_size are used. 
+ * Otherwise the default values will be used. These are:
  *      jump_algorithm = SLIDING_WINDOW_DECOMP
- *      q = 3
+ *      q = Q_DEFAULT
+ *      poly_method = POWER_MOD
  */
 F2LinJump* f2lin_jump_init(const size_t jump_size, F2LinConfig* cfg);
 
+/**
+ * Like f2lin_jump_init(), for generators of @param type. The jump can only be used with 
+ * generators of that type. Returns 0 if @param type is invalid.
+ */
+F2LinJump* f2lin_jump_init_type(enum F2LinRngType type, const size_t jump_size, 
+                                F2LinConfig* cfg);
+
+/**
+ * Like f2lin_jump_init_type(), for generators of the type and on the stream of 
+ * @param rng (see f2lin_rng_init_stream()). The jump can only be used with generators on 
+ * that stream.
+ *
+ * The minimal polynomial of a stream is computed on its first jump, which takes some ten
+ * microseconds for tinymt, and then stays cached for the whole process.
+ */
+F2LinJump* f2lin_jump_init_rng(const F2LinRngGeneric* rng, const size_t jump_size, 
+                               F2LinConfig* cfg);
+
 /**
  * Jump @param rng forward in the stream, according to the parameters set in @param jump.
+ * If @param jump was initialized for a different type of generator or stream, an error is
+ * printed and @param rng is left unchanged.
+ *
+ * @param jump is not modified, so threads can share one jump and jump generators of their
+ * own at the same time. The scratch space of a jump is kept per thread and freed when the 
+ * thread exits, see f2lin_jump_work_init() for providing it instead.
+ */
+void f2lin_jump(F2LinRngGeneric* rng, const F2LinJump* jump);
+
+/**
+ * Allocates the scratch space of jumps with @param jump, which can be given to 
+ * f2lin_jump_with_work() instead of using the one of the calling thread. A workspace must 
+ * only be used by one thread at a time, and fits all jumps of the same type of generator 
+ * which were initialized with the same or a smaller q.
+ *
+ * The returned pointer must be destroyed by a call to f2lin_jump_work_destroy().
+ */
+F2LinJumpWork* f2lin_jump_work_init(const F2LinJump* jump);
+
+/**
+ * Like f2lin_jump(), with the scratch space in @param work. If @param work doesn't fit 
+ * @param jump, an error is printed and @param rng is left unchanged.
+ */
+void f2lin_jump_with_work(F2LinRngGeneric* rng, const F2LinJump* jump, F2LinJumpWork* work);
+
+void f2lin_jump_work_destroy(F2LinJumpWork* work);
+
+/**
+ * Bytes of memory needed by f2lin_jump_work_init_at() for a workspace of @param jump.
  */
-void f2lin_jump(F2LinRngGeneric* rng, F2LinJump* jump);
+size_t f2lin_jump_work_size(const F2LinJump* jump);
+
+/**
+ * Like f2lin_jump_work_init(), but in @param mem, which has to hold f2lin_jump_work_size()
+ * bytes aligned to F2LIN_JUMP_WORK_ALIGN, e.g. a part of an arena owned by the caller. 
+ * Nothing is allocated, neither here nor by f2lin_jump_with_work() with the workspace, 
+ * which makes jumping in tight loops free of calls to malloc.
+ *
+ * The workspace must not be destroyed with f2lin_jump_work_destroy(), the memory belongs 
+ * to the caller.
+ */
+F2LinJumpWork* f2lin_jump_work_init_at(const F2LinJump* jump, void* mem);
+
+/**
+ * Moves @param rng @param n numbers ahead in its stream, without having to manage a jump.
+ *
+ * Short distances are stepped through, long ones jumped. Which one is cheaper depends on 
+ * the generator, so the cost of a step, of a jump and of initializing a jump is measured 
+ * once per type of generator, on its first advance by at least the state size. This 
+ * takes a few milliseconds, and up to about a tenth of a second for the Mersenne Twister,
+ * whose jumps are expensive to initialize.
+ * Jumps are initialized like f2lin_jump_init_rng() without a config. Their parameters are
+ * cached once a distance is advanced by a second time, after that advancing by it again 
+ * only costs the jump itself.
+ */
+void f2lin_advance(F2LinRngGeneric* rng, size_t n);
+
+/**
+ * Writes the position of the tracked @param rng to @param pos. 
+ *
+ * Returns 0 on success and -1 if @param rng doesn't track its position.
+ */
+int f2lin_position(const F2LinRngGeneric* rng, F2LinPosition* pos);
+
+/**
+ * Makes the current state of the tracked @param rng its checkpoint, which f2lin_seek_abs()
+ * starts from to reach positions behind the current one. A tracked generator has one
+ * checkpoint, initially its state at position 0.
+ *
+ * Returns 0 on success and -1 if @param rng doesn't track its position.
+ */
+int f2lin_checkpoint(F2LinRngGeneric* rng);
+
+/**
+ * Moves the tracked @param rng to position @param n, e.g. to replay the numbers of a
+ * run from a recorded position without generating everything before it again.
+ *
+ * The move starts from the current position or the checkpoint (see f2lin_checkpoint()),
+ * whichever is closer below @param n, and is done like f2lin_advance(). So seeking by the
+ * same distances repeatedly reuses cached jump parameters. Distances of 2^64 and more 
+ * compute a jump for the move only, which costs about as much as f2lin_jump_init().
+ *
+ * Returns 0 on success, and -1 if @param rng doesn't track its position, @param n is 
+ * before both the current position and the checkpoint or the jump for a distance of 2^64
+ * and more fails, which leaves @param rng unchanged.
+ */
+int f2lin_seek_abs(F2LinRngGeneric* rng, F2LinPosition n);
+
+/**
+ * Precomputes the substreams 0..@param ids - 1 of @param base, where substream id starts
+ * id * @param stride numbers after @param base, e.g. one substream per particle. The jumps
+ * by stride * 2^k are computed once for every bit k of the largest id, so positioning a
+ * generator on any substream costs one jump per set bit of its id, and no jump polynomial
+ * is computed afterwards. @param cfg can be 0, which uses MATRIX for generators with a 
+ * small state (see f2lin_jump_init()) and the default configuration for the others.
+ *
+ * The substreams are for the type and stream of @param base, which is copied. The results 
+ * only depend on the id, not on which thread or in which order substreams are positioned.
+ *
+ * Returns 0 if @param stride or @param ids is 0, or if the offset of the last substream
+ * doesn't fit into size_t. The returned pointer must be destroyed by a call to 
+ * f2lin_substreams_destroy().
+ */
+F2LinSubstreamTable* f2lin_substreams_init(const F2LinRngGeneric* base, size_t stride, 
+                                           size_t ids, F2LinConfig* cfg);
+
+/**
+ * Sets @param out to the start of substream @param id of @param table. @param out has to 
+ * be a generator of the type of the base generator, e.g. one initialized in place (see 
+ * f2lin_rng_init_at()). Threads can use one table at the same time.
+ *
+ * If @param out is tracked, it is positioned at id * stride after the position of the base 
+ * generator (0 if that wasn't tracked), and the base generator becomes its checkpoint.
+ *
+ * Returns @param out, or 0 if @param id is too large or @param out is of another type.
+ */
+F2LinRngGeneric* f2lin_substream(const F2LinSubstreamTable* table, size_t id, 
+                                 F2LinRngGeneric* out);
+
+/**
+ * Initializes the generators of the @param n substreams starting at @param first in place 
+ * in @param mem, which has to hold n * f2lin_rng_state_size() bytes aligned to 
+ * f2lin_rng_state_align() for the type of the base generator. Generator i is at 
+ * mem + i * f2lin_rng_state_size(). Only the first generator is positioned by its id, the 
+ * others are moved from their predecessor by one stride, with a single jump or by 
+ * stepping, whichever is cheaper.
+ *
+ * Returns 0 on success and -1 if the substreams don't exist or @param mem isn't aligned.
+ * The generators must not be destroyed with f2lin_rng_destroy().
+ */
+int f2lin_substream_range(const F2LinSubstreamTable* table, size_t first, size_t n, 
+                          void* mem);
+
+void f2lin_substreams_destroy(F2LinSubstreamTable* table);
+
+/**
+ * Returns the jump polynomial of a HORNER or SLIDING_WINDOW @param jump, with the 
+ * coefficient of x^i in bit i % 64 of word i / 64, and writes the number of words to 
+ * @param words. Returns 0 for other algorithms, which don't keep it.
+ *
+ * The polynomial belongs to @param jump and is valid until it is destroyed. E.g. 
+ * f2lin.hpp jumps its engines with it.
+ */
+const uint64_t* f2lin_jump_poly(const F2LinJump* jump, size_t* words);
 
 /**
  * Destroy the parameters for jumping ahead, freeing any space used by them. 
  */
 void f2lin_jump_destroy(F2LinJump* jump);
 
+/**
+ * Writes the parameters of @param jump to the file at @param path, so they can be loaded 
+ * by f2lin_jump_read() instead of being computed again.
+ *
+ * Returns 0 on success and -1 on failure.
+ */
+int f2lin_jump_write(const F2LinJump* jump, const char* path);
+
+/**
+ * Loads jump parameters written by f2lin_jump_write(). The file is memory mapped and used
+ * in place, so processes reading the same file share the parameters in the page cache.
+ * The jump is for the type of generator it was written for.
+ *
+ * Returns 0 if the file can't be read.
+ * The returned pointer must be destroyed by a call to f2lin_jump_destroy().
+ */
+F2LinJump* f2lin_jump_read(const char* path);
+
+/**
+ * Measures the jump algorithms HORNER, SLIDING_WINDOW and SLIDING_WINDOW_DECOMP with all
+ * values of q for generators of type RNG_TYPE_DEFAULT on this machine, writes the fastest 
+ * configuration for every bit length of the jump size as a profile to the file at 
+ * @param path, and loads it. This takes a few seconds for large generators.
+ *
+ * Returns 0 on success and -1 on failure.
+ */
+int f2lin_tune(const char* path);
+
+/**
+ * Like f2lin_tune(), for generators of @param type.
+ */
+int f2lin_tune_type(enum F2LinRngType type, const char* path);
+
+/**
+ * Loads a profile written by f2lin_tune(), which is then used by f2lin_jump_init() 
+ * whenever it is called without a config for the type of generator the profile was 
+ * measured for. Profiles of different types can be loaded at the same time. 
+ * Setting @param path to 0 unloads all profiles.
+ *
+ * If no profile is loaded explicitly, the ones at $F2LIN_TUNE_PROFILE are loaded on the 
+ * first call to f2lin_jump_init() without a config. Several profiles are separated by ':'.
+ *
+ * Returns 0 on success and -1 if the profile can't be read or was measured for a 
+ * generator which isn't part of the library.
+ */
+int f2lin_tune_load(const char* path);
+
+/**
+ * Jump parameters are cached process-wide, so initializing a jump with the same jump size,
+ * algorithm and q again only costs a lookup. The cache is thread safe and the cached
+ * parameters are shared read-only between all jumps using them.
+ *
+ * Sets the maximum number of bytes used by the cached jump parameters. Parameters which are
+ * not used by any jump are evicted least recently used first, once the limit is exceeded.
+ * Setting @param bytes to 0 disables the cache, every jump then owns its parameters.
+ *
+ * The default limit is JUMP_CACHE_LIMIT_DEFAULT.
+ */
+void f2lin_cache_set_limit(const size_t bytes);
+
+/**
+ * Sets the maximum number of cached jump parameters, evicting unused ones least recently
+ * used first. Setting @param entries to 0 disables the cache as well.
+ *
+ * The default limit is JUMP_CACHE_ENTRIES_DEFAULT.
+ */
+void f2lin_cache_set_entry_limit(const size_t entries);
+
+/**
+ * Writes the hit and miss counters and the memory usage of the jump cache into @param stats.
+ */
+void f2lin_cache_stats(F2LinJumpCacheStats* stats);
+
+/**
+ * Evicts all cached jump parameters which are not in use and resets the counters.
+ */
+void f2lin_cache_clear();
+
 /**
  * Destroys the random number generator, freeing all memory used by it.
  */
@@ -97,4 +466,36 @@ int64_t f2lin_next_signed(F2LinRngGeneric* rng);
  */ 
 double f2lin_next_double(F2LinRngGeneric* rng);
 
+/**
+ * Fills @param buf with the next @param n unsigned 64 bit numbers in the stream. 
+ * This is the same as @param n calls to f2lin_next_unsigned(), but generates the numbers
+ * in blocks, which is much faster for large @param n. The generator is only dispatched on 
+ * once per call, like in all fill functions.
+ */
+void f2lin_fill_u64(F2LinRngGeneric* rng, size_t n, uint64_t* buf);
+
+/**
+ * Fills @param buf with the next @param n real numbers in the range of 0 (inclusive) to 
+ * 1 (exclusive). This is the same as @param n calls to f2lin_next_double().
+ */
+void f2lin_fill_double(F2LinRngGeneric* rng, size_t n, double* buf);
+
+/**
+ * Fills @param buf with the next @param n real numbers in the range of 0 (exclusive) to 
+ * 1 (exclusive), made from the upper 52 bits of each number in the stream.
+ */
+void f2lin_fill_double_open(F2LinRngGeneric* rng, size_t n, double* buf);
+
+/**
+ * Fills @param buf with @param n floats in the range of 0 (inclusive) to 1 (exclusive).
+ * Every number in the stream gives two floats, the first one from its lower and the second
+ * one from its upper 32 bits. For an odd @param n the second float of the last number is
+ * discarded, so this always advances the stream by (n + 1) / 2 numbers.
+ */
+void f2lin_fill_float(F2LinRngGeneric* rng, size_t n, float* buf);
+
+#ifdef __cplusplus
+}
+#endif
+
 #endif
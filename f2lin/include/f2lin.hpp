@@ -0,0 +1,372 @@
+#ifndef F2LIN_HPP
+#define F2LIN_HPP
+
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <memory>
+
+#include "f2lin.h"
+
+/*
+ * C++17 interface to the generators of the library.
+ *
+ * f2lin::engine<Backend> holds the state of a generator by value and models
+ * UniformRandomBitGenerator, so it can be used with the distributions of <random>.
+ * All functions of a backend are resolved at compile time, so generating a number and the
+ * loops of a jump are inlined for every generator, instead of going through the function
+ * pointers of F2LinRngBackend. The streams are the same as the ones of the generators
+ * created by f2lin_rng_init_type() with the same seed.
+ *
+ * This header is not header-only. discard() gets the jump polynomial x^n mod p from the
+ * jump cache of the library, through f2lin_jump_init_type() and f2lin_jump_poly(), so 
+ * discarding the same n again doesn't compute it again. Programs using it include f2lin.h
+ * like every other program using the library, and link libf2lin.
+ */
+
+namespace f2lin {
+
+namespace detail {
+
+/* bits of the jump polynomial handled at once by the sliding window in jump() */
+constexpr int window = 4;
+
+struct jump_deleter {
+    void operator()(F2LinJump* jump) const { f2lin_jump_destroy(jump); }
+};
+
+using jump_ptr = std::unique_ptr<F2LinJump, jump_deleter>;
+
+/*
+ * Sets @param s to p(A) s, where A is the transition of Backend and p the jump 
+ * polynomial x^n mod the minimal polynomial, with the sliding window method. The table
+ * holds g(A) s for all polynomials g of degree below the window size.
+ */
+template <class Backend>
+void jump(typename Backend::state_type& s, unsigned long long n) {
+    using state_type = typename Backend::state_type;
+    F2LinConfig cfg{};
+    std::size_t words;
+    state_type table[1 << window];
+
+    // HORNER jumps share their polynomial in the cache with SLIDING_WINDOW ones
+    cfg.algorithm = HORNER;
+    cfg.q = Q_DEFAULT;
+    const jump_ptr j(f2lin_jump_init_type(Backend::type, n, &cfg));
+    const std::uint64_t* p = f2lin_jump_poly(j.get(), &words);
+
+    while (words && !p[words - 1]) --words;
+    if (!words) return;
+
+    // the window containing the leading coefficient, which isn't 0. windows don't cross 
+    // words, as 64 is a multiple of the window size
+    long lo = (64 * long(words) - 1 - __builtin_clzll(p[words - 1])) / window * window;
+    const auto bits = [p](long at) {
+        return (p[at / 64] >> (at % 64)) & ((std::uint64_t(1) << window) - 1);
+    };
+
+    table[1] = s;
+    for (int k = 1; k < window; ++k) {
+        state_type& xk = table[1 << k];
+
+        xk = table[1 << (k - 1)];
+        Backend::next_state(xk);
+        for (int m = 1; m < (1 << k); ++m) {
+            table[(1 << k) + m] = xk;
+            Backend::add(table[(1 << k) + m], table[m]);
+        }
+    }
+
+    s = table[bits(lo)];
+    for (lo -= window; lo >= 0; lo -= window) {
+        const std::uint64_t w = bits(lo);
+
+        for (int i = 0; i < window; ++i) Backend::next_state(s);
+        if (w) Backend::add(s, table[w]);
+    }
+}
+
+} // namespace detail
+
+/*
+ * The backends, one for every enum F2LinRngType. Each one describes its state and
+ * implements the same operations as the corresponding rng_generic_*.c, as static functions.
+ */
+
+struct xorshift64 {
+    struct state_type {
+        std::uint64_t x;
+    };
+
+    static constexpr long state_size = 64;
+    static constexpr std::size_t state_words = 1;
+    static constexpr F2LinRngType type = F2LIN_XORSHIFT64;
+
+    static void init(state_type& s) { s.x = 12323456ull; }
+    static void seed(state_type& s, std::uint64_t seed) { s.x = seed; }
+
+    static void next_state(state_type& s) {
+        s.x ^= s.x << 13;
+        s.x ^= s.x >> 17;
+        s.x ^= s.x << 5;
+    }
+
+    static std::uint64_t next(state_type& s) {
+        next_state(s);
+        return s.x;
+    }
+
+    static void add(state_type& lhs, const state_type& rhs) { lhs.x ^= rhs.x; }
+
+    static bool equal(const state_type& lhs, const state_type& rhs) { return lhs.x == rhs.x; }
+};
+
+struct mt19937_64 {
+    static constexpr std::size_t nn = 312;
+    static constexpr std::size_t mm = 156;
+    static constexpr std::uint64_t matrix_a = 0xB5026F5AA96619E9ull;
+    static constexpr std::uint64_t um = 0xFFFFFFFF80000000ull;
+    static constexpr std::uint64_t lm = 0x7FFFFFFFull;
+
+    // word i of the state is stored at (mti + i) % nn
+    struct state_type {
+        std::uint64_t mt[nn];
+        std::size_t mti;
+    };
+
+    static constexpr long state_size = 19937;
+    static constexpr std::size_t state_words = nn;
+    static constexpr F2LinRngType type = F2LIN_MT19937;
+
+    static void init(state_type& s) { seed(s, 1234567); }
+
+    static void seed(state_type& s, std::uint64_t seed) {
+        s.mt[0] = seed;
+        for (std::size_t i = 1; i < nn; ++i) {
+            s.mt[i] = 6364136223846793005ull * (s.mt[i - 1] ^ (s.mt[i - 1] >> 62)) + i;
+        }
+        s.mti = 0;
+    }
+
+    static void next_state(state_type& s) {
+        const std::size_t i = s.mti, i1 = i + 1 < nn ? i + 1 : 0;
+        const std::size_t im = i + mm < nn ? i + mm : i + mm - nn;
+        const std::uint64_t y = (s.mt[i] & um) | (s.mt[i1] & lm);
+
+        s.mt[i] = s.mt[im] ^ (y >> 1) ^ (-(y & 1ull) & matrix_a);
+        s.mti = i1;
+    }
+
+    static std::uint64_t next(state_type& s) {
+        const std::size_t i = s.mti;
+        std::uint64_t x;
+
+        next_state(s);
+        x = s.mt[i];
+        x ^= (x >> 29) & 0x5555555555555555ull;
+        x ^= (x << 17) & 0x71D67FFFEDA60000ull;
+        x ^= (x << 37) & 0xFFF7EEE000000000ull;
+        x ^= (x >> 43);
+        return x;
+    }
+
+    static void add(state_type& lhs, const state_type& rhs) {
+        // at most three parts in which the words of both states are contiguous
+        for (std::size_t i = 0, n; i < nn; i += n) {
+            const std::size_t l = (lhs.mti + i) % nn, r = (rhs.mti + i) % nn;
+
+            n = nn - (l > r ? l : r);
+            if (n > nn - i) n = nn - i;
+            for (std::size_t j = 0; j < n; ++j) lhs.mt[l + j] ^= rhs.mt[r + j];
+        }
+    }
+
+    static bool equal(const state_type& lhs, const state_type& rhs) {
+        // the same state can be stored with a different mti, and the lower bits of the
+        // word at mti aren't part of it, so compare the next nn words instead
+        state_type l = lhs, r = rhs;
+
+        for (std::size_t i = 0; i < nn; ++i) {
+            const std::size_t li = l.mti, ri = r.mti;
+
+            next_state(l);
+            next_state(r);
+            if (l.mt[li] != r.mt[ri]) return false;
+        }
+        return true;
+    }
+};
+
+struct tinymt64 {
+    static constexpr std::uint32_t mat1 = 0x65980cb3;
+    static constexpr std::uint32_t mat2 = 0xeb38facf;
+    static constexpr std::uint64_t tmat = 0xcc3b75ff;
+    static constexpr std::uint64_t mask = 0x7fffffffffffffffull;
+
+    struct state_type {
+        std::uint64_t status[2];
+    };
+
+    static constexpr long state_size = 127;
+    static constexpr std::size_t state_words = 2;
+    static constexpr F2LinRngType type = F2LIN_TINYMT64;
+
+    static void init(state_type& s) { seed(s, 2147482983); }
+
+    static void seed(state_type& s, std::uint64_t seed) {
+        s.status[0] = seed ^ (std::uint64_t(mat1) << 32);
+        s.status[1] = mat2 ^ tmat;
+        for (unsigned i = 1; i < 8; ++i) {
+            const std::uint64_t prev = s.status[(i - 1) & 1];
+
+            s.status[i & 1] ^= i + 6364136223846793005ull * (prev ^ (prev >> 62));
+        }
+        // period certification
+        if ((s.status[0] & mask) == 0 && s.status[1] == 0) {
+            s.status[0] = 'T';
+            s.status[1] = 'M';
+        }
+    }
+
+    static void next_state(state_type& s) {
+        std::uint64_t x = (s.status[0] & mask) ^ s.status[1];
+
+        x ^= x << 12;
+        x ^= x >> 32;
+        x ^= x << 32;
+        x ^= x << 11;
+        s.status[0] = s.status[1];
+        s.status[1] = x;
+        if (x & 1) {
+            s.status[0] ^= mat1;
+            s.status[1] ^= std::uint64_t(mat2) << 32;
+        }
+    }
+
+    static std::uint64_t next(state_type& s) {
+        std::uint64_t x;
+
+        next_state(s);
+        x = s.status[0] + s.status[1];
+        x ^= s.status[0] >> 8;
+        if (x & 1) x ^= tmat;
+        return x;
+    }
+
+    static void add(state_type& lhs, const state_type& rhs) {
+        lhs.status[0] ^= rhs.status[0];
+        lhs.status[1] ^= rhs.status[1];
+    }
+
+    static bool equal(const state_type& lhs, const state_type& rhs) {
+        return lhs.status[0] == rhs.status[0] && lhs.status[1] == rhs.status[1];
+    }
+};
+
+struct xoshiro256pp {
+    struct state_type {
+        std::uint64_t s[4];
+    };
+
+    static constexpr long state_size = 256;
+    static constexpr std::size_t state_words = 4;
+    static constexpr F2LinRngType type = F2LIN_XOSHIRO256PP;
+
+    static void init(state_type& s) { s = { { 12323456ull, 54321ull, 0xa02b4c7dull, 0x94a3f7eeull } }; }
+    static void seed(state_type& s, std::uint64_t seed) { s = { { seed, 0, 0, 0 } }; }
+
+    static std::uint64_t rotl(std::uint64_t x, int k) { return (x << k) | (x >> (64 - k)); }
+
+    static void next_state(state_type& st) {
+        std::uint64_t* s = st.s;
+        const std::uint64_t t = s[1] << 17;
+
+        s[2] ^= s[0];
+        s[3] ^= s[1];
+        s[1] ^= s[2];
+        s[0] ^= s[3];
+        s[2] ^= t;
+        s[3] = rotl(s[3], 45);
+    }
+
+    static std::uint64_t next(state_type& st) {
+        const std::uint64_t result = rotl(st.s[0] + st.s[3], 23) + st.s[0];
+
+        next_state(st);
+        return result;
+    }
+
+    static void add(state_type& lhs, const state_type& rhs) {
+        for (int i = 0; i < 4; ++i) lhs.s[i] ^= rhs.s[i];
+    }
+
+    static bool equal(const state_type& lhs, const state_type& rhs) {
+        return !std::memcmp(lhs.s, rhs.s, sizeof(lhs.s));
+    }
+};
+
+/*
+ * A generator of Backend, see the comment at the top of the file.
+ */
+template <class Backend>
+class engine {
+public:
+    using backend_type = Backend;
+    using state_type = typename Backend::state_type;
+    using result_type = std::uint64_t;
+
+    /*
+     * discard() iterates up to this many steps. A jump costs about state_size steps and
+     * state_size / window additions of state_words words each.
+     */
+    static constexpr unsigned long long iterate_max =
+        Backend::state_size + Backend::state_size / detail::window * Backend::state_words;
+
+    /* the same state as f2lin_rng_generic_init() */
+    engine() { Backend::init(state_); }
+
+    /* the same state as f2lin_rng_init_type() with @param seed */
+    explicit engine(result_type seed) { Backend::seed(state_, seed); }
+
+    void seed() { Backend::init(state_); }
+    void seed(result_type seed) { Backend::seed(state_, seed); }
+
+    static constexpr result_type min() { return 0; }
+    static constexpr result_type max() { return std::numeric_limits<result_type>::max(); }
+
+    result_type operator()() { return Backend::next(state_); }
+
+    /*
+     * Advances the stream by @param n numbers. Large @param n jump with the jump
+     * polynomial x^n mod p, so this takes about as long as state_size steps for any n once
+     * the polynomial is in the jump cache of the library.
+     */
+    void discard(unsigned long long n) {
+        if (n <= iterate_max) {
+            for (unsigned long long i = 0; i < n; ++i) Backend::next_state(state_);
+            return;
+        }
+
+        detail::jump<Backend>(state_, n);
+    }
+
+    const state_type& state() const { return state_; }
+
+    friend bool operator==(const engine& lhs, const engine& rhs) {
+        return Backend::equal(lhs.state_, rhs.state_);
+    }
+
+    friend bool operator!=(const engine& lhs, const engine& rhs) { return !(lhs == rhs); }
+
+private:
+    state_type state_;
+};
+
+using xorshift64_engine = engine<xorshift64>;
+using mt19937_64_engine = engine<mt19937_64>;
+using tinymt64_engine = engine<tinymt64>;
+using xoshiro256pp_engine = engine<xoshiro256pp>;
+
+} // namespace f2lin
+
+#endif
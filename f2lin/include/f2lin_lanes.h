@@ -0,0 +1,59 @@
+#ifndef F2LIN_LANES_H
+#define F2LIN_LANES_H
+
+#include <stdlib.h>
+#include <stdint.h>
+#include <inttypes.h>
+
+/*
+ * Multi-lane xoshiro256++, only available for base generators of type F2LIN_XOSHIRO256PP.
+ *
+ * Several xoshiro256++ states are advanced in lockstep with SIMD instructions, 8 lanes with
+ * AVX-512 and 4 with AVX2. The lanes are placed in the stream by jumping a base generator,
+ * so they are provably non-overlapping.
+ */
+
+typedef struct F2LinRngGeneric F2LinRngGeneric;
+typedef struct F2LinLanes F2LinLanes;
+
+/**
+ * How the lanes are placed in the stream and how their numbers are ordered.
+ *
+ * SUBSTREAMS: lane i starts at position i * substream_size of the base generator. 
+ * The numbers are written lane by lane, the k-th number of lane i ends up at k * lanes + i.
+ * The lanes don't overlap as long as every lane generates at most substream_size numbers,
+ * the output depends on the number of lanes.
+ * INTERLEAVED: the lanes generate alternating blocks of the stream of the base generator,
+ * and are jumped over the blocks of the other lanes. The numbers are written in the order of
+ * the stream, so the output is exactly the same as generating them one after another,
+ * independent of the number of lanes.
+ */
+enum F2LinLanesMode {
+    SUBSTREAMS = 0, INTERLEAVED = 1,
+};
+
+/**
+ * Initializes @param lanes generators starting at the position of @param base, which is not
+ * changed. If @param lanes is 0, the number of lanes of one vector on this cpu is used.
+ * @param substream_size is only used for SUBSTREAMS, and has to be larger than 0.
+ *
+ * Returns 0 if @param base isn't of type F2LIN_XOSHIRO256PP, @param substream_size is 0 for
+ * SUBSTREAMS or the jumps between the lanes can't be initialized.
+ * The returned pointer must be destroyed by a call to f2lin_lanes_destroy().
+ */
+F2LinLanes* f2lin_lanes_init(const F2LinRngGeneric* base, size_t lanes, 
+                             enum F2LinLanesMode mode, size_t substream_size);
+
+/**
+ * Fills @param buf with the next @param n numbers of the lanes, in the order of the mode.
+ */
+void f2lin_lanes_fill_u64(F2LinLanes* lanes, size_t n, uint64_t* buf);
+
+/**
+ * Number of lanes used by @param lanes.
+ */
+size_t f2lin_lanes_count(const F2LinLanes* lanes);
+
+void f2lin_lanes_destroy(F2LinLanes* lanes);
+
+#endif
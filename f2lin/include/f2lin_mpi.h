@@ -0,0 +1,100 @@
+#ifndef F2LIN_MPI_H
+#define F2LIN_MPI_H
+
+#include <stdlib.h>
+#include <stdint.h>
+#include <inttypes.h>
+
+#include "mpi.h"
+#include "config.h"
+
+/*
+ * Optional MPI support, only needed when linking src/f2lin_mpi.c (see mpi_objects in the 
+ * Makefile). 
+ *
+ * The jump parameters are only computed once, by rank 0 of the communicator, and then
+ * distributed in the serialized format of jump_file.h instead of being computed again 
+ * on every rank.
+ */
+
+typedef struct F2LinJump F2LinJump;
+typedef struct F2LinRngGeneric F2LinRngGeneric;
+
+/**
+ * How the jump parameters are distributed to the ranks of a communicator.
+ *
+ * SHARED_WINDOW: the parameters are broadcast to one rank per node, which places them in 
+ * a MPI-3 shared memory window. All ranks of the node use them from there, so only one 
+ * copy exists per node.
+ * BROADCAST: the parameters are broadcast to every rank, which then owns its own copy.
+ */
+enum F2LinMPIShare {
+    SHARED_WINDOW = 0, BROADCAST = 1,
+};
+
+/**
+ * Jumps by multiples of a jump size, see f2lin_mpi_jump_table_init().
+ */
+typedef struct F2LinMPIJumpTable F2LinMPIJumpTable;
+
+/**
+ * Initializes the jump parameters for generators of @param type for @param jump_size on all
+ * ranks of @param comm. This is collective, @param type, @param jump_size and @param cfg 
+ * have to be the same on all ranks.
+ * @param cfg can be 0 to use the default values, like for f2lin_jump_init().
+ *
+ * The jump is computed for the default parameters of @param type, like f2lin_jump_init_type().
+ * Generators with other parameters (e.g. further tinymt streams) are rejected by it, their
+ * jumps have to be initialized on every rank with f2lin_jump_init_rng().
+ *
+ * The returned pointer must be destroyed by a call to f2lin_jump_destroy(). With 
+ * SHARED_WINDOW destroying the jump is collective over the ranks of a node, and has to
+ * happen before MPI_Finalize().
+ */
+F2LinJump* f2lin_mpi_jump_init(enum F2LinRngType type, size_t jump_size, F2LinConfig* cfg, 
+                               enum F2LinMPIShare share, MPI_Comm comm);
+
+/**
+ * Initializes jumps by @param jump_size * 2^k for every bit k needed by the ranks of 
+ * @param comm, so every rank can jump to its own offset rank * @param jump_size with at 
+ * most log2(size) jumps. Parameters are shared like for f2lin_mpi_jump_init(), and so
+ * also only fit generators with the default parameters of @param type.
+ *
+ * The returned pointer must be destroyed by a call to f2lin_mpi_jump_table_destroy().
+ */
+F2LinMPIJumpTable* f2lin_mpi_jump_table_init(enum F2LinRngType type, size_t jump_size, 
+                                             F2LinConfig* cfg, enum F2LinMPIShare share, 
+                                             MPI_Comm comm);
+
+/**
+ * Jumps @param rng ahead by rank * jump_size, where rank is the rank of the calling process
+ * in the communicator @param table was initialized with. @param rng has to have the default
+ * parameters of its type, otherwise an error is printed and it is left unchanged.
+ */
+void f2lin_mpi_jump_rank(F2LinRngGeneric* rng, F2LinMPIJumpTable* table);
+
+/**
+ * Positions the generator of every rank of @param comm at the exclusive prefix sum of 
+ * @param count over the ranks, i.e. rank r starts where rank r - 1 stops after generating 
+ * its count numbers. The streams are the same as generating all numbers sequentially 
+ * from the generator of rank 0. This is collective, @param rng has to be of the same 
+ * type on all ranks, and on all other ranks its state is overwritten.
+ * Tracked generators (see f2lin_rng_init_tracked()) of the other ranks are positioned 
+ * after the one of rank 0, with their new state as checkpoint.
+ *
+ * The generators are passed along a binomial tree in log2(size) rounds. In round k, a rank
+ * receiving a generator jumps by min(count) * 2^k with parameters shared by all ranks,
+ * and advances over the remaining difference caused by uneven counts (see f2lin_advance()).
+ * So the setup costs O(log2(size)) jumps in total, and a single jump and advance per rank.
+ * If the generator of rank 0 has parameters other than the default ones, the jumps can't be
+ * shared, and every receiving rank computes its jump for these parameters itself.
+ */
+void f2lin_mpi_exscan_position(MPI_Comm comm, size_t count, F2LinRngGeneric* rng);
+
+/**
+ * Destroys the jumps of @param table. With SHARED_WINDOW this is collective over the ranks 
+ * of a node, and has to happen before MPI_Finalize().
+ */
+void f2lin_mpi_jump_table_destroy(F2LinMPIJumpTable* table);
+
+#endif
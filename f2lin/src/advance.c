@@ -0,0 +1,256 @@
+#include <float.h>
+#include <time.h>
+#include <pthread.h>
+
+#include "advance.h"
+#include "jump_ahead.h"
+
+/* every cost is measured this many times, the fastest run counts */
+#define ADVANCE_REPETITIONS 3
+
+/* numbers skipped per call to f2lin_rng_generic_skip() while measuring */
+#define ADVANCE_STEPS 4096
+
+/* jump size used for measuring, it is larger than every state size */
+#define ADVANCE_JUMP_SIZE 0x9e3779b97f4a7c15ull
+
+/* distances of fresh jumps remembered per type, so repeated ones are cached, a power of 2 */
+#define ADVANCE_SEEN 64
+
+/*------------------------------------------------------
+ * Forward Declarations                                |
+ /----------------------------------------------------*/
+
+static
+void calibrate(enum F2LinRngType type, F2LinAdvanceCost* cost);
+
+static
+void derive_thresholds(enum F2LinRngType type, F2LinAdvanceCost* cost);
+
+static
+int seen_before(enum F2LinRngType type, size_t n);
+
+static
+double time_step(enum F2LinRngType type);
+
+static
+double time_apply(enum F2LinRngType type);
+
+static
+double time_init(enum F2LinRngType type);
+
+static
+double now();
+
+/*------------------------------------------------------
+ * Cost Models                                         |
+ /----------------------------------------------------*/
+
+// protects everything below
+static pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+
+// signaled when a calibration is done
+static pthread_cond_t calibration_done = PTHREAD_COND_INITIALIZER;
+
+static F2LinAdvanceCost costs[F2LIN_RNG_TYPES];
+static int calibrated[F2LIN_RNG_TYPES] = { 0 };
+static int calibrating[F2LIN_RNG_TYPES] = { 0 };
+static size_t seen[F2LIN_RNG_TYPES][ADVANCE_SEEN];
+
+/*------------------------------------------------------
+ * Header Implementations                              |
+ /----------------------------------------------------*/
+
+F2LinAdvanceCost f2lin_advance_cost(enum F2LinRngType type) {
+    F2LinAdvanceCost cost;
+
+    // one thread measures every type without holding the lock, other threads using the
+    // same type wait for it instead of measuring at the same time
+    pthread_mutex_lock(&lock);
+    while (!calibrated[type]) {
+        if (calibrating[type]) {
+            pthread_cond_wait(&calibration_done, &lock);
+            continue;
+        }
+
+        calibrating[type] = 1;
+        pthread_mutex_unlock(&lock);
+        calibrate(type, &cost);
+        pthread_mutex_lock(&lock);
+        calibrating[type] = 0;
+
+        // unless the model was set in the meantime
+        if (!calibrated[type]) {
+            costs[type] = cost;
+            calibrated[type] = 1;
+        }
+        pthread_cond_broadcast(&calibration_done);
+    }
+    cost = costs[type];
+    pthread_mutex_unlock(&lock);
+
+    return cost;
+}
+
+void f2lin_advance_set_cost(enum F2LinRngType type, const F2LinAdvanceCost* cost) {
+    pthread_mutex_lock(&lock);
+    if (cost) {
+        costs[type] = *cost;
+        derive_thresholds(type, &costs[type]);
+    }
+    calibrated[type] = cost != 0;
+    pthread_mutex_unlock(&lock);
+}
+
+enum F2LinAdvanceMethod f2lin_advance_method(const F2LinRngGeneric* rng, size_t n) {
+    const enum F2LinRngType type = f2lin_rng_generic_type(rng);
+    F2LinAdvanceCost cost;
+    int cached;
+
+    // always iterated, which doesn't need the cost model
+    if (n < f2lin_rng_generic_state_size(type)) return ADVANCE_ITERATE;
+
+    cost = f2lin_advance_cost(type);
+    cached = n >= cost.cached_min && f2lin_jump_ahead_cached(rng, n, 0);
+
+    if (cached) return ADVANCE_CACHED_JUMP;
+    if (n >= cost.fresh_min) return ADVANCE_FRESH_JUMP;
+    return ADVANCE_ITERATE;
+}
+
+void f2lin_advance_rng(F2LinRngGeneric* rng, size_t n) {
+    const enum F2LinAdvanceMethod method = f2lin_advance_method(rng, n);
+    F2LinJump* jump;
+
+    if (method == ADVANCE_ITERATE) {
+        f2lin_rng_generic_skip(rng, n);
+        return;
+    }
+
+    // distances advanced by only once would fill the cache, so a fresh jump is inserted
+    // into it only if n was jumped before
+    if (method == ADVANCE_FRESH_JUMP && !seen_before(f2lin_rng_generic_type(rng), n)) {
+        jump = f2lin_jump_ahead_init_rng_uncached(rng, n, 0);
+    } else {
+        jump = f2lin_jump_ahead_init_rng(rng, n, 0);
+    }
+    f2lin_jump_ahead_jump(jump, rng);
+    f2lin_jump_ahead_destroy(jump);
+}
+
+/*------------------------------------------------------
+ * Internal Implementations                            |
+ /----------------------------------------------------*/
+
+static
+void calibrate(enum F2LinRngType type, F2LinAdvanceCost* cost) {
+    cost->step = time_step(type);
+    cost->apply = time_apply(type);
+    cost->init = time_init(type);
+    derive_thresholds(type, cost);
+}
+
+static
+void derive_thresholds(enum F2LinRngType type, F2LinAdvanceCost* cost) {
+    const size_t state_size = f2lin_rng_generic_state_size(type);
+    const double cached = cost->step > 0 ? cost->apply / cost->step : DBL_MAX;
+    const double fresh = cost->step > 0 ? (cost->init + cost->apply) / cost->step : DBL_MAX;
+
+    cost->cached_min = cached >= (double) SIZE_MAX ? SIZE_MAX : (size_t) cached + 1;
+    cost->fresh_min = fresh >= (double) SIZE_MAX ? SIZE_MAX : (size_t) fresh + 1;
+    if (cost->cached_min < state_size) cost->cached_min = state_size;
+    if (cost->fresh_min < state_size) cost->fresh_min = state_size;
+}
+
+// returns 1 if a fresh jump by n was done for a generator of type recently, and remembers
+// n otherwise. distances with the same slot replace each other
+static
+int seen_before(enum F2LinRngType type, size_t n) {
+    size_t* slot = &seen[type][((n * 0x9e3779b97f4a7c15ull) >> 32) & (ADVANCE_SEEN - 1)];
+    int ret;
+
+    pthread_mutex_lock(&lock);
+    ret = *slot == n;
+    *slot = n;
+    pthread_mutex_unlock(&lock);
+
+    return ret;
+}
+
+// average time per number of the fastest repetition
+static
+double time_step(enum F2LinRngType type) {
+    F2LinRngGeneric* rng = f2lin_rng_generic_init(type);
+    double best = DBL_MAX;
+
+    for (int rep = 0; rep < ADVANCE_REPETITIONS; ++rep) {
+        const double start = now();
+        double elapsed;
+        size_t n = 0;
+
+        do {
+            f2lin_rng_generic_skip(rng, ADVANCE_STEPS);
+            n += ADVANCE_STEPS;
+        } while ((elapsed = now() - start) < ADVANCE_MIN_TIME);
+
+        if (elapsed / n < best) best = elapsed / n;
+    }
+
+    f2lin_rng_generic_destroy(rng);
+    return best;
+}
+
+static
+double time_apply(enum F2LinRngType type) {
+    F2LinRngGeneric* rng = f2lin_rng_generic_init(type);
+    F2LinJump* jump = f2lin_jump_ahead_init_uncached(type, ADVANCE_JUMP_SIZE, 0);
+    double best = DBL_MAX;
+
+    for (int rep = 0; rep < ADVANCE_REPETITIONS; ++rep) {
+        const double start = now();
+        double elapsed;
+        size_t n = 0;
+
+        do {
+            f2lin_jump_ahead_jump(jump, rng);
+            ++n;
+        } while ((elapsed = now() - start) < ADVANCE_MIN_TIME);
+
+        if (elapsed / n < best) best = elapsed / n;
+    }
+
+    f2lin_jump_ahead_destroy(jump);
+    f2lin_rng_generic_destroy(rng);
+    return best;
+}
+
+// the parameters are computed without the cache, so measuring doesn't fill it
+static
+double time_init(enum F2LinRngType type) {
+    double best = DBL_MAX;
+
+    // the minimal polynomial is prepared once per process, which isn't part of the cost
+    f2lin_jump_ahead_destroy(f2lin_jump_ahead_init_uncached(type, ADVANCE_JUMP_SIZE, 0));
+
+    for (int rep = 0; rep < ADVANCE_REPETITIONS; ++rep) {
+        const double start = now();
+        double elapsed;
+        size_t n = 0;
+
+        do {
+            f2lin_jump_ahead_destroy(f2lin_jump_ahead_init_uncached(type, ADVANCE_JUMP_SIZE, 0));
+            ++n;
+        } while ((elapsed = now() - start) < ADVANCE_MIN_TIME);
+
+        if (elapsed / n < best) best = elapsed / n;
+    }
+
+    return best;
+}
+
+static
+double now() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
@@ -0,0 +1,73 @@
+#ifndef ADVANCE_H
+#define ADVANCE_H
+
+#include <stdlib.h>
+#include <stdint.h>
+#include <inttypes.h>
+
+#include "config.h"
+#include "rng_generic/rng_generic.h"
+
+/* minimum time every cost is measured for during the calibration, in seconds */
+#define ADVANCE_MIN_TIME 1e-3
+
+/**
+ * How f2lin_advance_rng() moves a generator ahead.
+ * ADVANCE_ITERATE steps with the bulk next_state kernel of the generator, see 
+ * f2lin_rng_generic_skip().
+ * ADVANCE_CACHED_JUMP jumps with parameters found in the jump cache.
+ * ADVANCE_FRESH_JUMP computes the jump parameters first. They are inserted into the cache
+ * only if the same distance was jumped recently, so distances used once don't fill it.
+ */
+enum F2LinAdvanceMethod {
+    ADVANCE_ITERATE = 0, ADVANCE_CACHED_JUMP = 1, ADVANCE_FRESH_JUMP = 2,
+};
+
+/**
+ * Cost model of one type of generator, in seconds.
+ * step is the cost of skipping one number, apply the cost of applying an initialized jump
+ * and init the cost of computing the parameters of a jump without the cache. Jumps are
+ * measured with the configuration f2lin_jump_ahead_init() uses without one, for a jump
+ * size above the state size, which all have a dense jump polynomial and cost the same.
+ *
+ * cached_min and fresh_min are the distances from which on a cached and a fresh jump
+ * are cheaper than stepping. Both are at least the state size, as below it the jump
+ * polynomial is x^n and jumping can't beat stepping.
+ */
+typedef struct F2LinAdvanceCost F2LinAdvanceCost;
+struct F2LinAdvanceCost {
+    double step;
+    double apply;
+    double init;
+    size_t cached_min;
+    size_t fresh_min;
+};
+
+/**
+ * Returns the cost model of generators of @param type. It is measured on the first call
+ * for every type, which takes a few milliseconds (about a tenth of a second for MT19937),
+ * and then shared by the whole process. Other threads using the same type wait for the
+ * measurement, threads using other types don't.
+ */
+F2LinAdvanceCost f2lin_advance_cost(enum F2LinRngType type);
+
+/**
+ * Replaces the cost model of @param type, e.g. with one measured on another machine.
+ * cached_min and fresh_min are derived from the costs. If @param cost is 0, the model is
+ * measured again on the next use.
+ */
+void f2lin_advance_set_cost(enum F2LinRngType type, const F2LinAdvanceCost* cost);
+
+/**
+ * The method f2lin_advance_rng() uses for moving @param rng @param n numbers ahead. Jumps
+ * are cached for the parameters of @param rng, see f2lin_jump_ahead_init_rng().
+ */
+enum F2LinAdvanceMethod f2lin_advance_method(const F2LinRngGeneric* rng, size_t n);
+
+/**
+ * Moves @param rng @param n numbers ahead, the same as n calls to gen64, with the
+ * cheapest method according to the cost model of its type.
+ */
+void f2lin_advance_rng(F2LinRngGeneric* rng, size_t n);
+
+#endif
@@ -1,27 +1,119 @@
 #ifndef CONFIG_H
 #define CONFIG_H
 
+#include <stdlib.h>
+#include <stdint.h>
+
 #define Q_MAX 10
 #define Q_DEFAULT 6
+#define Q_AUTO -1
 #define ALGORITHM_DEFAULT SLIDING_WINDOW_DECOMP
+#define JUMP_CACHE_LIMIT_DEFAULT (64ull << 20)
+#define JUMP_CACHE_ENTRIES_DEFAULT (1ull << 16)
+#define POW2_TABLE_SIZE 64
+#define MATRIX_STATE_MAX 256
+
+/* maximum size of the parameters of a generator in 64 bit words, see F2LinRngBackend */
+#define RNG_PARAMS_WORDS 4
+
+/* used to choose q if the cache sizes can't be queried */
+#define CACHE_L1_DEFAULT (32ul << 10)
+#define CACHE_L2_DEFAULT (1ul << 20)
+
+/* keep the states in the sliding window tables normalized, see f2lin_rng_generic_normalize */
+#ifndef NORMALIZE_H_TABLE
+#define NORMALIZE_H_TABLE 1
+#endif
+
+/**
+ * The generators contained in the library, see f2lin_rng_init_type().
+ * F2LIN_RNG_TYPES is the number of generators.
+ *
+ * F2LIN_XORSHIFT64: xorshift with 64 bits of state
+ * F2LIN_MT19937: the 64 bit Mersenne Twister MT19937-64
+ * F2LIN_TINYMT64: the 64 bit Tiny Mersenne Twister with 127 bits of state
+ * F2LIN_XOSHIRO256PP: xoshiro256++
+ * F2LIN_SFMT19937: the SIMD-oriented Fast Mersenne Twister SFMT19937, 64 bit outputs
+ * F2LIN_DSFMT19937: the double precision SFMT dSFMT19937, 52 random bits per number
+ * F2LIN_WELL512A: WELL512a, two 32 bit outputs per number
+ * F2LIN_WELL1024A: WELL1024a, two 32 bit outputs per number
+ * F2LIN_XOROSHIRO128PP: xoroshiro128++
+ */
+enum F2LinRngType {
+    F2LIN_XORSHIFT64 = 0, F2LIN_MT19937 = 1, F2LIN_TINYMT64 = 2, F2LIN_XOSHIRO256PP = 3,
+    F2LIN_SFMT19937 = 4, F2LIN_DSFMT19937 = 5, F2LIN_WELL512A = 6, F2LIN_WELL1024A = 7,
+    F2LIN_XOROSHIRO128PP = 8,
+};
+
+#define F2LIN_RNG_TYPES 9
+
+/* generator used by the functions which don't take a type, e.g. f2lin_rng_init() */
+#ifndef RNG_TYPE_DEFAULT
+#define RNG_TYPE_DEFAULT F2LIN_MT19937
+#endif
 
 /**
  * Which algorithm to use for jumping ahead in the random number stream
  * Default is SLIDING_WINDOW.
+ *
+ * MATRIX precomputes the jump as a matrix acting on the state, and is only available for
+ * generators with at most MATRIX_STATE_MAX state bits.
  */
 enum F2LinJumpAlgorithm {
-    HORNER = 0, SLIDING_WINDOW = 1, SLIDING_WINDOW_DECOMP = 2, 
+    HORNER = 0, SLIDING_WINDOW = 1, SLIDING_WINDOW_DECOMP = 2, MATRIX = 3,
+};
+
+/**
+ * How to calculate the jump polynomial x^jump_size mod p.
+ * POWER_MOD exponentiates x for every jump size.
+ * POW2_TABLE multiplies the precomputed x^(2^k) mod p for every bit k set in jump_size.
+ * The table is computed once per generator.
+ * Default is POWER_MOD.
+ */
+enum F2LinJumpPolyMethod {
+    POWER_MOD = 0, POW2_TABLE = 1,
 };
 
 /**
  * Used for configuring the application.
- * q is the degree of the decomposition polynomials when using the sliding window method
+ * q is the degree of the decomposition polynomials when using the sliding window method,
+ * Q_AUTO chooses it from the state size of the generator and the cache sizes. It isn't 0,
+ * so a zero-initialized config still gets Q_DEFAULT.
  */
 typedef struct F2LinConfig F2LinConfig;
 
 struct F2LinConfig {
     enum F2LinJumpAlgorithm algorithm;
     int q;
+    enum F2LinJumpPolyMethod poly_method;
+};
+
+/**
+ * Counters of the process wide jump parameter cache, see f2lin_jump_cache_stats().
+ * bytes is the memory currently held by cached entries, limit and entry_limit the
+ * configured bounds of the bytes and the number of entries.
+ */
+typedef struct F2LinJumpCacheStats F2LinJumpCacheStats;
+
+struct F2LinJumpCacheStats {
+    uint64_t hits;
+    uint64_t misses;
+    uint64_t evictions;
+    size_t entries;
+    size_t bytes;
+    size_t limit;
+    size_t entry_limit;
+};
+
+/**
+ * A position in the stream of a generator, the number hi * 2^64 + lo of numbers it is
+ * ahead of the state it was tracked from, see f2lin_rng_track_at().
+ */
+typedef struct F2LinPosition F2LinPosition;
+
+struct F2LinPosition {
+    uint64_t hi;
+    uint64_t lo;
 };
 
 #endif
@@ -1,26 +1,286 @@
 #include <stdio.h>
 #include "f2lin.h"
+#include "advance.h"
+#include "f2poly.h"
 #include "jump_ahead.h"
+#include "jump_cache.h"
+#include "jump_file.h"
+#include "position.h"
+#include "substream.h"
+#include "tune.h"
+#include "simd.h"
 #include "rng_generic/rng_generic.h"
 
+/* numbers converted at once by the fill functions, small enough to stay in L1 */
+#define FILL_BLOCK 512
+
+_Static_assert(F2LIN_JUMP_WORK_ALIGN == SIMD_ALIGN, "workspaces are aligned like states");
+
+/* the bulk generation of a backend, looked up once per call of a fill function */
+typedef void GenN(F2LinRngGeneric* rng, size_t n, uint64_t* buf);
+
+/* Internal Declarations */
+static 
+int valid_at(enum F2LinRngType type, const void* mem);
+
+static 
+int tracked(const F2LinRngGeneric* rng);
+
 /* Header Implementations */
 F2LinRngGeneric* f2lin_rng_init() {
-    return f2lin_rng_generic_init();
+    return f2lin_rng_generic_init(RNG_TYPE_DEFAULT);
 }
 
 F2LinRngGeneric* f2lin_rng_init_seed(const uint64_t seed) {
-    return f2lin_rng_generic_init_seed(seed);
+    return f2lin_rng_generic_init_seed(RNG_TYPE_DEFAULT, seed);
+}
+
+F2LinRngGeneric* f2lin_rng_init_type(enum F2LinRngType type, const uint64_t seed) {
+    if (!f2lin_rng_generic_valid_type(type)) {
+        fprintf(stderr, "Invalid generator type: %d\n", type);
+        return 0;
+    }
+    return f2lin_rng_generic_init_seed(type, seed);
+}
+
+F2LinRngGeneric* f2lin_rng_init_stream(enum F2LinRngType type, size_t stream, 
+                                       const uint64_t seed) {
+    if (!f2lin_rng_generic_valid_type(type)) {
+        fprintf(stderr, "Invalid generator type: %d\n", type);
+        return 0;
+    }
+    if (stream >= f2lin_rng_generic_param_sets(type)) {
+        fprintf(stderr, "Invalid stream %zu, %s has %zu streams\n", stream, 
+                f2lin_rng_generic_name(type), f2lin_rng_generic_param_sets(type));
+        return 0;
+    }
+    return f2lin_rng_generic_init_param_set(type, stream, seed);
+}
+
+size_t f2lin_rng_streams(enum F2LinRngType type) {
+    return f2lin_rng_generic_valid_type(type) ? f2lin_rng_generic_param_sets(type) : 0;
+}
+
+size_t f2lin_rng_state_size(enum F2LinRngType type) {
+    return f2lin_rng_generic_valid_type(type) ? f2lin_rng_generic_sizeof(type) : 0;
+}
+
+size_t f2lin_rng_state_align(enum F2LinRngType type) {
+    return f2lin_rng_generic_valid_type(type) ? f2lin_rng_generic_alignof(type) : 0;
+}
+
+F2LinRngGeneric* f2lin_rng_init_at(enum F2LinRngType type, const uint64_t seed, void* mem) {
+    if (!valid_at(type, mem)) return 0;
+    return f2lin_rng_generic_init_seed_at(type, seed, mem);
+}
+
+F2LinRngGeneric* f2lin_rng_init_stream_at(enum F2LinRngType type, size_t stream, 
+                                          const uint64_t seed, void* mem) {
+    if (!valid_at(type, mem)) return 0;
+    if (stream >= f2lin_rng_generic_param_sets(type)) {
+        fprintf(stderr, "Invalid stream %zu, %s has %zu streams\n", stream, 
+                f2lin_rng_generic_name(type), f2lin_rng_generic_param_sets(type));
+        return 0;
+    }
+    return f2lin_rng_generic_init_param_set_at(type, stream, seed, mem);
+}
+
+size_t f2lin_rng_tracked_size(enum F2LinRngType type) {
+    return f2lin_rng_generic_valid_type(type) ? f2lin_position_sizeof(type) : 0;
+}
+
+F2LinRngGeneric* f2lin_rng_init_tracked(enum F2LinRngType type, const uint64_t seed) {
+    if (!f2lin_rng_generic_valid_type(type)) {
+        fprintf(stderr, "Invalid generator type: %d\n", type);
+        return 0;
+    }
+
+    // seeded in the memory of the tracked generator, which then tracks it in place
+    F2LinRngGeneric* rng = f2lin_rng_generic_init_seed_at(
+        type, seed, f2lin_simd_alloc(f2lin_position_sizeof(type)));
+    return f2lin_position_init_at(rng, rng);
+}
+
+F2LinRngGeneric* f2lin_rng_track_at(const F2LinRngGeneric* rng, void* mem) {
+    if (!rng) {
+        fprintf(stderr, "Trying to call f2lin_rng_track_at with an uninitialized pointer\n");
+        return 0;
+    }
+    if (!valid_at(f2lin_rng_generic_type(rng), mem)) return 0;
+    return f2lin_position_init_at(rng, mem);
+}
+
+int f2lin_position(const F2LinRngGeneric* rng, F2LinPosition* pos) {
+    if (!rng || !pos) {
+        fprintf(stderr, "Trying to call f2lin_position with uninitialized pointers\n");
+        return -1;
+    }
+    if (!tracked(rng)) return -1;
+
+    *pos = f2lin_position_track(rng)->pos;
+    return 0;
+}
+
+int f2lin_checkpoint(F2LinRngGeneric* rng) {
+    if (!rng) {
+        fprintf(stderr, "Trying to call f2lin_checkpoint with an uninitialized pointer\n");
+        return -1;
+    }
+    if (!tracked(rng)) return -1;
+
+    f2lin_position_reset(rng, rng, f2lin_position_track(rng)->pos);
+    return 0;
+}
+
+int f2lin_seek_abs(F2LinRngGeneric* rng, F2LinPosition n) {
+    if (!rng) {
+        fprintf(stderr, "Trying to call f2lin_seek_abs with an uninitialized pointer\n");
+        return -1;
+    }
+    if (!tracked(rng)) return -1;
+
+    return f2lin_position_seek(rng, n);
+}
+
+enum F2LinRngType f2lin_rng_type(const F2LinRngGeneric* rng) {
+    return f2lin_rng_generic_type(rng);
+}
+
+const char* f2lin_rng_type_name(enum F2LinRngType type) {
+    return f2lin_rng_generic_valid_type(type) ? f2lin_rng_generic_name(type) : 0;
 }
 
 F2LinJump* f2lin_jump_init(size_t jump_size, F2LinConfig* cfg) {
-    return f2lin_jump_ahead_init(jump_size, cfg);
+    return f2lin_jump_ahead_init(RNG_TYPE_DEFAULT, jump_size, cfg);
+}
+
+F2LinJump* f2lin_jump_init_type(enum F2LinRngType type, size_t jump_size, F2LinConfig* cfg) {
+    if (!f2lin_rng_generic_valid_type(type)) {
+        fprintf(stderr, "Invalid generator type: %d\n", type);
+        return 0;
+    }
+    return f2lin_jump_ahead_init(type, jump_size, cfg);
 }
 
-void f2lin_jump(F2LinRngGeneric* rng, F2LinJump* jump) {
+F2LinJump* f2lin_jump_init_rng(const F2LinRngGeneric* rng, size_t jump_size, 
+                               F2LinConfig* cfg) {
+    return f2lin_jump_ahead_init_rng(rng, jump_size, cfg);
+}
+
+void f2lin_jump(F2LinRngGeneric* rng, const F2LinJump* jump) {
     if (!rng || !jump) {
         fprintf(stderr, "Trying to call f2lin_jump with uninitialized pointers\n");
+        return;
+    }
+    if (f2lin_jump_ahead_jump(jump, rng)) f2lin_position_count(rng, jump->jump_size);
+}
+
+F2LinJumpWork* f2lin_jump_work_init(const F2LinJump* jump) {
+    if (!jump) {
+        fprintf(stderr, "Trying to call f2lin_jump_work_init with an uninitialized pointer\n");
+        return 0;
+    }
+    return f2lin_jump_ahead_work_init(jump->type, f2lin_jump_ahead_work_q(jump));
+}
+
+void f2lin_jump_with_work(F2LinRngGeneric* rng, const F2LinJump* jump, F2LinJumpWork* work) {
+    if (!rng || !jump || !work) {
+        fprintf(stderr, "Trying to call f2lin_jump_with_work with uninitialized pointers\n");
+        return;
+    }
+    if (f2lin_jump_ahead_jump_work(jump, rng, work)) {
+        f2lin_position_count(rng, jump->jump_size);
+    }
+}
+
+void f2lin_jump_work_destroy(F2LinJumpWork* work) {
+    f2lin_jump_ahead_work_destroy(work);
+}
+
+size_t f2lin_jump_work_size(const F2LinJump* jump) {
+    if (!jump) {
+        fprintf(stderr, "Trying to call f2lin_jump_work_size with an uninitialized pointer\n");
+        return 0;
+    }
+    return f2lin_jump_ahead_work_size(jump->type, f2lin_jump_ahead_work_q(jump));
+}
+
+F2LinJumpWork* f2lin_jump_work_init_at(const F2LinJump* jump, void* mem) {
+    if (!jump || !mem) {
+        fprintf(stderr, "Trying to call f2lin_jump_work_init_at with uninitialized pointers\n");
+        return 0;
+    }
+    if ((uintptr_t) mem % F2LIN_JUMP_WORK_ALIGN) {
+        fprintf(stderr, "Memory of a workspace has to be aligned to %d bytes\n", 
+                F2LIN_JUMP_WORK_ALIGN);
+        return 0;
+    }
+    return f2lin_jump_ahead_work_init_at(jump->type, f2lin_jump_ahead_work_q(jump), mem);
+}
+
+void f2lin_advance(F2LinRngGeneric* rng, size_t n) {
+    if (!rng) {
+        fprintf(stderr, "Trying to call f2lin_advance with an uninitialized pointer\n");
+        return;
+    }
+    f2lin_advance_rng(rng, n);
+    f2lin_position_count(rng, n);
+}
+
+F2LinSubstreamTable* f2lin_substreams_init(const F2LinRngGeneric* base, size_t stride, 
+                                           size_t ids, F2LinConfig* cfg) {
+    if (!base) {
+        fprintf(stderr, "Trying to call f2lin_substreams_init with an uninitialized pointer\n");
+        return 0;
     }
-    f2lin_jump_ahead_jump(jump, rng);
+    return f2lin_substream_table_init(base, stride, ids, cfg);
+}
+
+F2LinRngGeneric* f2lin_substream(const F2LinSubstreamTable* table, size_t id, 
+                                 F2LinRngGeneric* out) {
+    if (!table || !out) {
+        fprintf(stderr, "Trying to call f2lin_substream with uninitialized pointers\n");
+        return 0;
+    }
+    return f2lin_substream_table_position(table, id, out);
+}
+
+int f2lin_substream_range(const F2LinSubstreamTable* table, size_t first, size_t n, 
+                          void* mem) {
+    if (!table || !mem) {
+        fprintf(stderr, "Trying to call f2lin_substream_range with uninitialized pointers\n");
+        return -1;
+    }
+    if (!valid_at(f2lin_rng_generic_type(table->base), mem)) return -1;
+    return f2lin_substream_table_range(table, first, n, mem);
+}
+
+void f2lin_substreams_destroy(F2LinSubstreamTable* table) {
+    f2lin_substream_table_destroy(table);
+}
+
+const uint64_t* f2lin_jump_poly(const F2LinJump* jump, size_t* words) {
+    const F2LinPoly* p;
+
+    if (!jump || !words) {
+        fprintf(stderr, "Trying to call f2lin_jump_poly with uninitialized pointers\n");
+        return 0;
+    }
+
+    switch (jump->algorithm) {
+        case HORNER:
+            p = jump->jp.horner;
+            break;
+        case SLIDING_WINDOW:
+            p = jump->jp.sw.jp;
+            break;
+        default:
+            *words = 0;
+            return 0;
+    }
+
+    *words = p->len;
+    return p->w;
 }
 
 void f2lin_jump_destroy(F2LinJump *jump) {
@@ -29,6 +289,70 @@ void f2lin_jump_destroy(F2LinJump *jump) {
     }
 }
 
+int f2lin_jump_write(const F2LinJump* jump, const char* path) {
+    if (!jump || !path) {
+        fprintf(stderr, "Trying to call f2lin_jump_write with uninitialized pointers\n");
+        return -1;
+    }
+    return f2lin_jump_file_write(jump, path);
+}
+
+F2LinJump* f2lin_jump_read(const char* path) {
+    if (!path) {
+        fprintf(stderr, "Trying to call f2lin_jump_read with uninitialized pointer\n");
+        return 0;
+    }
+    return f2lin_jump_file_read(path);
+}
+
+int f2lin_tune(const char* path) {
+    return f2lin_tune_type(RNG_TYPE_DEFAULT, path);
+}
+
+int f2lin_tune_type(enum F2LinRngType type, const char* path) {
+    F2LinTuneProfile* profile;
+    int ret;
+
+    if (!path) {
+        fprintf(stderr, "Trying to call f2lin_tune with uninitialized pointer\n");
+        return -1;
+    }
+    if (!f2lin_rng_generic_valid_type(type)) {
+        fprintf(stderr, "Invalid generator type: %d\n", type);
+        return -1;
+    }
+
+    profile = f2lin_tune_profile_measure(type, TUNE_MIN_TIME_DEFAULT);
+    ret = f2lin_tune_profile_write(profile, path);
+    f2lin_tune_profile_destroy(profile);
+
+    return ret ? ret : f2lin_tune_profile_load(path);
+}
+
+int f2lin_tune_load(const char* path) {
+    return f2lin_tune_profile_load(path);
+}
+
+void f2lin_cache_set_limit(const size_t bytes) {
+    f2lin_jump_cache_set_limit(bytes);
+}
+
+void f2lin_cache_set_entry_limit(const size_t entries) {
+    f2lin_jump_cache_set_entry_limit(entries);
+}
+
+void f2lin_cache_stats(F2LinJumpCacheStats* stats) {
+    if (!stats) {
+        fprintf(stderr, "Trying to call f2lin_cache_stats with uninitialized pointer\n");
+        return;
+    }
+    f2lin_jump_cache_stats(stats);
+}
+
+void f2lin_cache_clear() {
+    f2lin_jump_cache_clear();
+}
+
 void f2lin_rng_destroy(F2LinRngGeneric* rng) {
     if (rng) { 
         f2lin_rng_generic_destroy(rng);
@@ -40,6 +364,7 @@ uint64_t f2lin_next_unsigned(F2LinRngGeneric* rng) {
         fprintf(stderr, "Trying to generate unsigned number with uninitialized rng\n");
         return -1;
     }
+    f2lin_position_count(rng, 1);
     return f2lin_rng_generic_gen64(rng);
 }
 
@@ -48,6 +373,7 @@ int64_t f2lin_next_signed(F2LinRngGeneric* rng) {
         fprintf(stderr, "Trying to generate signed number with uninitialized rng\n");
         return -1;
     }
+    f2lin_position_count(rng, 1);
     return (int64_t) f2lin_rng_generic_gen64(rng);
 }
 
@@ -57,5 +383,108 @@ double f2lin_next_double(F2LinRngGeneric* rng) {
         return -1;
     }
     uint64_t num = f2lin_rng_generic_gen64(rng);
+    f2lin_position_count(rng, 1);
     return (num >> 11) * (1.0/9007199254740992.0);
 }
+
+void f2lin_fill_u64(F2LinRngGeneric* rng, size_t n, uint64_t* buf) {
+    if (!rng || !buf) {
+        fprintf(stderr, "Trying to call f2lin_fill_u64 with uninitialized pointers\n");
+        return;
+    }
+    f2lin_rng_generic_gen_n_numbers(rng, n, buf);
+    f2lin_position_count(rng, n);
+}
+
+void f2lin_fill_double(F2LinRngGeneric* rng, size_t n, double* buf) {
+    uint64_t block[FILL_BLOCK];
+    GenN* gen_n;
+
+    if (!rng || !buf) {
+        fprintf(stderr, "Trying to call f2lin_fill_double with uninitialized pointers\n");
+        return;
+    }
+
+    gen_n = f2lin_rng_generic_backend(rng)->gen_n_numbers;
+    for (size_t i = 0, m; i < n; i += m) {
+        m = n - i < FILL_BLOCK ? n - i : FILL_BLOCK;
+        gen_n(rng, m, block);
+        f2lin_simd_u64_to_double(&buf[i], block, m);
+    }
+    f2lin_position_count(rng, n);
+}
+
+void f2lin_fill_double_open(F2LinRngGeneric* rng, size_t n, double* buf) {
+    uint64_t block[FILL_BLOCK];
+    GenN* gen_n;
+
+    if (!rng || !buf) {
+        fprintf(stderr, "Trying to call f2lin_fill_double_open with uninitialized pointers\n");
+        return;
+    }
+
+    gen_n = f2lin_rng_generic_backend(rng)->gen_n_numbers;
+    for (size_t i = 0, m; i < n; i += m) {
+        m = n - i < FILL_BLOCK ? n - i : FILL_BLOCK;
+        gen_n(rng, m, block);
+        f2lin_simd_u64_to_double_open(&buf[i], block, m);
+    }
+    f2lin_position_count(rng, n);
+}
+
+void f2lin_fill_float(F2LinRngGeneric* rng, size_t n, float* buf) {
+    uint64_t block[FILL_BLOCK];
+    float last[2];
+    GenN* gen_n;
+
+    if (!rng || !buf) {
+        fprintf(stderr, "Trying to call f2lin_fill_float with uninitialized pointers\n");
+        return;
+    }
+
+    // pairs of floats, i counts numbers in the stream
+    gen_n = f2lin_rng_generic_backend(rng)->gen_n_numbers;
+    for (size_t i = 0, m; i < n / 2; i += m) {
+        m = n / 2 - i < FILL_BLOCK ? n / 2 - i : FILL_BLOCK;
+        gen_n(rng, m, block);
+        f2lin_simd_u64_to_float(&buf[2 * i], block, m);
+    }
+
+    if (n % 2) {
+        gen_n(rng, 1, block);
+        f2lin_simd_u64_to_float(last, block, 1);
+        buf[n - 1] = last[0];
+    }
+    f2lin_position_count(rng, (n + 1) / 2);
+}
+
+/* Internal Implementations */
+
+// checks the arguments of the functions initializing generators in place
+static 
+int valid_at(enum F2LinRngType type, const void* mem) {
+    if (!f2lin_rng_generic_valid_type(type)) {
+        fprintf(stderr, "Invalid generator type: %d\n", type);
+        return 0;
+    }
+    if (!mem) {
+        fprintf(stderr, "Trying to initialize a generator in an uninitialized pointer\n");
+        return 0;
+    }
+    if ((uintptr_t) mem % f2lin_rng_generic_alignof(type)) {
+        fprintf(stderr, "Memory of a generator of type %s has to be aligned to %zu bytes\n",
+                f2lin_rng_generic_name(type), f2lin_rng_generic_alignof(type));
+        return 0;
+    }
+    return 1;
+}
+
+static 
+int tracked(const F2LinRngGeneric* rng) {
+    if (!rng->tracked) {
+        fprintf(stderr, "Generator of type %s doesn't track its position\n",
+                f2lin_rng_generic_name(f2lin_rng_generic_type(rng)));
+        return 0;
+    }
+    return 1;
+}
@@ -0,0 +1,162 @@
+#include <stdio.h>
+#include <string.h>
+
+#include "f2lin_lanes.h"
+#include "config.h"
+#include "jump_ahead.h"
+#include "simd.h"
+#include "rng_generic/rng_generic.h"
+
+/* numbers generated per lane before the lanes are jumped or the block is copied out */
+#define LANES_BLOCK 1024
+#define XOSHIRO_WORDS 4
+
+/**
+ * The state of all lanes as structure of arrays, see f2lin_simd_xoshiro_lanes(). 
+ * block holds the last LANES_BLOCK numbers of every lane in the order they are returned, 
+ * of which the ones from pos on haven't been returned yet.
+ */
+struct F2LinLanes {
+    enum F2LinLanesMode mode;
+    size_t lanes;
+    uint64_t* state;
+    uint64_t* block;
+    size_t pos;
+    // INTERLEAVED: jumps a lane over the blocks of all other lanes
+    F2LinJump* skip;
+    F2LinRngGeneric* tmp;
+};
+
+/*------------------------------------------------------
+ * Forward Declarations                                |
+ /----------------------------------------------------*/
+
+static
+void load_lane(F2LinLanes* l, size_t i, const F2LinRngGeneric* rng);
+
+static
+void store_lane(const F2LinLanes* l, size_t i, F2LinRngGeneric* rng);
+
+static
+void refill(F2LinLanes* l);
+
+/*------------------------------------------------------
+ * Header Implementations                              |
+ /----------------------------------------------------*/
+
+F2LinLanes* f2lin_lanes_init(const F2LinRngGeneric* base, size_t lanes, 
+                             enum F2LinLanesMode mode, size_t substream_size) {
+    // jumps by the same size are repeated for every lane, so they should be cheap
+    F2LinConfig cfg = { .algorithm = MATRIX, .q = Q_AUTO, .poly_method = POWER_MOD };
+    F2LinLanes* l;
+    F2LinJump* jump;
+
+    if (f2lin_rng_generic_type(base) != F2LIN_XOSHIRO256PP) {
+        fprintf(stderr, "Lanes are only available for xoshiro256\n");
+        return 0;
+    }
+    if (mode != SUBSTREAMS && mode != INTERLEAVED) {
+        fprintf(stderr, "Invalid lanes mode: %d\n", mode);
+        return 0;
+    }
+    if (mode == SUBSTREAMS && !substream_size) {
+        fprintf(stderr, "Substreams of lanes have to be larger than 0\n");
+        return 0;
+    }
+
+    // lane i starts at i * substream_size, or at the i-th block
+    jump = f2lin_jump_ahead_init(F2LIN_XOSHIRO256PP, 
+                                 mode == SUBSTREAMS ? substream_size : LANES_BLOCK, &cfg);
+    if (!jump) {
+        fprintf(stderr, "Unable to initialize the jump between the lanes\n");
+        return 0;
+    }
+
+    l = calloc(1, sizeof(F2LinLanes));
+    l->mode = mode;
+    l->lanes = lanes ? lanes : f2lin_simd_xoshiro_width();
+    l->state = f2lin_simd_alloc(XOSHIRO_WORDS * l->lanes * sizeof(uint64_t));
+    l->block = f2lin_simd_alloc(LANES_BLOCK * l->lanes * sizeof(uint64_t));
+    l->pos = LANES_BLOCK * l->lanes;
+    l->tmp = f2lin_rng_generic_copy(f2lin_rng_generic_init_zero(F2LIN_XOSHIRO256PP), base);
+
+    for (size_t i = 0; i < l->lanes; ++i) {
+        load_lane(l, i, l->tmp);
+        f2lin_jump_ahead_jump(jump, l->tmp);
+    }
+    f2lin_jump_ahead_destroy(jump);
+
+    if (mode == INTERLEAVED) {
+        l->skip = f2lin_jump_ahead_init(F2LIN_XOSHIRO256PP, (l->lanes - 1) * LANES_BLOCK, 
+                                        &cfg);
+        if (!l->skip) {
+            fprintf(stderr, "Unable to initialize the jump over the other lanes\n");
+            f2lin_lanes_destroy(l);
+            return 0;
+        }
+    }
+
+    return l;
+}
+
+void f2lin_lanes_fill_u64(F2LinLanes* l, size_t n, uint64_t* buf) {
+    const size_t total = LANES_BLOCK * l->lanes;
+
+    for (size_t j = 0, m; j < n; j += m) {
+        if (l->pos == total) refill(l);
+        m = n - j < total - l->pos ? n - j : total - l->pos;
+
+        memcpy(&buf[j], &l->block[l->pos], m * sizeof(uint64_t));
+        l->pos += m;
+    }
+}
+
+size_t f2lin_lanes_count(const F2LinLanes* l) {
+    return l->lanes;
+}
+
+void f2lin_lanes_destroy(F2LinLanes* l) {
+    if (!l) return;
+
+    if (l->skip) f2lin_jump_ahead_destroy(l->skip);
+    f2lin_rng_generic_destroy(l->tmp);
+    free(l->state);
+    free(l->block);
+    free(l);
+}
+
+/*------------------------------------------------------
+ * Internal Implementations                            |
+ /----------------------------------------------------*/
+
+static
+void load_lane(F2LinLanes* l, size_t i, const F2LinRngGeneric* rng) {
+    uint64_t words[XOSHIRO_WORDS];
+
+    f2lin_rng_generic_get_state(rng, words);
+    for (size_t w = 0; w < XOSHIRO_WORDS; ++w) l->state[w * l->lanes + i] = words[w];
+}
+
+static
+void store_lane(const F2LinLanes* l, size_t i, F2LinRngGeneric* rng) {
+    uint64_t words[XOSHIRO_WORDS];
+
+    for (size_t w = 0; w < XOSHIRO_WORDS; ++w) words[w] = l->state[w * l->lanes + i];
+    f2lin_rng_generic_set_state(rng, words);
+}
+
+static
+void refill(F2LinLanes* l) {
+    // for INTERLEAVED, the block of every lane is one consecutive part of the stream
+    f2lin_simd_xoshiro_lanes(l->state, l->lanes, LANES_BLOCK, l->block, l->mode == INTERLEAVED);
+
+    // every lane continues after the blocks generated by the other lanes
+    if (l->mode == INTERLEAVED) {
+        for (size_t i = 0; i < l->lanes; ++i) {
+            store_lane(l, i, l->tmp);
+            f2lin_jump_ahead_jump(l->skip, l->tmp);
+            load_lane(l, i, l->tmp);
+        }
+    }
+    l->pos = 0;
+}
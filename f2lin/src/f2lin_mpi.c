@@ -0,0 +1,334 @@
+#include <limits.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "f2lin_mpi.h"
+#include "advance.h"
+#include "jump_ahead.h"
+#include "jump_file.h"
+#include "position.h"
+#include "rng_generic/rng_generic.h"
+
+/**
+ * The serialized parameters of all jumps, as sent from rank 0. 
+ * buf starts with n and the offsets of the n + 1 serialized jumps, all as 64 bit words.
+ * The memory is either a shared window or a buffer owned by this rank. It is freed once 
+ * all jumps attached to it were destroyed.
+ */
+typedef struct F2LinMPIShared F2LinMPIShared;
+struct F2LinMPIShared {
+    enum F2LinMPIShare share;
+    uint64_t* buf;
+    size_t refs;
+    MPI_Win win;
+    MPI_Comm node;
+};
+
+struct F2LinMPIJumpTable {
+    int rank;
+    size_t n;
+    F2LinJump** jumps;
+};
+
+/*------------------------------------------------------
+ * Forward Declarations                                |
+ /----------------------------------------------------*/
+
+static
+F2LinJump** share_jumps(enum F2LinRngType type, size_t n, const size_t jump_sizes[n], 
+                        F2LinConfig* cfg, enum F2LinMPIShare share, MPI_Comm comm);
+
+static
+void jump_received(F2LinRngGeneric* rng, F2LinMPIJumpTable* table, size_t k, size_t count,
+                   MPI_Comm comm);
+
+static
+uint64_t* serialize_jumps(enum F2LinRngType type, size_t n, const size_t jump_sizes[n], 
+                          F2LinConfig* cfg, size_t* len);
+
+static
+F2LinMPIShared* shared_window(uint64_t* root_buf, size_t len, MPI_Comm comm);
+
+static
+F2LinMPIShared* broadcast(uint64_t* root_buf, size_t len, MPI_Comm comm);
+
+static
+void bcast_bytes(void* buf, size_t len, MPI_Comm comm);
+
+static
+void release_shared(void* shared);
+
+/*------------------------------------------------------
+ * Header Implementations                              |
+ /----------------------------------------------------*/
+
+F2LinJump* f2lin_mpi_jump_init(enum F2LinRngType type, size_t jump_size, F2LinConfig* cfg, 
+                               enum F2LinMPIShare share, MPI_Comm comm) {
+    F2LinJump** jumps = share_jumps(type, 1, &jump_size, cfg, share, comm);
+    F2LinJump* jump = jumps[0];
+
+    free(jumps);
+    return jump;
+}
+
+F2LinMPIJumpTable* f2lin_mpi_jump_table_init(enum F2LinRngType type, size_t jump_size, 
+                                             F2LinConfig* cfg, enum F2LinMPIShare share, 
+                                             MPI_Comm comm) {
+    F2LinMPIJumpTable* table = calloc(1, sizeof(F2LinMPIJumpTable));
+    size_t jump_sizes[sizeof(size_t) * CHAR_BIT];
+    int size;
+
+    MPI_Comm_rank(comm, &table->rank);
+    MPI_Comm_size(comm, &size);
+
+    // enough jumps to represent the highest rank
+    while (((size_t) (size - 1)) >> table->n) {
+        if (jump_size > (SIZE_MAX >> table->n)) {
+            fprintf(stderr, "Jump size %zu is too large for %d ranks\n", jump_size, size);
+            MPI_Abort(comm, EXIT_FAILURE);
+        }
+        jump_sizes[table->n] = jump_size << table->n;
+        ++table->n;
+    }
+
+    table->jumps = share_jumps(type, table->n, jump_sizes, cfg, share, comm);
+
+    return table;
+}
+
+void f2lin_mpi_jump_rank(F2LinRngGeneric* rng, F2LinMPIJumpTable* table) {
+    for (size_t k = 0; k < table->n; ++k) {
+        if ((table->rank >> k) & 1) f2lin_jump_ahead_jump(table->jumps[k], rng);
+    }
+}
+
+void f2lin_mpi_exscan_position(MPI_Comm comm, size_t count, F2LinRngGeneric* rng) {
+    F2LinMPIJumpTable* table;
+    uint64_t position = 0, min_count, msg_position;
+    const enum F2LinRngType type = f2lin_rng_generic_type(rng);
+    const int rng_bytes = (int) f2lin_rng_generic_sizeof(type);
+    const uint32_t tracked = rng->tracked;
+    F2LinPosition origin = { 0, 0 };
+    int rank, size, default_params;
+
+    MPI_Comm_rank(comm, &rank);
+    MPI_Comm_size(comm, &size);
+
+    // MPI_Exscan leaves the result undefined on rank 0
+    MPI_Exscan(&(uint64_t) { count }, &position, 1, MPI_UINT64_T, MPI_SUM, comm);
+    if (rank == 0) position = 0;
+    MPI_Allreduce(&(uint64_t) { count }, &min_count, 1, MPI_UINT64_T, MPI_MIN, comm);
+
+    // tracked generators continue from the position of the one of rank 0
+    if (rank == 0 && tracked) origin = f2lin_position_track(rng)->pos;
+    MPI_Bcast(&origin, 2, MPI_UINT64_T, 0, comm);
+
+    // the shared jumps only fit the default parameters, see jump_received()
+    if (rank == 0) default_params = f2lin_rng_generic_default_params(rng);
+    MPI_Bcast(&default_params, 1, MPI_INT, 0, comm);
+
+    // the ranks in [0, 2^k) are positioned after round k and send to rank + 2^k,
+    // which is at least min_count * 2^k numbers ahead of them
+    table = default_params ? f2lin_mpi_jump_table_init(type, min_count, 0, SHARED_WINDOW, comm)
+                           : 0;
+
+    for (size_t k = 0; ((size_t) 1 << k) < (size_t) size; ++k) {
+        const int step = 1 << k;
+
+        if (rank < step && rank + step < size) {
+            MPI_Send(&position, 1, MPI_UINT64_T, rank + step, 0, comm);
+            MPI_Send(rng, rng_bytes, MPI_BYTE, rank + step, 1, comm);
+        } else if (rank >= step && rank < 2 * step) {
+            MPI_Recv(&msg_position, 1, MPI_UINT64_T, rank - step, 0, comm, MPI_STATUS_IGNORE);
+            MPI_Recv(rng, rng_bytes, MPI_BYTE, rank - step, 1, comm, MPI_STATUS_IGNORE);
+            // only the state is sent, whether the generator is tracked stays the same
+            rng->tracked = tracked;
+
+            if (min_count) jump_received(rng, table, k, min_count, comm);
+            f2lin_advance_rng(rng, position - msg_position - ((uint64_t) min_count << k));
+        }
+    }
+
+    if (rank && tracked) f2lin_position_reset(rng, rng, f2lin_position_add(origin, position));
+    f2lin_mpi_jump_table_destroy(table);
+}
+
+void f2lin_mpi_jump_table_destroy(F2LinMPIJumpTable* table) {
+    if (!table) return;
+
+    for (size_t k = 0; k < table->n; ++k) f2lin_jump_ahead_destroy(table->jumps[k]);
+    free(table->jumps);
+    free(table);
+}
+
+/*------------------------------------------------------
+ * Internal Implementations                            |
+ /----------------------------------------------------*/
+
+static
+F2LinJump** share_jumps(enum F2LinRngType type, size_t n, const size_t jump_sizes[n], 
+                        F2LinConfig* cfg, enum F2LinMPIShare share, MPI_Comm comm) {
+    F2LinJump** jumps = calloc(n ? n : 1, sizeof(F2LinJump*));
+    F2LinMPIShared* shared;
+    uint64_t* root_buf = 0;
+    size_t len = 0;
+    int rank;
+
+    MPI_Comm_rank(comm, &rank);
+
+    if (rank == 0) root_buf = serialize_jumps(type, n, jump_sizes, cfg, &len);
+    MPI_Bcast(&len, 1, MPI_UINT64_T, 0, comm); // size_t is 64 bit, see jump_file.c
+
+    shared = share == BROADCAST ? broadcast(root_buf, len, comm) 
+                                : shared_window(root_buf, len, comm);
+    free(root_buf);
+
+    shared->refs = n;
+    for (size_t i = 0; i < n; ++i) {
+        const uint64_t begin = shared->buf[1 + i], end = shared->buf[2 + i];
+
+        jumps[i] = f2lin_jump_file_attach((char*) shared->buf + begin, end - begin, 
+                                          release_shared, shared);
+        if (!jumps[i]) {
+            fprintf(stderr, "Received invalid jump parameters on rank %d\n", rank);
+            MPI_Abort(comm, EXIT_FAILURE);
+        }
+    }
+    if (n == 0) release_shared(shared);
+
+    return jumps;
+}
+
+// jumps the generator received in round k by count * 2^k. Without a table the generator has
+// parameters other than the default ones, which the jump is computed for on this rank.
+// Every rank receives only once, so this is a single jump per rank as well
+static
+void jump_received(F2LinRngGeneric* rng, F2LinMPIJumpTable* table, size_t k, size_t count,
+                   MPI_Comm comm) {
+    F2LinJump* jump;
+    F2LinRngGeneric* jumped;
+    int rank;
+
+    MPI_Comm_rank(comm, &rank);
+
+    if (table) {
+        jump = table->jumps[k];
+    } else if (count > (SIZE_MAX >> k)) {
+        fprintf(stderr, "Jump size %zu is too large for rank %d\n", count, rank);
+        MPI_Abort(comm, EXIT_FAILURE);
+        return;
+    } else {
+        jump = f2lin_jump_ahead_init_rng(rng, count << k, 0);
+    }
+
+    jumped = f2lin_jump_ahead_jump(jump, rng);
+    if (!table) f2lin_jump_ahead_destroy(jump);
+
+    if (!jumped) {
+        fprintf(stderr, "Unable to position the generator of rank %d\n", rank);
+        MPI_Abort(comm, EXIT_FAILURE);
+    }
+}
+
+static
+uint64_t* serialize_jumps(enum F2LinRngType type, size_t n, const size_t jump_sizes[n], 
+                          F2LinConfig* cfg, size_t* len) {
+    F2LinJump** jumps = malloc((n ? n : 1) * sizeof(F2LinJump*));
+    uint64_t* buf;
+    size_t offset = (n + 2) * sizeof(uint64_t);
+
+    for (size_t i = 0; i < n; ++i) {
+        jumps[i] = f2lin_jump_ahead_init(type, jump_sizes[i], cfg);
+        offset += f2lin_jump_file_size(jumps[i]);
+    }
+
+    *len = offset;
+    buf = malloc(*len);
+    buf[0] = n;
+    offset = (n + 2) * sizeof(uint64_t);
+
+    // the serialized jumps are multiples of 8 bytes long, so every one stays aligned
+    for (size_t i = 0; i < n; ++i) {
+        buf[1 + i] = offset;
+        f2lin_jump_file_serialize(jumps[i], (char*) buf + offset);
+        offset += f2lin_jump_file_size(jumps[i]);
+        f2lin_jump_ahead_destroy(jumps[i]);
+    }
+    buf[1 + n] = offset;
+
+    free(jumps);
+    return buf;
+}
+
+static
+F2LinMPIShared* shared_window(uint64_t* root_buf, size_t len, MPI_Comm comm) {
+    F2LinMPIShared* shared = calloc(1, sizeof(F2LinMPIShared));
+    MPI_Comm leaders;
+    MPI_Aint size;
+    int disp_unit, node_rank;
+
+    shared->share = SHARED_WINDOW;
+
+    // rank 0 of comm is also rank 0 of its node, since ranks keep their order
+    MPI_Comm_split_type(comm, MPI_COMM_TYPE_SHARED, 0, MPI_INFO_NULL, &shared->node);
+    MPI_Comm_rank(shared->node, &node_rank);
+    MPI_Comm_split(comm, node_rank == 0 ? 0 : MPI_UNDEFINED, 0, &leaders);
+
+    MPI_Win_allocate_shared(node_rank == 0 ? len : 0, 1, MPI_INFO_NULL, shared->node, 
+                            &shared->buf, &shared->win);
+    MPI_Win_shared_query(shared->win, 0, &size, &disp_unit, &shared->buf);
+    MPI_Win_lock_all(MPI_MODE_NOCHECK, shared->win);
+
+    // only one rank per node receives the parameters
+    if (node_rank == 0) {
+        if (root_buf) memcpy(shared->buf, root_buf, len);
+        bcast_bytes(shared->buf, len, leaders);
+        MPI_Comm_free(&leaders);
+    }
+
+    MPI_Win_sync(shared->win);
+    MPI_Barrier(shared->node);
+    MPI_Win_sync(shared->win);
+
+    return shared;
+}
+
+static
+F2LinMPIShared* broadcast(uint64_t* root_buf, size_t len, MPI_Comm comm) {
+    F2LinMPIShared* shared = calloc(1, sizeof(F2LinMPIShared));
+
+    shared->share = BROADCAST;
+    shared->buf = malloc(len);
+    if (root_buf) memcpy(shared->buf, root_buf, len);
+    bcast_bytes(shared->buf, len, comm);
+
+    return shared;
+}
+
+static
+void bcast_bytes(void* buf, size_t len, MPI_Comm comm) {
+    // counts are int, so larger buffers are sent in chunks
+    for (size_t sent = 0; sent < len; sent += INT_MAX) {
+        const size_t count = len - sent < INT_MAX ? len - sent : INT_MAX;
+        MPI_Bcast((char*) buf + sent, (int) count, MPI_BYTE, 0, comm);
+    }
+}
+
+static
+void release_shared(void* p) {
+    F2LinMPIShared* shared = p;
+
+    if (shared->refs > 1) {
+        --shared->refs;
+        return;
+    }
+
+    if (shared->share == SHARED_WINDOW) {
+        MPI_Win_unlock_all(shared->win);
+        MPI_Win_free(&shared->win);
+        MPI_Comm_free(&shared->node);
+    } else {
+        free(shared->buf);
+    }
+    free(shared);
+}
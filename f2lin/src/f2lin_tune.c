@@ -0,0 +1,30 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "f2lin.h"
+
+/**
+ * Measures the jump algorithms for the generator named on the command line and writes the 
+ * tuning profile, which is loaded by setting F2LIN_TUNE_PROFILE to its path.
+ */
+int main(int argc, char* argv[argc + 1]) {
+    if (argc < 3) {
+        printf("Usage: tune rng profile\n");
+        printf("rng: one of");
+        for (int t = 0; t < F2LIN_RNG_TYPES; ++t) printf(" %s", f2lin_rng_type_name(t));
+        printf("\nprofile: path the tuning profile is written to\n");
+        return EXIT_FAILURE;
+    }
+
+    for (int t = 0; t < F2LIN_RNG_TYPES; ++t) {
+        if (strcmp(argv[1], f2lin_rng_type_name(t))) continue;
+        if (f2lin_tune_type(t, argv[2])) return EXIT_FAILURE;
+
+        printf("wrote tuning profile for %s to %s\n", argv[1], argv[2]);
+        return EXIT_SUCCESS;
+    }
+
+    fprintf(stderr, "Unknown generator: %s\n", argv[1]);
+    return EXIT_FAILURE;
+}
@@ -0,0 +1,761 @@
+#include <string.h>
+#include <stdio.h>
+#include <pthread.h>
+
+#include "f2poly.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define F2POLY_PCLMUL
+#endif
+
+/* operands with less words than this are multiplied with the schoolbook method */
+#define KARATSUBA_THRESHOLD 16
+
+/* number of words needed to store a polynomial of degree deg */
+#define WORDS(deg) (((size_t) (deg) >> 6) + 1)
+
+/* multiplies a (na words) with b (nb words) and writes all na + nb words into r */
+typedef void mul_basecase_fn(uint64_t* r, const uint64_t* a, size_t na,
+                             const uint64_t* b, size_t nb);
+
+/*------------------------------------------------------
+ * Forward Declarations                                |
+ /----------------------------------------------------*/
+
+static
+size_t norm_len(const uint64_t* w, size_t len);
+
+static
+long deg_words(const uint64_t* w, size_t len);
+
+static
+size_t shr_words(uint64_t* dest, const uint64_t* src, size_t len, long bits);
+
+static
+size_t sqr_words(uint64_t* r, const uint64_t* a, size_t len);
+
+static
+void mul_words(uint64_t* r, const uint64_t* a, size_t na,
+               const uint64_t* b, size_t nb, uint64_t* scratch);
+
+static
+void mul_karatsuba(uint64_t* r, const uint64_t* a, const uint64_t* b, size_t n,
+                   uint64_t* scratch);
+
+static
+void mul_basecase_portable(uint64_t* r, const uint64_t* a, size_t na,
+                           const uint64_t* b, size_t nb);
+
+#ifdef F2POLY_PCLMUL
+static
+void mul_basecase_pclmul(uint64_t* r, const uint64_t* a, size_t na,
+                         const uint64_t* b, size_t nb);
+#endif
+
+static
+size_t rem_words(uint64_t* r, uint64_t* a, size_t la, const F2LinPolyMod* F,
+                 uint64_t* scratch);
+
+static
+size_t rem_long_division(uint64_t* a, size_t la, const F2LinPoly* f);
+
+static
+void div_long(F2LinPoly* q, const F2LinPoly* a, const F2LinPoly* f);
+
+static
+size_t scratch_words(const F2LinPolyMod* F);
+
+static
+void sqr_mod_scratch(F2LinPoly* r, const F2LinPoly* a, const F2LinPolyMod* F,
+                     uint64_t* scratch);
+
+static
+void mul_mod_scratch(F2LinPoly* r, const F2LinPoly* a, const F2LinPoly* b,
+                     const F2LinPolyMod* F, uint64_t* scratch);
+
+static
+void mul_x_mod(F2LinPoly* r, const F2LinPolyMod* F);
+
+static
+void select_mul_basecase();
+
+static
+uint64_t bits_at(const uint64_t* w, size_t pos);
+
+static
+void xor_shifted(uint64_t* r, const uint64_t* a, size_t len, size_t shift);
+
+// chosen once depending on the cpu, see select_mul_basecase()
+static mul_basecase_fn* mul_basecase = 0;
+static pthread_once_t mul_basecase_once = PTHREAD_ONCE_INIT;
+
+/*------------------------------------------------------
+ * Header Implementations                              |
+ /----------------------------------------------------*/
+
+F2LinPoly* f2lin_poly_init() {
+    return calloc(1, sizeof(F2LinPoly));
+}
+
+F2LinPoly* f2lin_poly_init_from_string(const char* s) {
+    F2LinPoly* p = f2lin_poly_init();
+    size_t len = strlen(s);
+
+    f2lin_poly_reserve(p, WORDS(len));
+    for (size_t i = 0; i < len; ++i) {
+        if (s[i] == '1') p->w[i >> 6] |= 1ull << (i & 63);
+    }
+    p->len = norm_len(p->w, WORDS(len));
+
+    return p;
+}
+
+void f2lin_poly_destroy(F2LinPoly* p) {
+    if (!p) return;
+    free(p->w);
+    free(p);
+}
+
+void f2lin_poly_reserve(F2LinPoly* p, size_t words) {
+    if (words <= p->cap) return;
+    p->w = realloc(p->w, words * sizeof(uint64_t));
+    memset(p->w + p->cap, 0, (words - p->cap) * sizeof(uint64_t));
+    p->cap = words;
+}
+
+long f2lin_poly_deg(const F2LinPoly* p) {
+    return deg_words(p->w, p->len);
+}
+
+void f2lin_poly_set_coeff(F2LinPoly* p, long i, int a) {
+    size_t k = (size_t) i >> 6;
+
+    if (a & 1) {
+        if (k >= p->len) {
+            f2lin_poly_reserve(p, k + 1);
+            memset(p->w + p->len, 0, (k + 1 - p->len) * sizeof(uint64_t));
+            p->len = k + 1;
+        }
+        p->w[k] |= 1ull << (i & 63);
+    } else if (k < p->len) {
+        p->w[k] &= ~(1ull << (i & 63));
+        p->len = norm_len(p->w, p->len);
+    }
+}
+
+void f2lin_poly_set_zero(F2LinPoly* p) {
+    p->len = 0;
+}
+
+F2LinPoly* f2lin_poly_copy(F2LinPoly* dest, const F2LinPoly* src) {
+    if (dest == src) return dest;
+    f2lin_poly_reserve(dest, src->len);
+    if (src->len) memcpy(dest->w, src->w, src->len * sizeof(uint64_t));
+    dest->len = src->len;
+    return dest;
+}
+
+int f2lin_poly_equal(const F2LinPoly* a, const F2LinPoly* b) {
+    return a->len == b->len &&
+           (!a->len || !memcmp(a->w, b->w, a->len * sizeof(uint64_t)));
+}
+
+void f2lin_poly_add(F2LinPoly* r, const F2LinPoly* a, const F2LinPoly* b) {
+    const F2LinPoly* l = a->len >= b->len ? a : b;
+    const F2LinPoly* s = a->len >= b->len ? b : a;
+    size_t i = 0, len = l->len;
+
+    // r might alias s, so read everything from s before touching r->w
+    f2lin_poly_reserve(r, len);
+    for (; i < s->len; ++i) r->w[i] = l->w[i] ^ s->w[i];
+    if (r != l) for (; i < len; ++i) r->w[i] = l->w[i];
+    r->len = norm_len(r->w, len);
+}
+
+void f2lin_poly_mul(F2LinPoly* r, const F2LinPoly* a, const F2LinPoly* b) {
+    size_t n = a->len + b->len;
+    size_t m = a->len < b->len ? a->len : b->len;
+    uint64_t* buf;
+    uint64_t* scratch;
+
+    if (!a->len || !b->len) {
+        r->len = 0;
+        return;
+    }
+
+    buf = malloc(n * sizeof(uint64_t));
+    scratch = malloc((12 * m + 64) * sizeof(uint64_t));
+    mul_words(buf, a->w, a->len, b->w, b->len, scratch);
+
+    free(r->w);
+    r->w = buf;
+    r->cap = n;
+    r->len = norm_len(buf, n);
+    free(scratch);
+}
+
+void f2lin_poly_sqr(F2LinPoly* r, const F2LinPoly* a) {
+    size_t n = 2 * a->len;
+    uint64_t* buf = malloc((n ? n : 1) * sizeof(uint64_t));
+
+    n = sqr_words(buf, a->w, a->len);
+    free(r->w);
+    r->w = buf;
+    r->cap = 2 * a->len;
+    r->len = n;
+}
+
+F2LinPolyMod* f2lin_poly_mod_init(const F2LinPoly* f) {
+    F2LinPolyMod* F = calloc(1, sizeof(F2LinPolyMod));
+    F2LinPoly* x2n = f2lin_poly_init();
+
+    F->n = f2lin_poly_deg(f);
+    F->f = f2lin_poly_copy(f2lin_poly_init(), f);
+    F->mu = f2lin_poly_init();
+
+    if (F->n < 1) {
+        fprintf(stderr, "Modulus needs to have a degree of at least 1\n");
+        f2lin_poly_destroy(x2n);
+        return F;
+    }
+
+    // mu = floor(x^(2n) / f)
+    f2lin_poly_set_coeff(x2n, 2 * F->n, 1);
+    div_long(F->mu, x2n, F->f);
+
+    f2lin_poly_destroy(x2n);
+    return F;
+}
+
+void f2lin_poly_mod_destroy(F2LinPolyMod* F) {
+    if (!F) return;
+    f2lin_poly_destroy(F->f);
+    f2lin_poly_destroy(F->mu);
+    free(F);
+}
+
+void f2lin_poly_rem(F2LinPoly* r, const F2LinPoly* a, const F2LinPolyMod* F) {
+    uint64_t* scratch = malloc((scratch_words(F) + 2 * a->len) * sizeof(uint64_t));
+    uint64_t* buf = scratch + scratch_words(F);
+    size_t len = a->len;
+
+    if (len) memcpy(buf, a->w, len * sizeof(uint64_t));
+
+    if (deg_words(buf, len) >= 2 * F->n) len = rem_long_division(buf, len, F->f);
+
+    f2lin_poly_reserve(r, WORDS(F->n));
+    r->len = rem_words(r->w, buf, len, F, scratch);
+    free(scratch);
+}
+
+void f2lin_poly_mul_mod(F2LinPoly* r, const F2LinPoly* a, const F2LinPoly* b,
+                        const F2LinPolyMod* F) {
+    uint64_t* scratch = malloc(scratch_words(F) * sizeof(uint64_t));
+    mul_mod_scratch(r, a, b, F, scratch);
+    free(scratch);
+}
+
+void f2lin_poly_sqr_mod(F2LinPoly* r, const F2LinPoly* a, const F2LinPolyMod* F) {
+    uint64_t* scratch = malloc(scratch_words(F) * sizeof(uint64_t));
+    sqr_mod_scratch(r, a, F, scratch);
+    free(scratch);
+}
+
+void f2lin_poly_power_mod(F2LinPoly* r, const F2LinPoly* a, uint64_t e,
+                          const F2LinPolyMod* F) {
+    uint64_t* scratch;
+    F2LinPoly* base;
+
+    if (!e) {
+        f2lin_poly_set_zero(r);
+        f2lin_poly_set_coeff(r, 0, 1);
+        return;
+    }
+
+    scratch = malloc(scratch_words(F) * sizeof(uint64_t));
+    base = f2lin_poly_copy(f2lin_poly_init(), a);
+
+    // left to right binary exponentiation, starting with the highest set bit
+    f2lin_poly_copy(r, base);
+    for (int i = 62 - __builtin_clzll(e); i >= 0; --i) {
+        sqr_mod_scratch(r, r, F, scratch);
+        if ((e >> i) & 1) mul_mod_scratch(r, r, base, F, scratch);
+    }
+
+    f2lin_poly_destroy(base);
+    free(scratch);
+}
+
+void f2lin_poly_power_x_mod(F2LinPoly* r, uint64_t e, const F2LinPolyMod* F) {
+    uint64_t* scratch;
+    uint64_t v = 0;
+    int i;
+
+    f2lin_poly_set_zero(r);
+    f2lin_poly_reserve(r, WORDS(F->n));
+
+    if (e < (uint64_t) F->n) {
+        f2lin_poly_set_coeff(r, (long) e, 1);
+        return;
+    }
+
+    // x^v needs no reduction as long as v < n, so we can skip the first squarings
+    for (i = 63 - __builtin_clzll(e); i >= 0 && ((v << 1) | ((e >> i) & 1)) < (uint64_t) F->n; --i) {
+        v = (v << 1) | ((e >> i) & 1);
+    }
+    f2lin_poly_set_coeff(r, (long) v, 1);
+
+    scratch = malloc(scratch_words(F) * sizeof(uint64_t));
+    for (; i >= 0; --i) {
+        sqr_mod_scratch(r, r, F, scratch);
+        if ((e >> i) & 1) mul_x_mod(r, F);
+    }
+    free(scratch);
+}
+
+char* f2lin_poly_to_string(const F2LinPoly* p) {
+    const long deg = f2lin_poly_deg(p);
+    char* s = malloc(deg + 2);
+
+    for (long i = 0; i <= deg; ++i) s[i] = f2lin_poly_coeff(p, i) ? '1' : '0';
+    s[deg + 1] = 0;
+
+    return s;
+}
+
+// berlekamp-massey, with the connection polynomials c and b packed into words. The 
+// discrepancy of step k is the parity of c AND s_k, s_(k-1), .., which is a contiguous 
+// window of the reversed sequence, so both it and the update c += x^m * b take one 
+// operation per word of c.
+F2LinPoly* f2lin_poly_min_poly_seq(const uint64_t* seq, size_t n) {
+    const size_t words = WORDS(n) + 1;
+    uint64_t* rev = calloc(words + 1, sizeof(uint64_t));
+    uint64_t* c = calloc(words, sizeof(uint64_t));
+    uint64_t* b = calloc(words, sizeof(uint64_t));
+    uint64_t* t = calloc(words, sizeof(uint64_t));
+    uint64_t* swap;
+    size_t l = 0, m = 1, lb = 0;
+    F2LinPoly* p = f2lin_poly_init();
+
+    // bit j of rev is s_(n - 1 - j)
+    for (size_t i = 0; i < n; ++i) {
+        if ((seq[i >> 6] >> (i & 63)) & 1) rev[(n - 1 - i) >> 6] |= 1ull << ((n - 1 - i) & 63);
+    }
+
+    c[0] = b[0] = 1;
+    for (size_t k = 0; k < n; ++k) {
+        uint64_t d = 0;
+
+        for (size_t w = 0; w <= (l >> 6); ++w) d ^= c[w] & bits_at(rev, n - 1 - k + 64 * w);
+        if (!__builtin_parityll(d)) {
+            ++m;
+        } else if (2 * l <= k) {
+            memcpy(t, c, WORDS(l) * sizeof(uint64_t));
+            xor_shifted(c, b, WORDS(lb), m);
+            lb = l;
+            l = k + 1 - l;
+            m = 1;
+            swap = b;
+            b = t;
+            t = swap;
+        } else {
+            xor_shifted(c, b, WORDS(lb), m);
+            ++m;
+        }
+    }
+
+    // the minimal polynomial is the reverse x^l * c(1/x) of the connection polynomial
+    f2lin_poly_reserve(p, WORDS(l));
+    for (size_t i = 0; i <= l; ++i) {
+        if ((c[i >> 6] >> (i & 63)) & 1) p->w[(l - i) >> 6] |= 1ull << ((l - i) & 63);
+    }
+    p->len = norm_len(p->w, WORDS(l));
+
+    free(rev);
+    free(c);
+    free(b);
+    free(t);
+    return p;
+}
+
+/*------------------------------------------------------
+ * Internal Implementations                            |
+ /----------------------------------------------------*/
+
+static
+size_t norm_len(const uint64_t* w, size_t len) {
+    while (len && !w[len - 1]) --len;
+    return len;
+}
+
+static
+long deg_words(const uint64_t* w, size_t len) {
+    len = norm_len(w, len);
+    if (!len) return -1;
+    return (long) (64 * (len - 1) + 63 - __builtin_clzll(w[len - 1]));
+}
+
+// dest may alias src
+static
+size_t shr_words(uint64_t* dest, const uint64_t* src, size_t len, long bits) {
+    const size_t ws = (size_t) bits >> 6;
+    const unsigned bs = bits & 63;
+    size_t n;
+
+    if (len <= ws) return 0;
+    n = len - ws;
+
+    if (!bs) {
+        memmove(dest, src + ws, n * sizeof(uint64_t));
+    } else {
+        for (size_t i = 0; i < n - 1; ++i) {
+            dest[i] = (src[ws + i] >> bs) | (src[ws + i + 1] << (64 - bs));
+        }
+        dest[n - 1] = src[len - 1] >> bs;
+    }
+
+    return norm_len(dest, n);
+}
+
+static inline
+uint64_t spread32(uint32_t x) {
+    uint64_t v = x;
+    v = (v | (v << 16)) & 0x0000ffff0000ffffull;
+    v = (v | (v << 8)) & 0x00ff00ff00ff00ffull;
+    v = (v | (v << 4)) & 0x0f0f0f0f0f0f0f0full;
+    v = (v | (v << 2)) & 0x3333333333333333ull;
+    v = (v | (v << 1)) & 0x5555555555555555ull;
+    return v;
+}
+
+// over GF(2) (sum a_i x^i)^2 = sum a_i x^2i, so squaring interleaves the bits with zeros
+static
+size_t sqr_words(uint64_t* r, const uint64_t* a, size_t len) {
+    for (size_t i = len; i-- > 0;) {
+        uint64_t w = a[i];
+        r[2 * i + 1] = spread32((uint32_t) (w >> 32));
+        r[2 * i] = spread32((uint32_t) w);
+    }
+    return norm_len(r, 2 * len);
+}
+
+// multiplies a with each word of b, using a table of the 16 multiples of a
+static inline
+void clmul_row(uint64_t* r, uint64_t a, const uint64_t* b, size_t nb) {
+    const uint64_t a0 = a & 0x1fffffffffffffffull;
+    uint64_t u[16];
+
+    // a0 has at most 61 bits, so a0 * k for k < 16 fits into a single word
+    u[0] = 0;
+    u[1] = a0;
+    for (size_t k = 2; k < 16; k += 2) {
+        u[k] = u[k >> 1] << 1;
+        u[k + 1] = u[k] ^ a0;
+    }
+
+    for (size_t j = 0; j < nb; ++j) {
+        const uint64_t bj = b[j];
+        uint64_t lo = u[bj & 15], hi = 0;
+
+        for (unsigned i = 4; i < 64; i += 4) {
+            uint64_t g = u[(bj >> i) & 15];
+            lo ^= g << i;
+            hi ^= g >> (64 - i);
+        }
+
+        // add the contribution of the three upper bits of a
+        for (unsigned i = 61; i < 64; ++i) {
+            if ((a >> i) & 1) {
+                lo ^= bj << i;
+                hi ^= bj >> (64 - i);
+            }
+        }
+
+        r[j] ^= lo;
+        r[j + 1] ^= hi;
+    }
+}
+
+static
+void mul_basecase_portable(uint64_t* r, const uint64_t* a, size_t na,
+                           const uint64_t* b, size_t nb) {
+    memset(r, 0, (na + nb) * sizeof(uint64_t));
+    for (size_t i = 0; i < na; ++i) {
+        if (a[i]) clmul_row(r + i, a[i], b, nb);
+    }
+}
+
+#ifdef F2POLY_PCLMUL
+__attribute__((target("pclmul,sse4.1")))
+static
+void mul_basecase_pclmul(uint64_t* r, const uint64_t* a, size_t na,
+                         const uint64_t* b, size_t nb) {
+    memset(r, 0, (na + nb) * sizeof(uint64_t));
+    for (size_t i = 0; i < na; ++i) {
+        const __m128i ai = _mm_cvtsi64_si128((long long) a[i]);
+        for (size_t j = 0; j < nb; ++j) {
+            __m128i* dest = (__m128i*) &r[i + j];
+            __m128i p = _mm_clmulepi64_si128(ai, _mm_cvtsi64_si128((long long) b[j]), 0);
+            _mm_storeu_si128(dest, _mm_xor_si128(_mm_loadu_si128(dest), p));
+        }
+    }
+}
+#endif
+
+static
+void select_mul_basecase() {
+    mul_basecase = mul_basecase_portable;
+#ifdef F2POLY_PCLMUL
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("pclmul") && __builtin_cpu_supports("sse4.1")) {
+        mul_basecase = mul_basecase_pclmul;
+    }
+#endif
+}
+
+// r = a * b, where a and b both have n words and r has 2n words.
+// scratch has to hold at least 8n + 64 words
+static
+void mul_karatsuba(uint64_t* r, const uint64_t* a, const uint64_t* b, size_t n,
+                   uint64_t* scratch) {
+    // a = a0 + a1 * X, with a0 having h words and a1 having k >= h words
+    const size_t h = n / 2, k = n - h;
+    uint64_t* as = scratch;
+    uint64_t* bs = scratch + k;
+    uint64_t* z1 = scratch + 2 * k;
+
+    if (n < KARATSUBA_THRESHOLD) {
+        mul_basecase(r, a, n, b, n);
+        return;
+    }
+
+    for (size_t i = 0; i < k; ++i) {
+        as[i] = a[h + i] ^ (i < h ? a[i] : 0);
+        bs[i] = b[h + i] ^ (i < h ? b[i] : 0);
+    }
+
+    mul_karatsuba(r, a, b, h, scratch + 4 * k);                 // z0 = a0 * b0
+    mul_karatsuba(r + 2 * h, a + h, b + h, k, scratch + 4 * k); // z2 = a1 * b1
+    mul_karatsuba(z1, as, bs, k, scratch + 4 * k);              // (a0 + a1)(b0 + b1)
+
+    // z1 = (a0 + a1)(b0 + b1) - z0 - z2
+    for (size_t i = 0; i < 2 * h; ++i) z1[i] ^= r[i];
+    for (size_t i = 0; i < 2 * k; ++i) z1[i] ^= r[2 * h + i];
+    for (size_t i = 0; i < 2 * k; ++i) r[h + i] ^= z1[i];
+}
+
+// r = a * b, r has na + nb words and must not alias a or b.
+// scratch has to hold at least 12 * min(na, nb) + 64 words
+static
+void mul_words(uint64_t* r, const uint64_t* a, size_t na,
+               const uint64_t* b, size_t nb, uint64_t* scratch) {
+    uint64_t* prod;
+    uint64_t* chunk;
+
+    pthread_once(&mul_basecase_once, select_mul_basecase);
+
+    if (na < nb) {
+        const uint64_t* t = a; a = b; b = t;
+        size_t tn = na; na = nb; nb = tn;
+    }
+
+    if (!nb) {
+        memset(r, 0, na * sizeof(uint64_t));
+        return;
+    }
+
+    if (nb < KARATSUBA_THRESHOLD) {
+        mul_basecase(r, a, na, b, nb);
+        return;
+    }
+
+    // split a into chunks of nb words, so each partial product is a square karatsuba
+    prod = scratch;
+    chunk = scratch + 2 * nb;
+    memset(r, 0, (na + nb) * sizeof(uint64_t));
+
+    for (size_t off = 0; off < na; off += nb) {
+        const size_t m = na - off < nb ? na - off : nb;
+        const uint64_t* src = a + off;
+
+        if (m < nb) {
+            memcpy(chunk, a + off, m * sizeof(uint64_t));
+            memset(chunk + m, 0, (nb - m) * sizeof(uint64_t));
+            src = chunk;
+        }
+
+        mul_karatsuba(prod, src, b, nb, chunk + nb);
+        for (size_t i = 0; i < m + nb; ++i) r[off + i] ^= prod[i];
+    }
+}
+
+// enough scratch space for a single reduction or multiplication modulo F
+static
+size_t scratch_words(const F2LinPolyMod* F) {
+    return 32 * (F->f->len + 2) + 128;
+}
+
+// bitwise long division, only used for polynomials of degree >= 2n
+static
+size_t rem_long_division(uint64_t* a, size_t la, const F2LinPoly* f) {
+    const long n = f2lin_poly_deg(f);
+
+    for (long i = deg_words(a, la); i >= n; --i) {
+        const size_t ws = (size_t) (i - n) >> 6;
+        const unsigned bs = (i - n) & 63;
+
+        if (!((a[i >> 6] >> (i & 63)) & 1)) continue;
+
+        for (size_t j = 0; j < f->len; ++j) {
+            a[ws + j] ^= f->w[j] << bs;
+            if (bs && ws + j + 1 < la) a[ws + j + 1] ^= f->w[j] >> (64 - bs);
+        }
+    }
+
+    return norm_len(a, la);
+}
+
+// q = floor(a / f)
+static
+void div_long(F2LinPoly* q, const F2LinPoly* a, const F2LinPoly* f) {
+    const long n = f2lin_poly_deg(f);
+    const long da = f2lin_poly_deg(a);
+    F2LinPoly* r = f2lin_poly_copy(f2lin_poly_init(), a);
+
+    f2lin_poly_set_zero(q);
+    if (da < n) {
+        f2lin_poly_destroy(r);
+        return;
+    }
+
+    f2lin_poly_reserve(q, WORDS(da - n));
+    memset(q->w, 0, WORDS(da - n) * sizeof(uint64_t));
+
+    for (long i = da; i >= n; --i) {
+        const size_t ws = (size_t) (i - n) >> 6;
+        const unsigned bs = (i - n) & 63;
+
+        if (!((r->w[i >> 6] >> (i & 63)) & 1)) continue;
+
+        q->w[ws] |= 1ull << bs;
+        for (size_t j = 0; j < f->len; ++j) {
+            r->w[ws + j] ^= f->w[j] << bs;
+            if (bs && ws + j + 1 < r->len) r->w[ws + j + 1] ^= f->w[j] >> (64 - bs);
+        }
+    }
+
+    q->len = norm_len(q->w, WORDS(da - n));
+    f2lin_poly_destroy(r);
+}
+
+// r = a mod F for deg(a) < 2n, using barrett reduction:
+// q = floor(floor(a / x^n) * mu / x^n) is the exact quotient, so r = a + q * f.
+// r may alias a.
+static
+size_t rem_words(uint64_t* r, uint64_t* a, size_t la, const F2LinPolyMod* F,
+                 uint64_t* scratch) {
+    const long n = F->n;
+    const size_t nr = WORDS(n - 1);
+    const F2LinPoly* mu = F->mu;
+    const F2LinPoly* f = F->f;
+    uint64_t* q = scratch;
+    uint64_t* t;
+    size_t lq, lt;
+
+    la = norm_len(a, la);
+    if (deg_words(a, la) < n) {
+        if (r != a) memcpy(r, a, la * sizeof(uint64_t));
+        return la;
+    }
+
+    lq = shr_words(q, a, la, n);
+    t = q + lq;
+    mul_words(t, q, lq, mu->w, mu->len, t + lq + mu->len);
+    lq = shr_words(q, t, lq + mu->len, n);
+
+    t = q + lq;
+    mul_words(t, q, lq, f->w, f->len, t + lq + f->len);
+    lt = lq + f->len;
+
+    for (size_t i = 0; i < nr; ++i) {
+        r[i] = (i < la ? a[i] : 0) ^ (i < lt ? t[i] : 0);
+    }
+    if (n & 63) r[nr - 1] &= (1ull << (n & 63)) - 1;
+
+    return norm_len(r, nr);
+}
+
+static
+void sqr_mod_scratch(F2LinPoly* r, const F2LinPoly* a, const F2LinPolyMod* F,
+                     uint64_t* scratch) {
+    uint64_t* p = scratch;
+    size_t lp = sqr_words(p, a->w, a->len);
+
+    f2lin_poly_reserve(r, WORDS(F->n));
+    r->len = rem_words(r->w, p, lp, F, scratch + 2 * a->len);
+}
+
+static
+void mul_mod_scratch(F2LinPoly* r, const F2LinPoly* a, const F2LinPoly* b,
+                     const F2LinPolyMod* F, uint64_t* scratch) {
+    uint64_t* p = scratch;
+    size_t lp = a->len + b->len;
+
+    if (!a->len || !b->len) {
+        r->len = 0;
+        return;
+    }
+
+    mul_words(p, a->w, a->len, b->w, b->len, scratch + lp);
+    f2lin_poly_reserve(r, WORDS(F->n));
+    r->len = rem_words(r->w, p, lp, F, scratch + lp);
+}
+
+// r = r * x mod F, r has to be reduced
+static
+void mul_x_mod(F2LinPoly* r, const F2LinPolyMod* F) {
+    const long n = F->n;
+    const size_t len = WORDS(n);
+    uint64_t carry = 0;
+
+    f2lin_poly_reserve(r, len);
+    for (size_t i = r->len; i < len; ++i) r->w[i] = 0;
+
+    for (size_t i = 0; i < len; ++i) {
+        uint64_t w = r->w[i];
+        r->w[i] = (w << 1) | carry;
+        carry = w >> 63;
+    }
+
+    if ((r->w[n >> 6] >> (n & 63)) & 1) {
+        for (size_t i = 0; i < F->f->len; ++i) r->w[i] ^= F->f->w[i];
+    }
+
+    r->len = norm_len(r->w, len);
+}
+
+// the 64 bits of w starting at bit pos, w has to have a word after the one containing pos
+static
+uint64_t bits_at(const uint64_t* w, size_t pos) {
+    const size_t k = pos >> 6;
+    const int o = pos & 63;
+
+    return o ? (w[k] >> o) | (w[k + 1] << (64 - o)) : w[k];
+}
+
+// r += a * x^shift, where a has len words and r has room for len + shift / 64 + 1 words
+static
+void xor_shifted(uint64_t* r, const uint64_t* a, size_t len, size_t shift) {
+    const size_t k = shift >> 6;
+    const int o = shift & 63;
+
+    if (!o) {
+        for (size_t i = 0; i < len; ++i) r[i + k] ^= a[i];
+        return;
+    }
+    for (size_t i = 0; i < len; ++i) {
+        r[i + k] ^= a[i] << o;
+        r[i + k + 1] ^= a[i] >> (64 - o);
+    }
+}
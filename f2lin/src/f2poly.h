@@ -0,0 +1,192 @@
+#ifndef F2POLY_H
+#define F2POLY_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdlib.h>
+#include <stdint.h>
+#include <inttypes.h>
+
+/**
+ * A polynomial over GF(2), packed into 64 bit words.
+ *
+ * Coefficient i is stored in bit (i % 64) of w[i / 64]. The polynomial is always kept
+ * normalized, meaning w[len - 1] != 0, or len == 0 for the zero polynomial.
+ */
+typedef struct F2LinPoly F2LinPoly;
+struct F2LinPoly {
+    uint64_t* w;
+    size_t len;
+    size_t cap;
+};
+
+/**
+ * A polynomial f of degree n, prepared for reducing polynomials modulo f.
+ *
+ * mu = floor(x^(2n) / f) is precomputed, so that the remainder of any polynomial of
+ * degree < 2n can be computed with two multiplications (barrett reduction).
+ */
+typedef struct F2LinPolyMod F2LinPolyMod;
+struct F2LinPolyMod {
+    long n;
+    F2LinPoly* f;
+    F2LinPoly* mu;
+};
+
+/**
+ * Initialize the zero polynomial. Has to be destroyed with f2lin_poly_destroy().
+ */
+F2LinPoly* f2lin_poly_init();
+
+/**
+ * Initialize a polynomial from a string of '0' and '1' characters, where the character
+ * at index i is the coefficient of x^i. This is the format of the MIN_POLY headers.
+ */
+F2LinPoly* f2lin_poly_init_from_string(const char* s);
+
+void f2lin_poly_destroy(F2LinPoly* p);
+
+/**
+ * Make sure @param p can hold at least @param words words without reallocating.
+ */
+void f2lin_poly_reserve(F2LinPoly* p, size_t words);
+
+/**
+ * Returns the degree of @param p, or -1 if p is the zero polynomial.
+ */
+long f2lin_poly_deg(const F2LinPoly* p);
+
+static inline
+int f2lin_poly_coeff(const F2LinPoly* p, long i) {
+    size_t k = (size_t) i >> 6;
+    return i >= 0 && k < p->len ? (int) ((p->w[k] >> (i & 63)) & 1) : 0;
+}
+
+/**
+ * Returns the @param q coefficients of x^lo..x^(lo+q-1) of @param p as an integer, where 
+ * the coefficient of x^lo is the least significant bit. lo >= 0 and q <= 64.
+ *
+ * This is the same order the windows of the sliding window method use, so the result can 
+ * directly be used as index into the table of decomposition polynomials.
+ */
+static inline
+uint64_t f2lin_poly_window(const F2LinPoly* p, long lo, int q) {
+    const size_t k = (size_t) lo >> 6;
+    const unsigned s = lo & 63;
+    uint64_t w = k < p->len ? p->w[k] >> s : 0;
+
+    if (s && k + 1 < p->len) w |= p->w[k + 1] << (64 - s);
+
+    return q < 64 ? w & ((1ull << q) - 1) : w;
+}
+
+/**
+ * Returns the index of the highest nonzero coefficient of @param p at or below @param i,
+ * or -1 if there is none. Runs of zero coefficients are skipped a word at a time.
+ */
+static inline
+long f2lin_poly_prev_set(const F2LinPoly* p, long i) {
+    size_t k = (size_t) i >> 6;
+    uint64_t w;
+
+    if (i < 0 || !p->len) return -1;
+
+    if (k >= p->len) {
+        k = p->len - 1;
+        w = p->w[k];
+    } else {
+        w = p->w[k] & (~0ull >> (63 - (i & 63)));
+    }
+
+    while (!w) {
+        if (!k) return -1;
+        w = p->w[--k];
+    }
+
+    return (long) (64 * k + 63 - __builtin_clzll(w));
+}
+
+void f2lin_poly_set_coeff(F2LinPoly* p, long i, int a);
+
+void f2lin_poly_set_zero(F2LinPoly* p);
+
+F2LinPoly* f2lin_poly_copy(F2LinPoly* dest, const F2LinPoly* src);
+
+int f2lin_poly_equal(const F2LinPoly* a, const F2LinPoly* b);
+
+/**
+ * r = a + b. r may alias a or b.
+ */
+void f2lin_poly_add(F2LinPoly* r, const F2LinPoly* a, const F2LinPoly* b);
+
+/**
+ * r = a * b. r may alias a or b.
+ *
+ * Uses the carry-less multiply instruction (PCLMULQDQ) if the cpu supports it, and a
+ * portable implementation otherwise. Large operands are split with karatsuba.
+ */
+void f2lin_poly_mul(F2LinPoly* r, const F2LinPoly* a, const F2LinPoly* b);
+
+/**
+ * r = a^2. r may alias a.
+ *
+ * Squaring is linear over GF(2), so this only spreads the bits of a apart.
+ */
+void f2lin_poly_sqr(F2LinPoly* r, const F2LinPoly* a);
+
+F2LinPolyMod* f2lin_poly_mod_init(const F2LinPoly* f);
+
+void f2lin_poly_mod_destroy(F2LinPolyMod* F);
+
+/**
+ * r = a mod F. r may alias a.
+ */
+void f2lin_poly_rem(F2LinPoly* r, const F2LinPoly* a, const F2LinPolyMod* F);
+
+/**
+ * r = a * b mod F. a and b have to be reduced modulo F. r may alias a or b.
+ */
+void f2lin_poly_mul_mod(F2LinPoly* r, const F2LinPoly* a, const F2LinPoly* b,
+                        const F2LinPolyMod* F);
+
+/**
+ * r = a^2 mod F. a has to be reduced modulo F. r may alias a.
+ */
+void f2lin_poly_sqr_mod(F2LinPoly* r, const F2LinPoly* a, const F2LinPolyMod* F);
+
+/**
+ * r = a^e mod F. a has to be reduced modulo F. r may alias a.
+ */
+void f2lin_poly_power_mod(F2LinPoly* r, const F2LinPoly* a, uint64_t e,
+                          const F2LinPolyMod* F);
+
+/**
+ * r = x^e mod F.
+ *
+ * This is the polynomial needed for jumping ahead e steps. Multiplying with x is only a
+ * shift, so this is cheaper than f2lin_poly_power_mod().
+ */
+void f2lin_poly_power_x_mod(F2LinPoly* r, uint64_t e, const F2LinPolyMod* F);
+
+/**
+ * Returns the coefficients of @param p from the constant one up to the leading one as a 
+ * null terminated string of '0' and '1', the format read by f2lin_poly_init_from_string().
+ * Has to be freed by the caller.
+ */
+char* f2lin_poly_to_string(const F2LinPoly* p);
+
+/**
+ * Returns the minimal polynomial of the sequence of @param n bits s_0 .. s_(n - 1), which 
+ * are packed like coefficients into @param seq (berlekamp-massey). It is only guaranteed 
+ * to be the minimal polynomial of the infinite sequence if its degree is at most n / 2, 
+ * e.g. for n = 2 * state size of a F2-linear generator. Takes O(n^2 / 64) operations.
+ */
+F2LinPoly* f2lin_poly_min_poly_seq(const uint64_t* seq, size_t n);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,89 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "gf2x_wrapper.h"
+#include "f2poly.h"
+
+/*-------------------------------------------------------------
+ * Implementation of the GF2X interface on top of the packed
+ * polynomials in f2poly.h, so the jump path can be built 
+ * without NTL.
+ ------------------------------------------------------------*/
+
+struct GF2X {
+    F2LinPoly p;
+};
+
+struct GF2XModulus {
+    F2LinPolyMod* F;
+};
+
+GF2X* GF2X_zero_init() {
+    return calloc(1, sizeof(GF2X));
+}
+
+void GF2X_zero_destroy(GF2X* p) {
+    if (!p) return;
+    free(p->p.w);
+    free(p);
+}
+
+long GF2X_coeff(const GF2X* p, long i) {
+    return f2lin_poly_coeff(&p->p, i);
+}
+
+void GF2X_SetCoeff(GF2X* p, long i, long a) {
+    f2lin_poly_set_coeff(&p->p, i, (int) (a & 1));
+}
+
+long GF2X_deg(const GF2X* p) {
+    return f2lin_poly_deg(&p->p);
+}
+
+void GF2X_print(const GF2X* x) {
+    printf("[");
+    for (long i = 0; i <= f2lin_poly_deg(&x->p); ++i) {
+        printf(i ? " %d" : "%d", f2lin_poly_coeff(&x->p, i));
+    }
+    printf("]\n");
+}
+
+void GF2X_copy(GF2X* x, const GF2X* a) {
+    f2lin_poly_copy(&x->p, &a->p);
+}
+
+F2LinPoly* GF2X_pack(const GF2X* p) {
+    return f2lin_poly_copy(f2lin_poly_init(), &p->p);
+}
+
+
+GF2XModulus* GF2XModulus_zero_init() {
+    return calloc(1, sizeof(GF2XModulus));
+}
+
+void GF2XModulus_destroy(GF2XModulus* F) {
+    if (!F) return;
+    f2lin_poly_mod_destroy(F->F);
+    free(F);
+}
+
+void GF2XModulus_build(GF2XModulus* F, const GF2X* f) {
+    f2lin_poly_mod_destroy(F->F);
+    F->F = f2lin_poly_mod_init(&f->p);
+}
+
+void GF2X_PowerMod(GF2X* x, const GF2X* a, const long e, const GF2XModulus* F) {
+    if (f2lin_poly_deg(&a->p) == 1 && a->p.w[0] == 2) {
+        f2lin_poly_power_x_mod(&x->p, (uint64_t) e, F->F);
+    } else {
+        f2lin_poly_power_mod(&x->p, &a->p, (uint64_t) e, F->F);
+    }
+}
+
+void GF2X_MulMod(GF2X* x, const GF2X* a, const GF2X* b, const GF2XModulus* F) {
+    f2lin_poly_mul_mod(&x->p, &a->p, &b->p, F->F);
+}
+
+void GF2X_SqrMod(GF2X* x, const GF2X* a, const GF2XModulus* F) {
+    f2lin_poly_sqr_mod(&x->p, &a->p, F->F);
+}
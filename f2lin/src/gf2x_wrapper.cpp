@@ -25,6 +25,26 @@ void GF2X_print(const GF2X* x) {
     std::cout << *x << std::endl;
 }
 
+void GF2X_copy(GF2X* x, const GF2X* a) {
+    *x = *a;
+}
+
+F2LinPoly* GF2X_pack(const GF2X* p) {
+    F2LinPoly* packed = f2lin_poly_init();
+    const long n = NumBytes(*p);
+    unsigned char* bytes = new unsigned char[n];
+
+    BytesFromGF2X(bytes, *p, n);
+    f2lin_poly_reserve(packed, (n + 7) / 8);
+    for (long i = 0; i < n; ++i) {
+        packed->w[i / 8] |= (uint64_t) bytes[i] << (8 * (i % 8));
+    }
+    packed->len = (n + 7) / 8;
+
+    delete[] bytes;
+    return packed;
+}
+
 
 GF2XModulus* GF2XModulus_zero_init() {
     return new GF2XModulus();
@@ -42,3 +62,10 @@ void GF2X_PowerMod(GF2X* x, const GF2X* a, const long e, const GF2XModulus* F) {
     PowerMod(*x, *a, e, *F);
 }
 
+void GF2X_MulMod(GF2X* x, const GF2X* a, const GF2X* b, const GF2XModulus* F) {
+    MulMod(*x, *a, *b, *F);
+}
+
+void GF2X_SqrMod(GF2X* x, const GF2X* a, const GF2XModulus* F) {
+    SqrMod(*x, *a, *F);
+}
@@ -1,6 +1,8 @@
 #ifndef GF2X_WRAPPER_H
 #define GF2X_WRAPPER_H
 
+#include "f2poly.h"
+
 #ifdef __cplusplus
 
 #include "NTL/GF2X.h"
@@ -30,6 +32,14 @@ long GF2X_deg(const GF2X* p);
 
 void GF2X_print(const GF2X* x);
 
+void GF2X_copy(GF2X* x, const GF2X* a);
+
+/**
+ * Returns a copy of @param p packed into 64 bit words, which has to be destroyed with 
+ * f2lin_poly_destroy().
+ */
+F2LinPoly* GF2X_pack(const GF2X* p);
+
 
 GF2XModulus* GF2XModulus_zero_init();
 
@@ -39,6 +49,10 @@ void GF2XModulus_build(GF2XModulus* F, const GF2X* f);
 
 void GF2X_PowerMod(GF2X* x, const GF2X* a, const long e, const GF2XModulus* F);
 
+void GF2X_MulMod(GF2X* x, const GF2X* a, const GF2X* b, const GF2XModulus* F);
+
+void GF2X_SqrMod(GF2X* x, const GF2X* a, const GF2XModulus* F);
+
 #ifdef __cplusplus
 }
 #endif
@@ -6,18 +6,17 @@
 #include <stdio.h>
 
 #include <inttypes.h>
-#include "gf2x_wrapper.h"
+#include "f2poly.h"
 
 
+/**
+ * Returns the coefficients i-1..i-q of @param poly, with the coefficient of i-1 as the
+ * most significant bit. Since the coefficients are packed in the same order, this is 
+ * only a shift of the word(s) containing them.
+ */
 static inline 
-size_t f2lin_determine_gray_enumeration(const size_t q, const size_t i, const GF2X* poly) {
-    size_t gray_enumeration = 0;
-
-    for (size_t j = 0; j < q; ++j) {
-        gray_enumeration = (gray_enumeration << 1) ^ GF2X_coeff(poly, i - j - 1);
-    }
-    
-    return gray_enumeration;
+size_t f2lin_determine_gray_enumeration(const size_t q, const size_t i, const F2LinPoly* poly) {
+    return (size_t) f2lin_poly_window(poly, (long) (i - q), (int) q);
 }
 
 /**
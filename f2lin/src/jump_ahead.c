@@ -1,6 +1,9 @@
 #include <stdlib.h>
 #include <stdio.h>
+#include <string.h>
 #include <assert.h>
+#include <unistd.h>
+#include <pthread.h>
 
 #include "config.h"
 #include "gray.h"
@@ -8,6 +11,33 @@
 #include "gf2x_wrapper.h"
 #include "rng_generic/rng_generic.h"
 #include "poly_decomp.h"
+#include "jump_cache.h"
+#include "jump_poly.h"
+#include "jump_matrix.h"
+#include "simd.h"
+#include "tune.h"
+
+/**
+ * The generator a jump is computed for: its type, its parameters and the minimal 
+ * polynomial of its transition with them.
+ */
+typedef struct F2LinJumpGen F2LinJumpGen;
+struct F2LinJumpGen {
+    enum F2LinRngType type;
+    const char* min_poly;
+    uint64_t params[RNG_PARAMS_WORDS];
+};
+
+/**
+ * The workspaces of one thread used by f2lin_jump_ahead_jump(), one for every type.
+ */
+typedef struct F2LinJumpThreadWork F2LinJumpThreadWork;
+struct F2LinJumpThreadWork {
+    F2LinJumpWork* work[F2LIN_RNG_TYPES];
+};
+
+static pthread_key_t work_key;
+static pthread_once_t work_once = PTHREAD_ONCE_INIT;
 
 /*------------------------------------------------------ 
  * Forward Declarations                                |
@@ -15,28 +45,73 @@
 
 // functions used for initialization
 static 
-GF2X* init_jump_poly(const GF2X* min_poly, const size_t jump_size);
+void default_gen(enum F2LinRngType type, F2LinJumpGen* gen);
 
 static 
-F2LinRngGeneric** init_y(int q); 
+void rng_gen(const F2LinRngGeneric* rng, F2LinJumpGen* gen);
+
+static 
+F2LinJump* set_gen(F2LinJump* jump, const F2LinJumpGen* gen);
+
+static 
+F2LinJump* init_gen(const F2LinJumpGen* gen, size_t jump_size, F2LinConfig* cfg);
+
+static 
+F2LinConfig* resolve_config(enum F2LinRngType type, size_t jump_size, F2LinConfig* cfg,
+                            F2LinConfig* def);
+
+static 
+F2LinJump* init_uncached(const F2LinJumpGen* gen, size_t jump_size, const F2LinConfig* cfg);
+
+static 
+F2LinJump* init_from_poly(const F2LinJumpGen* gen, size_t jump_size, const F2LinConfig* cfg,
+                          F2LinPoly* jump_poly);
+
+static 
+F2LinPoly* init_jump_poly(const F2LinJumpGen* gen, const size_t jump_size, 
+                          enum F2LinJumpPolyMethod method);
+
+static 
+F2LinJumpCacheEntry* acquire_jump_params(const F2LinJumpGen* gen, const size_t jump_size, 
+                                         const F2LinConfig* cfg);
+
+static 
+F2LinJumpMatrix* init_matrix(const F2LinJumpGen* gen, const size_t jump_size, 
+                             F2LinPoly* jump_poly, void (*release)(void* owner), void* owner);
 
 static 
 void init_decomp_poly();
 
+// workspaces of the calling thread
 static 
-void destroy_y(F2LinRngGeneric** y, int q);
+void init_work_key();
 
 static 
-GF2X* load_min_poly();
+void destroy_thread_work(void* thread_work);
+
+static 
+F2LinJumpWork* thread_work(enum F2LinRngType type, int q);
+
+static 
+int work_fits(const F2LinJumpWork* work, const F2LinJump* jump);
+
+static 
+size_t work_layout(enum F2LinRngType type, int q, size_t* states, size_t* work);
 
 // verification
 static 
-void verify_config(F2LinConfig* cfg);
+void verify_config(enum F2LinRngType type, F2LinConfig* cfg);
+
+static 
+int same_params(const F2LinJump* jump, const F2LinRngGeneric* rng);
+
+static 
+size_t cache_size(int level);
 
 // functions used for implementing the jump algorithm
 static 
 void init_sliding_window(const int Q, F2LinRngGeneric* h[1 << Q], 
-                         F2LinRngGeneric* rng);
+                         F2LinRngGeneric* A[Q + 1], const F2LinRngGeneric* rng);
 
 static 
 void precompute_A(const int Q, F2LinRngGeneric* A[Q + 1], 
@@ -47,97 +122,291 @@ void compute_decomposition_polys(const int Q, F2LinRngGeneric* h[1 << Q],
                                  const F2LinRngGeneric* A[Q + 1]);
 
 static 
-F2LinRngGeneric* horner(F2LinRngGeneric* rng, const GF2X* jump_poly);
+F2LinRngGeneric* horner(F2LinRngGeneric* rng, const F2LinPoly* jump_poly, 
+                        F2LinRngGeneric* tmp);
 
 static 
 F2LinRngGeneric* sliding_window(const int Q, F2LinRngGeneric* rng, 
-                                const GF2X* jump_poly, const F2LinRngGeneric* h[1 << Q]);
+                                const F2LinPoly* jump_poly, F2LinRngGeneric* h[1 << Q],
+                                F2LinRngGeneric* tmp);
 
 static 
-F2LinRngGeneric* sliding_window_decomp(const int Q, F2LinRngGeneric* rng, 
-                                       const F2LinPolyDecomp* jump_poly, 
-                                       const F2LinRngGeneric* h[1 << Q]);
+F2LinRngGeneric* sliding_window_decomp(F2LinRngGeneric* rng, const F2LinPolyDecomp* jump_poly, 
+                                       F2LinRngGeneric** h, F2LinRngGeneric* tmp);
 
 
 /*------------------------------------------------------ 
  * Header Implementations                              |
  /----------------------------------------------------*/
 
-F2LinJump* f2lin_jump_ahead_init(size_t jump_size, F2LinConfig* cfg) {
-    // load the minimal polynomial from the header
-    GF2X* min_poly = load_min_poly();
+F2LinJump* f2lin_jump_ahead_init(enum F2LinRngType type, size_t jump_size, F2LinConfig* cfg) {
+    F2LinJumpGen gen;
+
+    default_gen(type, &gen);
+    return init_gen(&gen, jump_size, cfg);
+}
+
+F2LinJump* f2lin_jump_ahead_init_rng(const F2LinRngGeneric* rng, size_t jump_size, 
+                                     F2LinConfig* cfg) {
+    F2LinJumpGen gen;
+
+    rng_gen(rng, &gen);
+    return init_gen(&gen, jump_size, cfg);
+}
+
+F2LinJump* f2lin_jump_ahead_init_uncached(enum F2LinRngType type, size_t jump_size, 
+                                          F2LinConfig* cfg) {
+    F2LinConfig def;
+    F2LinJumpGen gen;
+
+    default_gen(type, &gen);
+    return init_uncached(&gen, jump_size, resolve_config(type, jump_size, cfg, &def));
+}
+
+F2LinJump* f2lin_jump_ahead_init_rng_uncached(const F2LinRngGeneric* rng, size_t jump_size, 
+                                              F2LinConfig* cfg) {
+    F2LinConfig def;
+    F2LinJumpGen gen;
+
+    rng_gen(rng, &gen);
+    return init_uncached(&gen, jump_size, resolve_config(gen.type, jump_size, cfg, &def));
+}
+
+F2LinJump* f2lin_jump_ahead_init_rng_high(const F2LinRngGeneric* rng, uint64_t hi, 
+                                          F2LinConfig* cfg) {
+    F2LinConfig def;
+    F2LinJumpGen gen;
+    GF2X* jump_poly;
+    F2LinPoly* packed;
+    unsigned shift = 64;
+
+    rng_gen(rng, &gen);
+    cfg = resolve_config(gen.type, SIZE_MAX, cfg, &def);
+
+    // hi * 2^64 numbers are hi * 2^(64 - log2(numbers_per_step)) whole steps
+    for (size_t n = f2lin_rng_generic_numbers_per_step(gen.type); n > 1; n >>= 1) --shift;
+    jump_poly = f2lin_jump_poly_power_mod_shifted(f2lin_jump_cache_modulus(gen.min_poly), 
+                                                  hi, shift);
+    packed = GF2X_pack(jump_poly);
+    GF2X_zero_destroy(jump_poly);
+
+    return init_from_poly(&gen, 0, cfg, packed);
+}
+
+int f2lin_jump_ahead_cached(const F2LinRngGeneric* rng, size_t jump_size, F2LinConfig* cfg) {
+    F2LinConfig def;
+    F2LinJumpGen gen;
+
+    if (!f2lin_jump_cache_enabled()) return 0;
+
+    // the same keys as used by acquire_jump_params()
+    rng_gen(rng, &gen);
+    cfg = resolve_config(gen.type, jump_size, cfg, &def);
+    switch (cfg->algorithm) {
+        case HORNER:
+        case SLIDING_WINDOW:
+            return f2lin_jump_cache_contains(gen.min_poly, jump_size, HORNER, 0);
+        case MATRIX:
+            return f2lin_jump_cache_contains(gen.min_poly, jump_size, MATRIX, 0);
+        default:
+            return f2lin_jump_cache_contains(gen.min_poly, jump_size, SLIDING_WINDOW_DECOMP, 
+                                             cfg->q);
+    }
+}
+
+F2LinJump* f2lin_jump_ahead_init_params(enum F2LinRngType type, size_t jump_size, 
+                                        enum F2LinJumpAlgorithm algorithm, int q, 
+                                        F2LinPoly* jump_poly, F2LinPolyDecomp* pd,
+                                        F2LinJumpMatrix* matrix,
+                                        void (*release)(void* owner), void* owner) {
     F2LinJump* jump_params = calloc(1, sizeof(F2LinJump));
-    F2LinConfig def = { .q = Q_DEFAULT, .algorithm = SLIDING_WINDOW_DECOMP };
-    GF2X* jump_poly = init_jump_poly(min_poly, jump_size);
     union F2LinJumpPoly jp;
+    F2LinJumpGen gen;
 
-    // verify config
-    if (!cfg) cfg = &def;
-    else verify_config(cfg);
-
-    // initialize config values
-    jump_params->algorithm = cfg->algorithm;
+    default_gen(type, &gen);
+    set_gen(jump_params, &gen);
+    jump_params->type = type;
+    jump_params->algorithm = algorithm;
+    jump_params->jump_size = jump_size;
+    jump_params->release = release;
+    jump_params->owner = owner;
 
-    switch (jump_params->algorithm) {
+    switch (algorithm) {
         case HORNER:
             jp.horner = jump_poly; 
             break;
         case SLIDING_WINDOW:
             jp.sw = (F2LinJumpSW) {
-                .q = cfg->q,
-                .y = init_y(cfg->q),
+                .q = q,
                 .jp = jump_poly,
             };
             break;
+        case MATRIX:
+            jp.matrix = matrix;
+            break;
         default:
             jp.swd = (F2LinJumpSWD) {
-                .q = cfg->q,
-                .y = init_y(cfg->q),
-                .pd = f2lin_poly_decomp_init_from_gf2x(jump_poly, cfg->q),
+                .q = q,
+                .pd = pd,
             };
-            GF2X_zero_destroy(jump_poly);
     }
 
     jump_params->jp = jp;
-    GF2X_zero_destroy(min_poly);
     return jump_params;
 }
 
-F2LinRngGeneric* f2lin_jump_ahead_jump(F2LinJump* jump_params, F2LinRngGeneric* rng) {
+int f2lin_jump_ahead_auto_q(enum F2LinRngType type) {
+    const long deg = f2lin_rng_generic_state_size(type);
+    const size_t stride = f2lin_rng_generic_sizeof(type);
+    const size_t l1 = cache_size(1), l2 = cache_size(2);
+    double best_cost = 0;
+    int best_q = 1;
+
+    for (int q = 1; q <= Q_MAX; ++q) {
+        const size_t table_bytes = stride << q;
+        // building the table copies and adds 2^q states, the jump adds one state for every
+        // window, which are q + 2 coefficients apart on average for a random jump polynomial
+        double cost = 2.0 * (1 << q) + (double) deg / (q + 2);
+
+        if (table_bytes > l2) cost *= 2;
+        else if (table_bytes > l1) cost *= 1.25;
+
+        if (q == 1 || cost < best_cost) {
+            best_cost = cost;
+            best_q = q;
+        }
+    }
+    return best_q;
+}
+
+F2LinRngGeneric* f2lin_jump_ahead_jump(const F2LinJump* jump_params, F2LinRngGeneric* rng) {
+    F2LinJumpWork* work = thread_work(jump_params->type, f2lin_jump_ahead_work_q(jump_params));
+
+    return f2lin_jump_ahead_jump_work(jump_params, rng, work);
+}
+
+F2LinRngGeneric* f2lin_jump_ahead_jump_work(const F2LinJump* jump_params, 
+                                            F2LinRngGeneric* rng, F2LinJumpWork* work) {
+    if (f2lin_rng_generic_type(rng) != jump_params->type) {
+        fprintf(stderr, "Trying to jump a generator of type %s with a jump for %s\n",
+                f2lin_rng_generic_name(f2lin_rng_generic_type(rng)), 
+                f2lin_rng_generic_name(jump_params->type));
+        return 0;
+    }
+    if (!same_params(jump_params, rng)) {
+        fprintf(stderr, "Trying to jump a generator of type %s with a jump for other "
+                "parameters\n", f2lin_rng_generic_name(jump_params->type));
+        return 0;
+    }
+    if (!work_fits(work, jump_params)) {
+        fprintf(stderr, "Trying to jump a generator of type %s with a workspace which "
+                "doesn't fit the jump\n", f2lin_rng_generic_name(jump_params->type));
+        return 0;
+    }
+
     switch (jump_params->algorithm) {
         case HORNER: 
-            return horner(rng, jump_params->jp.horner);
+            horner(rng, jump_params->jp.horner, work->tmp);
+            break;
         case SLIDING_WINDOW: {
-            F2LinJumpSW* sw = &jump_params->jp.sw;
-            init_sliding_window(sw->q, sw->y, rng);
-            return sliding_window(sw->q, rng, sw->jp, sw->y);
+            const F2LinJumpSW* sw = &jump_params->jp.sw;
+            init_sliding_window(sw->q, work->h, work->A, rng);
+            sliding_window(sw->q, rng, sw->jp, work->h, work->tmp);
+            break;
         }
+        case MATRIX:
+            f2lin_jump_matrix_apply(jump_params->jp.matrix, rng);
+            break;
         default: {
-            F2LinJumpSWD* swd = &jump_params->jp.swd;
-            init_sliding_window(swd->q, swd->y, rng);
-            return sliding_window_decomp(swd->q, rng, swd->pd, swd->y);
+            const F2LinJumpSWD* swd = &jump_params->jp.swd;
+            init_sliding_window(swd->q, work->h, work->A, rng);
+            sliding_window_decomp(rng, swd->pd, work->h, work->tmp);
         }
     }
+
+    // the jump polynomial covers the whole steps, the numbers left over are generated
+    f2lin_rng_generic_skip(rng, jump_params->jump_size % 
+                                f2lin_rng_generic_numbers_per_step(jump_params->type));
+    return rng;
+}
+
+size_t f2lin_jump_ahead_work_size(enum F2LinRngType type, int q) {
+    size_t states, work;
+
+    return work_layout(type, q, &states, &work);
+}
+
+// the states come first, h in the order of their index, which is how they are looked up 
+// in the jump, followed by A and tmp. Small states share cache lines, states larger than 
+// a cache line start at one (see SIMD_ALIGN) 
+F2LinJumpWork* f2lin_jump_ahead_work_init_at(enum F2LinRngType type, int q, void* mem) {
+    const size_t stride = f2lin_rng_generic_sizeof(type);
+    const size_t n = (1 << q) + q + 2;
+    size_t states_offset, work_offset;
+    F2LinRngGeneric** states;
+    F2LinJumpWork* work;
+
+    work_layout(type, q, &states_offset, &work_offset);
+    states = (F2LinRngGeneric**) ((char*) mem + states_offset);
+    work = (F2LinJumpWork*) ((char*) mem + work_offset);
+
+    for (size_t i = 0; i < n; ++i) {
+        states[i] = f2lin_rng_generic_init_zero_at(type, (char*) mem + i * stride);
+    }
+
+    work->type = type;
+    work->q = q;
+    work->h = states;
+    work->A = states + (1 << q);
+    work->tmp = states[n - 1];
+    return work;
+}
+
+F2LinJumpWork* f2lin_jump_ahead_work_init(enum F2LinRngType type, int q) {
+    return f2lin_jump_ahead_work_init_at(type, q, 
+                                         f2lin_simd_alloc(f2lin_jump_ahead_work_size(type, q)));
+}
+
+int f2lin_jump_ahead_work_q(const F2LinJump* jump_params) {
+    switch (jump_params->algorithm) {
+        case SLIDING_WINDOW:
+            return jump_params->jp.sw.q;
+        case SLIDING_WINDOW_DECOMP:
+            return jump_params->jp.swd.q;
+        default:
+            return 0;
+    }
+}
+
+void f2lin_jump_ahead_work_destroy(F2LinJumpWork* work) {
+    // h[0] is the start of the memory of the workspace
+    if (work) free(work->h[0]);
 }
 
 void f2lin_jump_ahead_destroy(F2LinJump* jump_params) {
+    // shared parameters are given back to their owner below
+    const int owned = !jump_params->release;
+
     switch (jump_params->algorithm) {
         case HORNER: 
-            GF2X_zero_destroy(jump_params->jp.horner); 
+            if (owned) f2lin_poly_destroy(jump_params->jp.horner); 
             break;
         case SLIDING_WINDOW: {
             F2LinJumpSW* sw = &jump_params->jp.sw;
-            GF2X_zero_destroy(sw->jp);
-            destroy_y(sw->y, sw->q);
+            if (owned) f2lin_poly_destroy(sw->jp);
             break;
         }
+        case MATRIX:
+            if (owned) f2lin_jump_matrix_destroy(jump_params->jp.matrix);
+            break;
         default: {
             F2LinJumpSWD* swd = &jump_params->jp.swd;
-            f2lin_poly_decomp_destroy(swd->pd);
-            destroy_y(swd->y, swd->q);
+            if (owned) f2lin_poly_decomp_destroy(swd->pd);
         }
     }
 
+    if (!owned) jump_params->release(jump_params->owner);
+
     free(jump_params);
     jump_params = 0;
 }
@@ -147,85 +416,288 @@ void f2lin_jump_ahead_destroy(F2LinJump* jump_params) {
  /----------------------------------------------------*/
 
 static 
-GF2X* init_jump_poly(const GF2X* min_poly, const size_t jump_size) {
-    GF2X* jump_poly = GF2X_zero_init();
-    GF2X* x = GF2X_zero_init();
-    GF2X_SetCoeff(x, 1, 1);
-    GF2XModulus* minimal_poly_mod = GF2XModulus_zero_init();
+void default_gen(enum F2LinRngType type, F2LinJumpGen* gen) {
+    const F2LinRngBackend* backend = f2lin_rng_backends[type];
 
-    GF2XModulus_build(minimal_poly_mod, min_poly);
-    GF2X_PowerMod(jump_poly, x, jump_size, minimal_poly_mod);
-    
-    GF2X_zero_destroy(x);
-    GF2XModulus_destroy(minimal_poly_mod);
-    return jump_poly;
+    memset(gen, 0, sizeof(F2LinJumpGen));
+    gen->type = type;
+    gen->min_poly = backend->min_poly;
+    if (backend->params_size) memcpy(gen->params, backend->default_params, backend->params_size);
+}
+
+static 
+void rng_gen(const F2LinRngGeneric* rng, F2LinJumpGen* gen) {
+    memset(gen, 0, sizeof(F2LinJumpGen));
+    gen->type = f2lin_rng_generic_type(rng);
+    gen->min_poly = f2lin_jump_cache_rng_min_poly(rng);
+    f2lin_rng_generic_get_params(rng, gen->params);
 }
 
 static 
-F2LinRngGeneric** init_y(int q) {
-    F2LinRngGeneric** y = calloc(sizeof(F2LinRngGeneric*), (1 << q));
-    for (size_t i = 0; i < (1 << q); ++i) {
-        y[i] = f2lin_rng_generic_init();
+F2LinJump* set_gen(F2LinJump* jump, const F2LinJumpGen* gen) {
+    jump->min_poly = gen->min_poly;
+    memcpy(jump->params, gen->params, sizeof(jump->params));
+    return jump;
+}
+
+static 
+F2LinJump* init_gen(const F2LinJumpGen* gen, size_t jump_size, F2LinConfig* cfg) {
+    F2LinConfig def;
+
+    cfg = resolve_config(gen->type, jump_size, cfg, &def);
+
+    if (f2lin_jump_cache_enabled()) {
+        // share the parameters with every other jump of the same size and generator
+        F2LinJumpCacheEntry* entry = acquire_jump_params(gen, jump_size, cfg);
+        F2LinJump* jump = f2lin_jump_ahead_init_params(gen->type, jump_size, cfg->algorithm,
+                                                       cfg->q, entry->jump_poly, entry->pd, 
+                                                       entry->matrix, 
+                                                       f2lin_jump_cache_release, entry);
+        return set_gen(jump, gen);
+    } 
+
+    return init_uncached(gen, jump_size, cfg);
+}
+
+// without a config the loaded tuning profile replaces the defaults, which are written to 
+// def. A passed config is verified in place
+static 
+F2LinConfig* resolve_config(enum F2LinRngType type, size_t jump_size, F2LinConfig* cfg,
+                            F2LinConfig* def) {
+    if (cfg) {
+        verify_config(type, cfg);
+        return cfg;
     }
-    return y;
+
+    *def = (F2LinConfig) { .q = Q_DEFAULT, .algorithm = SLIDING_WINDOW_DECOMP };
+    if (f2lin_tune_config(type, jump_size, def)) verify_config(type, def);
+    return def;
+}
+
+// computes parameters owned by the jump, without looking them up in the jump cache
+static 
+F2LinJump* init_uncached(const F2LinJumpGen* gen, size_t jump_size, const F2LinConfig* cfg) {
+    return init_from_poly(gen, jump_size, cfg, init_jump_poly(gen, jump_size, cfg->poly_method));
 }
 
+// the parameters of cfg->algorithm built from jump_poly, which is taken over by the jump
 static 
-void destroy_y(F2LinRngGeneric** y, int q) {
-    for (size_t i = 0; i < (1 << q); ++i) {
-        f2lin_rng_generic_destroy(y[i]);
+F2LinJump* init_from_poly(const F2LinJumpGen* gen, size_t jump_size, const F2LinConfig* cfg,
+                          F2LinPoly* jump_poly) {
+    F2LinPolyDecomp* pd = 0;
+    F2LinJumpMatrix* matrix = 0;
+
+    if (cfg->algorithm == SLIDING_WINDOW_DECOMP) {
+        pd = f2lin_poly_decomp_init_from_poly(jump_poly, cfg->q);
+        f2lin_poly_destroy(jump_poly);
+        jump_poly = 0;
+    } else if (cfg->algorithm == MATRIX) {
+        matrix = init_matrix(gen, jump_size, jump_poly, 0, 0);
+        jump_poly = 0;
     }
-    free(y);
+
+    return set_gen(f2lin_jump_ahead_init_params(gen->type, jump_size, cfg->algorithm, cfg->q, 
+                                                jump_poly, pd, matrix, 0, 0), gen);
+}
+
+// the jump polynomial of the whole steps in jump_size, see f2lin_jump_ahead_jump()
+static 
+F2LinPoly* init_jump_poly(const F2LinJumpGen* gen, const size_t jump_size, 
+                          enum F2LinJumpPolyMethod method) {
+    const size_t steps = jump_size / f2lin_rng_generic_numbers_per_step(gen->type);
+    GF2X* jump_poly;
+    F2LinPoly* packed;
+
+    if (method == POW2_TABLE) {
+        jump_poly = f2lin_jump_poly_compose(f2lin_jump_cache_pow2_table(gen->min_poly), steps);
+    } else {
+        jump_poly = f2lin_jump_poly_power_mod(f2lin_jump_cache_modulus(gen->min_poly), steps);
+    }
+
+    packed = GF2X_pack(jump_poly);
+    GF2X_zero_destroy(jump_poly);
+    return packed;
+}
+
+// look up the parameters in the jump cache, computing and inserting them on a miss
+static 
+F2LinJumpCacheEntry* acquire_jump_params(const F2LinJumpGen* gen, const size_t jump_size, 
+                                         const F2LinConfig* cfg) {
+    const char* min_poly = gen->min_poly;
+    F2LinJumpCacheEntry* entry;
+    F2LinJumpCacheEntry* poly_entry;
+    F2LinPolyDecomp* pd;
+
+    // horner and sliding window share the jump polynomial, which doesn't depend on q
+    if (cfg->algorithm == HORNER || cfg->algorithm == SLIDING_WINDOW) {
+        entry = f2lin_jump_cache_lookup(min_poly, jump_size, HORNER, 0);
+        if (entry) return entry;
+        return f2lin_jump_cache_insert(min_poly, jump_size, HORNER, 0,
+                                       init_jump_poly(gen, jump_size, cfg->poly_method), 
+                                       0, 0);
+    }
+
+    // the matrix doesn't depend on q either
+    if (cfg->algorithm == MATRIX) {
+        entry = f2lin_jump_cache_lookup(min_poly, jump_size, MATRIX, 0);
+        if (entry) return entry;
+
+        poly_entry = acquire_jump_params(gen, jump_size, &(F2LinConfig) { 
+            .algorithm = HORNER, 
+            .poly_method = cfg->poly_method 
+        });
+        return f2lin_jump_cache_insert(min_poly, jump_size, MATRIX, 0, 0, 0, 
+                                       init_matrix(gen, jump_size, poly_entry->jump_poly,
+                                                   f2lin_jump_cache_release, poly_entry));
+    }
+
+    entry = f2lin_jump_cache_lookup(min_poly, jump_size, SLIDING_WINDOW_DECOMP, cfg->q);
+    if (entry) return entry;
+
+    // the decomposition is built from the (possibly cached) jump polynomial
+    poly_entry = acquire_jump_params(gen, jump_size, &(F2LinConfig) { 
+        .algorithm = HORNER, 
+        .poly_method = cfg->poly_method 
+    });
+    pd = f2lin_poly_decomp_init_from_poly(poly_entry->jump_poly, cfg->q);
+    f2lin_jump_cache_release(poly_entry);
+
+    return f2lin_jump_cache_insert(min_poly, jump_size, SLIDING_WINDOW_DECOMP, cfg->q, 
+                                   0, pd, 0);
+}
+
+// builds the matrix by jumping with horner, which is given the jump polynomial
+static 
+F2LinJumpMatrix* init_matrix(const F2LinJumpGen* gen, const size_t jump_size, 
+                             F2LinPoly* jump_poly, void (*release)(void* owner), void* owner) {
+    F2LinJump* jump = f2lin_jump_ahead_init_params(gen->type, jump_size, HORNER, 0, 
+                                                   jump_poly, 0, 0, release, owner);
+    F2LinJumpMatrix* matrix = f2lin_jump_matrix_init(set_gen(jump, gen));
+
+    f2lin_jump_ahead_destroy(jump);
+    return matrix;
+}
+
+static 
+void init_work_key() {
+    pthread_key_create(&work_key, destroy_thread_work);
+}
+
+static 
+void destroy_thread_work(void* thread_work) {
+    F2LinJumpThreadWork* tw = thread_work;
+
+    for (size_t i = 0; i < F2LIN_RNG_TYPES; ++i) f2lin_jump_ahead_work_destroy(tw->work[i]);
+    free(tw);
 }
 
+// the workspace of the calling thread for type, which is replaced if its q is too small
 static 
-GF2X* load_min_poly() {
-    GF2X* min_poly = GF2X_zero_init();
-    char* min_poly_string = f2lin_rng_generic_min_poly();
-    for (size_t i = 0; min_poly_string[i] != 0; ++i) {
-        GF2X_SetCoeff(min_poly, i, min_poly_string[i] == '1' ? 1 : 0);
+F2LinJumpWork* thread_work(enum F2LinRngType type, int q) {
+    F2LinJumpThreadWork* tw;
+
+    pthread_once(&work_once, init_work_key);
+    tw = pthread_getspecific(work_key);
+    if (!tw) {
+        tw = calloc(1, sizeof(F2LinJumpThreadWork));
+        pthread_setspecific(work_key, tw);
     }
-    return min_poly;
+
+    if (!tw->work[type] || tw->work[type]->q < q) {
+        f2lin_jump_ahead_work_destroy(tw->work[type]);
+        tw->work[type] = f2lin_jump_ahead_work_init(type, q);
+    }
+    return tw->work[type];
 }
 
 static 
-void verify_config(F2LinConfig* cfg) {
-    if (cfg->q > Q_MAX || cfg->q == 0)  {
-        fprintf(stderr, "Invalid value for Q: %d, defaulting to 4", cfg->q);
+int work_fits(const F2LinJumpWork* work, const F2LinJump* jump) {
+    return work && work->type == jump->type && work->q >= f2lin_jump_ahead_work_q(jump);
+}
+
+// offsets of the state pointers and of the workspace in its memory, returns its size
+static 
+size_t work_layout(enum F2LinRngType type, int q, size_t* states, size_t* work) {
+    const size_t n = (1 << q) + q + 2;
+    const size_t align = _Alignof(F2LinJumpWork);
+
+    *states = n * f2lin_rng_generic_sizeof(type);
+    *states = (*states + _Alignof(F2LinRngGeneric*) - 1) & ~(_Alignof(F2LinRngGeneric*) - 1);
+    *work = (*states + n * sizeof(F2LinRngGeneric*) + align - 1) & ~(align - 1);
+
+    return *work + sizeof(F2LinJumpWork);
+}
+
+static 
+void verify_config(enum F2LinRngType type, F2LinConfig* cfg) {
+    if (cfg->q == Q_AUTO) {
+        cfg->q = f2lin_jump_ahead_auto_q(type);
+    } else if (cfg->q > Q_MAX || cfg->q < 1)  {
+        fprintf(stderr, "Invalid value for Q: %d, defaulting to %d\n", cfg->q, Q_DEFAULT);
         cfg->q = Q_DEFAULT;
     }
+    if (cfg->poly_method != POWER_MOD && cfg->poly_method != POW2_TABLE) {
+        fprintf(stderr, "Invalid jump polynomial method: %d, defaulting to POWER_MOD", 
+                cfg->poly_method);
+        cfg->poly_method = POWER_MOD;
+    }
+    if (cfg->algorithm == MATRIX && !f2lin_jump_matrix_supported(type)) {
+        fprintf(stderr, "State of %ld bits is too large for MATRIX, "
+                "defaulting to SLIDING_WINDOW_DECOMP\n", f2lin_rng_generic_state_size(type));
+        cfg->algorithm = SLIDING_WINDOW_DECOMP;
+    }
 }
 
 static 
-void init_sliding_window(const int Q, F2LinRngGeneric* h[1 << Q], F2LinRngGeneric* rng) {
-    // in the paper, the seed is denoted as 'x'
-    F2LinRngGeneric* A[Q + 1]; // = A^j * x
+int same_params(const F2LinJump* jump, const F2LinRngGeneric* rng) {
+    const size_t len = f2lin_rng_generic_params_size(jump->type);
+    uint64_t params[RNG_PARAMS_WORDS];
+
+    if (!len) return 1;
 
-    // precompute A^j * x 
+    f2lin_rng_generic_get_params(rng, params);
+    return !memcmp(params, jump->params, len);
+}
+
+// size of the level 1 data or level 2 cache in bytes
+static 
+size_t cache_size(int level) {
+    long size = -1;
+
+#if defined(_SC_LEVEL1_DCACHE_SIZE) && defined(_SC_LEVEL2_CACHE_SIZE)
+    size = sysconf(level == 1 ? _SC_LEVEL1_DCACHE_SIZE : _SC_LEVEL2_CACHE_SIZE);
+#endif
+
+    if (size <= 0) return level == 1 ? CACHE_L1_DEFAULT : CACHE_L2_DEFAULT;
+    return size;
+}
+
+static 
+void init_sliding_window(const int Q, F2LinRngGeneric* h[1 << Q], 
+                         F2LinRngGeneric* A[Q + 1], const F2LinRngGeneric* rng) {
+    // in the paper, the seed is denoted as 'x', A[j] = A^j * x
     precompute_A(Q, A, rng);
 
     // polynomials in h always contain z^q, so 
     // each of the 2^q polynomials h contains A^j * x
-    compute_decomposition_polys(Q, h, A);
-
-    for (size_t i = 0; i < Q + 1; ++i) {
-        f2lin_rng_generic_destroy(A[i]);
-    }
+    compute_decomposition_polys(Q, h, (const F2LinRngGeneric**) A);
 }
 
 // precomputes A^0x..A^qx which are the first q state transitions
 // (equivalent to repeated calls to step()
 static 
 void precompute_A(const int Q, F2LinRngGeneric* A[Q + 1], const F2LinRngGeneric* rng) {
-    F2LinRngGeneric* tmp = f2lin_rng_generic_init_zero();// = calloc(1, sizeof(*rng)); 
-    f2lin_rng_generic_copy(tmp, rng);
+    f2lin_rng_generic_copy(A[0], rng);
+
+    for (size_t i = 1; i < Q + 1; ++i) { 
+        f2lin_rng_generic_copy(A[i], A[i - 1]);
+        f2lin_rng_generic_next_state(A[i]);
+    }
 
-    for (size_t i = 0; i < Q + 1; ++i) { 
-        A[i] = f2lin_rng_generic_init_zero();
-        f2lin_rng_generic_copy(A[i], tmp);
-        f2lin_rng_generic_next_state(tmp);
+    // all h are sums of A, so they are normalized as well
+    if (NORMALIZE_H_TABLE) {
+        for (size_t i = 0; i < Q + 1; ++i) f2lin_rng_generic_normalize(A[i]);
     }
-    f2lin_rng_generic_destroy(tmp);
 }
 
 static 
@@ -253,39 +725,36 @@ void compute_decomposition_polys(const int Q, F2LinRngGeneric* h[1 << Q],
 
 // calculate jump polynomial by evaluating with horners method
 static 
-F2LinRngGeneric* horner(F2LinRngGeneric* rng, const GF2X* jump_poly) {
-    F2LinRngGeneric* tmp = f2lin_rng_generic_init_zero();  
-    int i = GF2X_deg(jump_poly);
+F2LinRngGeneric* horner(F2LinRngGeneric* rng, const F2LinPoly* jump_poly, 
+                        F2LinRngGeneric* tmp) {
+    long i = f2lin_poly_deg(jump_poly), k;
 
     f2lin_rng_generic_copy(tmp, rng);
 
-    if (i > 0) {
-        f2lin_rng_generic_next_state(tmp);
-        --i;
-        for(; i > 0; --i) {
-            if(GF2X_coeff(jump_poly, i) != 0) f2lin_rng_generic_add(tmp, rng);
-            f2lin_rng_generic_next_state(tmp);
-        }
-
-        if(GF2X_coeff(jump_poly, 0) != 0) f2lin_rng_generic_add(tmp, rng);
+    // step to the next nonzero coefficient, and add rng there
+    while (i > 0 && (k = f2lin_poly_prev_set(jump_poly, i - 1)) >= 0) {
+        f2lin_rng_generic_next_state_n(tmp, i - k);
+        f2lin_rng_generic_add(tmp, rng);
+        i = k;
     }
 
+    // the remaining coefficients are all zero
+    f2lin_rng_generic_next_state_n(tmp, i);
+
     f2lin_rng_generic_copy(rng, tmp);
-    f2lin_rng_generic_destroy(tmp);
     return rng;
 }
 
 static 
-F2LinRngGeneric* sliding_window(int Q, F2LinRngGeneric* rng, const GF2X* jump_poly, 
-                                const F2LinRngGeneric* h[1 << Q]) {
+F2LinRngGeneric* sliding_window(int Q, F2LinRngGeneric* rng, const F2LinPoly* jump_poly, 
+                                F2LinRngGeneric* h[1 << Q], F2LinRngGeneric* tmp) {
     // use horners method with sliding window
-    F2LinRngGeneric* tmp = f2lin_rng_generic_init_zero();
-    int i = GF2X_deg(jump_poly); 
-    int dj = i, dj_next = 0, dm = 0;
+    long i = f2lin_poly_deg(jump_poly), k; 
+    long dj = i, dm = 0;
 
-    // go to first non zero coefficient
-    // NTL polynomials should always start with the first non zero component
-    //assert(GF2X_coeff(jump_poly, i) == 1);
+    // the zero state with the parameters of rng, which are copied back into it below
+    f2lin_rng_generic_copy(tmp, rng);
+    f2lin_rng_generic_add(tmp, rng);
 
     if (i >= (Q)) {
         //; h1(A) * x, first component in horner's method
@@ -293,43 +762,43 @@ F2LinRngGeneric* sliding_window(int Q, F2LinRngGeneric* rng, const GF2X* jump_po
 
         i -= (Q + 1);
 
-        for (; i >= Q; --i) {
-            if (GF2X_coeff(jump_poly, i) == 1) {
-                dj_next = i;
-                // step forward dj - dj_next steps, which is the same as
-                // multiplying with A^(dj - dj_next)
-                for (size_t j = 0; j < dj - dj_next; ++j) f2lin_rng_generic_next_state(tmp);
+        // jump directly to the next nonzero coefficient
+        while ((k = f2lin_poly_prev_set(jump_poly, i)) >= Q) {
+            // step forward dj - k steps, which is the same as
+            // multiplying with A^(dj - k)
+            f2lin_rng_generic_next_state_n(tmp, dj - k);
 
-                // find out the gray_enumeration of the current decomposition
-                // polynomials and calculate cur_state + h_i(A)x
-                f2lin_rng_generic_add(tmp, h[f2lin_determine_gray_enumeration(Q, i, jump_poly)]);
+            // find out the gray_enumeration of the current decomposition
+            // polynomials and calculate cur_state + h_i(A)x
+            f2lin_rng_generic_add(tmp, h[f2lin_determine_gray_enumeration(Q, k, jump_poly)]);
 
-                i -= Q;
-                dj = dj_next;
-            }
+            i = k - Q - 1;
+            dj = k;
         }
+        if (i > Q - 1) i = Q - 1;
 
         // calculate h_m+1 and do the last part of the decomposition 
         // which is multiplying the current state with A^dm
         // xoring with h_m+1(A)x and adding A^qx
         dm = dj - Q;
 
-        for (size_t j = 0; j < dm; ++j) f2lin_rng_generic_next_state(tmp);
+        f2lin_rng_generic_next_state_n(tmp, dm);
     }
 
     f2lin_rng_generic_add(tmp, h[f2lin_determine_gray_enumeration(i + 1, i + 1, jump_poly)]);
     f2lin_rng_generic_add(tmp, h[0]);
 
     f2lin_rng_generic_copy(rng, tmp);
-    f2lin_rng_generic_destroy(tmp);
     return rng;
 }
 
 static 
-F2LinRngGeneric* sliding_window_decomp(const int Q, F2LinRngGeneric* rng, 
-                                       const F2LinPolyDecomp* decomp_poly, 
-                                       const F2LinRngGeneric** h) {
-    F2LinRngGeneric* tmp = f2lin_rng_generic_init_zero();
+F2LinRngGeneric* sliding_window_decomp(F2LinRngGeneric* rng, const F2LinPolyDecomp* decomp_poly, 
+                                       F2LinRngGeneric** h, F2LinRngGeneric* tmp) {
+
+    // the zero state with the parameters of rng, which are copied back into it below
+    f2lin_rng_generic_copy(tmp, rng);
+    f2lin_rng_generic_add(tmp, rng);
 
     // go to first non zero coefficient
     // NTL polynomials should always start with the first non zero component
@@ -339,18 +808,16 @@ F2LinRngGeneric* sliding_window_decomp(const int Q, F2LinRngGeneric* rng,
         f2lin_rng_generic_copy(tmp, h[decomp_poly->h[0]]);
 
         for (size_t i = 1; i < decomp_poly->m; ++i) {
-            for (size_t j = 0; j < decomp_poly->d[i - 1] - decomp_poly->d[i]; ++j) f2lin_rng_generic_next_state(tmp);
+            f2lin_rng_generic_next_state_n(tmp, decomp_poly->d[i - 1] - decomp_poly->d[i]);
             f2lin_rng_generic_add(tmp, h[decomp_poly->h[i]]);
         }
 
-        for (size_t i = 0; i < decomp_poly->d[decomp_poly->m - 1]; ++i) f2lin_rng_generic_next_state(tmp);
+        f2lin_rng_generic_next_state_n(tmp, decomp_poly->d[decomp_poly->m - 1]);
     }
 
     f2lin_rng_generic_add(tmp, h[decomp_poly->hm1]);
     f2lin_rng_generic_add(tmp, h[0]);
     f2lin_rng_generic_copy(rng, tmp);
 
-    f2lin_rng_generic_destroy(tmp);
-
     return rng;
 }
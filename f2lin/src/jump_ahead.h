@@ -8,37 +8,183 @@
 #include <inttypes.h>
 
 typedef struct F2LinRngGeneric F2LinRngGeneric;
-typedef struct GF2X GF2X;
+typedef struct F2LinPoly F2LinPoly;
 typedef struct F2LinPolyDecomp F2LinPolyDecomp;
+typedef struct F2LinJumpMatrix F2LinJumpMatrix;
 
 typedef struct F2LinJumpSW F2LinJumpSW;
 struct F2LinJumpSW {
     int q;
-    F2LinRngGeneric** y;
-    GF2X* jp;
+    F2LinPoly* jp;
 };
 
 typedef struct F2LinJumpSWD F2LinJumpSWD;
 struct F2LinJumpSWD {
     int q;
-    F2LinRngGeneric** y;
     F2LinPolyDecomp* pd;
 };
 
+/**
+ * The jump polynomials are packed into 64 bit words (see f2poly.h), so the jump algorithms 
+ * can read whole windows of coefficients and skip runs of zeros at once.
+ */
 union F2LinJumpPoly {
-    GF2X* horner;
+    F2LinPoly* horner;
     F2LinJumpSW sw;
     F2LinJumpSWD swd;
+    F2LinJumpMatrix* matrix;
 };
 
+/**
+ * The scratch space of one jump: the states A^0x..A^qx, the table h of the 2^q sums of
+ * them used by the sliding window algorithms, and the state the jump is accumulated in.
+ * The jump itself is never written to, so one jump can be used by several threads at 
+ * once, as long as every thread has a workspace of its own.
+ *
+ * A workspace fits every jump for generators of its type with a q of at most its q.
+ * The states, the pointers to them and the workspace itself are stored in one block of 
+ * memory starting at h[0], see f2lin_jump_ahead_work_init_at().
+ */
+typedef struct F2LinJumpWork F2LinJumpWork;
+struct F2LinJumpWork {
+    enum F2LinRngType type;
+    int q;
+    F2LinRngGeneric** h;
+    F2LinRngGeneric** A;
+    F2LinRngGeneric* tmp;
+};
+
+/**
+ * The jump polynomial depends on the minimal polynomial of the generator, so every jump 
+ * belongs to one type of generator and can only be used with generators of that type.
+ * Generators like tinymt have parameters which change their transition, a jump also
+ * belongs to the parameters in params, whose minimal polynomial is min_poly.
+ *
+ * jump_size counts numbers. For generators with two numbers per step (SFMT, dSFMT) the
+ * jump polynomial is the one of jump_size / 2 steps, and an odd number left over is 
+ * generated after applying it, see f2lin_rng_generic_skip().
+ *
+ * If release is set, the jump polynomial or decomposition in jp is not owned by the jump,
+ * but shared with owner (e.g. an entry of the jump cache). It is then given back with
+ * release(owner) on destruction, instead of being freed.
+ */
 typedef struct F2LinJump F2LinJump;
 struct F2LinJump {
+    enum F2LinRngType type;
     enum F2LinJumpAlgorithm algorithm;
+    size_t jump_size;
+    const char* min_poly;
+    uint64_t params[RNG_PARAMS_WORDS];
     union F2LinJumpPoly jp;
+    void (*release)(void* owner);
+    void* owner;
 };
 
-F2LinJump* f2lin_jump_ahead_init(const size_t jump_size, F2LinConfig* c);
-F2LinRngGeneric* f2lin_jump_ahead_jump(F2LinJump* jump_params, F2LinRngGeneric* rng);
+F2LinJump* f2lin_jump_ahead_init(enum F2LinRngType type, const size_t jump_size, 
+                                 F2LinConfig* c);
+
+/**
+ * Like f2lin_jump_ahead_init(), but for generators with the type and parameters of 
+ * @param rng, e.g. a stream of f2lin_rng_generic_init_param_set(). The minimal polynomial
+ * of parameters other than the default ones is computed on the first use, see 
+ * f2lin_jump_cache_rng_min_poly().
+ */
+F2LinJump* f2lin_jump_ahead_init_rng(const F2LinRngGeneric* rng, size_t jump_size, 
+                                     F2LinConfig* cfg);
+
+/**
+ * Like f2lin_jump_ahead_init_rng(), for a jump by @param hi * 2^64 numbers, which doesn't 
+ * fit into jump_size. jump_size of the returned jump is 0, and its parameters are always 
+ * computed and owned by it, such jumps are too rare to be cached.
+ */
+F2LinJump* f2lin_jump_ahead_init_rng_high(const F2LinRngGeneric* rng, uint64_t hi, 
+                                          F2LinConfig* cfg);
+
+/**
+ * Like f2lin_jump_ahead_init(), but the parameters are always computed and owned by the 
+ * jump, even if the jump cache is enabled. Used to measure the cost of a fresh jump.
+ */
+F2LinJump* f2lin_jump_ahead_init_uncached(enum F2LinRngType type, size_t jump_size, 
+                                          F2LinConfig* cfg);
+
+/**
+ * Like f2lin_jump_ahead_init_rng(), but the parameters are always computed and owned by 
+ * the jump. Used for jumps which are unlikely to be done again, so they don't fill the
+ * jump cache.
+ */
+F2LinJump* f2lin_jump_ahead_init_rng_uncached(const F2LinRngGeneric* rng, size_t jump_size, 
+                                              F2LinConfig* cfg);
+
+/**
+ * Returns 1 if f2lin_jump_ahead_init_rng() would find the parameters for @param rng, 
+ * @param jump_size and @param cfg in the jump cache, without counting as a hit or miss. 
+ * @param cfg can be 0 like for f2lin_jump_ahead_init().
+ */
+int f2lin_jump_ahead_cached(const F2LinRngGeneric* rng, size_t jump_size, F2LinConfig* cfg);
+
+/**
+ * Creates a jump from already computed parameters. Only @param jump_poly (HORNER, 
+ * SLIDING_WINDOW), @param pd (SLIDING_WINDOW_DECOMP) or @param matrix (MATRIX) is used.
+ * The jump is for generators with the default parameters of @param type.
+ *
+ * If @param release is 0 the jump takes ownership of the parameters, otherwise they are
+ * given back with release(owner) when the jump is destroyed.
+ */
+F2LinJump* f2lin_jump_ahead_init_params(enum F2LinRngType type, size_t jump_size, 
+                                        enum F2LinJumpAlgorithm algorithm, int q, 
+                                        F2LinPoly* jump_poly, F2LinPolyDecomp* pd,
+                                        F2LinJumpMatrix* matrix,
+                                        void (*release)(void* owner), void* owner);
+/**
+ * The q used for the sliding window algorithms if the config sets Q_AUTO. 
+ * Larger q make the table of 2^q states more expensive to build but the jump cheaper, 
+ * q is chosen to minimize the cost of both, and penalized if the table doesn't fit into
+ * the L1 or L2 cache.
+ */
+int f2lin_jump_ahead_auto_q(enum F2LinRngType type);
+
+/**
+ * Jumps @param rng ahead and returns it. If @param rng isn't of the type or doesn't have
+ * the parameters @param jump_params was initialized for, an error is printed, @param rng is
+ * left unchanged and 0 is returned.
+ *
+ * The scratch space is a workspace of the calling thread, which is kept for further jumps
+ * of the same type and freed when the thread exits. 
+ */
+F2LinRngGeneric* f2lin_jump_ahead_jump(const F2LinJump* jump_params, F2LinRngGeneric* rng);
+
+/**
+ * Like f2lin_jump_ahead_jump(), with the scratch space in @param work. If @param work 
+ * doesn't fit @param jump_params, an error is printed, @param rng is left unchanged and 0 
+ * is returned.
+ */
+F2LinRngGeneric* f2lin_jump_ahead_jump_work(const F2LinJump* jump_params, 
+                                            F2LinRngGeneric* rng, F2LinJumpWork* work);
+
+/**
+ * A workspace for jumps of generators of @param type with a q of at most @param q.
+ */
+F2LinJumpWork* f2lin_jump_ahead_work_init(enum F2LinRngType type, int q);
+
+/**
+ * Bytes of memory of a workspace of f2lin_jump_ahead_work_init_at().
+ */
+size_t f2lin_jump_ahead_work_size(enum F2LinRngType type, int q);
+
+/**
+ * Like f2lin_jump_ahead_work_init(), but in @param mem, which has to hold 
+ * f2lin_jump_ahead_work_size() bytes aligned to F2LIN_JUMP_WORK_ALIGN. Nothing is 
+ * allocated, the workspace must not be destroyed with f2lin_jump_ahead_work_destroy(), 
+ * the memory belongs to the caller.
+ */
+F2LinJumpWork* f2lin_jump_ahead_work_init_at(enum F2LinRngType type, int q, void* mem);
+
+/**
+ * The q a workspace needs for @param jump_params, 0 for HORNER and MATRIX.
+ */
+int f2lin_jump_ahead_work_q(const F2LinJump* jump_params);
+
+void f2lin_jump_ahead_work_destroy(F2LinJumpWork* work);
 void f2lin_jump_ahead_destroy(F2LinJump* jump_params);
 
 #endif
@@ -0,0 +1,492 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <pthread.h>
+
+#include "jump_cache.h"
+#include "gf2x_wrapper.h"
+#include "poly_decomp.h"
+#include "jump_matrix.h"
+#include "jump_poly.h"
+#include "min_poly.h"
+#include "rng_generic/rng_generic.h"
+
+/**
+ * The minimal polynomial of one generator, identified by the address of its MIN_POLY
+ * string. The table of x^(2^k) is only built once it is needed.
+ */
+typedef struct F2LinJumpCacheGen F2LinJumpCacheGen;
+struct F2LinJumpCacheGen {
+    const char* min_poly_string;
+    GF2XModulus* modulus;
+    F2LinPow2Table* pow2;
+    F2LinJumpCacheGen* next;
+};
+
+/**
+ * A minimal polynomial computed at runtime, for generators of type with the parameters 
+ * in params.
+ */
+typedef struct F2LinJumpCacheMinPoly F2LinJumpCacheMinPoly;
+struct F2LinJumpCacheMinPoly {
+    enum F2LinRngType type;
+    void* params;
+    size_t len;
+    char* min_poly_string;
+    F2LinJumpCacheMinPoly* next;
+};
+
+/*------------------------------------------------------
+ * Forward Declarations                                |
+ /----------------------------------------------------*/
+
+static
+F2LinJumpCacheMinPoly* find_min_poly(enum F2LinRngType type, const void* params, size_t len);
+
+static
+GF2XModulus* load_modulus(const char* min_poly_string);
+
+static
+F2LinJumpCacheGen* find_generator(const char* min_poly_string);
+
+static
+F2LinJumpCacheEntry* find(const void* generator, size_t jump_size,
+                          enum F2LinJumpAlgorithm algorithm, int q);
+
+static
+size_t hash(const void* generator, size_t jump_size, enum F2LinJumpAlgorithm algorithm, 
+            int q);
+
+static
+void add_entry(F2LinJumpCacheEntry* entry);
+
+static
+void grow_buckets();
+
+static
+void lru_push(F2LinJumpCacheEntry* entry);
+
+static
+void lru_remove(F2LinJumpCacheEntry* entry);
+
+static
+size_t entry_bytes(const F2LinJumpCacheEntry* entry);
+
+static
+void evict(size_t bound, size_t entry_bound);
+
+static
+void destroy_entry(F2LinJumpCacheEntry* entry);
+
+/*------------------------------------------------------
+ * Cache State                                         |
+ /----------------------------------------------------*/
+
+// protects everything below
+static pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+
+static F2LinJumpCacheGen* generators = 0;
+static F2LinJumpCacheMinPoly* min_polys = 0;
+// the entries are chained in the buckets of a hash table of their keys. The ones which
+// aren't in use are also linked from the least recently used lru_head to lru_tail
+static F2LinJumpCacheEntry** buckets = 0;
+static size_t n_buckets = 0;
+static F2LinJumpCacheEntry* lru_head = 0;
+static F2LinJumpCacheEntry* lru_tail = 0;
+static size_t limit = JUMP_CACHE_LIMIT_DEFAULT;
+static size_t entry_limit = JUMP_CACHE_ENTRIES_DEFAULT;
+static size_t n_entries = 0;
+static size_t bytes = 0;
+static uint64_t hits = 0;
+static uint64_t misses = 0;
+static uint64_t evictions = 0;
+
+/*------------------------------------------------------
+ * Header Implementations                              |
+ /----------------------------------------------------*/
+
+const GF2XModulus* f2lin_jump_cache_modulus(const char* min_poly) {
+    F2LinJumpCacheGen* gen;
+
+    pthread_mutex_lock(&lock);
+    gen = find_generator(min_poly);
+    pthread_mutex_unlock(&lock);
+
+    return gen->modulus;
+}
+
+const F2LinPow2Table* f2lin_jump_cache_pow2_table(const char* min_poly) {
+    F2LinJumpCacheGen* gen;
+
+    pthread_mutex_lock(&lock);
+    gen = find_generator(min_poly);
+    if (!gen->pow2) gen->pow2 = f2lin_jump_poly_pow2_table_init(gen->modulus, POW2_TABLE_SIZE);
+    pthread_mutex_unlock(&lock);
+
+    return gen->pow2;
+}
+
+const char* f2lin_jump_cache_min_poly(const F2LinRngGeneric* rng, const void* params, 
+                                      size_t len) {
+    const enum F2LinRngType type = f2lin_rng_generic_type(rng);
+    F2LinJumpCacheMinPoly* mp;
+    char* computed;
+
+    pthread_mutex_lock(&lock);
+    mp = find_min_poly(type, params, len);
+    pthread_mutex_unlock(&lock);
+    if (mp) return mp->min_poly_string;
+
+    // computing takes milliseconds for large states, so other lookups don't wait for it
+    computed = f2lin_min_poly_compute_string(rng);
+
+    pthread_mutex_lock(&lock);
+    mp = find_min_poly(type, params, len);
+    if (mp) {
+        // another thread computed it in the meantime
+        free(computed);
+    } else {
+        mp = calloc(1, sizeof(F2LinJumpCacheMinPoly));
+        mp->type = type;
+        mp->params = malloc(len);
+        memcpy(mp->params, params, len);
+        mp->len = len;
+        mp->min_poly_string = computed;
+        mp->next = min_polys;
+        min_polys = mp;
+    }
+    pthread_mutex_unlock(&lock);
+
+    return mp->min_poly_string;
+}
+
+const char* f2lin_jump_cache_rng_min_poly(const F2LinRngGeneric* rng) {
+    const enum F2LinRngType type = f2lin_rng_generic_type(rng);
+    const size_t len = f2lin_rng_generic_params_size(type);
+    uint64_t params[RNG_PARAMS_WORDS];
+    F2LinJumpCacheMinPoly* mp;
+    F2LinRngGeneric* proto;
+    const char* min_poly;
+
+    if (f2lin_rng_generic_default_params(rng)) return f2lin_rng_generic_min_poly(type);
+
+    f2lin_rng_generic_get_params(rng, params);
+    pthread_mutex_lock(&lock);
+    mp = find_min_poly(type, params, len);
+    pthread_mutex_unlock(&lock);
+    if (mp) return mp->min_poly_string;
+
+    // the state of rng may lie in a smaller invariant subspace, a seeded one doesn't
+    proto = f2lin_rng_generic_init_zero(type);
+    f2lin_rng_generic_set_params(proto, params);
+    f2lin_rng_generic_backend(proto)->init_seed(proto, 1);
+    min_poly = f2lin_jump_cache_min_poly(proto, params, len);
+    f2lin_rng_generic_destroy(proto);
+
+    return min_poly;
+}
+
+int f2lin_jump_cache_enabled() {
+    int enabled;
+
+    pthread_mutex_lock(&lock);
+    enabled = limit > 0 && entry_limit > 0;
+    pthread_mutex_unlock(&lock);
+
+    return enabled;
+}
+
+F2LinJumpCacheEntry* f2lin_jump_cache_lookup(const char* min_poly, size_t jump_size,
+                                             enum F2LinJumpAlgorithm algorithm, int q) {
+    const void* generator = min_poly;
+    F2LinJumpCacheEntry* entry;
+
+    pthread_mutex_lock(&lock);
+    entry = find(generator, jump_size, algorithm, q);
+    if (entry) {
+        if (!entry->refs++) lru_remove(entry);
+        ++hits;
+    } else {
+        ++misses;
+    }
+    pthread_mutex_unlock(&lock);
+
+    return entry;
+}
+
+int f2lin_jump_cache_contains(const char* min_poly, size_t jump_size,
+                              enum F2LinJumpAlgorithm algorithm, int q) {
+    const void* generator = min_poly;
+    int found;
+
+    pthread_mutex_lock(&lock);
+    found = find(generator, jump_size, algorithm, q) != 0;
+    pthread_mutex_unlock(&lock);
+
+    return found;
+}
+
+F2LinJumpCacheEntry* f2lin_jump_cache_insert(const char* min_poly, size_t jump_size,
+                                             enum F2LinJumpAlgorithm algorithm, int q,
+                                             F2LinPoly* jump_poly, F2LinPolyDecomp* pd,
+                                             F2LinJumpMatrix* matrix) {
+    const void* generator = min_poly;
+    F2LinJumpCacheEntry* entry;
+    F2LinJumpCacheEntry* existing;
+
+    entry = calloc(1, sizeof(F2LinJumpCacheEntry));
+    *entry = (F2LinJumpCacheEntry) {
+        .generator = generator,
+        .jump_size = jump_size,
+        .algorithm = algorithm,
+        .q = q,
+        .jump_poly = jump_poly,
+        .pd = pd,
+        .matrix = matrix,
+        .refs = 1,
+    };
+    entry->bytes = entry_bytes(entry);
+
+    pthread_mutex_lock(&lock);
+    existing = find(generator, jump_size, algorithm, q);
+
+    if (existing) {
+        // somebody else computed the same parameters while we did
+        if (!existing->refs++) lru_remove(existing);
+    } else {
+        add_entry(entry);
+        evict(limit, entry_limit);
+    }
+    pthread_mutex_unlock(&lock);
+
+    if (existing) {
+        destroy_entry(entry);
+        return existing;
+    }
+
+    return entry;
+}
+
+void f2lin_jump_cache_release(void* p) {
+    F2LinJumpCacheEntry* entry = p;
+
+    if (!entry) return;
+
+    pthread_mutex_lock(&lock);
+    if (!--entry->refs) lru_push(entry);
+    evict(limit, entry_limit);
+    pthread_mutex_unlock(&lock);
+}
+
+void f2lin_jump_cache_set_limit(size_t new_limit) {
+    pthread_mutex_lock(&lock);
+    limit = new_limit;
+    evict(limit, entry_limit);
+    pthread_mutex_unlock(&lock);
+}
+
+void f2lin_jump_cache_set_entry_limit(size_t entries) {
+    pthread_mutex_lock(&lock);
+    entry_limit = entries;
+    evict(limit, entry_limit);
+    pthread_mutex_unlock(&lock);
+}
+
+void f2lin_jump_cache_stats(F2LinJumpCacheStats* stats) {
+    pthread_mutex_lock(&lock);
+    *stats = (F2LinJumpCacheStats) {
+        .hits = hits,
+        .misses = misses,
+        .evictions = evictions,
+        .entries = n_entries,
+        .bytes = bytes,
+        .limit = limit,
+        .entry_limit = entry_limit,
+    };
+    pthread_mutex_unlock(&lock);
+}
+
+void f2lin_jump_cache_clear() {
+    pthread_mutex_lock(&lock);
+    evict(0, 0);
+    hits = misses = evictions = 0;
+    pthread_mutex_unlock(&lock);
+}
+
+/*------------------------------------------------------
+ * Internal Implementations                            |
+ /----------------------------------------------------*/
+
+// must be called while holding the lock
+static
+F2LinJumpCacheMinPoly* find_min_poly(enum F2LinRngType type, const void* params, size_t len) {
+    for (F2LinJumpCacheMinPoly* mp = min_polys; mp; mp = mp->next) {
+        if (mp->type == type && mp->len == len && !memcmp(mp->params, params, len)) return mp;
+    }
+    return 0;
+}
+
+static
+GF2XModulus* load_modulus(const char* min_poly_string) {
+    GF2X* min_poly = GF2X_zero_init();
+    GF2XModulus* modulus = GF2XModulus_zero_init();
+
+    for (size_t i = 0; min_poly_string[i] != 0; ++i) {
+        GF2X_SetCoeff(min_poly, i, min_poly_string[i] == '1' ? 1 : 0);
+    }
+
+    GF2XModulus_build(modulus, min_poly);
+    GF2X_zero_destroy(min_poly);
+
+    return modulus;
+}
+
+// returns the generator with the minimal polynomial min_poly_string, building its modulus
+// on first use. building it is done only once per generator, so it can happen while 
+// holding the lock, which must be held by the caller
+static
+F2LinJumpCacheGen* find_generator(const char* min_poly_string) {
+    F2LinJumpCacheGen* gen;
+
+    for (gen = generators; gen; gen = gen->next) {
+        if (gen->min_poly_string == min_poly_string) return gen;
+    }
+
+    gen = calloc(1, sizeof(F2LinJumpCacheGen));
+    gen->min_poly_string = min_poly_string;
+    gen->modulus = load_modulus(min_poly_string);
+    gen->next = generators;
+    generators = gen;
+
+    return gen;
+}
+
+// must be called while holding the lock
+static
+F2LinJumpCacheEntry* find(const void* generator, size_t jump_size,
+                          enum F2LinJumpAlgorithm algorithm, int q) {
+    if (!n_buckets) return 0;
+
+    const size_t b = hash(generator, jump_size, algorithm, q) & (n_buckets - 1);
+
+    for (F2LinJumpCacheEntry* e = buckets[b]; e; e = e->next) {
+        if (e->generator == generator && e->jump_size == jump_size &&
+            e->algorithm == algorithm && e->q == q) {
+            return e;
+        }
+    }
+    return 0;
+}
+
+// the finalizer of splitmix64, applied to the fields of the key
+static
+size_t hash(const void* generator, size_t jump_size, enum F2LinJumpAlgorithm algorithm, 
+            int q) {
+    uint64_t h = (uint64_t) (uintptr_t) generator ^ ((uint64_t) algorithm << 56) ^ 
+                 ((uint64_t) q << 48) ^ (jump_size * 0x9e3779b97f4a7c15ull);
+
+    h = (h ^ (h >> 30)) * 0xbf58476d1ce4e5b9ull;
+    h = (h ^ (h >> 27)) * 0x94d049bb133111ebull;
+    return h ^ (h >> 31);
+}
+
+// adds a new entry. it is in use, so it isn't linked into the lru list yet.
+// must be called while holding the lock
+static
+void add_entry(F2LinJumpCacheEntry* entry) {
+    if (n_entries >= n_buckets) grow_buckets();
+
+    const size_t b = hash(entry->generator, entry->jump_size, entry->algorithm, entry->q) & 
+                     (n_buckets - 1);
+
+    entry->next = buckets[b];
+    buckets[b] = entry;
+    bytes += entry->bytes;
+    ++n_entries;
+}
+
+// doubles the number of buckets, which stays a power of two
+static
+void grow_buckets() {
+    const size_t n = n_buckets ? 2 * n_buckets : 64;
+    F2LinJumpCacheEntry** grown = calloc(n, sizeof(F2LinJumpCacheEntry*));
+
+    for (size_t i = 0; i < n_buckets; ++i) {
+        while (buckets[i]) {
+            F2LinJumpCacheEntry* e = buckets[i];
+            const size_t b = hash(e->generator, e->jump_size, e->algorithm, e->q) & (n - 1);
+
+            buckets[i] = e->next;
+            e->next = grown[b];
+            grown[b] = e;
+        }
+    }
+
+    free(buckets);
+    buckets = grown;
+    n_buckets = n;
+}
+
+// appends an entry which is no longer in use as the most recently used one
+static
+void lru_push(F2LinJumpCacheEntry* entry) {
+    entry->lru_prev = lru_tail;
+    entry->lru_next = 0;
+    if (lru_tail) lru_tail->lru_next = entry;
+    else lru_head = entry;
+    lru_tail = entry;
+}
+
+static
+void lru_remove(F2LinJumpCacheEntry* entry) {
+    if (entry->lru_prev) entry->lru_prev->lru_next = entry->lru_next;
+    else lru_head = entry->lru_next;
+    if (entry->lru_next) entry->lru_next->lru_prev = entry->lru_prev;
+    else lru_tail = entry->lru_prev;
+    entry->lru_prev = entry->lru_next = 0;
+}
+
+static
+size_t entry_bytes(const F2LinJumpCacheEntry* entry) {
+    size_t n = sizeof(F2LinJumpCacheEntry);
+
+    if (entry->jump_poly) n += sizeof(F2LinPoly) + entry->jump_poly->cap * sizeof(uint64_t);
+    if (entry->pd) {
+        n += sizeof(F2LinPolyDecomp) + entry->pd->cap * (sizeof(uint16_t) + sizeof(size_t));
+    }
+    if (entry->matrix) {
+        n += sizeof(F2LinJumpMatrix) + 
+             f2lin_jump_matrix_table_words(entry->matrix->words) * sizeof(uint64_t);
+    }
+
+    return n;
+}
+
+// evict unused entries, least recently used first, until at most bound bytes and 
+// entry_bound entries are used. must be called while holding the lock
+static
+void evict(size_t bound, size_t entry_bound) {
+    // once everything left is in use, it is evicted when it is released
+    while ((bytes > bound || n_entries > entry_bound) && lru_head) {
+        F2LinJumpCacheEntry* entry = lru_head;
+        F2LinJumpCacheEntry** e = &buckets[hash(entry->generator, entry->jump_size, 
+                                                entry->algorithm, entry->q) & (n_buckets - 1)];
+
+        while (*e != entry) e = &(*e)->next;
+        *e = entry->next;
+        lru_remove(entry);
+
+        bytes -= entry->bytes;
+        --n_entries;
+        ++evictions;
+        destroy_entry(entry);
+    }
+}
+
+static
+void destroy_entry(F2LinJumpCacheEntry* entry) {
+    if (entry->jump_poly) f2lin_poly_destroy(entry->jump_poly);
+    if (entry->pd) f2lin_poly_decomp_destroy(entry->pd);
+    if (entry->matrix) f2lin_jump_matrix_destroy(entry->matrix);
+    free(entry);
+}
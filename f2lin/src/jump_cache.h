@@ -0,0 +1,149 @@
+#ifndef JUMP_CACHE_H
+#define JUMP_CACHE_H
+
+#include <stdlib.h>
+#include <stdint.h>
+#include <inttypes.h>
+
+#include "config.h"
+
+typedef struct GF2XModulus GF2XModulus;
+typedef struct F2LinPoly F2LinPoly;
+typedef struct F2LinPolyDecomp F2LinPolyDecomp;
+typedef struct F2LinPow2Table F2LinPow2Table;
+typedef struct F2LinJumpMatrix F2LinJumpMatrix;
+typedef struct F2LinRngGeneric F2LinRngGeneric;
+
+/**
+ * Shared, read-only jump parameters of one (generator, jump_size, algorithm, q).
+ * The generator is identified by the address of its minimal polynomial, see 
+ * f2lin_rng_generic_min_poly() and f2lin_jump_cache_rng_min_poly(), so generators of one 
+ * type with other parameters have their own entries.
+ *
+ * HORNER and SLIDING_WINDOW both only need the jump polynomial, which does not depend
+ * on q, so it is looked up with algorithm = HORNER and q = 0 for both of them.
+ * Entries for SLIDING_WINDOW_DECOMP hold the decomposition of the jump polynomial,
+ * entries for MATRIX (with q = 0) the jump matrix.
+ *
+ * next chains the entries of one bucket of the hash table of the keys. Entries which are
+ * not in use (refs == 0) are kept in a list ordered by their last use, linked by lru_prev
+ * and lru_next, so lookups and evictions take constant time.
+ */
+typedef struct F2LinJumpCacheEntry F2LinJumpCacheEntry;
+struct F2LinJumpCacheEntry {
+    const void* generator;
+    size_t jump_size;
+    enum F2LinJumpAlgorithm algorithm;
+    int q;
+
+    F2LinPoly* jump_poly;
+    F2LinPolyDecomp* pd;
+    F2LinJumpMatrix* matrix;
+
+    size_t bytes;
+    size_t refs;
+    F2LinJumpCacheEntry* next;
+    F2LinJumpCacheEntry* lru_prev;
+    F2LinJumpCacheEntry* lru_next;
+};
+
+/**
+ * Returns the minimal polynomial @param min_poly, a string returned by 
+ * f2lin_rng_generic_min_poly() or f2lin_jump_cache_rng_min_poly(), prepared as a modulus.
+ * It is built on the first call and then shared by the whole process, it must not be
+ * destroyed.
+ */
+const GF2XModulus* f2lin_jump_cache_modulus(const char* min_poly);
+
+/**
+ * Returns the table of x^(2^k) mod @param min_poly with POW2_TABLE_SIZE entries. Like the
+ * modulus it is built on the first call and shared.
+ */
+const F2LinPow2Table* f2lin_jump_cache_pow2_table(const char* min_poly);
+
+/**
+ * Returns the minimal polynomial of generators of the type of @param rng with the 
+ * parameters @param params of @param len bytes, e.g. mat1, mat2 and tmat of tinymt, in 
+ * the format of f2lin_rng_generic_min_poly().
+ * On the first call for a type and parameters it is computed from @param rng with
+ * f2lin_min_poly_compute(), later calls only look it up. The string is shared by the 
+ * whole process and must not be freed, so its address identifies the parameters like 
+ * the one of a MIN_POLY header identifies a generator.
+ */
+const char* f2lin_jump_cache_min_poly(const F2LinRngGeneric* rng, const void* params,
+                                      size_t len);
+
+/**
+ * Returns the minimal polynomial of the transition of @param rng, which depends on its
+ * parameters (see f2lin_rng_generic_get_params()). For the default parameters it is 
+ * f2lin_rng_generic_min_poly(), for all others it is computed once per process with
+ * f2lin_jump_cache_min_poly(), from a generator with the same parameters seeded with 1.
+ */
+const char* f2lin_jump_cache_rng_min_poly(const F2LinRngGeneric* rng);
+
+/**
+ * Returns 1 if jump parameters are cached, 0 if the cache was disabled by setting its
+ * limit or entry limit to 0.
+ */
+int f2lin_jump_cache_enabled();
+
+/**
+ * Looks up the jump parameters of generators with the minimal polynomial @param min_poly
+ * for @param jump_size, @param algorithm and @param q.
+ * Returns 0 on a miss. Every lookup counts as either a hit or a miss.
+ *
+ * Every entry returned has to be given back with f2lin_jump_cache_release().
+ */
+F2LinJumpCacheEntry* f2lin_jump_cache_lookup(const char* min_poly, size_t jump_size,
+                                             enum F2LinJumpAlgorithm algorithm, int q);
+
+/**
+ * Returns 1 if the jump parameters of generators with the minimal polynomial 
+ * @param min_poly for @param jump_size, @param algorithm and @param q are cached. Unlike f2lin_jump_cache_lookup() it neither 
+ * counts as a hit or miss nor marks the entry as used.
+ */
+int f2lin_jump_cache_contains(const char* min_poly, size_t jump_size,
+                              enum F2LinJumpAlgorithm algorithm, int q);
+
+/**
+ * Inserts the jump parameters computed after a miss. The cache takes ownership of
+ * @param jump_poly, @param pd and @param matrix, only one of them is expected to be set.
+ *
+ * If another thread inserted the same parameters in the meantime, the passed ones are
+ * destroyed and the existing entry is returned instead.
+ * The returned entry has to be given back with f2lin_jump_cache_release().
+ */
+F2LinJumpCacheEntry* f2lin_jump_cache_insert(const char* min_poly, size_t jump_size,
+                                             enum F2LinJumpAlgorithm algorithm, int q,
+                                             F2LinPoly* jump_poly, F2LinPolyDecomp* pd,
+                                             F2LinJumpMatrix* matrix);
+
+/**
+ * Gives back an entry returned by f2lin_jump_cache_lookup() or f2lin_jump_cache_insert().
+ * Takes a void pointer, so it can be used as the release function of a F2LinJump.
+ */
+void f2lin_jump_cache_release(void* entry);
+
+/**
+ * Sets the maximum number of bytes the cached jump parameters may use.
+ * Unused entries are evicted least recently used first. 0 disables the cache.
+ */
+void f2lin_jump_cache_set_limit(size_t bytes);
+
+/**
+ * Sets the maximum number of cached entries, which bounds the memory used by many small
+ * entries. Unused entries are evicted least recently used first. 0 disables the cache.
+ */
+void f2lin_jump_cache_set_entry_limit(size_t entries);
+
+/**
+ * Writes the current hit and miss counters and memory usage into @param stats.
+ */
+void f2lin_jump_cache_stats(F2LinJumpCacheStats* stats);
+
+/**
+ * Evicts all entries which are not in use and resets the counters.
+ */
+void f2lin_jump_cache_clear();
+
+#endif
@@ -0,0 +1,370 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "jump_file.h"
+#include "jump_ahead.h"
+#include "poly_decomp.h"
+#include "jump_matrix.h"
+#include "f2poly.h"
+#include "rng_generic/rng_generic.h"
+
+// d is used in place, so it has to have the same layout as in the file
+_Static_assert(sizeof(size_t) == sizeof(uint64_t), "jump files need 64 bit size_t");
+
+/**
+ * The parameters of a jump attached to a serialized buffer. poly and pd point into buf.
+ */
+typedef struct F2LinJumpFile F2LinJumpFile;
+struct F2LinJumpFile {
+    F2LinPoly poly;
+    F2LinPolyDecomp pd;
+    F2LinJumpMatrix matrix;
+    void (*release)(void* owner);
+    void* owner;
+};
+
+/**
+ * A mapped file.
+ */
+typedef struct F2LinJumpFileMap F2LinJumpFileMap;
+struct F2LinJumpFileMap {
+    void* addr;
+    size_t len;
+};
+
+/*------------------------------------------------------
+ * Forward Declarations                                |
+ /----------------------------------------------------*/
+
+static
+uint64_t checksum(const char* min_poly);
+
+static
+int verify_header(const F2LinJumpFileHeader* header, size_t len, enum F2LinRngType* type);
+
+static
+int in_buffer(uint64_t offset, uint64_t n, size_t size, size_t len);
+
+static
+int verify_decomp(const F2LinJumpFileHeader* header, const char* base);
+
+static
+int find_type(const F2LinJumpFileHeader* header, enum F2LinRngType* type);
+
+static
+void release_file(void* file);
+
+static
+void unmap(void* map);
+
+static
+size_t align8(size_t n);
+
+/*------------------------------------------------------
+ * Header Implementations                              |
+ /----------------------------------------------------*/
+
+uint64_t f2lin_jump_file_checksum(enum F2LinRngType type) {
+    return checksum(f2lin_rng_generic_min_poly(type));
+}
+
+size_t f2lin_jump_file_size(const F2LinJump* jump) {
+    switch (jump->algorithm) {
+        case HORNER:
+            return sizeof(F2LinJumpFileHeader) + jump->jp.horner->len * sizeof(uint64_t);
+        case SLIDING_WINDOW:
+            return sizeof(F2LinJumpFileHeader) + jump->jp.sw.jp->len * sizeof(uint64_t);
+        case MATRIX:
+            return sizeof(F2LinJumpFileHeader) + 
+                   f2lin_jump_matrix_table_words(jump->jp.matrix->words) * sizeof(uint64_t);
+        default: {
+            const size_t m = jump->jp.swd.pd->m;
+            return sizeof(F2LinJumpFileHeader) + m * sizeof(uint64_t) + 
+                   align8(m * sizeof(uint16_t));
+        }
+    }
+}
+
+void f2lin_jump_file_serialize(const F2LinJump* jump, void* buf) {
+    F2LinJumpFileHeader* header = buf;
+    const F2LinPoly* poly = 0;
+    char* data = (char*) buf + sizeof(F2LinJumpFileHeader);
+
+    memset(buf, 0, f2lin_jump_file_size(jump));
+    memcpy(header->magic, JUMP_FILE_MAGIC, sizeof(header->magic));
+    header->version = JUMP_FILE_VERSION;
+    header->byte_order = JUMP_FILE_BYTE_ORDER;
+    header->algorithm = jump->algorithm;
+    header->jump_size = jump->jump_size;
+    header->state_size = f2lin_rng_generic_state_size(jump->type);
+    // jumps for other parameters than the default ones have another minimal polynomial, 
+    // so attaching them fails instead of jumping generators with the default parameters
+    header->min_poly_checksum = checksum(jump->min_poly);
+
+    switch (jump->algorithm) {
+        case HORNER: 
+            poly = jump->jp.horner;
+            break;
+        case SLIDING_WINDOW: 
+            poly = jump->jp.sw.jp;
+            header->q = jump->jp.sw.q;
+            break;
+        case MATRIX: {
+            const size_t n = f2lin_jump_matrix_table_words(jump->jp.matrix->words);
+            header->n = n;
+            header->poly_offset = sizeof(F2LinJumpFileHeader);
+            memcpy(data, jump->jp.matrix->table, n * sizeof(uint64_t));
+            break;
+        }
+        default: {
+            const F2LinPolyDecomp* pd = jump->jp.swd.pd;
+            header->q = jump->jp.swd.q;
+            header->n = pd->m;
+            header->hm1 = pd->hm1;
+            header->d_offset = sizeof(F2LinJumpFileHeader);
+            header->h_offset = header->d_offset + pd->m * sizeof(uint64_t);
+            if (pd->m) {
+                memcpy(data, pd->d, pd->m * sizeof(uint64_t));
+                memcpy(data + pd->m * sizeof(uint64_t), pd->h, pd->m * sizeof(uint16_t));
+            }
+        }
+    }
+
+    if (poly) {
+        header->n = poly->len;
+        header->poly_offset = sizeof(F2LinJumpFileHeader);
+        if (poly->len) memcpy(data, poly->w, poly->len * sizeof(uint64_t));
+    }
+}
+
+F2LinJump* f2lin_jump_file_attach(const void* buf, size_t len, 
+                                  void (*release)(void* owner), void* owner) {
+    const F2LinJumpFileHeader* header = buf;
+    const char* base = buf;
+    enum F2LinRngType type;
+    F2LinJumpFile* file;
+
+    if (!verify_header(header, len, &type)) return 0;
+
+    file = calloc(1, sizeof(F2LinJumpFile));
+    file->release = release;
+    file->owner = owner;
+
+    // the parameters are never written to, so it is fine to drop the const here
+    if (header->algorithm == MATRIX) {
+        file->matrix = (F2LinJumpMatrix) {
+            .words = f2lin_rng_generic_state_words(type),
+            .table = (uint64_t*) (base + header->poly_offset),
+        };
+    } else if (header->algorithm == SLIDING_WINDOW_DECOMP) {
+        file->pd = (F2LinPolyDecomp) {
+            .h = (uint16_t*) (base + header->h_offset),
+            .d = (size_t*) (base + header->d_offset),
+            .m = header->n,
+            .hm1 = header->hm1,
+            .cap = header->n,
+        };
+    } else {
+        file->poly = (F2LinPoly) {
+            .w = (uint64_t*) (base + header->poly_offset),
+            .len = header->n,
+            .cap = header->n,
+        };
+    }
+
+    return f2lin_jump_ahead_init_params(type, header->jump_size, header->algorithm, 
+                                        header->q, &file->poly, &file->pd, &file->matrix, 
+                                        release_file, file);
+}
+
+int f2lin_jump_file_write(const F2LinJump* jump, const char* path) {
+    const size_t len = f2lin_jump_file_size(jump);
+    uint64_t* buf = malloc(len);
+    char* tmp_path = malloc(strlen(path) + 5);
+    FILE* f;
+    int ok;
+
+    f2lin_jump_file_serialize(jump, buf);
+
+    // write to a temporary file first, so the file is never seen half written,
+    // and mappings of the old file stay intact
+    sprintf(tmp_path, "%s.tmp", path);
+    f = fopen(tmp_path, "wb");
+    if (!f) {
+        fprintf(stderr, "Unable to open %s for writing jump parameters\n", tmp_path);
+        free(buf);
+        free(tmp_path);
+        return -1;
+    }
+
+    ok = fwrite(buf, 1, len, f) == len;
+    ok = !fclose(f) && ok;
+    ok = ok && !rename(tmp_path, path);
+
+    if (!ok) {
+        fprintf(stderr, "Unable to write jump parameters to %s\n", path);
+        remove(tmp_path);
+    }
+
+    free(buf);
+    free(tmp_path);
+    return ok ? 0 : -1;
+}
+
+F2LinJump* f2lin_jump_file_read(const char* path) {
+    struct stat st;
+    F2LinJumpFileMap* map;
+    F2LinJump* jump;
+    void* addr;
+    int fd = open(path, O_RDONLY);
+
+    if (fd < 0) {
+        fprintf(stderr, "Unable to open jump parameters %s\n", path);
+        return 0;
+    }
+
+    if (fstat(fd, &st) || (size_t) st.st_size < sizeof(F2LinJumpFileHeader)) {
+        fprintf(stderr, "%s is too small to contain jump parameters\n", path);
+        close(fd);
+        return 0;
+    }
+
+    addr = mmap(0, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (addr == MAP_FAILED) {
+        fprintf(stderr, "Unable to map jump parameters %s\n", path);
+        return 0;
+    }
+
+    map = malloc(sizeof(F2LinJumpFileMap));
+    *map = (F2LinJumpFileMap) { .addr = addr, .len = st.st_size };
+
+    jump = f2lin_jump_file_attach(addr, st.st_size, unmap, map);
+    if (!jump) {
+        fprintf(stderr, "%s doesn't contain valid jump parameters\n", path);
+        unmap(map);
+    }
+
+    return jump;
+}
+
+/*------------------------------------------------------
+ * Internal Implementations                            |
+ /----------------------------------------------------*/
+
+static
+uint64_t checksum(const char* min_poly) {
+    // FNV-1a
+    uint64_t hash = 0xcbf29ce484222325ull;
+
+    for (size_t i = 0; min_poly[i] != 0; ++i) {
+        hash ^= (unsigned char) min_poly[i];
+        hash *= 0x100000001b3ull;
+    }
+
+    return hash;
+}
+
+static
+int verify_header(const F2LinJumpFileHeader* header, size_t len, enum F2LinRngType* type) {
+    if (len < sizeof(F2LinJumpFileHeader)) return 0;
+    if (memcmp(header->magic, JUMP_FILE_MAGIC, sizeof(header->magic))) return 0;
+
+    if (header->byte_order != JUMP_FILE_BYTE_ORDER) {
+        fprintf(stderr, "Jump parameters were written with a different byte order\n");
+        return 0;
+    }
+    if (header->version != JUMP_FILE_VERSION) {
+        fprintf(stderr, "Unsupported version of jump parameters: %u\n", header->version);
+        return 0;
+    }
+    if (!find_type(header, type)) {
+        fprintf(stderr, "Jump parameters were computed for an unknown generator\n");
+        return 0;
+    }
+    if (header->algorithm > MATRIX || 
+        ((header->algorithm == SLIDING_WINDOW || header->algorithm == SLIDING_WINDOW_DECOMP) &&
+         (header->q == 0 || header->q > Q_MAX))) {
+        return 0;
+    }
+    if (header->algorithm == MATRIX && 
+        (!f2lin_jump_matrix_supported(*type) || 
+         header->n != f2lin_jump_matrix_table_words(f2lin_rng_generic_state_words(*type)))) {
+        return 0;
+    }
+
+    // make sure all the data lies inside of the buffer and is aligned
+    if (header->algorithm == SLIDING_WINDOW_DECOMP) {
+        if (header->d_offset % 8 || header->h_offset % 2) return 0;
+        if (!in_buffer(header->d_offset, header->n, sizeof(uint64_t), len) ||
+            !in_buffer(header->h_offset, header->n, sizeof(uint16_t), len)) {
+            return 0;
+        }
+        return verify_decomp(header, (const char*) header);
+    }
+
+    if (header->poly_offset % 8) return 0;
+    return in_buffer(header->poly_offset, header->n, sizeof(uint64_t), len);
+}
+
+// n elements of size bytes starting at offset fit into len bytes, without overflowing
+static
+int in_buffer(uint64_t offset, uint64_t n, size_t size, size_t len) {
+    return offset <= len && n <= (len - offset) / size;
+}
+
+// the windows index tables of 2^q states, and the distances between them are positive and
+// lie inside of the state, so that the jump never steps by a wrapped around distance
+static
+int verify_decomp(const F2LinJumpFileHeader* header, const char* base) {
+    const uint64_t* d = (const uint64_t*) (base + header->d_offset);
+    const uint16_t* h = (const uint16_t*) (base + header->h_offset);
+
+    if (header->hm1 >> header->q) return 0;
+
+    for (uint64_t i = 0; i < header->n; ++i) {
+        if (h[i] >> header->q) return 0;
+        if (d[i] >= (uint64_t) header->state_size) return 0;
+        if (i && d[i] >= d[i - 1]) return 0;
+    }
+
+    return 1;
+}
+
+static
+int find_type(const F2LinJumpFileHeader* header, enum F2LinRngType* type) {
+    for (int t = 0; t < F2LIN_RNG_TYPES; ++t) {
+        if (header->state_size == (uint64_t) f2lin_rng_generic_state_size(t) &&
+            header->min_poly_checksum == f2lin_jump_file_checksum(t)) {
+            *type = t;
+            return 1;
+        }
+    }
+    return 0;
+}
+
+static
+void release_file(void* p) {
+    F2LinJumpFile* file = p;
+
+    if (file->release) file->release(file->owner);
+    free(file);
+}
+
+static
+void unmap(void* p) {
+    F2LinJumpFileMap* map = p;
+
+    munmap(map->addr, map->len);
+    free(map);
+}
+
+static
+size_t align8(size_t n) {
+    return (n + 7) & ~(size_t) 7;
+}
@@ -0,0 +1,91 @@
+#ifndef JUMP_FILE_H
+#define JUMP_FILE_H
+
+#include <stdlib.h>
+#include <stdint.h>
+#include <inttypes.h>
+
+#include "config.h"
+
+typedef struct F2LinJump F2LinJump;
+
+#define JUMP_FILE_MAGIC "F2LINJMP"
+#define JUMP_FILE_VERSION 1
+#define JUMP_FILE_BYTE_ORDER 0x01020304u
+
+/**
+ * Header of a file containing the parameters of a single jump.
+ *
+ * All values are stored in the byte order of the machine that wrote the file, which is 
+ * detected with byte_order. The header is followed by the data, at the byte offsets 
+ * stored in the header:
+ *  - HORNER and SLIDING_WINDOW: n words of the packed jump polynomial (see f2poly.h)
+ *  - MATRIX: n words of the tables of the jump matrix (see jump_matrix.h)
+ *  - SLIDING_WINDOW_DECOMP: d[n] as 64 bit integers, followed by h[n] as 16 bit integers
+ *
+ * The data is aligned to 8 bytes, so it can be used directly from a mapping of the file.
+ * The generator is identified by its state size and a checksum of its minimal polynomial,
+ * which select the type of generator the jump is for when it is attached.
+ */
+typedef struct F2LinJumpFileHeader F2LinJumpFileHeader;
+struct F2LinJumpFileHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t byte_order;
+    uint32_t algorithm;
+    uint32_t q;
+    uint64_t jump_size;
+    uint64_t state_size;
+    uint64_t min_poly_checksum;
+    uint64_t n;
+    uint64_t hm1;
+    uint64_t poly_offset;
+    uint64_t d_offset;
+    uint64_t h_offset;
+};
+
+/**
+ * Returns the number of bytes needed to serialize @param jump.
+ */
+size_t f2lin_jump_file_size(const F2LinJump* jump);
+
+/**
+ * Serializes @param jump into @param buf, which has to hold f2lin_jump_file_size() bytes
+ * and be aligned to 8 bytes. This is exactly the content written to a file.
+ */
+void f2lin_jump_file_serialize(const F2LinJump* jump, void* buf);
+
+/**
+ * Returns a jump using the serialized parameters in @param buf in place, after verifying 
+ * them. @param buf has to stay valid and unchanged until the jump is destroyed, at which 
+ * point release(owner) is called.
+ *
+ * Returns 0 if @param buf doesn't contain parameters for one of the generators of the 
+ * library.
+ */
+F2LinJump* f2lin_jump_file_attach(const void* buf, size_t len, 
+                                  void (*release)(void* owner), void* owner);
+
+/**
+ * Writes the parameters of @param jump to the file at @param path, replacing it.
+ * Returns 0 on success and -1 on failure.
+ */
+int f2lin_jump_file_write(const F2LinJump* jump, const char* path);
+
+/**
+ * Maps the file at @param path and returns a jump using its parameters in place.
+ * The file stays mapped until the jump is destroyed with f2lin_jump_ahead_destroy().
+ *
+ * Returns 0 if the file can't be read, or if it was written for a generator which isn't 
+ * part of the library. This includes jumps for parameters other than the default ones,
+ * see f2lin_jump_ahead_init_rng().
+ */
+F2LinJump* f2lin_jump_file_read(const char* path);
+
+/**
+ * Returns the checksum of the minimal polynomial of generators of @param type, as it is 
+ * stored in the header.
+ */
+uint64_t f2lin_jump_file_checksum(enum F2LinRngType type);
+
+#endif
@@ -0,0 +1,96 @@
+#include <stdio.h>
+#include <string.h>
+
+#include "jump_matrix.h"
+#include "jump_ahead.h"
+#include "rng_generic/rng_generic.h"
+
+#define MATRIX_WORDS_MAX (MATRIX_STATE_MAX / 64)
+
+/*------------------------------------------------------
+ * Header Implementations                              |
+ /----------------------------------------------------*/
+
+int f2lin_jump_matrix_supported(enum F2LinRngType type) {
+    return f2lin_rng_generic_state_words(type) <= MATRIX_WORDS_MAX;
+}
+
+size_t f2lin_jump_matrix_table_words(size_t words) {
+    // 8 tables with 256 entries of size words for every state word
+    return words * 8 * 256 * words;
+}
+
+F2LinJumpMatrix* f2lin_jump_matrix_init(F2LinJump* jump) {
+    const size_t words = f2lin_rng_generic_state_words(jump->type);
+    const size_t bits = words * 64;
+    F2LinJumpMatrix* matrix;
+    F2LinRngGeneric* rng;
+    uint64_t* columns;
+    uint64_t unit[MATRIX_WORDS_MAX];
+
+    if (words > MATRIX_WORDS_MAX) {
+        fprintf(stderr, "State with %zu words is too large for a jump matrix\n", words);
+        return 0;
+    }
+
+    // column i is the jumped i-th unit vector
+    // the columns depend on the transition, so on the parameters of the generator
+    rng = f2lin_rng_generic_init_zero(jump->type);
+    f2lin_rng_generic_set_params(rng, jump->params);
+    columns = malloc(bits * words * sizeof(uint64_t));
+    for (size_t i = 0; i < bits; ++i) {
+        memset(unit, 0, sizeof(unit));
+        unit[i / 64] = 1ull << (i % 64);
+        f2lin_rng_generic_set_state(rng, unit);
+        f2lin_jump_ahead_jump(jump, rng);
+        f2lin_rng_generic_get_state(rng, &columns[i * words]);
+    }
+    f2lin_rng_generic_destroy(rng);
+
+    matrix = malloc(sizeof(F2LinJumpMatrix));
+    matrix->words = words;
+    matrix->table = malloc(f2lin_jump_matrix_table_words(words) * sizeof(uint64_t));
+
+    // entry v is entry v without its lowest bit plus the column of that bit
+    for (size_t b = 0; b < words * 8; ++b) {
+        uint64_t* table = &matrix->table[b * 256 * words];
+
+        memset(table, 0, words * sizeof(uint64_t));
+        for (size_t v = 1; v < 256; ++v) {
+            const uint64_t* prev = &table[(v & (v - 1)) * words];
+            const uint64_t* col = &columns[(b * 8 + __builtin_ctzll(v)) * words];
+
+            for (size_t w = 0; w < words; ++w) table[v * words + w] = prev[w] ^ col[w];
+        }
+    }
+
+    free(columns);
+    return matrix;
+}
+
+F2LinRngGeneric* f2lin_jump_matrix_apply(const F2LinJumpMatrix* matrix, F2LinRngGeneric* rng) {
+    const size_t words = matrix->words;
+    uint64_t state[MATRIX_WORDS_MAX], result[MATRIX_WORDS_MAX] = { 0 };
+
+    f2lin_rng_generic_get_state(rng, state);
+
+    for (size_t i = 0; i < words; ++i) {
+        const uint64_t* table = &matrix->table[i * 8 * 256 * words];
+        uint64_t s = state[i];
+
+        for (size_t b = 0; b < 8; ++b, s >>= 8, table += 256 * words) {
+            const uint64_t* entry = &table[(s & 0xff) * words];
+            for (size_t w = 0; w < words; ++w) result[w] ^= entry[w];
+        }
+    }
+
+    f2lin_rng_generic_set_state(rng, result);
+    return rng;
+}
+
+void f2lin_jump_matrix_destroy(F2LinJumpMatrix* matrix) {
+    if (!matrix) return;
+
+    free(matrix->table);
+    free(matrix);
+}
@@ -0,0 +1,47 @@
+#ifndef JUMP_MATRIX_H
+#define JUMP_MATRIX_H
+
+#include <stdlib.h>
+#include <stdint.h>
+#include <inttypes.h>
+
+#include "config.h"
+
+typedef struct F2LinJump F2LinJump;
+typedef struct F2LinRngGeneric F2LinRngGeneric;
+
+/**
+ * A jump as a matrix over GF(2) acting on the state bits of the generator 
+ * (see f2lin_rng_generic_get_state()), stored as byte sliced lookup tables:
+ * For every byte b of the state there is a table of 256 entries, where entry v is the 
+ * sum of the columns of the matrix selected by the bits of v.
+ *
+ * Entry v of table b consists of the words table[(b * 256 + v) * words ...].
+ * Applying the matrix is then one lookup per byte of the state.
+ */
+typedef struct F2LinJumpMatrix F2LinJumpMatrix;
+struct F2LinJumpMatrix {
+    size_t words;
+    uint64_t* table;
+};
+
+/**
+ * Returns 1 if generators of @param type are small enough to jump with a matrix.
+ */
+int f2lin_jump_matrix_supported(enum F2LinRngType type);
+
+/**
+ * Computes the matrix of @param jump, by jumping every unit vector of the state of a 
+ * generator of the type of @param jump.
+ */
+F2LinJumpMatrix* f2lin_jump_matrix_init(F2LinJump* jump);
+
+/**
+ * Number of words in the tables of a matrix with @param words state words.
+ */
+size_t f2lin_jump_matrix_table_words(size_t words);
+
+F2LinRngGeneric* f2lin_jump_matrix_apply(const F2LinJumpMatrix* matrix, F2LinRngGeneric* rng);
+void f2lin_jump_matrix_destroy(F2LinJumpMatrix* matrix);
+
+#endif
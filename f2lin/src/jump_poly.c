@@ -0,0 +1,93 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "jump_poly.h"
+
+/*------------------------------------------------------ 
+ * Header Implementations                              |
+ /----------------------------------------------------*/
+
+GF2X* f2lin_jump_poly_power_mod(const GF2XModulus* F, const size_t jump_size) {
+    GF2X* jump_poly = GF2X_zero_init();
+    GF2X* x = GF2X_zero_init();
+    GF2X_SetCoeff(x, 1, 1);
+
+    GF2X_PowerMod(jump_poly, x, jump_size, F);
+    
+    GF2X_zero_destroy(x);
+    return jump_poly;
+}
+
+GF2X* f2lin_jump_poly_power_mod_shifted(const GF2XModulus* F, const uint64_t e, 
+                                        const unsigned shift) {
+    // the exponent of GF2X_PowerMod is signed, so e is halved to fit and squared back
+    GF2X* jump_poly = f2lin_jump_poly_power_mod(F, e >> 1);
+
+    GF2X_SqrMod(jump_poly, jump_poly, F);
+    if (e & 1) {
+        GF2X* x = f2lin_jump_poly_power_mod(F, 1);
+        GF2X_MulMod(jump_poly, jump_poly, x, F);
+        GF2X_zero_destroy(x);
+    }
+
+    for (unsigned k = 0; k < shift; ++k) GF2X_SqrMod(jump_poly, jump_poly, F);
+    return jump_poly;
+}
+
+F2LinPow2Table* f2lin_jump_poly_pow2_table_init(const GF2XModulus* F, const size_t n) {
+    F2LinPow2Table* table = calloc(1, sizeof(F2LinPow2Table));
+    table->F = F;
+    table->n = n;
+    table->x2k = calloc(sizeof(GF2X*), n);
+
+    if (n == 0) return table;
+
+    // x^(2^0) = x, which might still need to be reduced for very small p
+    table->x2k[0] = f2lin_jump_poly_power_mod(F, 1);
+
+    // x^(2^k) = (x^(2^(k-1)))^2
+    for (size_t k = 1; k < n; ++k) {
+        table->x2k[k] = GF2X_zero_init();
+        GF2X_SqrMod(table->x2k[k], table->x2k[k - 1], F);
+    }
+
+    return table;
+}
+
+void f2lin_jump_poly_pow2_table_destroy(F2LinPow2Table* table) {
+    if (!table) return;
+
+    for (size_t k = 0; k < table->n; ++k) GF2X_zero_destroy(table->x2k[k]);
+
+    free(table->x2k);
+    free(table);
+}
+
+GF2X* f2lin_jump_poly_compose(const F2LinPow2Table* table, const size_t jump_size) {
+    GF2X* jump_poly = GF2X_zero_init();
+    size_t bits = jump_size;
+    int first = 1;
+
+    if (table->n < 64 && bits >> table->n) {
+        fprintf(stderr, "Jump size %zu is too large for a table of %zu entries, "
+                        "falling back to exponentiation\n", jump_size, table->n);
+        GF2X_zero_destroy(jump_poly);
+        return f2lin_jump_poly_power_mod(table->F, jump_size);
+    }
+
+    // x^0 = 1
+    if (!bits) {
+        GF2X_SetCoeff(jump_poly, 0, 1);
+        return jump_poly;
+    }
+
+    for (size_t k = 0; bits; ++k, bits >>= 1) {
+        if (!(bits & 1)) continue;
+
+        if (first) GF2X_copy(jump_poly, table->x2k[k]);
+        else GF2X_MulMod(jump_poly, jump_poly, table->x2k[k], table->F);
+        first = 0;
+    }
+
+    return jump_poly;
+}
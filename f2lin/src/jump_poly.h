@@ -0,0 +1,52 @@
+#ifndef JUMP_POLY_H
+#define JUMP_POLY_H
+
+#include <stdlib.h>
+#include <stdint.h>
+#include <inttypes.h>
+#include "gf2x_wrapper.h"
+
+/**
+ * The polynomials x^(2^k) mod p for k = 0..n-1, where p is the minimal polynomial
+ * of a generator.
+ *
+ * Since x^(a + b) = x^a * x^b, the jump polynomial of any jump size below 2^n is the
+ * product of the entries for the bits set in the jump size.
+ */
+typedef struct F2LinPow2Table F2LinPow2Table;
+struct F2LinPow2Table {
+    const GF2XModulus* F;
+    GF2X** x2k;
+    size_t n;
+};
+
+/**
+ * Calculates the jump polynomial x^@param jump_size mod @param F by exponentiation.
+ */
+GF2X* f2lin_jump_poly_power_mod(const GF2XModulus* F, const size_t jump_size);
+
+/**
+ * Calculates x^(@param e * 2^@param shift) mod @param F, for jumps too large for size_t. 
+ * x^e is computed by exponentiation and then squared @param shift times.
+ */
+GF2X* f2lin_jump_poly_power_mod_shifted(const GF2XModulus* F, const uint64_t e, 
+                                        const unsigned shift);
+
+/**
+ * Initializes the table of x^(2^k) mod @param F for k = 0..@param n-1 by repeated
+ * squaring. @param F is not copied, so it has to outlive the table.
+ *
+ * The table must be destroyed with f2lin_jump_poly_pow2_table_destroy().
+ */
+F2LinPow2Table* f2lin_jump_poly_pow2_table_init(const GF2XModulus* F, const size_t n);
+
+void f2lin_jump_poly_pow2_table_destroy(F2LinPow2Table* table);
+
+/**
+ * Calculates the jump polynomial x^@param jump_size mod p by multiplying the entries of
+ * @param table for every bit set in @param jump_size. 
+ * This needs popcount(jump_size) - 1 modular multiplications.
+ */
+GF2X* f2lin_jump_poly_compose(const F2LinPow2Table* table, const size_t jump_size);
+
+#endif
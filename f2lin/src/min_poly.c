@@ -0,0 +1,81 @@
+#include "min_poly.h"
+
+/*------------------------------------------------------
+ * Forward Declarations                                |
+ /----------------------------------------------------*/
+
+static
+int is_prime(long n);
+
+/*------------------------------------------------------
+ * Header Implementations                              |
+ /----------------------------------------------------*/
+
+F2LinPoly* f2lin_min_poly_compute(const F2LinRngGeneric* rng) {
+    const enum F2LinRngType type = f2lin_rng_generic_type(rng);
+    const size_t n = 2 * f2lin_rng_generic_state_size(type);
+    uint64_t* seq = calloc((n >> 6) + 1, sizeof(uint64_t));
+    F2LinRngGeneric* copy = f2lin_rng_generic_init_zero(type);
+    F2LinPoly* p;
+
+    // copying keeps the parameters of rng
+    f2lin_rng_generic_copy(copy, rng);
+    for (size_t i = 0; i < n; ++i) {
+        seq[i >> 6] |= (f2lin_rng_generic_next_state(copy) & 1ull) << (i & 63);
+    }
+    p = f2lin_poly_min_poly_seq(seq, n);
+
+    f2lin_rng_generic_destroy(copy);
+    free(seq);
+    return p;
+}
+
+char* f2lin_min_poly_compute_string(const F2LinRngGeneric* rng) {
+    F2LinPoly* p = f2lin_min_poly_compute(rng);
+    char* s = f2lin_poly_to_string(p);
+
+    f2lin_poly_destroy(p);
+    return s;
+}
+
+int f2lin_min_poly_irreducible(const F2LinPoly* p) {
+    const long n = f2lin_poly_deg(p);
+    F2LinPolyMod* F;
+    F2LinPoly* r;
+    F2LinPoly* x;
+    size_t weight = 0;
+    int irreducible;
+
+    if (n < 2) return n == 1;
+    if (!is_prime(n)) return -1;
+
+    // x and x + 1 are the only factors of x^2 - x, so p must not vanish at 0 or 1
+    for (size_t i = 0; i < p->len; ++i) weight += __builtin_popcountll(p->w[i]);
+    if (!f2lin_poly_coeff(p, 0) || !(weight & 1)) return 0;
+
+    // every irreducible factor of p has a degree dividing n, so 1 or n
+    F = f2lin_poly_mod_init(p);
+    r = f2lin_poly_init();
+    x = f2lin_poly_init();
+    f2lin_poly_set_coeff(x, 1, 1);
+    f2lin_poly_copy(r, x);
+    for (long i = 0; i < n; ++i) f2lin_poly_sqr_mod(r, r, F);
+    irreducible = f2lin_poly_equal(r, x);
+
+    f2lin_poly_destroy(x);
+    f2lin_poly_destroy(r);
+    f2lin_poly_mod_destroy(F);
+    return irreducible;
+}
+
+/*------------------------------------------------------
+ * Internal Implementations                            |
+ /----------------------------------------------------*/
+
+static
+int is_prime(long n) {
+    for (long d = 2; d * d <= n; ++d) {
+        if (n % d == 0) return 0;
+    }
+    return n > 1;
+}
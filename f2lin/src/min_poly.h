@@ -0,0 +1,50 @@
+#ifndef MIN_POLY_H
+#define MIN_POLY_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdlib.h>
+#include <stdint.h>
+#include <inttypes.h>
+
+#include "config.h"
+#include "f2poly.h"
+#include "rng_generic/rng_generic.h"
+
+/**
+ * Computes the minimal polynomial of the transition of @param rng at runtime, from the 
+ * lowest bit of the next 2 * state size words returned by next_state (see 
+ * f2lin_poly_min_poly_seq()). @param rng is left unchanged.
+ *
+ * Strictly this is the minimal polynomial of that bit sequence, which divides the one of
+ * the transition. It is the same unless the state of @param rng lies in a smaller 
+ * invariant subspace, like the default state of tinymt does, so generators should be 
+ * seeded with f2lin_rng_generic_init_seed().
+ *
+ * Unlike the headers written by minpoly.cpp this works for any parameters of a generator,
+ * see f2lin_jump_cache_min_poly() for computing them once per process.
+ */
+F2LinPoly* f2lin_min_poly_compute(const F2LinRngGeneric* rng);
+
+/**
+ * Like f2lin_min_poly_compute(), but returns the polynomial in the format of 
+ * f2lin_rng_generic_min_poly(). Has to be freed by the caller.
+ */
+char* f2lin_min_poly_compute_string(const F2LinRngGeneric* rng);
+
+/**
+ * Returns 1 if @param p is irreducible, 0 if it isn't. Only prime degrees are decided
+ * (with the test of rabin, which needs no gcd for them), -1 is returned for all others.
+ *
+ * For a prime degree n with a mersenne prime 2^n - 1, like n = 127 for tinymt, an 
+ * irreducible minimal polynomial means the generator has the maximal period 2^n - 1.
+ */
+int f2lin_min_poly_irreducible(const F2LinPoly* p);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
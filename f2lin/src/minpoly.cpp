@@ -2,59 +2,47 @@
 #include <cstring>
 #include <cstdio>
 
-#include "NTL/GF2X.h"
-
 #include "rng_generic/rng_generic.h"
+#include "min_poly.h"
 
 #define F_NAME "minpoly.h"
 
-/* Forward Declarations */
-static void f2lin_init_min_poly(NTL::GF2X& p_min);
-
-/* Internal Implementations */
-static void f2lin_init_min_poly(NTL::GF2X& p_min) {
-
-    const int state_size = f2lin_rng_generic_state_size();
-    const size_t seq_len = 2 * state_size;
-
-    NTL::vec_GF2 seq(NTL::INIT_SIZE, seq_len);
-    F2LinRngGeneric* rng = f2lin_rng_generic_init();
-
-    for (size_t i = 0; i < seq_len; ++i) {
-        seq[i] = f2lin_rng_generic_next_state(rng) & 1ull;
-    }
-
-    NTL::MinPolySeq(p_min, seq, state_size);
-}
-
-// store the coefficients of polynomial of degree n in a string of the form
-// a_0*x^n, a_1*x^(n-1) ... a_n*
-// Note that the string is NOT null terminated
-static char* f2lin_minpoly_to_string(NTL::GF2X& p_min) {
-    int deg = NTL::deg(p_min);
-    std::cout << deg << std::endl;
-    
-    char* buf = (char*) calloc(sizeof(char), deg + 1);
-
-    for (int i = deg; i >= 0; --i) { 
-        NTL::coeff(p_min, i) == 1 ? buf[i] = '1' : buf[i] = '0';
-    }
-
-    return buf;
-}
-
+/* the generator to compute the minimal polynomial of, set by the Makefile */
+#ifndef RNG_TYPE
+#define RNG_TYPE RNG_TYPE_DEFAULT
+#endif
+
+/* 
+ * the sequence of a single state only gives a divisor of the characteristic polynomial if 
+ * the state lies in a smaller invariant subspace, like the default state of tinymt does.
+ * Seeded states can miss small components as well (dSFMT with seed 1 misses one of degree
+ * 2), so the polynomial of largest degree among these seeds is taken.
+ */
+static const uint64_t seeds[] = { 1, 2, 3, 12323456 };
+
+// the polynomial is computed with the native berlekamp-massey (see min_poly.h) and stored 
+// as a string of the form a_0, a_1 ... a_n, with a_i the coefficient of x^i
 int main(void) {
-    char* p_min_string;
+    char* p_min_string = 0;
     FILE* file;
-    NTL::GF2X p_min;
-    size_t p_min_len;
+    size_t p_min_len = 0;
 
     /* initialize minimal polynomial and write it to string */
     printf("%s\n", F_NAME);
-    f2lin_init_min_poly(p_min);
-    p_min_len = NTL::deg(p_min) + 1;
-    //std::cout << p_min << std::endl;
-    p_min_string = f2lin_minpoly_to_string(p_min);
+    for (size_t i = 0; i < sizeof(seeds) / sizeof(seeds[0]); ++i) {
+        F2LinRngGeneric* rng = f2lin_rng_generic_init_seed(RNG_TYPE, seeds[i]);
+        char* s = f2lin_min_poly_compute_string(rng);
+
+        if (strlen(s) > p_min_len) {
+            free(p_min_string);
+            p_min_string = s;
+            p_min_len = strlen(s);
+        } else {
+            free(s);
+        }
+        f2lin_rng_generic_destroy(rng);
+    }
+    printf("%zu\n", p_min_len - 1);
 
     file = fopen((char*) F_NAME, "w");
     if (!file) {
@@ -69,6 +57,8 @@ int main(void) {
     }
 
     fwrite("\"", sizeof(char), 1, file);
+    fclose(file);
 
+    free(p_min_string);
     return EXIT_SUCCESS;
 }
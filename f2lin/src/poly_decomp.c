@@ -17,25 +17,35 @@ static F2LinPolyDecomp* f2lin_poly_decomp_init(int q, int deg) {
     return pd;
 }
 
-// TODO test this
-F2LinPolyDecomp* f2lin_poly_decomp_init_from_gf2x(const GF2X* jump_poly, const int Q) {
-    int i = GF2X_deg(jump_poly);
+F2LinPolyDecomp* f2lin_poly_decomp_init_from_poly(const F2LinPoly* jump_poly, const int Q) {
+    long i = f2lin_poly_deg(jump_poly), k;
     F2LinPolyDecomp* dp = f2lin_poly_decomp_init(Q, i);
 
-    for (; i >= Q; --i) {
-        if (GF2X_coeff(jump_poly, i) == 0) continue;
+    // jump directly to the next nonzero coefficient, instead of testing each of them
+    while ((k = f2lin_poly_prev_set(jump_poly, i)) >= Q) {
         // TODO make typedefs for h and d
         // actually, we should never need to reallocate.
-        dp->h[dp->m] = f2lin_determine_gray_enumeration(Q, i, jump_poly);
-        i -= Q;
-        dp->d[dp->m] = i;
+        dp->h[dp->m] = f2lin_determine_gray_enumeration(Q, k, jump_poly);
+        dp->d[dp->m] = k - Q;
         ++dp->m;
+        i = k - Q - 1;
     }
+
+    // the remaining coefficients below q form the last window
+    if (i > Q - 1) i = Q - 1;
     dp->hm1 = f2lin_determine_gray_enumeration(i + 1, i + 1, jump_poly);
 
     return dp;
 }
 
+F2LinPolyDecomp* f2lin_poly_decomp_init_from_gf2x(const GF2X* jump_poly, const int Q) {
+    F2LinPoly* packed = GF2X_pack(jump_poly);
+    F2LinPolyDecomp* dp = f2lin_poly_decomp_init_from_poly(packed, Q);
+
+    f2lin_poly_destroy(packed);
+    return dp;
+}
+
 void f2lin_poly_decomp_destroy(F2LinPolyDecomp* pd) {
     free(pd->h);
     free(pd->d);
@@ -5,6 +5,7 @@
 #include <stdint.h>
 #include <inttypes.h>
 #include "gf2x_wrapper.h"
+#include "f2poly.h"
 
 typedef struct F2LinPolyDecomp F2LinPolyDecomp;
 struct F2LinPolyDecomp {
@@ -20,6 +21,11 @@ struct F2LinPolyDecomp {
  *
  * @param decomp_poly can not be 0
  */
+F2LinPolyDecomp* f2lin_poly_decomp_init_from_poly(const F2LinPoly* jump_poly, const int Q);
+
+/**
+ * Same as f2lin_poly_decomp_init_from_poly(), but packs @param jump_poly first.
+ */
 F2LinPolyDecomp* f2lin_poly_decomp_init_from_gf2x(const GF2X* jump_poly, const int Q);
 
 /**
@@ -0,0 +1,161 @@
+#include <stdio.h>
+#include <string.h>
+
+#include "position.h"
+#include "advance.h"
+#include "jump_ahead.h"
+
+/*------------------------------------------------------
+ * Forward Declarations                                |
+ /----------------------------------------------------*/
+
+static
+size_t checkpoint_offset(enum F2LinRngType type);
+
+static
+F2LinRngGeneric* checkpoint(const F2LinRngGeneric* rng);
+
+static
+int less(F2LinPosition a, F2LinPosition b);
+
+static
+F2LinPosition sub(F2LinPosition a, F2LinPosition b);
+
+static
+int move(F2LinRngGeneric* rng, F2LinPosition n);
+
+/*------------------------------------------------------
+ * Header Implementations                              |
+ /----------------------------------------------------*/
+
+size_t f2lin_position_sizeof(enum F2LinRngType type) {
+    const size_t align = f2lin_rng_generic_alignof(type);
+    const size_t size = checkpoint_offset(type) + f2lin_rng_generic_sizeof(type);
+
+    return (size + align - 1) & ~(align - 1);
+}
+
+F2LinRngGeneric* f2lin_position_init_at(const F2LinRngGeneric* rng, void* mem) {
+    const enum F2LinRngType type = f2lin_rng_generic_type(rng);
+    F2LinRngGeneric* tracked = mem;
+
+    if (rng == tracked) {
+        if (rng->tracked) return tracked;
+    } else if (rng->tracked) {
+        memcpy(mem, rng, f2lin_position_sizeof(type));
+        return tracked;
+    } else {
+        memcpy(mem, rng, f2lin_rng_generic_sizeof(type));
+    }
+
+    tracked->tracked = 1;
+    f2lin_position_reset(tracked, tracked, (F2LinPosition) { 0, 0 });
+    return tracked;
+}
+
+void f2lin_position_reset(F2LinRngGeneric* rng, const F2LinRngGeneric* origin,
+                          F2LinPosition pos) {
+    F2LinRngTrack* track = f2lin_position_track(rng);
+    F2LinRngGeneric* cp = checkpoint(rng);
+
+    // the checkpoint is a plain generator, so it is copied with its parameters
+    memcpy(cp, origin, f2lin_rng_generic_sizeof(f2lin_rng_generic_type(rng)));
+    cp->tracked = 0;
+
+    track->pos = pos;
+    track->checkpoint_pos = pos;
+}
+
+int f2lin_position_seek(F2LinRngGeneric* rng, F2LinPosition target) {
+    F2LinRngTrack* track = f2lin_position_track(rng);
+    const size_t size = f2lin_rng_generic_sizeof(f2lin_rng_generic_type(rng));
+    F2LinPosition n;
+    int from_checkpoint;
+    void* saved = 0;
+
+    if (less(target, track->checkpoint_pos) && less(target, track->pos)) {
+        fprintf(stderr, "Position %" PRIu64 ":%" PRIu64 " is before the checkpoint at "
+                "%" PRIu64 ":%" PRIu64 "\n", target.hi, target.lo,
+                track->checkpoint_pos.hi, track->checkpoint_pos.lo);
+        return -1;
+    }
+
+    // the checkpoint is the start if the target is behind the position, or closer to it
+    from_checkpoint = less(target, track->pos) ||
+        (less(track->pos, track->checkpoint_pos) && !less(target, track->checkpoint_pos));
+    n = sub(target, from_checkpoint ? track->checkpoint_pos : track->pos);
+
+    // the jump of the upper word can fail, which has to leave rng as it was before
+    if (n.hi) {
+        if (!(saved = malloc(size))) {
+            fprintf(stderr, "Unable to allocate memory for seeking\n");
+            return -1;
+        }
+        memcpy(saved, rng, size);
+    }
+
+    if (from_checkpoint) {
+        memcpy(rng, checkpoint(rng), size);
+        rng->tracked = 1;
+    }
+
+    if (move(rng, n)) {
+        memcpy(rng, saved, size);
+        free(saved);
+        return -1;
+    }
+
+    free(saved);
+    track->pos = target;
+    return 0;
+}
+
+/*------------------------------------------------------
+ * Internal Implementations                            |
+ /----------------------------------------------------*/
+
+// the checkpoint follows the track, aligned like the generator
+static
+size_t checkpoint_offset(enum F2LinRngType type) {
+    const size_t align = f2lin_rng_generic_alignof(type);
+    const size_t track_align = _Alignof(F2LinRngTrack);
+    size_t offset = f2lin_rng_generic_sizeof(type);
+
+    offset = (offset + track_align - 1) & ~(track_align - 1);
+    offset += sizeof(F2LinRngTrack);
+    return (offset + align - 1) & ~(align - 1);
+}
+
+static
+F2LinRngGeneric* checkpoint(const F2LinRngGeneric* rng) {
+    return (F2LinRngGeneric*) ((char*) rng + checkpoint_offset(f2lin_rng_generic_type(rng)));
+}
+
+static
+int less(F2LinPosition a, F2LinPosition b) {
+    return a.hi < b.hi || (a.hi == b.hi && a.lo < b.lo);
+}
+
+// a - b, where b is not larger than a
+static
+F2LinPosition sub(F2LinPosition a, F2LinPosition b) {
+    return (F2LinPosition) { a.hi - b.hi - (a.lo < b.lo), a.lo - b.lo };
+}
+
+// moves rng ahead by n numbers, the upper word with a jump of its own. Returns -1 if 
+// that jump fails, after which rng may have been moved to the start of the seek
+static
+int move(F2LinRngGeneric* rng, F2LinPosition n) {
+    if (n.hi) {
+        F2LinJump* jump = f2lin_jump_ahead_init_rng_high(rng, n.hi, 0);
+        const int jumped = jump && f2lin_jump_ahead_jump(jump, rng);
+
+        if (jump) f2lin_jump_ahead_destroy(jump);
+        if (!jumped) {
+            fprintf(stderr, "Unable to jump %" PRIu64 " * 2^64 numbers ahead\n", n.hi);
+            return -1;
+        }
+    }
+    if (n.lo) f2lin_advance_rng(rng, n.lo);
+    return 0;
+}
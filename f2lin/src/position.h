@@ -0,0 +1,86 @@
+#ifndef POSITION_H
+#define POSITION_H
+
+#include <stdlib.h>
+#include <stdint.h>
+#include <inttypes.h>
+
+#include "config.h"
+#include "rng_generic/rng_generic.h"
+
+/**
+ * The position of a tracked generator in its stream, stored right after the generator.
+ * It is followed by the checkpoint, a copy of the generator at checkpoint_pos, from which
+ * f2lin_position_seek() starts if that is closer to the target than the current position.
+ * A tracked generator with its track and checkpoint takes f2lin_position_sizeof() bytes.
+ *
+ * Only the functions of f2lin.h count numbers, generating through the backends directly
+ * (e.g. f2lin_rng_generic_gen64()) leaves the position unchanged.
+ */
+typedef struct F2LinRngTrack F2LinRngTrack;
+struct F2LinRngTrack {
+    F2LinPosition pos;
+    F2LinPosition checkpoint_pos;
+};
+
+/**
+ * Size in bytes of a tracked generator of @param type, including its track and checkpoint.
+ * The alignment is the one of the generator, f2lin_rng_generic_alignof().
+ */
+size_t f2lin_position_sizeof(enum F2LinRngType type);
+
+/**
+ * Initializes a tracked copy of @param rng in @param mem, which has to hold
+ * f2lin_position_sizeof() bytes aligned to f2lin_rng_generic_alignof(). If @param rng is
+ * tracked, its position and checkpoint are copied as well. Otherwise the copy is at
+ * position 0, which is also its checkpoint. @param rng may be at @param mem, which then
+ * starts tracking it in place.
+ */
+F2LinRngGeneric* f2lin_position_init_at(const F2LinRngGeneric* rng, void* mem);
+
+/**
+ * Sets the position of the tracked @param rng to @param pos, and makes @param origin, a
+ * generator of the same type, its checkpoint at @param pos. @param origin may be @param rng.
+ */
+void f2lin_position_reset(F2LinRngGeneric* rng, const F2LinRngGeneric* origin,
+                          F2LinPosition pos);
+
+/**
+ * Moves the tracked @param rng to position @param target. The move starts from the
+ * current position or the checkpoint, whichever is closer below the target, and advances
+ * from there with f2lin_advance_rng(), so jumps by distances seeked before are found in
+ * the jump cache. Distances of 2^64 numbers and more need a jump which is computed for
+ * this move only (see f2lin_jump_ahead_init_rng_high()).
+ *
+ * Returns -1 and leaves @param rng and its position unchanged if @param target is before
+ * the checkpoint, or if the jump for 2^64 numbers and more fails.
+ */
+int f2lin_position_seek(F2LinRngGeneric* rng, F2LinPosition target);
+
+static inline
+F2LinPosition f2lin_position_add(F2LinPosition pos, uint64_t n) {
+    pos.lo += n;
+    pos.hi += pos.lo < n;
+    return pos;
+}
+
+static inline
+F2LinRngTrack* f2lin_position_track(const F2LinRngGeneric* rng) {
+    const size_t size = f2lin_rng_generic_backend(rng)->size;
+    const size_t align = _Alignof(F2LinRngTrack);
+
+    return (F2LinRngTrack*) ((char*) rng + ((size + align - 1) & ~(align - 1)));
+}
+
+/**
+ * Adds @param n numbers to the position of @param rng, if it is tracked.
+ */
+static inline
+void f2lin_position_count(F2LinRngGeneric* rng, uint64_t n) {
+    if (rng->tracked) {
+        F2LinRngTrack* track = f2lin_position_track(rng);
+        track->pos = f2lin_position_add(track->pos, n);
+    }
+}
+
+#endif
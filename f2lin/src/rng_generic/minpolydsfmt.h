@@ -0,0 +1 @@
+#define MIN_POLY "11000000001111111111110011000000111100110011111111001100001100110011000011110011111111110011111111000011111100111100111000110011001110000111111000000001111000000111111000011001111110000000011000011000000001100001111110000000000001111111010010000010000011001111111100001111111100000000110011110011000011110011001111000011001100110000000000001111110011000001110001110010011010000110101111001111111101000010000010000110011011100000100101111100011111100000000111111111100001111101000000000000001111000011010000110011001011100011100000001000010000010011010001010111000100000001100010101111110101001100100101101101001000100100011100001001001010000111111001011111010010011000110000101100001000110100111100010011001011001100111100110011001111110000000011001100001100001100110011111100001111001111110000110011000011110000000011110011110000110000101010001101011111001001011111101100001111000010000000111110001001100000011110011000000110011111100001111111010111011000000101010000001010100000001101111000000010011011010000010111101000101111100110110001111010011100001110111110010011000110111011111000100110001000110000011000011001011101111010010111000111110000101001001001011100011100010100111111001100100000101111001100111011001111001010110111000100101110000011110011001100111011000011110011110011111011001101100000010001101011110110111010010011010011011001001111101100010110101111100110011110001010010111001011110110000100111111011011011010111000100110100010100111011101011110111001111110010000110001011101010100111100011101111000111010101111000100001011001001111001101010011111001101011001101010111011111110001100101110000101101110011010111110110101010011010001000111001000011000101000110101011001101001011111110010110011100001110011110001010101101010111110001100001110000101011000111010011100010000100010110011101001000011001000101100101110011011100010010101101001110100110000111101001011110010100011110101000100100001110100010101001101010101110101100110100101110101001101010001111010010100000000110000001111111111100110001111101110001000100010110001100001101000110101010111010111001101111111111000100100100101001101001101010100010001011100100111011101100101011100000000100111000000011011110001110011011100010101000000011111011001000111000011000101010011010101100110011101000100101101011010111101000011010000110111000000111100110100010011001110101111011111101011100101001011001110111000011001011001001101111011001110101000100001000111110000000110011010010010110011000101111111010110010011111110110110111101101010000011010011011111110101110110101010010100001110101111111010011110110011111001000000001011100111110101011100100011001010110000100110000000011000111010000110111000111011011001100111111011111100011101100101110000001010001010000100011011100100110111111000000010101010011011101100101011101001101110001101010110011110001111011010011110001011101011001011111010111011001101001111111101011110001101010001101000100110111101010001000100111101010000000001000101001111000000110010101111100100101010100010000010000110100010000011111001110010010110001100011101110001010000111000001101110010100101111101100000010011001011101000101001100011011101011111000110100100110010100001010101010110011000100011111011100001010010010000011111111000110111000100001100101110011000111111001111001101001101010100000011011110001110110110001011010001000011011110011000111011101000111111011011101011111011110101100010000110100011010011001010001101011111101000011011111000011011110100010111011011100011010000110101000011100100110010001101101000000001010010010011000101010011110101001010101111110100000110001101000000000010010110110101000110010100010011111001000011110010000100101010100001000100001001000010110001101000100111101010000101100011010111111010001100101010111011101111011111110110101000000110101101100110000010010110100000010001011000100111101011110110111011011100010110111101111011011100000111010111011111111101010000111001101101000101000011110010101111100011001010101100101110110110101110010110101011010010010001110011110001010100111011001110110001010111111101000100001110011111001100010011000110110000000101101101001010000101010101110000111100111001111101001100011111101001000111101100000011111001110101011000101001101011110001100110010100111010011011000111011101100010111010101000001001111011111000110111101011110110101111101110111101000100011011000101101010101001010101110010001101101111100101110100000001101001011001100100100101100011011111101000110101110101110000100010100001110110110001001111000001001001101011000001100101110100011001000011111100001000011010001000000011010000100111101010001111110001011001011000110110101000100100011110011111101101111000001000110101011001100010101100110111101100100010100000101100001011110101000000100000000011111101111111011010100100110101110001011111110000110101000101011000000001010010010101001110101010011100111100001011101001010010001101011000101101100001100001111101010110010000000000011110000111111100001110111010010101101100010101100110110001001000111001111001010010100001011111011101010111011000101001000011001111111110100011100100001000010000001010100110001110111010011111101000010010010001111000101011000011011001001111010000101101110111111000001010110000100111101010101010111001000110000110111000100000100111110111110110111011010110001010001111011110001100101110000000110110111101001110000001000001011001011010001001001111001101000010110111000111110100110100101111111101110111000010100110000111100111010010001001000000010000001000101110100000001100011010011101010101001010000110100100101101111110011000011001001011000010111111000101001000100101001011000001100110111110100001010001000100111100101001010011111000100100111101101011011011110011011111001000101101100110001101101110010111100000011001001011000111010001001000001111111111010001100100011011001111110011111101110011010001001100111011101000111110100000000110111111111101011110101011101100111001100010110100111000111111110010001111101110000001100011111101111000111100000010110011101101101001000010110110101110010111010000101011100001000100010110100011010100110001000101101011001100101100011011011000011111011011001010111110010101000000010000100101001001110010100101110010111110011011110001001010001000001010100001110001011101111001010111010100100110111100110001011000110110001101001110111101001010001111111010001110010000101111110101110011100000000011011001000010110001111110110010110100101100111110000010111000000110110001110110110101111001011101011110111101000011011110011101101111011111101010010000011000000000001101001000111110100010100000110011000100001111100011000010100001010001011000010011101011111110001111011010010111000111000100011010001010001111001000101100100000111010001001010101111001011100111110001111001101000101111010101000000100011001010110000011000110011111011010001110111111110001000000100110001010001011011100010000011110101110011011010101010101110000111101100100001000101101001111000010000100101100010110001001001110101010111111000011001101111110010000101000101011011100000101100001100101000101011110001000001001101000100100011111011010100100011010011000011110010000010010110110101101010010010101010010111100101100001111101001111011001000101010011100001101000011111010001011001001001110001000011011111000000010110010011000110111100000001011100010000100100000000111100110110110001001001001010100011000011100010110110100011010110011000101101110011010110011110010001000010011011100001011111110010111010001000101100100110100001011100011001110010011100101011110011101000000001111011000101110100110100000000001101000110000011010101011111111101100011110100100100110011011111011111001010001100101010100011010111001000001110011100100110101010011011001101011110000100101000101101111011110011010100111111110011110110101000011100011000010010011001111100010101100000110000011100111001011011010100000010101001001110100001001110010001010111000110000100100010110111011001110111101010001100010001010011000000010010100011010001011010001000101000111011010010001101110001000101100101100110100101111100110001010000101101000100111010101101111000101111111110010111010010110011011110000001001010110111011101101100110010010111101001001101000001000110101111010011010011111010001001101001110100111011101011111111001011011000001110100110011101001111011111110000110100101011110010011100001100000000101101110011001001110010000011110111101000101101010101001101010011001010000100010101010010110101111110010101100011110100111010101110100110110101011110100110011000101101001101000000011101011101011111101010001100011100111101000111101110100100000001010000110000010101100000111110000110110110001110111101101010000100101101111100010011010010101100101011010001101011100110011000101110101101101010110001110010110010000101000110111001111010001010011001011000110011101101101100101101101010000101111101100100110110010100110000001101111011100111110111100101000110110110100001000000110011101000010010000001111010110010011000100110001111111010011010010001001011011111000010100011110000010001010110001110010010000010101000001001001111010010001010100011010101000001001110100101010111001010000000000010110100010101000110000001111111111101100110000010001101001011000011001010100011101100100100110101100100111001010101011110000000000101111100101100101000101101100010101010110010000011111000001100110101001001010010101110101110111100001000001011000101111110100001100100101100010010111000100110000010111010110110111110100100110110110100101110101001101011001110101010100101001001111111001100011000011100011000100011010111101011100000011101101100110111111000001111100110000001101101010110000110111110101101011010110000101010101101000110101001010101111100011010100110000101001100110110101111110000001000110010111111101011101101101000110001010110011001111101011010110010000001011100011100000100110000110010010010011011110110011000001000011001100110110101000100100101000000000110110101100001110110110100101101101100110111100011101001100000100001010011110100101100111100010101001000100100101110100010111101100101110100110110101110001010101010100000001001110111110100110001111100101111000100111011111101011011101011001110011011100110011011000111100110000110101101111110010001111100100010000010111100011111000110111111000110111101000010100010101011100000110000111110110111100000011011000110001100001111001000011100010101011100110000001010100101110100110010001001110000010001110110000100001110011010111111110110001011101101011000100011000110110110000001100011100101110010101110110101011101010100001011010011000110101001001010010110100010100100100001110101010110000000101111000111011000011010110101010011001001110000000000000010110110110100100101101011100100001111101111011101110100001001111001111111111101000101111001001110111000010101010100111110110011101101011000111010010001110011110101010100011010001011001111100100100110011110010010000001011110101010000000110001011010001101101011000101100110000100000011011010010100110111001001101101110000111011100010001110100001100110001111101100111010001110100001111001100010001011001110101111111101010011101110011010000100000100110110000000111110101110111110010001001011000011110110110001100010000110100110010011011110011110101000111110110001000111001000110010111010010001100010110001011110101111010010011101011000111001100000001010100000010101100010011101110101000000111111111111001000110101010011010101110000011100111000101111011001110011111001101110110001101101111011100000001101110100001101101000111000111010101001000010111010100010000111010011001111101010100001000010101000100111100100000111100101010011001101000110110000100110111101100001011010011000110010001110011111101110010010000011001000101110010101101101111100010001100101011111110111100001111100001001000000100001000000011000001101010010000111110010101000111111010111101111011101001110110110010011101011110111011100101000000010000001111101111001000100001011111011010010000101101111100010010101100001000011100011111010101111001101000010001010100101101001011001010010010010100010000110011101100101011011000010101111010110110101101100010000111111000110100000010000101010110001000010000011101011001010000010100110000111000111111011001100111011101000111110011011110010100011001000101100101001001110101100000110010001111011001111010111010011011010100110001111001101000111110110110111100010011110111111011101111111000111111111100111010011010011111101100011111100000110101001010011100101000011110000001010010001110100011111001000001000110100101101100011010101100001010101100000001011001010110000010001101000110000000110000110110010001101110100011111000100011001010110110110111101000000000011100010110110011001010100010100100111011010100110110010010011110011011101001010111001010010111000000110111100001010011111101000011010110110111000111100000101001000011010000001011101010011011011011110100000101101011010010101110010010001010110001000001101100001100000111010001101010101011101001001010110001010111010110110010001010001111011101010110110001011101110001100011010110001101000110011111000011110011111000010100111110011101111000100001100100101100100111110111110000110111111101110110011100010110110001011110001111010011010110001100100011011101101001101110000010000110010011000011101000010011001000011010010010111111010101011001000001110100110101111011101101101000101001100100011100101101110000110101000100011110001101000110111010110111000010111100000011111111001111011100000011101001010111000100001011100101111010100001101100010100001111100011110101100000111011100101011100111101100000000100001110001010001011111110111011111001010110110001010001101010110000110011010001000011011010111100111011111000010011100010100010000001101001001011101010010100000011000010011101101010000010100010101010111011111010011010011100011111001101100111001001101110100000101001101101110010001110000110000001010010100100010111011100010011011011100000100000101000001100001000111111011001110001101111101111011110111011111110011000111110000110111000100001111110001101111100000011111110000100000111111111100011111011001000000011101110011001010111101010110010011111101000100110010100101101000101001100110101010100101110101100000001111000100110101111100001101110001000000000100111001010011000001110000000110010111100110000111101110111110001001100111101011000110100011001110001100011100100000100011011001101010100100100101001101011100011111001000111001011101101110111110010110010110111000101100010011000100110111101110100011011101001101101001111110001011100110101001111010010101110111101001010010101000011000101000101010000101100011111000011111111001110001010100010111011110001111000100000000001110011000110101111011110000000011010110011000000111101010000011110100100101011001000111100010010000000001000001111100010110000110101000000011010011010110101101000000111010111010111000010010010011110110000000000010010110100101001100100111010111100011010110000111110001001110101101000111001010011001010000010110000000011010111110011010110000010010011001111010010101000110000000011001101000000000011001010101010101100001111111111010000110111000110011001110001011110110110000011011010011101100010110111000011110010101100111010100111110111001010000101000001101010010110110010001110001101101100110010001001111001011000111001111110100010111110111010101110110101110000010011011000010010000001100110010100110110001100100100001011110000100011001000000001010011001000110010101111101110100010011001000111010110011100110001111000110110010111110001010011110000110011111110110011001111010111001011000110001010100001101011101011010001011010100101000101001011011111000001111010111011111101110000110000100001101000111111011111100110010111000000100100001000011011110100000010100000100101101001000000001110011010101001111011011111111101001111111100000010011001000011110010100010001101110011110000111111110100000101111111010010000001000001010100001101110101011101101101001001011001111010011010110001001001011010001110010101001111000111001100111101100011111001010000101101110101110100010010111111000010100010001100001000000011000101000110101111010000100110011101100011011101011000001101101111001000101011100010000001101010010000001111110001101011010111000110011100001011010101011010000010101110001011110110011011011100011110111111101111001111000100110000111111001001101001100000011110101000110010010010101001001110110000010000011101100000101101111111111011011110001110010110110111010000100011100011001101010000101111100101101100010111111001000100110111011100001000011100100000000011010011101001111100110101110111011001110001000110011111101100000110110101101111110000100100110011101000111100111001100011111001001110110000000011010110100110100011000100101110010110111001110011000011100010101011001001000000011000110010000010001010100001010101001110001001100111000110011010010101111010001001110111101110011011101111011011000101011010111111000010110000100011110111101110100100100100110100100111101011010111110000100010000101011011100101000110010101010010100000001010101010100001101100111100110100110001000011110110100000101000010010001000011000110001111110111101010101000011000001101000011110001000010111001011000111101010010010011100011011100111010001000011010111101101110100101110011100110100011110000100011101010000000001111001001100101000000110100101010111101100000100111010000101101010110101111001010100010100010000001001011111010001111011101011000100101010011000000100111110011000110011110100011010110101000010010011111100011110001010100000101110111111011110001110111001000001001000010101101001100110001101101100111100011100101011011110111110110001011110100001111111110001111110110100000000101111111111111000100010110101100000000011100011111000011011100100011111001110101011111100101101100011110100010010111101000101100110110001010000000110100000001011101010000110010000111100000110111000011111001111010010110101010010001000011001010000001100101011100010110101001010110101100111001110110110100010011100000111101011000100111111001011001011111011110001101111000010000110111100101111000000110011010111111110111111001100001101111110110010101111111100010110011001111100111010000011111100010111010001100010101111110000100101011101111100111011100011000110111001011111100000011100010101111111010000000111101010111011000011111011100110011001101100110100110010001101011010011011101110110110110110011101000100100000000000101101001011101010000110000000010101010011111110101011111111010101000010111001111010000100101001111001001100101000100111110001110000010100100100100001010101101011100111001110101010110010000001001011001101001110111111011000000000111101011110100011111110110100111111100111011100110010101111001100111010111000111100100100000000110010000010111100110100110110011100001111011001111100110001011100110000111010101100001111111000000011000001100000000110111101010011100100100100110001011110001100111011110010000100010000001011100010000010101110100111110001111000101100010101011011100011101001110010111010101001000111111001011111000001111111011100100011110011110011111111110000110010001011010010000011000000000011101101110100100011001111000111000101101101101011001000000001000110011000100101110001111100101111001000001110000011001100101111001111001101111111111111110101111111010000100100000001001110100000000111000110111111010011010111110001110010011100110000001100001100000011011110110000110001000111110000001000101100110011011111111111111110110100110011001011100000111111010001111100000010001000110011110000111100110000100011110100111101110000101111001000010001000011100011000100001110001100010000111000110001000011101100110100110001000011100000000011110000000000010001000100101101110111010010111000011101001011011110000100101101111000010010110111011110110100100001110111100010000111101110000011111111000000001000000011111111000000001111110011111100111111110011111100111111001111110011111100111111001111110011110000111100001111110000111101110000111100001111000011110000111100001111001100110011001100111100110011001100110011001100110011001100110011001100111111111111111111110011111111111111111111111111111111111111111111111111111100000000000000000000000000000000000000000000000000000000000000000000000011"
\ No newline at end of file
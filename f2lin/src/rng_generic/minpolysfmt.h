@@ -0,0 +1 @@
+#define MIN_POLY "1000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000001000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000101000000000000000000000000000000000010000000000000000000000000001000000000000000000000000000000000000000000000000000000000000000000000000000000000000000010100000000000000000000000000000000000000000000000000000000000000101000000000000000000000000000000000000000000000000000000000000000000000000000000000000000010100000000000000000000000000000000000000000000000000000000000000101000000000000000000010001000000000000000000000000000000000000000000000000000000000000100000100000000000000000000010000000000000000000000000000000000000000001000000000000000001010100000000000000000000000000000000000000000000000000000000000010100000100000000000000000001000000000000000000000000000000000000000000000000000000000000001010001000000000000000000000000000000000000000000000000000000000010000010100000000000000000000000000000000000000000000000000000010000000000000000000000010000000000000000000000000001000000000000000000000000000000000000000010000010100000000000000010001000000000000000000000000000000001010000000000000000000000010001000000000000000000000100000000000010000000000000000000000000001010000000100000000000000000000010000000000000000000000000000101000000000000000000000100010000010000000000000000010001000000000010000000000000000000000000000010000000100000000000000010000100000000000000100010000000010101000000000000000000010101010000010000000000000000000100000000000010000000000000000000100010001010000010100000000010000000000000000000000010000010000000010001000000000000000000010000010001000000000000000100000100000010000010000000010000000010100000000010000010100000000000000010000000000000001000100000000100010001000000000000000100000101010000010000000000000000010000001010000000000001010000000010000010001010100000100000000000000000000010000000100010100000010100010101000000000000000101000000010000000000000001000100000000101000000000000001000000100000000000000000100000100010001000000010001000000010001000000011010100000101001000000000000000000001010000010000000000000000010010101000000100000000000010101010100000001000000010100000101000000000000000000000001010000111000100000001011010000000000000000100010001000000010000000000000010001010010001000101011010100000100000000000000010000010101000000000001000000010100000010101000100000000010000010001000100000001010000010000000101000000110010000010000111010000011000101000000000001000000000101000001000000000000000000010100010010001010100001000001010010000010100000100010000000100010100000000100010000100000010000110000000100010010001000000000000001000001000000000001000100000100100110000010100101000000100000001010000010110010000000000000001001000010110010000000010001011001010100000110010001000000010100000101000000000100000100000001100010000000110101000010111000100000000011100010001000100000000101100110110000100000011001000010010100010100000000000001010000000101000000000001010000000001000010000001110000001011000000100001000100100010100000001000111100000000010010100000011000011010000110010010010000000101000100000001000001000001010000100010100010000111110100101000011000000111000000010010001010100001111001100000011000100001010000011001001010110000001000000101000000010010000000000101010110100000000010001110100001101010001010000111000000000010101010001001001001000100111010000101100001011000001000010100000000000001010110000010000001000000000110100111000011101101110001100000011011000100000101110010100000110100001101000000110000100111000001011010001000000111000001000000010100010011000000000101100000010100100001111000000100101001000101011101000110001010001010000100111111000110110001100001100000011010001010000110010001001000000110001110010000000000110010010100010001001000000000100010011100000000001100111000000111100100110001100100111001010000000000011011001010100001010010101010000110010011010000000101000000100101010100011101000101100011101111011000100010000010000010010000101000101100111011000000000001010000101011000100000001100000010111001111000000000110010010100101000000011101110100001101100011000011001011110010001001100000011010100100111101110001000001100010101110000101000001001011011000000010010010001100100010000100100111010010110100000101000101000001100110011111100100000000111010001010111001110101010000010010111000000000000001000101100111001010011010101110100000000110001111100110000101101100001001000100100000001110010100000010011010101000111001010100011000010011101100100001001000000100000000010010010000101101000110110001001011011000000101110100011101000111000111000011010100010010101000001100001101000100100011010100111001001000000010000001110000001001111000001110000111000101010010111110110100001110001110000111001101110111000001110110101011010011010000010110000011100010111000101100000010011001010000001010110010000111100010000010111000111010110100011111100000000110000101011010110100001100010111001100000101010100100001011010111011101100001000100101100111110110100000000000010111000010100001001010000001000100001100000001111001001000010010000101011011011100011100110111001010101001110110001000001100001110000010100011101000000011000000001011000100111101110001000100110010001101000011010110010100000011000110011001101111101011100010010100000010001000011001000000101010110110001001001000011010000101111001111110100100000100001110101110001010110010111010100010001110100100101100101011000111010110011110001101000100111110000110000010100001110100101010001110110010100111000100011101001111111100110100001010100101011011100001001010101101101100000110001010111000100010100110101100000100000010010001000000000011001010010000000010010101101100011001001010010101001000100100100110100110001010001110011111011111111111001100010000110011000100101000111011010100100110100100101011111010011101010101100100111001010101010011001111000110011111100101101011101110001001000010100100001011101100110100001100100011100010100001100000100001000111001001001111111100001101010110000000001011010010101100110000101000000111010010001010001111001010001010011111101001011111000100011011000010001010001000010110001101011000111010000000110011001001010011010001100001000101001101101000010101011101111101011100000001010111001101101011001100100100001010101010111011010110000101001101110011011100100101010001111110111100100000010110001111011000111000101100010111011100111000010100110010100010100000010010101100110111101010001100000110011110110110100111100111011100011101000101110100010110001010010101101000101101010011010010011101010011011111101010001000101011100011101010101111000010010111111101110111001011110111000111110001101011100100110100011100111000001000101001010111111110010101111101010010011000101000001110010111110011011000110011110110001011011011011001111011010000010100110100000101011111011111101010001111111100011010111010110011111110101100100110010100110010111010101001110000010011000110100000100101110111000011101011000101100001101011110011011111011011101010011111001100010110101010101110010100101111100101001110010010000011010101111100100100100100000111000110010111100110110100111000111001010010111110011111111011000010011010011000101111111110001110000110001010111110010000110100010000001100110110000011110100001011101000010000001001110011111001101010010101100101011110000101000111100100111011011110111101011000100011000111010100111111110100101001010100101001010000000000011000110001001001010110101001001101101010011111010001011110010100110010010001101011000110001111111000100001101110101000011010000010010000000110101000110100001010110000010010100101100111100001100011101100011000111011110101011100011111101000101111100000111110101011000100001011001001001000110011101011010111100111110111001011100111111011110001011111110100110010110100110100100001100110000101101100110000110000001100001001000000010111000000101110100111100111110110110100001101111001111000110010101101101111000000010101001001010000110010101100001011111110011100110100100010011110101110011000101010100001000101100100110100001011100100001001010111110010011011100011111011111100110001000011001101111111001110101010011000111110010010011111101001010000010011110101000101011110000110011010000101110011101110101011000100110010100011001110001111011000100000101011000011111100010110100010110101101000000011011001100100011100100100001111101100001101000001000011110010001000101110101111100001101100000010010110100100000101001001111000011001011011101001001101111101011110011010101100101101101011000101000000011111011011000011010001010100101001011000110000100101111111111101000101111110011101100000000000110111011111110010000011111100010011110110111011100011011010111001101110000000001101001010011100000011110010101110100011001011011001110000101000000111011011111011100101010000010100000011011010100001011101001111101000110101100100100111000111101001100000000010011111001011101110001110011010001010010011000110110000000101001110010111101001101111011000101010010110100100110010100111111110010100111101010010001001011111010101101000001011111010100011100011111010100000010101100010111000100011100000011001100110101111110011011010110000011100111010010010110100001000001111001000110001111010001100011000111111111000000001011001000111110010011001001110101110101011011110100110000101000101110011111001110110011100100011000100101100111010011011001111101101000000100110111101011111001000101101000001010011110101011000010010000010001111100111011011000010011111101010000000011000000001001010011100000100000111111111000100101100100011101011100101000111011101111000100000101001001000000111110111001110111101011110100100011010100000000110011111111101010101000101000100111011111101100101000010011101001101011001011101100000111110010001001011100100100110011010101010101100110101001011001000000100011110010101010010000100110111000100011111100011010010101000110100101100111101100100111011100001111001111000000100001001110101001100000000011000010111010111001111110010101100011111100001000110111010111111011001111000010011110010111011010000000101100101000001010011100000111011101100011110110111110110010010011100110111011101111111001110110100000011000100111110110100111101111110101111110110001000111110011001000100011101101010100111010011001011000010101101101010010101111111111001110101111111010011001111110000111000000100100001100100010100001010000101101100000101100000000001000011001010101000110000000011101110111110111110100111111110100010010101111010110001011101101001101011000100001000010101011010000001111110101110000100101001010101010000101001010000110000001101000101000010110111011011100011000100101000110100100001100010010100001010100111000111000010111000101100100000001111000100110001000001100000010111110001111101011111111000110001010000111010111011101001101111100010011100010000110110110000001110000101010111010010111110110000000000101110101000100000100100000010110001011001010100110100111010000110100101101100010000011101000001110101001010011000000001010100111100000100001000010100101001100100011101100101100101010001000100100000111101111001100111010101110011101100111001101101100111101100100001101011111101101010101011110101011011011100010101001110111011011100010010011111100110011000100111111010101110000001010110111111100111111001000101100011101101100111111001101101001100110110010001111100011111000001001111000111111001011011100100111100000010111111101100111000010001001111100000000101111100001000001010001011110101001011110110111100011100000010111011000001110111000111011010110000100011010001101011111011100111101000110010000100101000100011001000100110110010010111111011100101101010010010111011000110000110000111001101101110011001100100110111110001001010111110101011000000001101000101111110110011100110010111110001100000101100101001011001111111110010111001101000000000011010111110010110010000010110000111111010010010010010101011011110111010011011001100001100100000110101010110101111010001010011010101000111111101110000001000110001110101101111010001010110010110111110100011000110101010111011001001000101111100001010010000011100101100101100101001110010010010101001110011010111111101011001001110110001010111111011111101100110111110010111111111011011110110101001110100010110111111101011110101001100100001001110111001100011001110010110101100110010001010100001011100011001101101111011111110110010110110101101111010110001101111100001110100111011100100000010111000011100000011100010100011010011111111110100110000011100010000000000111100011111000000101000001000111111010101011000100000001010011011100100101110111101010001010011011101001010011011011000000100001100000111000011010100001101101011010010011100001000010100101000101100101001001101000011011110011000000101110110111101010001000100111110000010010000000100101110101001001111011001111000100110000111000000101111010001000101000010001000101111010111101010010010011010111111101100111101001111001101111101110011110011111000111111011011010100110100100101000011100110101110111101111101000100100010100111011111001101010010101100100111010111000101001011000110101001010010010101101011010101100100001100010011000101010010011010001110000000100110001110101010110111110011111001011010011110100110100101110010010000100111010010011001000001011001100010101111001110111000010110110100001011001111111110111111011100001000011011110001000110111010100000100100111101010001001001000100001001001001111100011101110000000110001001101000101010010110110100100011000010001101111010101110100001011111010000010000011010111110000101111000001111100001110010101000000010011001010111100101111010100101111000100011111010011000000110001011111100001100111001010110000101001110101110101011110011011011000110011010110000001100111011001100110000001101001101100101111111110000010011010000010000110111111101001100100101001111010010001000100101001111110101110000010000100000011001001001110010011100101011010001101110100101001010100001010001011010100101101110010011111001101100101000010110001101001101110001011001100011010101100100111001011100010110001011000011101110010111100000000000110010000101000010010110110110110110001111011100101100100011001101001110100011101111110010000001010100111000010000110101101011100010100111111111100010000110111100010101001110011010000101011100111000100101010010000000011101110011011100110111000011010100111100011011000101010111000110010010011010001110100001000100001111010100010000001010011001111001110010110000000110010001011111011001010100101010110111010001100100011000000000000101111000100001010001111011100010010000000011001101010000011101010011111101011110001000100001100011010101001010110010101100110011000011100011011001011100010000100000011010001111011011101010000000100000000000001010001001000110000101111000110001100000100001111111111000000000001100110001011001101111100001000100010000001010001011100000010010001010000010000000001110000110000011010010000001100100000001001010110100101011111010110111101010001101010010001011110000010001110001101011100110011011000010000010000001000000010011010010101011011100001100010010011110101110110011000111011001010111101100110111001011000000101000000101011000010011001110000101001010000000100010010111010101000010101010001011011100110111011000100100100001101111001001000000000000011001010001000110011000000001111100010110001110011010011011001000000011010001000001000010010011010001010010001111010000000000100100001001101011110111110100011010001000010101111001010010110001001100101111100110011011101000100101010101011101111100100101000011010110000000010000000010100001011111101010110110010000000001001000011101001100000110100000010010100010001000100011101100000100010100000000111010010111000011011110001100011000100011111001010001100010100011100000001100100001100111111000000010101000010000110101010010011010001001000110000001000101001000110101000100000110010000011000000000010000010001000010110101010100010001101011000000011100000100001000000000100101010010001010000101000000100000000110101010000001010001001000010100010000000000110100010101100011010010101000000000001001100010101000110110000100100000100000010010111010010101000000000001000100100101010001000010000010011001011000000010000001000001000011110010011000010011000001011010101110000000010000100000110100011000101011010001000001000000000110100010100001010000000010101000000000000010111000000001000011010000101100000100000001000000000000100101000000000000110001001100110011010000000000000011000100101001100101010000000000101001001000001000100000001100100010010010001100100001000101010110001100000100010000010010110000011000001010010000000100001000000111101010010100000000101010001001000000101000010000000000010010010010110110000000000001010110100000100000000101011000101000001100010010010000000100100101000000001000000100000010101000010000011000101000000000001000100011011000010100001000000100000100001110000000000001000010001000001000000011000000000100001100010110000000100000011011001001011000000000001000010000000100110011010100000110001000000000000100101010100010000001010000000000001000011011010001001100000000000000000000100100101110000001000000001000001000000000010000000010001100000100100001000000010000000110000000000001010000000000001000101110010101000100001000000111000000010000100011000001000000000000100000010001000100100011000000010100000101000000100000000000000010000000010000010000001000100010000101000100100000000100000001000100100010000001010000001000101000000000000000100010001000010100010111000000100000000100000001000000000000010000000000100010010001000100001000000010000000000000101010000000010000010010001000000001000100000011000000000100010001000000100000000000000000000000000000010000000000101010000010000100010010000000000001000100001010001000000001010000000000000000010000000010001000000000010001000000100000000100000001000010000000010000000000001010000010000101010000000010000000010000000110101000000001010000001000000000000100010001000010000000010101000000000000000001000000000000000000000000000000000010100000000001010000000000000000000100000000101000000000010000000000000000000000000000000000000000000101000000000000100000000001000000000000000000000000000000100000000000010000000010001000000001000000001000000000000000000000000000000000010001000000000000000001000000000000100000000000000000000000000000000000000000000010000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000001000000000000000000000000000000000010000000000000000000001000000000000100000000000000000000000000000000000000000001000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000001"
\ No newline at end of file
@@ -1 +1 @@
-#define MIN_POLY "100000111000000100011001000101110111111111010111100101010101111011101111001001100001001000010101010111001000010100101001010001"
\ No newline at end of file
+#define MIN_POLY "11100010101000011101001111011001000111111100100110111010101001100010001101111100100111111001101010100101111001101111011110110111"
\ No newline at end of file
@@ -0,0 +1 @@
+#define MIN_POLY "10000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000100000000000001010001010000000000010000000001000101000100000001010000010001010101010111010100000000000101010110010000010000000001001001001000111000011111110011011110010101001110100000000001001010001011100000001000011101111100111110000100010001001111011110000111110111101111110110101101001100000001011111101010110101011100101001110111001001000101111101010101100111010101101111101100110100000001100011001010110010111011011110011011101000111000111101100110000110100110001001101011101001000110000100100000010111100110111101111110110101001001000111110000111010001001010100110100001001001100111111000101000101011111101001100000011111010110110011010101010001110111010111101010100110111011001011110000010011010111011101000101010101110000010101011110110000110001111001100101011101010100101101001001111010100110101000101001001000100011010110010001111110010010101010001010000000000000000000000000000000001"
\ No newline at end of file
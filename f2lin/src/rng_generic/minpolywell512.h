@@ -0,0 +1 @@
+#define MIN_POLY "100000000000000000000110111001010100011111001111001011110000011110100001100001110000110011010011100101011001111011010110101111101110110001000110001010111100111111010011001001001010010111001000010010110100001111000111000111001101001111011000000111001000010101100000111110101101010111101111010110110011010011100101001000001000010010100100000011000111001010001111010011100000010100110101100000011000011010011011101100101001001110100100010101010010010011100111111010000010001111000000000000000000000000000000000000001"
\ No newline at end of file
@@ -0,0 +1 @@
+#define MIN_POLY "100000010000110100000110111010011110111000001110011101011011000110100111011010111010101000011111010011110011110110001100000000001"
\ No newline at end of file
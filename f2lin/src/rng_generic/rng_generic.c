@@ -0,0 +1,141 @@
+#include <string.h>
+
+#include "rng_generic.h"
+#include "simd.h"
+
+const F2LinRngBackend* const f2lin_rng_backends[F2LIN_RNG_TYPES] = {
+    [F2LIN_XORSHIFT64] = &f2lin_rng_backend_64,
+    [F2LIN_MT19937] = &f2lin_rng_backend_mt,
+    [F2LIN_TINYMT64] = &f2lin_rng_backend_tinymt,
+    [F2LIN_XOSHIRO256PP] = &f2lin_rng_backend_xoshiro,
+    [F2LIN_SFMT19937] = &f2lin_rng_backend_sfmt,
+    [F2LIN_DSFMT19937] = &f2lin_rng_backend_dsfmt,
+    [F2LIN_WELL512A] = &f2lin_rng_backend_well512,
+    [F2LIN_WELL1024A] = &f2lin_rng_backend_well1024,
+    [F2LIN_XOROSHIRO128PP] = &f2lin_rng_backend_xoroshiro,
+};
+
+int f2lin_rng_generic_valid_type(int type) {
+    return type >= 0 && type < F2LIN_RNG_TYPES;
+}
+
+F2LinRngGeneric* f2lin_rng_generic_init_zero(enum F2LinRngType type) {
+    // aligned for all backends, so states larger than a cache line start at one
+    return f2lin_rng_generic_init_zero_at(type,
+                                          f2lin_simd_alloc(f2lin_rng_backends[type]->size));
+}
+
+F2LinRngGeneric* f2lin_rng_generic_init(enum F2LinRngType type) {
+    F2LinRngGeneric* rng = f2lin_rng_generic_init_zero(type);
+
+    f2lin_rng_backends[type]->init(rng);
+    return rng;
+}
+
+F2LinRngGeneric* f2lin_rng_generic_init_seed(enum F2LinRngType type, uint64_t seed) {
+    return f2lin_rng_generic_init_seed_at(type, seed, 
+                                          f2lin_simd_alloc(f2lin_rng_backends[type]->size));
+}
+
+F2LinRngGeneric* f2lin_rng_generic_init_seed_at(enum F2LinRngType type, uint64_t seed, 
+                                                void* mem) {
+    F2LinRngGeneric* rng = f2lin_rng_generic_init_zero_at(type, mem);
+
+    f2lin_rng_backends[type]->init_seed(rng, seed);
+    return rng;
+}
+
+F2LinRngGeneric* f2lin_rng_generic_init_zero_at(enum F2LinRngType type, void* mem) {
+    const F2LinRngBackend* backend = f2lin_rng_backends[type];
+    F2LinRngGeneric* rng = mem;
+
+    memset(rng, 0, backend->size);
+    rng->type = type;
+    backend->init_zero(rng);
+    return rng;
+}
+
+void f2lin_rng_generic_destroy(F2LinRngGeneric* rng) {
+    free(rng);
+}
+
+long f2lin_rng_generic_state_size(enum F2LinRngType type) {
+    return f2lin_rng_backends[type]->state_size;
+}
+
+const char* f2lin_rng_generic_name(enum F2LinRngType type) {
+    return f2lin_rng_backends[type]->name;
+}
+
+size_t f2lin_rng_generic_sizeof(enum F2LinRngType type) {
+    return f2lin_rng_backends[type]->size;
+}
+
+size_t f2lin_rng_generic_alignof(enum F2LinRngType type) {
+    return f2lin_rng_backends[type]->align;
+}
+
+size_t f2lin_rng_generic_state_words(enum F2LinRngType type) {
+    return f2lin_rng_backends[type]->state_words;
+}
+
+const char* f2lin_rng_generic_min_poly(enum F2LinRngType type) {
+    return f2lin_rng_backends[type]->min_poly;
+}
+
+size_t f2lin_rng_generic_numbers_per_step(enum F2LinRngType type) {
+    return f2lin_rng_backends[type]->numbers_per_step;
+}
+
+size_t f2lin_rng_generic_params_size(enum F2LinRngType type) {
+    return f2lin_rng_backends[type]->params_size;
+}
+
+size_t f2lin_rng_generic_param_sets(enum F2LinRngType type) {
+    return f2lin_rng_backends[type]->param_sets;
+}
+
+F2LinRngGeneric* f2lin_rng_generic_init_param_set(enum F2LinRngType type, size_t id,
+                                                  uint64_t seed) {
+    const F2LinRngBackend* backend = f2lin_rng_backends[type];
+
+    if (id >= backend->param_sets) return 0;
+
+    return f2lin_rng_generic_init_param_set_at(type, id, seed, f2lin_simd_alloc(backend->size));
+}
+
+F2LinRngGeneric* f2lin_rng_generic_init_param_set_at(enum F2LinRngType type, size_t id,
+                                                     uint64_t seed, void* mem) {
+    const F2LinRngBackend* backend = f2lin_rng_backends[type];
+    F2LinRngGeneric* rng;
+
+    if (id >= backend->param_sets) return 0;
+
+    // seeding may depend on the parameters, like it does for tinymt
+    rng = f2lin_rng_generic_init_zero_at(type, mem);
+    backend->set_params(rng, (const char*) backend->param_table + id * backend->params_size);
+    backend->init_seed(rng, seed);
+    return rng;
+}
+
+void f2lin_rng_generic_get_params(const F2LinRngGeneric* rng, void* params) {
+    const F2LinRngBackend* backend = f2lin_rng_generic_backend(rng);
+
+    if (backend->params_size) backend->get_params(rng, params);
+}
+
+void f2lin_rng_generic_set_params(F2LinRngGeneric* rng, const void* params) {
+    const F2LinRngBackend* backend = f2lin_rng_generic_backend(rng);
+
+    if (backend->params_size) backend->set_params(rng, params);
+}
+
+int f2lin_rng_generic_default_params(const F2LinRngGeneric* rng) {
+    const F2LinRngBackend* backend = f2lin_rng_generic_backend(rng);
+    uint64_t params[RNG_PARAMS_WORDS];
+
+    if (!backend->params_size) return 1;
+
+    backend->get_params(rng, params);
+    return !memcmp(params, backend->default_params, backend->params_size);
+}
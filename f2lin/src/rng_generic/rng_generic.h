@@ -9,34 +9,292 @@ extern "C" {
 #include <stdint.h>
 #include <inttypes.h>
 
+#include "config.h"
+
 /**
  * Represents the current state of the rng, e.g. the current random number
+ *
+ * Every generator starts with its type, which selects the backend implementing it, and is
+ * followed by the state of the backend (see the structs in rng_generic_*.c). The type is
+ * stored instead of a pointer to the backend, so a generator only contains plain data and
+ * can be copied bytewise, e.g. to send it to another process.
+ *
+ * If tracked is set, the generator is followed by its position in the stream and a
+ * checkpoint, see position.h. It is 0 for every generator initialized here, and isn't
+ * changed by any of the functions below, which only work on the state.
  */
 typedef struct F2LinRngGeneric F2LinRngGeneric;
+struct F2LinRngGeneric {
+    enum F2LinRngType type;
+    uint32_t tracked;
+};
+
+/**
+ * The implementation of one generator.
+ *
+ * size and align are the size and alignment of its struct, state_words the number of
+ * 64 bit words holding its state bits, see f2lin_rng_generic_get_state().
+ * min_poly is the minimal polynomial, with the coefficient of x^i at index i.
+ * It is 0 when building with CALC_MIN_POLY, see minpoly.cpp.
+ *
+ * One call to next_state is one step of the transition the minimal polynomial belongs to,
+ * which yields numbers_per_step calls to gen64. It is 1 for most generators, and 2 for the
+ * SIMD-oriented ones (SFMT, dSFMT) whose transition produces a 128 bit word, which gen64
+ * returns in two halves. Jump sizes always count numbers, see f2lin_rng_generic_skip().
+ *
+ * init_zero is called on zeroed memory and sets everything which isn't part of the state,
+ * e.g. the parameters of tinymt. All other functions are called through the
+ * f2lin_rng_generic_*() function of the same name.
+ *
+ * Generators whose transition depends on parameters stored in the generator have 
+ * params_size bytes of them, which get_params and set_params copy out and in. 
+ * default_params are the ones set by init_zero, min_poly belongs to them. param_table 
+ * holds param_sets further parameter sets, see f2lin_rng_generic_init_param_set().
+ * Generators without parameters set all of these to 0.
+ */
+typedef struct F2LinRngBackend F2LinRngBackend;
+struct F2LinRngBackend {
+    const char* name;
+    long state_size;
+    size_t state_words;
+    size_t size;
+    size_t align;
+    const char* min_poly;
+    size_t numbers_per_step;
+
+    void (*init_zero)(F2LinRngGeneric* rng);
+    void (*init)(F2LinRngGeneric* rng);
+    void (*init_seed)(F2LinRngGeneric* rng, uint64_t seed);
+    void (*copy)(F2LinRngGeneric* dest, const F2LinRngGeneric* source);
+    void (*add)(F2LinRngGeneric* lhs, const F2LinRngGeneric* rhs);
+    void (*normalize)(F2LinRngGeneric* rng);
+    uint64_t (*gen64)(F2LinRngGeneric* rng);
+    uint64_t (*next_state)(F2LinRngGeneric* rng);
+    void (*next_state_n)(F2LinRngGeneric* rng, size_t n);
+    void (*gen_n_numbers)(F2LinRngGeneric* rng, size_t n, uint64_t* buf);
+    void (*get_state)(const F2LinRngGeneric* rng, uint64_t* words);
+    void (*set_state)(F2LinRngGeneric* rng, const uint64_t* words);
+    int (*compare_state)(const F2LinRngGeneric* lhs, const F2LinRngGeneric* rhs);
+
+    size_t params_size;
+    const void* default_params;
+    size_t param_sets;
+    const void* param_table;
+    void (*get_params)(const F2LinRngGeneric* rng, void* params);
+    void (*set_params)(F2LinRngGeneric* rng, const void* params);
+};
 
-F2LinRngGeneric* f2lin_rng_generic_init_zero();
-F2LinRngGeneric* f2lin_rng_generic_init();
-F2LinRngGeneric* f2lin_rng_generic_copy(F2LinRngGeneric* dest, const F2LinRngGeneric* source);
-F2LinRngGeneric* f2lin_rng_generic_add(F2LinRngGeneric* lhs, const F2LinRngGeneric* rhs);
-uint64_t f2lin_rng_generic_gen64(F2LinRngGeneric* rng); 
-uint64_t f2lin_rng_generic_next_state(F2LinRngGeneric* rng);
-F2LinRngGeneric* f2lin_rng_generic_init_seed(uint64_t seed); 
+/**
+ * The parameters of tinymt, see f2lin_rng_generic_get_params().
+ */
+typedef struct F2LinTinyMTParams F2LinTinyMTParams;
+struct F2LinTinyMTParams {
+    uint32_t mat1;
+    uint32_t mat2;
+    uint64_t tmat;
+};
+
+extern const F2LinRngBackend f2lin_rng_backend_64;
+extern const F2LinRngBackend f2lin_rng_backend_mt;
+extern const F2LinRngBackend f2lin_rng_backend_tinymt;
+extern const F2LinRngBackend f2lin_rng_backend_xoshiro;
+extern const F2LinRngBackend f2lin_rng_backend_sfmt;
+extern const F2LinRngBackend f2lin_rng_backend_dsfmt;
+extern const F2LinRngBackend f2lin_rng_backend_well512;
+extern const F2LinRngBackend f2lin_rng_backend_well1024;
+extern const F2LinRngBackend f2lin_rng_backend_xoroshiro;
+
+/* the backend of every enum F2LinRngType, indexed by the type */
+extern const F2LinRngBackend* const f2lin_rng_backends[F2LIN_RNG_TYPES];
+
+/**
+ * Returns 1 if @param type is one of enum F2LinRngType.
+ */
+int f2lin_rng_generic_valid_type(int type);
+
+/**
+ * The functions taking a type allocate a generator of that type, or describe it.
+ */
+F2LinRngGeneric* f2lin_rng_generic_init_zero(enum F2LinRngType type);
+F2LinRngGeneric* f2lin_rng_generic_init(enum F2LinRngType type);
+F2LinRngGeneric* f2lin_rng_generic_init_seed(enum F2LinRngType type, uint64_t seed);
 void f2lin_rng_generic_destroy(F2LinRngGeneric* rng);
-long f2lin_rng_generic_state_size();
+long f2lin_rng_generic_state_size(enum F2LinRngType type);
+const char* f2lin_rng_generic_name(enum F2LinRngType type);
 
-// ask christian if this is good style or not
-#ifdef __cplusplus
-void f2lin_rng_generic_gen_n_numbers(F2LinRngGeneric* rng, size_t N, uint64_t *buf);
-#else
-void f2lin_rng_generic_gen_n_numbers(F2LinRngGeneric* rng, size_t N, uint64_t buf[N]);
-#endif
+/**
+ * Size of a generator of @param type in bytes.
+ */
+size_t f2lin_rng_generic_sizeof(enum F2LinRngType type);
 
-int f2lin_rng_generic_compare_state(F2LinRngGeneric* lhs, F2LinRngGeneric* rhs);
+/**
+ * Alignment of a generator of @param type in bytes.
+ */
+size_t f2lin_rng_generic_alignof(enum F2LinRngType type);
 
-#ifndef CALC_MIN_POLY
-char* f2lin_rng_generic_min_poly();
-#endif
+/**
+ * Initializes a generator like f2lin_rng_generic_init_zero(), but in @param mem, which has
+ * to hold f2lin_rng_generic_sizeof() bytes aligned to f2lin_rng_generic_alignof().
+ * The generator must not be destroyed with f2lin_rng_generic_destroy(), the memory
+ * belongs to the caller.
+ */
+F2LinRngGeneric* f2lin_rng_generic_init_zero_at(enum F2LinRngType type, void* mem);
+
+/**
+ * Like f2lin_rng_generic_init_seed(), but in @param mem, see 
+ * f2lin_rng_generic_init_zero_at().
+ */
+F2LinRngGeneric* f2lin_rng_generic_init_seed_at(enum F2LinRngType type, uint64_t seed, 
+                                                void* mem);
+
+/**
+ * Number of 64 bit words holding the state bits of a generator of @param type.
+ * f2lin_rng_generic_get_state() and f2lin_rng_generic_set_state() copy the state bits
+ * from and to that many words, all other fields of the generator are left unchanged.
+ */
+size_t f2lin_rng_generic_state_words(enum F2LinRngType type);
+
+const char* f2lin_rng_generic_min_poly(enum F2LinRngType type);
+
+/**
+ * Number of calls to f2lin_rng_generic_gen64() per call to f2lin_rng_generic_next_state()
+ * for generators of @param type, see F2LinRngBackend.
+ */
+size_t f2lin_rng_generic_numbers_per_step(enum F2LinRngType type);
+
+/**
+ * Number of bytes of the parameters of generators of @param type, 0 if they have none.
+ */
+size_t f2lin_rng_generic_params_size(enum F2LinRngType type);
+
+/**
+ * Number of parameter sets bundled with generators of @param type, 0 if they have none.
+ */
+size_t f2lin_rng_generic_param_sets(enum F2LinRngType type);
+
+/**
+ * Allocates a generator of @param type with the parameter set @param id, seeded with 
+ * @param seed. Generators with different parameter sets have different transitions, so 
+ * their streams can be used in parallel without jumping. The minimal polynomial of a set
+ * is not stored, see f2lin_jump_cache_rng_min_poly().
+ * Returns 0 if @param id isn't less than f2lin_rng_generic_param_sets().
+ */
+F2LinRngGeneric* f2lin_rng_generic_init_param_set(enum F2LinRngType type, size_t id,
+                                                  uint64_t seed);
+
+/**
+ * Like f2lin_rng_generic_init_param_set(), but in @param mem, see 
+ * f2lin_rng_generic_init_zero_at().
+ */
+F2LinRngGeneric* f2lin_rng_generic_init_param_set_at(enum F2LinRngType type, size_t id,
+                                                     uint64_t seed, void* mem);
+
+/**
+ * Copies the parameters of @param rng into @param params, which has to hold 
+ * f2lin_rng_generic_params_size() bytes. Does nothing for generators without parameters.
+ */
+void f2lin_rng_generic_get_params(const F2LinRngGeneric* rng, void* params);
+
+/**
+ * Sets the parameters of @param rng, without changing its state. Does nothing for 
+ * generators without parameters.
+ */
+void f2lin_rng_generic_set_params(F2LinRngGeneric* rng, const void* params);
+
+/**
+ * Returns 1 if @param rng has the default parameters of its type, i.e. the transition 
+ * whose minimal polynomial is f2lin_rng_generic_min_poly(). Always 1 for generators 
+ * without parameters.
+ */
+int f2lin_rng_generic_default_params(const F2LinRngGeneric* rng);
 
+/**
+ * The functions taking a generator dispatch on its type. They are inlined, so calling one
+ * costs a lookup of the backend and an indirect call. Loops over many numbers should use
+ * the functions working on many numbers at once, e.g. f2lin_rng_generic_gen_n_numbers().
+ */
+static inline
+enum F2LinRngType f2lin_rng_generic_type(const F2LinRngGeneric* rng) {
+    return rng->type;
+}
+
+static inline
+const F2LinRngBackend* f2lin_rng_generic_backend(const F2LinRngGeneric* rng) {
+    return f2lin_rng_backends[rng->type];
+}
+
+static inline
+F2LinRngGeneric* f2lin_rng_generic_copy(F2LinRngGeneric* dest, const F2LinRngGeneric* source) {
+    f2lin_rng_generic_backend(source)->copy(dest, source);
+    return dest;
+}
+
+static inline
+F2LinRngGeneric* f2lin_rng_generic_add(F2LinRngGeneric* lhs, const F2LinRngGeneric* rhs) {
+    f2lin_rng_generic_backend(lhs)->add(lhs, rhs);
+    return lhs;
+}
+
+/**
+ * Brings the state of @param rng into a canonical layout, without changing the stream.
+ * For generators storing their state in a ring buffer (MT) the state is rotated to start
+ * at index 0, so adding two normalized states doesn't need to wrap around.
+ */
+static inline
+void f2lin_rng_generic_normalize(F2LinRngGeneric* rng) {
+    f2lin_rng_generic_backend(rng)->normalize(rng);
+}
+
+static inline
+uint64_t f2lin_rng_generic_gen64(F2LinRngGeneric* rng) {
+    return f2lin_rng_generic_backend(rng)->gen64(rng);
+}
+
+static inline
+uint64_t f2lin_rng_generic_next_state(F2LinRngGeneric* rng) {
+    return f2lin_rng_generic_backend(rng)->next_state(rng);
+}
+
+/**
+ * Does the same as @param n calls to f2lin_rng_generic_next_state().
+ */
+static inline
+void f2lin_rng_generic_next_state_n(F2LinRngGeneric* rng, size_t n) {
+    f2lin_rng_generic_backend(rng)->next_state_n(rng, n);
+}
+
+/**
+ * Moves @param rng @param n numbers ahead, the same as n calls to 
+ * f2lin_rng_generic_gen64(). Whole steps are done with next_state_n, only the numbers 
+ * left over are generated one by one.
+ */
+static inline
+void f2lin_rng_generic_skip(F2LinRngGeneric* rng, size_t n) {
+    const F2LinRngBackend* backend = f2lin_rng_generic_backend(rng);
+
+    backend->next_state_n(rng, n / backend->numbers_per_step);
+    for (size_t i = n % backend->numbers_per_step; i; --i) backend->gen64(rng);
+}
+
+static inline
+void f2lin_rng_generic_gen_n_numbers(F2LinRngGeneric* rng, size_t N, uint64_t* buf) {
+    f2lin_rng_generic_backend(rng)->gen_n_numbers(rng, N, buf);
+}
+
+static inline
+void f2lin_rng_generic_get_state(const F2LinRngGeneric* rng, uint64_t* words) {
+    f2lin_rng_generic_backend(rng)->get_state(rng, words);
+}
+
+static inline
+void f2lin_rng_generic_set_state(F2LinRngGeneric* rng, const uint64_t* words) {
+    f2lin_rng_generic_backend(rng)->set_state(rng, words);
+}
+
+static inline
+int f2lin_rng_generic_compare_state(const F2LinRngGeneric* lhs, const F2LinRngGeneric* rhs) {
+    return lhs->type == rhs->type && f2lin_rng_generic_backend(lhs)->compare_state(lhs, rhs);
+}
 
 #ifdef __cplusplus
 }
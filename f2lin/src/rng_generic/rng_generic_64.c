@@ -1,14 +1,18 @@
+#include <string.h>
 #include "rng_generic.h"
 
 #ifndef CALC_MIN_POLY
 #include "minpoly64.h"
+#else
+#define MIN_POLY 0
 #endif
 
 #define XOR64_RNG_STATE_SIZE 64
 
-typedef struct F2LinRngGeneric F2LinRngGeneric;
+typedef struct F2LinRng64 F2LinRng64;
 
-struct F2LinRngGeneric {
+struct F2LinRng64 {
+    F2LinRngGeneric base;
     uint64_t state;
 };
 
@@ -16,63 +20,120 @@ const static uint64_t a = 13;
 const static uint64_t b = 17;
 const static uint64_t c = 5;
 
-F2LinRngGeneric* f2lin_rng_generic_init_zero() {
-    return (F2LinRngGeneric*) calloc(1, sizeof(F2LinRngGeneric));
+static
+void init_zero(F2LinRngGeneric* rng) {
+    // there are no parameters
 }
 
-F2LinRngGeneric* f2lin_rng_generic_init() {
-    F2LinRngGeneric* rng = (F2LinRngGeneric* )calloc(1, sizeof(F2LinRngGeneric));
-    rng->state = 12323456ull;
-    return rng;
+static
+void init(F2LinRngGeneric* rng) {
+    ((F2LinRng64*) rng)->state = 12323456ull;
 }
 
-F2LinRngGeneric* f2lin_rng_generic_init_seed(uint64_t seed) {
-    F2LinRngGeneric* rng = f2lin_rng_generic_init_zero();
-    rng->state = seed;
-    return rng;
+static
+void init_seed(F2LinRngGeneric* rng, uint64_t seed) {
+    ((F2LinRng64*) rng)->state = seed;
 }
 
-F2LinRngGeneric* f2lin_rng_generic_copy(F2LinRngGeneric *dest, 
-        const F2LinRngGeneric *source) {
-    dest->state = source->state;
-    return dest;
+static
+void copy(F2LinRngGeneric* dest, const F2LinRngGeneric* source) {
+    ((F2LinRng64*) dest)->state = ((const F2LinRng64*) source)->state;
 }
 
-F2LinRngGeneric* f2lin_rng_generic_add(F2LinRngGeneric* lhs, 
-        const F2LinRngGeneric* rhs) {
-    lhs->state ^= rhs->state;
-    return lhs;
+static
+void add(F2LinRngGeneric* lhs, const F2LinRngGeneric* rhs) {
+    ((F2LinRng64*) lhs)->state ^= ((const F2LinRng64*) rhs)->state;
 }
 
-uint64_t f2lin_rng_generic_next_state(F2LinRngGeneric* rng) {
-    rng->state ^= (rng->state << a);
-    rng->state ^= (rng->state >> b);
-    rng->state ^= (rng->state << c);
-    return rng->state;
+static
+void normalize(F2LinRngGeneric* rng) {
+    // the state is always stored the same way
 }
 
-uint64_t f2lin_rng_generic_gen64(F2LinRngGeneric* rng) {
-    return f2lin_rng_generic_next_state(rng);
+static inline
+uint64_t step(uint64_t x) {
+    x ^= x << a;
+    x ^= x >> b;
+    x ^= x << c;
+    return x;
 }
 
-void f2lin_rng_generic_gen_n_numbers(F2LinRngGeneric* rng, size_t N, uint64_t buf[N]) {
-    for (size_t i = 0; i < N; ++i) buf[i] = f2lin_rng_generic_gen64(rng);
+static
+uint64_t next_state(F2LinRngGeneric* rng) {
+    F2LinRng64* r = (F2LinRng64*) rng;
+
+    r->state = step(r->state);
+    return r->state;
 }
 
-long f2lin_rng_generic_state_size() {
-    return XOR64_RNG_STATE_SIZE;
+static
+uint64_t gen64(F2LinRngGeneric* rng) {
+    return next_state(rng);
 }
 
-void f2lin_rng_generic_destroy(F2LinRngGeneric* rng) {
-    free(rng);
+static
+void next_state_n(F2LinRngGeneric* rng, size_t n) {
+    F2LinRng64* r = (F2LinRng64*) rng;
+    uint64_t x = r->state;
+
+    for (size_t i = 0; i < n; ++i) x = step(x);
+    r->state = x;
 }
 
-#ifndef CALC_MIN_POLY
-char* f2lin_rng_generic_min_poly() {
-    return MIN_POLY;
+static
+void gen_n_numbers(F2LinRngGeneric* rng, size_t N, uint64_t* buf) {
+    // keep the state in a register, buf might alias rng otherwise
+    F2LinRng64* r = (F2LinRng64*) rng;
+    uint64_t x = r->state;
+    size_t i = 0;
+
+    for (; i + 4 <= N; i += 4) {
+        x = step(x); buf[i] = x;
+        x = step(x); buf[i + 1] = x;
+        x = step(x); buf[i + 2] = x;
+        x = step(x); buf[i + 3] = x;
+    }
+    for (; i < N; ++i) {
+        x = step(x); buf[i] = x;
+    }
+
+    r->state = x;
+}
+
+static
+void get_state(const F2LinRngGeneric* rng, uint64_t* words) {
+    words[0] = ((const F2LinRng64*) rng)->state;
+}
+
+static
+void set_state(F2LinRngGeneric* rng, const uint64_t* words) {
+    ((F2LinRng64*) rng)->state = words[0];
 }
-#endif
 
-int f2lin_rng_generic_compare_state(F2LinRngGeneric* lhs, F2LinRngGeneric* rhs) {
-    return lhs->state == rhs->state;  
+static
+int compare_state(const F2LinRngGeneric* lhs, const F2LinRngGeneric* rhs) {
+    return ((const F2LinRng64*) lhs)->state == ((const F2LinRng64*) rhs)->state;
 }
+
+const F2LinRngBackend f2lin_rng_backend_64 = {
+    .name = "xorshift64",
+    .state_size = XOR64_RNG_STATE_SIZE,
+    .state_words = 1,
+    .size = sizeof(F2LinRng64),
+    .align = _Alignof(F2LinRng64),
+    .min_poly = MIN_POLY,
+    .numbers_per_step = 1,
+    .init_zero = init_zero,
+    .init = init,
+    .init_seed = init_seed,
+    .copy = copy,
+    .add = add,
+    .normalize = normalize,
+    .gen64 = gen64,
+    .next_state = next_state,
+    .next_state_n = next_state_n,
+    .gen_n_numbers = gen_n_numbers,
+    .get_state = get_state,
+    .set_state = set_state,
+    .compare_state = compare_state,
+};
@@ -0,0 +1,305 @@
+#include <string.h>
+
+#include "rng_generic.h"
+#ifndef CALC_MIN_POLY
+#include "minpolydsfmt.h"
+#else
+#define MIN_POLY 0
+#endif
+
+#include "simd.h"
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+#define SEED 1234567
+/* the 2 * N * 52 mantissa bits and lung, plus one for the constant exponent bits */
+#define XOR64_RNG_STATE_SIZE 19993
+
+/* the parameters of dSFMT19937, N is the number of 128 bit words besides lung */
+#define N 191
+#define POS1 117
+#define SL1 19
+#define SR 12
+#define MSK1 0x000ffafffffffb3full
+#define MSK2 0x000ffdfffc90fffdull
+#define FIX1 0x90014964b32f4329ull
+#define FIX2 0x3b8d12ac548a7c7aull
+#define PCV1 0x3d84e1ac0dc82880ull
+#define PCV2 0x0000000000000001ull
+
+/* every word is a double in [1, 2), which has these exponent bits */
+#define LOW_MASK 0x000fffffffffffffull
+#define HIGH_CONST 0x3ff0000000000000ull
+
+typedef struct F2LinRngDSFMT F2LinRngDSFMT;
+
+/*
+ * Like the state of SFMT (see rng_generic_sfmt.c) a ring buffer of N 128 bit words and 
+ * the pending upper half, followed by the word lung which takes part in every step.
+ * Every 64 bit half of the ring buffer holds a double in [1, 2), gen64 returns its 52 bit
+ * mantissa in the upper bits, so f2lin_next_double() returns the double minus 1.
+ *
+ * The exponent bits are kept by the transition, so the states lie in a subspace of 
+ * 19993 dimensions, which is the degree of the minimal polynomial.
+ */
+struct F2LinRngDSFMT {
+    F2LinRngGeneric base;
+    _Alignas(SIMD_ALIGN) uint64_t state[2 * N + 2];
+    unsigned int idx;
+    int high;
+};
+
+static
+void regenerate(uint64_t* state, size_t from, size_t to);
+
+static
+void init_zero(F2LinRngGeneric* rng) {
+    // idx = 0 and high = 0, there are no parameters
+}
+
+static
+void init_seed(F2LinRngGeneric* rng, uint64_t seed) {
+    F2LinRngDSFMT* dsfmt = (F2LinRngDSFMT*) rng;
+    uint32_t s[4 * (N + 1)];
+    uint64_t* lung = &dsfmt->state[2 * N];
+    uint64_t inner;
+
+    // dsfmt_init_gen_rand() of the reference implementation, the upper half of the seed is
+    // mixed into the second word, so seeds below 2^32 give the reference stream
+    s[0] = (uint32_t) seed;
+    for (uint32_t i = 1; i < 4 * (N + 1); ++i) {
+        s[i] = 1812433253u * (s[i - 1] ^ (s[i - 1] >> 30)) + i;
+        if (i == 1) s[i] ^= (uint32_t) (seed >> 32);
+    }
+    for (size_t i = 0; i < 2 * (N + 1); ++i) {
+        dsfmt->state[i] = ((uint64_t) s[2 * i + 1] << 32) | s[2 * i];
+        if (i < 2 * N) dsfmt->state[i] = (dsfmt->state[i] & LOW_MASK) | HIGH_CONST;
+    }
+
+    // period certification, flips the lowest bit of the check vector if needed
+    inner = ((lung[0] ^ FIX1) & PCV1) ^ ((lung[1] ^ FIX2) & PCV2);
+    for (int i = 32; i > 0; i >>= 1) inner ^= inner >> i;
+    if (!(inner & 1)) lung[1] ^= 1;
+
+    dsfmt->idx = 0;
+    dsfmt->high = 0;
+}
+
+static
+void init(F2LinRngGeneric* rng) {
+    init_seed(rng, SEED);
+}
+
+static
+void copy(F2LinRngGeneric* dest, const F2LinRngGeneric* source) {
+    F2LinRngDSFMT* d = (F2LinRngDSFMT*) dest;
+    const F2LinRngDSFMT* s = (const F2LinRngDSFMT*) source;
+
+    memcpy(d->state, s->state, sizeof(d->state));
+    d->idx = s->idx;
+    d->high = s->high;
+}
+
+static
+void add(F2LinRngGeneric* lhs, const F2LinRngGeneric* rhs) {
+    // like the add of MT, in at most three contiguous parts, and lung
+    F2LinRngDSFMT* l = (F2LinRngDSFMT*) lhs;
+    const F2LinRngDSFMT* r = (const F2LinRngDSFMT*) rhs;
+
+    for (size_t i = 0, n; i < N; i += n) {
+        const size_t li = (l->idx + i) % N, ri = (r->idx + i) % N;
+
+        n = N - (li > ri ? li : ri);
+        if (n > N - i) n = N - i;
+        f2lin_simd_xor(&l->state[2 * li], &r->state[2 * ri], 2 * n);
+    }
+    l->state[2 * N] ^= r->state[2 * N];
+    l->state[2 * N + 1] ^= r->state[2 * N + 1];
+}
+
+static
+void normalize(F2LinRngGeneric* rng) {
+    F2LinRngDSFMT* dsfmt = (F2LinRngDSFMT*) rng;
+    const size_t k = dsfmt->idx;
+    uint64_t tmp[2 * N];
+
+    // rotate the state so it starts at idx = 0
+    if (k) {
+        memcpy(tmp, &dsfmt->state[2 * k], 2 * (N - k) * sizeof(uint64_t));
+        memcpy(&tmp[2 * (N - k)], dsfmt->state, 2 * k * sizeof(uint64_t));
+        memcpy(dsfmt->state, tmp, sizeof(tmp));
+    }
+    dsfmt->idx = 0;
+}
+
+static
+uint64_t next_state(F2LinRngGeneric* rng) {
+    F2LinRngDSFMT* dsfmt = (F2LinRngDSFMT*) rng;
+    const unsigned int i = dsfmt->idx;
+
+    regenerate(dsfmt->state, i, i + 1);
+    dsfmt->idx = i + 1 < N ? i + 1 : 0;
+
+    // the lowest bit of the word doesn't see the whole state, which would give a divisor
+    // of the minimal polynomial (see min_poly.h), the parity of the whole word does
+    return __builtin_parityll(dsfmt->state[2 * i] ^ dsfmt->state[2 * i + 1]);
+}
+
+static
+uint64_t gen64(F2LinRngGeneric* rng) {
+    F2LinRngDSFMT* dsfmt = (F2LinRngDSFMT*) rng;
+
+    if (dsfmt->high) {
+        dsfmt->high = 0;
+        return dsfmt->state[2 * ((dsfmt->idx + N - 1) % N) + 1] << 12;
+    }
+
+    dsfmt->high = 1;
+    next_state(rng);
+    return dsfmt->state[2 * ((dsfmt->idx + N - 1) % N)] << 12;
+}
+
+static
+void next_state_n(F2LinRngGeneric* rng, size_t n) {
+    F2LinRngDSFMT* dsfmt = (F2LinRngDSFMT*) rng;
+
+    for (size_t i = 0, m; i < n; i += m) {
+        const size_t num = dsfmt->idx;
+
+        m = N - num < n - i ? N - num : n - i;
+        regenerate(dsfmt->state, num, num + m);
+        dsfmt->idx = (num + m) % N;
+    }
+}
+
+static
+void gen_n_numbers(F2LinRngGeneric* rng, size_t n, uint64_t* buf) {
+    F2LinRngDSFMT* dsfmt = (F2LinRngDSFMT*) rng;
+    size_t i = 0;
+
+    if (n && dsfmt->high) buf[i++] = gen64(rng);
+
+    // the numbers of whole words are the mantissas of the words, so they are regenerated
+    // in place and shifted out, up to the end of the state at a time
+    while (n - i >= 2) {
+        const size_t num = dsfmt->idx;
+        const size_t words = (n - i) / 2;
+        const size_t m = N - num < words ? N - num : words;
+
+        regenerate(dsfmt->state, num, num + m);
+        for (size_t k = 0; k < 2 * m; ++k) buf[i + k] = dsfmt->state[2 * num + k] << 12;
+        dsfmt->idx = (num + m) % N;
+        i += 2 * m;
+    }
+
+    if (i < n) buf[i] = gen64(rng);
+}
+
+static
+void get_state(const F2LinRngGeneric* rng, uint64_t* words) {
+    // the raw ring buffer and lung, idx and high are not part of the words
+    memcpy(words, ((const F2LinRngDSFMT*) rng)->state, (2 * N + 2) * sizeof(uint64_t));
+}
+
+static
+void set_state(F2LinRngGeneric* rng, const uint64_t* words) {
+    memcpy(((F2LinRngDSFMT*) rng)->state, words, (2 * N + 2) * sizeof(uint64_t));
+}
+
+static
+int compare_state(const F2LinRngGeneric* lhs, const F2LinRngGeneric* rhs) {
+    // the same state can be stored with a different idx, and a pending upper half makes
+    // the next number differ
+    const F2LinRngDSFMT* l = (const F2LinRngDSFMT*) lhs;
+    const F2LinRngDSFMT* r = (const F2LinRngDSFMT*) rhs;
+
+    if (l->high != r->high) return 0;
+    if (l->state[2 * N] != r->state[2 * N] || l->state[2 * N + 1] != r->state[2 * N + 1]) {
+        return 0;
+    }
+    for (size_t k = 0; k < N; ++k) {
+        const size_t li = (l->idx + k) % N, ri = (r->idx + k) % N;
+
+        if (l->state[2 * li] != r->state[2 * ri]) return 0;
+        if (l->state[2 * li + 1] != r->state[2 * ri + 1]) return 0;
+    }
+    return 1;
+}
+
+const F2LinRngBackend f2lin_rng_backend_dsfmt = {
+    .name = "dsfmt19937",
+    .state_size = XOR64_RNG_STATE_SIZE,
+    .state_words = 2 * N + 2,
+    .size = sizeof(F2LinRngDSFMT),
+    .align = _Alignof(F2LinRngDSFMT),
+    .min_poly = MIN_POLY,
+    .numbers_per_step = 2,
+    .init_zero = init_zero,
+    .init = init,
+    .init_seed = init_seed,
+    .copy = copy,
+    .add = add,
+    .normalize = normalize,
+    .gen64 = gen64,
+    .next_state = next_state,
+    .next_state_n = next_state_n,
+    .gen_n_numbers = gen_n_numbers,
+    .get_state = get_state,
+    .set_state = set_state,
+    .compare_state = compare_state,
+};
+
+/*
+ * Regenerates the words from to to - 1 with the recursion of dSFMT19937, where word i
+ * depends on the words i and i + POS1 of the ring buffer and on lung, which is updated
+ * by every word. lung is kept in a register, and the loop is split where i + POS1 wraps
+ * around, like dsfmt_gen_rand_all() of the reference implementation.
+ */
+#ifdef __SSE2__
+static
+void regenerate(uint64_t* state, size_t from, size_t to) {
+    const __m128i mask = _mm_set_epi64x(MSK2, MSK1);
+    __m128i* w = (__m128i*) state;
+    __m128i lung = _mm_load_si128(&w[N]);
+    size_t i = from;
+
+// one word of the recursion, a is word i and b word i + POS1. The shuffle swaps the 32 bit
+// halves of both words of lung and exchanges the words.
+#define DSFMT_SSE2_WORD(b) do {                                         \
+        const __m128i a = _mm_load_si128(&w[i]);                        \
+        __m128i z = _mm_xor_si128(_mm_slli_epi64(a, SL1), (b));         \
+        lung = _mm_xor_si128(_mm_shuffle_epi32(lung, 0x1b), z);         \
+        z = _mm_xor_si128(_mm_srli_epi64(lung, SR), a);                 \
+        z = _mm_xor_si128(z, _mm_and_si128(lung, mask));                \
+        _mm_store_si128(&w[i], z);                                      \
+    } while (0)
+
+    for (; i < to && i < N - POS1; ++i) DSFMT_SSE2_WORD(_mm_load_si128(&w[i + POS1]));
+    for (; i < to; ++i) DSFMT_SSE2_WORD(_mm_load_si128(&w[i + POS1 - N]));
+#undef DSFMT_SSE2_WORD
+
+    _mm_store_si128(&w[N], lung);
+}
+#else
+static
+void regenerate(uint64_t* state, size_t from, size_t to) {
+    uint64_t l0 = state[2 * N], l1 = state[2 * N + 1];
+
+    for (size_t i = from; i < to; ++i) {
+        const size_t b = i < N - POS1 ? i + POS1 : i + POS1 - N;
+        const uint64_t t0 = state[2 * i], t1 = state[2 * i + 1];
+        const uint64_t n0 = (t0 << SL1) ^ (l1 >> 32) ^ (l1 << 32) ^ state[2 * b];
+        const uint64_t n1 = (t1 << SL1) ^ (l0 >> 32) ^ (l0 << 32) ^ state[2 * b + 1];
+
+        state[2 * i] = (n0 >> SR) ^ (n0 & MSK1) ^ t0;
+        state[2 * i + 1] = (n1 >> SR) ^ (n1 & MSK2) ^ t1;
+        l0 = n0;
+        l1 = n1;
+    }
+
+    state[2 * N] = l0;
+    state[2 * N + 1] = l1;
+}
+#endif
@@ -4,121 +4,217 @@
 #include "rng_generic.h"
 #ifndef CALC_MIN_POLY 
 #include "minpolymt.h"
+#else
+#define MIN_POLY 0
 #endif
 
 #include "lib/mt/mt.h"
+#include "simd.h"
 
 #define SEED 1234567
 #define XOR64_RNG_STATE_SIZE 19937
 
-struct F2LinRngGeneric {
-    MT mt;
+typedef struct F2LinRngMT F2LinRngMT;
+
+// aligned, so the state starts at a cache line for f2lin_simd_xor()
+struct F2LinRngMT {
+    F2LinRngGeneric base;
+    _Alignas(SIMD_ALIGN) MT mt;
 };
 
-F2LinRngGeneric* f2lin_rng_generic_init_zero() {
-    return (F2LinRngGeneric* ) calloc(1, sizeof(F2LinRngGeneric));
+static
+void regenerate(uint64_t* state, size_t from, size_t to);
+
+static
+void init_zero(F2LinRngGeneric* rng) {
+    // mti = 0, there are no parameters
 }
 
-F2LinRngGeneric* f2lin_rng_generic_init() {
-    F2LinRngGeneric* rng = (F2LinRngGeneric* ) calloc(1, sizeof(F2LinRngGeneric));
-    mt_init_genrand64(&rng->mt, SEED);
-    return rng;
+static
+void init(F2LinRngGeneric* rng) {
+    mt_init_genrand64(&((F2LinRngMT*) rng)->mt, SEED);
 }
 
-F2LinRngGeneric* f2lin_rng_generic_copy(F2LinRngGeneric* dest, const F2LinRngGeneric* source) {
-    memcpy(dest->mt.mt, source->mt.mt, sizeof(uint64_t) * NN) ;
-    dest->mt.mti = source->mt.mti;
-    return dest;
+static
+void init_seed(F2LinRngGeneric* rng, uint64_t seed) {
+    mt_init_genrand64(&((F2LinRngMT*) rng)->mt, seed);
 }
 
-F2LinRngGeneric* f2lin_rng_generic_add(F2LinRngGeneric* lhs, const F2LinRngGeneric* rhs) {
-    /* taken from original implementation of the authors */
-
-    const size_t plhs = lhs->mt.mti, prhs = rhs->mt.mti, len = NN;
-    size_t i = 0;
-    // represent internal state as 64 bit words
-    uint64_t* slhs = &lhs->mt.mt[0];
-    const uint64_t* srhs =  &rhs->mt.mt[0];
-
-    if (prhs >= plhs) {
-        for (; i < len - prhs; ++i) {
-            slhs[i + plhs] ^= srhs[i + prhs];
-        }
-        for (; i < len - plhs; ++i) { 
-            slhs[i + plhs] ^= srhs[i + prhs - len];
-        }
-    } else {
-        for (; i < len - plhs; ++i) {
-            slhs[i + plhs] ^= srhs[i + prhs];
-        }
-        for (; i < len - prhs; ++i) {
-            slhs[i + plhs - len] ^= srhs[i + prhs];
-        }
-    }
-    for (; i < len; ++i) { 
-        slhs[i + plhs - len] ^= srhs[i + prhs - len];
-    }
+static
+void copy(F2LinRngGeneric* dest, const F2LinRngGeneric* source) {
+    MT* d = &((F2LinRngMT*) dest)->mt;
+    const MT* s = &((const F2LinRngMT*) source)->mt;
 
-    return lhs;
+    memcpy(d->mt, s->mt, sizeof(uint64_t) * NN);
+    d->mti = s->mti;
 }
 
-uint64_t f2lin_rng_generic_gen64(F2LinRngGeneric* rng) {
-    uint64_t ret = f2lin_rng_generic_next_state(rng);
+static
+void add(F2LinRngGeneric* lhs, const F2LinRngGeneric* rhs) {
+    // word i of a state is stored at (mti + i) % NN, so the sum consists of at most three 
+    // parts in which the words of both states are contiguous. 
+    // If both have the same mti, e.g. after normalize(), it is only one.
+    MT* l = &((F2LinRngMT*) lhs)->mt;
+    const MT* r = &((const F2LinRngMT*) rhs)->mt;
+    const size_t plhs = l->mti, prhs = r->mti;
+
+    for (size_t i = 0, n; i < NN; i += n) {
+        const size_t li = (plhs + i) % NN, ri = (prhs + i) % NN;
+
+        n = NN - (li > ri ? li : ri);
+        if (n > NN - i) n = NN - i;
+        f2lin_simd_xor(&l->mt[li], &r->mt[ri], n);
+    }
+}
 
-    ret ^= (ret >> 29) & 0x5555555555555555ULL;
-    ret ^= (ret << 17) & 0x71D67FFFEDA60000ULL;
-    ret ^= (ret << 37) & 0xFFF7EEE000000000ULL;
-    ret ^= (ret >> 43);
-    return ret;
+static
+void normalize(F2LinRngGeneric* rng) {
+    MT* mt = &((F2LinRngMT*) rng)->mt;
+    const size_t k = mt->mti % NN;
+    uint64_t tmp[NN];
+
+    // rotate the state so it starts at mti = 0
+    if (k) {
+        memcpy(tmp, &mt->mt[k], (NN - k) * sizeof(uint64_t));
+        memcpy(&tmp[NN - k], mt->mt, k * sizeof(uint64_t));
+        memcpy(mt->mt, tmp, sizeof(tmp));
+    }
+    mt->mti = 0;
 }
 
-uint64_t f2lin_rng_generic_next_state(F2LinRngGeneric* rng) {
-    const int num = rng->mt.mti;
+static
+uint64_t next_state(F2LinRngGeneric* rng) {
+    MT* mt = &((F2LinRngMT*) rng)->mt;
+    const int num = mt->mti;
     uint64_t y;
     uint64_t mat[2]={0ull, MATRIX_A};
-    uint64_t* state = &rng->mt.mt[0];
+    uint64_t* state = &mt->mt[0];
   
     if (num < NN - MM){
         y = (state[num] & UM) | (state[num + 1] & LM);
         state[num] = state[num + MM] ^ (y >> 1) ^ mat[y & 1ULL];
-        rng->mt.mti++;
+        mt->mti++;
     } else if (num < NN - 1){
         y = (state[num] & UM) | (state[num + 1] & LM);
         state[num] = state[num + (MM - NN)] ^ (y >> 1) ^ mat[y & 1ULL];
-        rng->mt.mti++;
+        mt->mti++;
     } else if (num == NN - 1){
         y = (state[NN - 1] & UM) | (state[0] & LM);
         state[NN - 1] = state[MM - 1] ^ (y >> 1) ^ mat[y & 1ULL];
-        rng->mt.mti = 0;
+        mt->mti = 0;
     }
   
     return state[num];
 }
 
-void f2lin_rng_generic_gen_n_numbers(F2LinRngGeneric* rng, size_t N, uint64_t buf[N]) {
-    for (size_t i = 0; i < N; ++i) buf[i] = f2lin_rng_generic_gen64(rng);
+static
+uint64_t gen64(F2LinRngGeneric* rng) {
+    uint64_t ret = next_state(rng);
+
+    ret ^= (ret >> 29) & 0x5555555555555555ULL;
+    ret ^= (ret << 17) & 0x71D67FFFEDA60000ULL;
+    ret ^= (ret << 37) & 0xFFF7EEE000000000ULL;
+    ret ^= (ret >> 43);
+    return ret;
 }
 
-F2LinRngGeneric* f2lin_rng_generic_init_seed(uint64_t seed) {
-    F2LinRngGeneric* rng = f2lin_rng_generic_init_zero();
-    mt_init_genrand64(&rng->mt, *(uint64_t*) seed);
-    return rng;
+static
+void next_state_n(F2LinRngGeneric* rng, size_t n) {
+    MT* mt = &((F2LinRngMT*) rng)->mt;
+
+    // like gen_n_numbers(), without tempering
+    for (size_t i = 0, m; i < n; i += m) {
+        const size_t num = mt->mti;
+
+        m = NN - num < n - i ? NN - num : n - i;
+        regenerate(mt->mt, num, num + m);
+        mt->mti = (num + m) % NN;
+    }
 }
 
-long f2lin_rng_generic_state_size() {
-    return XOR64_RNG_STATE_SIZE;
+static
+void gen_n_numbers(F2LinRngGeneric* rng, size_t N, uint64_t* buf) {
+    MT* mt = &((F2LinRngMT*) rng)->mt;
+
+    // regenerate the words from mti up to the end of the state, or until N are generated, 
+    // and temper them at once. After the first block, whole states are generated.
+    for (size_t i = 0, n; i < N; i += n) {
+        const size_t num = mt->mti;
+
+        n = NN - num < N - i ? NN - num : N - i;
+        regenerate(mt->mt, num, num + n);
+        f2lin_simd_temper_mt64(&buf[i], &mt->mt[num], n);
+        mt->mti = (num + n) % NN;
+    }
 }
 
-void f2lin_rng_generic_destroy(F2LinRngGeneric* rng) {
-    free(rng);
+static
+void get_state(const F2LinRngGeneric* rng, uint64_t* words) {
+    // the raw array, mti is not part of the words
+    memcpy(words, ((const F2LinRngMT*) rng)->mt.mt, NN * sizeof(uint64_t));
 }
 
-#ifndef  CALC_MIN_POLY
-char* f2lin_rng_generic_min_poly() {
-    return MIN_POLY;
+static
+void set_state(F2LinRngGeneric* rng, const uint64_t* words) {
+    memcpy(((F2LinRngMT*) rng)->mt.mt, words, NN * sizeof(uint64_t));
 }
-#endif
 
-int f2lin_rng_generic_compare_state(F2LinRngGeneric* lhs, F2LinRngGeneric* rhs) {
-    return lhs->mt.mt[lhs->mt.mti] == rhs->mt.mt[rhs->mt.mti];
+static
+int compare_state(const F2LinRngGeneric* lhs, const F2LinRngGeneric* rhs) {
+    // the same state can be stored with a different mti, and mti == NN doesn't point into 
+    // the state, so compare the next NN words instead, which determine the whole state
+    F2LinRngMT l = *(const F2LinRngMT*) lhs, r = *(const F2LinRngMT*) rhs;
+
+    for (size_t i = 0; i < NN; ++i) {
+        if (next_state(&l.base) != next_state(&r.base)) return 0;
+    }
+
+    return 1;
 } 
+
+const F2LinRngBackend f2lin_rng_backend_mt = {
+    .name = "mt19937-64",
+    .state_size = XOR64_RNG_STATE_SIZE,
+    .state_words = NN,
+    .size = sizeof(F2LinRngMT),
+    .align = _Alignof(F2LinRngMT),
+    .min_poly = MIN_POLY,
+    .numbers_per_step = 1,
+    .init_zero = init_zero,
+    .init = init,
+    .init_seed = init_seed,
+    .copy = copy,
+    .add = add,
+    .normalize = normalize,
+    .gen64 = gen64,
+    .next_state = next_state,
+    .next_state_n = next_state_n,
+    .gen_n_numbers = gen_n_numbers,
+    .get_state = get_state,
+    .set_state = set_state,
+    .compare_state = compare_state,
+};
+
+/*
+ * Does the same as calling next_state() for the words from to to - 1, 
+ * with the branches on mti moved out of the loops. The first loop only reads words which 
+ * haven't been regenerated yet, the second one only those at least MM - 1 words behind, 
+ * so both can be vectorized.
+ */
+static
+void regenerate(uint64_t* state, size_t from, size_t to) {
+    size_t i = from;
+
+    for (; i < to && i < NN - MM; ++i) {
+        const uint64_t y = (state[i] & UM) | (state[i + 1] & LM);
+        state[i] = state[i + MM] ^ (y >> 1) ^ (-(y & 1ULL) & MATRIX_A);
+    }
+    for (; i < to && i < NN - 1; ++i) {
+        const uint64_t y = (state[i] & UM) | (state[i + 1] & LM);
+        state[i] = state[i + (MM - NN)] ^ (y >> 1) ^ (-(y & 1ULL) & MATRIX_A);
+    }
+    if (i < to) {
+        const uint64_t y = (state[NN - 1] & UM) | (state[0] & LM);
+        state[NN - 1] = state[MM - 1] ^ (y >> 1) ^ (-(y & 1ULL) & MATRIX_A);
+    }
+}
@@ -0,0 +1,333 @@
+#include <string.h>
+
+#include "rng_generic.h"
+#ifndef CALC_MIN_POLY
+#include "minpolysfmt.h"
+#else
+#define MIN_POLY 0
+#endif
+
+#include "simd.h"
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+#define SEED 1234567
+#define XOR64_RNG_STATE_SIZE 19968
+
+/* the parameters of SFMT19937, N is the number of 128 bit words of the state */
+#define N 156
+#define POS1 122
+#define SL1 18
+#define SL2 1
+#define SR1 11
+#define SR2 1
+#define MSK1 0xdfffffefu
+#define MSK2 0xddfecb7fu
+#define MSK3 0xbffaffffu
+#define MSK4 0xbffffff6u
+#define PARITY1 0x00000001u
+#define PARITY2 0x00000000u
+#define PARITY3 0x00000000u
+#define PARITY4 0x13c9e684u
+
+/* the masks as 64 bit halves, and the bits kept by the 32 bit shifts */
+#define MSK_LO (((uint64_t) MSK2 << 32) | MSK1)
+#define MSK_HI (((uint64_t) MSK4 << 32) | MSK3)
+#define SR1_KEEP ((0xffffffffull >> SR1) * 0x100000001ull)
+#define SL1_KEEP (((0xffffffffull << SL1) & 0xffffffffull) * 0x100000001ull)
+
+typedef struct F2LinRngSFMT F2LinRngSFMT;
+
+/*
+ * The state is a ring buffer of N 128 bit words, word k is stored at (idx + k) % N, with
+ * its lower 64 bits at state[2 * k] and the upper ones at state[2 * k + 1], which is the
+ * layout of the reference implementation on little endian machines.
+ *
+ * One step regenerates the word at idx. Like gen_rand_all() of the reference, gen64
+ * regenerates the rest of the ring buffer at once and then returns its numbers one by
+ * one, the lower half of a word first. pending counts the numbers of the last words which
+ * were regenerated but not returned yet, so the state is pending numbers ahead of the
+ * stream. pending is not part of the state bits, and steps don't change it.
+ */
+struct F2LinRngSFMT {
+    F2LinRngGeneric base;
+    _Alignas(SIMD_ALIGN) uint64_t state[2 * N];
+    unsigned int idx;
+    unsigned int pending;
+};
+
+static
+void regenerate(uint64_t* state, size_t from, size_t to);
+
+static
+void init_zero(F2LinRngGeneric* rng) {
+    // idx = 0 and pending = 0, there are no parameters
+}
+
+static
+void init_seed(F2LinRngGeneric* rng, uint64_t seed) {
+    F2LinRngSFMT* sfmt = (F2LinRngSFMT*) rng;
+    uint32_t s[4 * N];
+    const uint32_t parity[4] = { PARITY1, PARITY2, PARITY3, PARITY4 };
+    uint32_t inner = 0;
+
+    // init_gen_rand() of the reference implementation, the upper half of the seed is mixed
+    // into the second word, so seeds below 2^32 give the reference stream
+    s[0] = (uint32_t) seed;
+    for (uint32_t i = 1; i < 4 * N; ++i) {
+        s[i] = 1812433253u * (s[i - 1] ^ (s[i - 1] >> 30)) + i;
+        if (i == 1) s[i] ^= (uint32_t) (seed >> 32);
+    }
+
+    // period certification, flips one bit if the state misses the largest component
+    for (int i = 0; i < 4; ++i) inner ^= s[i] & parity[i];
+    for (int i = 16; i > 0; i >>= 1) inner ^= inner >> i;
+    if (!(inner & 1)) {
+        for (int i = 0, done = 0; i < 4 && !done; ++i) {
+            for (int j = 0; j < 32 && !done; ++j) {
+                if ((parity[i] >> j) & 1) {
+                    s[i] ^= 1u << j;
+                    done = 1;
+                }
+            }
+        }
+    }
+
+    for (size_t i = 0; i < 2 * N; ++i) {
+        sfmt->state[i] = ((uint64_t) s[2 * i + 1] << 32) | s[2 * i];
+    }
+    sfmt->idx = 0;
+    sfmt->pending = 0;
+}
+
+static
+void init(F2LinRngGeneric* rng) {
+    init_seed(rng, SEED);
+}
+
+static
+void copy(F2LinRngGeneric* dest, const F2LinRngGeneric* source) {
+    F2LinRngSFMT* d = (F2LinRngSFMT*) dest;
+    const F2LinRngSFMT* s = (const F2LinRngSFMT*) source;
+
+    memcpy(d->state, s->state, sizeof(d->state));
+    d->idx = s->idx;
+    d->pending = s->pending;
+}
+
+static
+void add(F2LinRngGeneric* lhs, const F2LinRngGeneric* rhs) {
+    // like the add of MT, in at most three contiguous parts
+    F2LinRngSFMT* l = (F2LinRngSFMT*) lhs;
+    const F2LinRngSFMT* r = (const F2LinRngSFMT*) rhs;
+
+    for (size_t i = 0, n; i < N; i += n) {
+        const size_t li = (l->idx + i) % N, ri = (r->idx + i) % N;
+
+        n = N - (li > ri ? li : ri);
+        if (n > N - i) n = N - i;
+        f2lin_simd_xor(&l->state[2 * li], &r->state[2 * ri], 2 * n);
+    }
+}
+
+static
+void normalize(F2LinRngGeneric* rng) {
+    F2LinRngSFMT* sfmt = (F2LinRngSFMT*) rng;
+    const size_t k = sfmt->idx;
+    uint64_t tmp[2 * N];
+
+    // rotate the state so it starts at idx = 0
+    if (k) {
+        memcpy(tmp, &sfmt->state[2 * k], 2 * (N - k) * sizeof(uint64_t));
+        memcpy(&tmp[2 * (N - k)], sfmt->state, 2 * k * sizeof(uint64_t));
+        memcpy(sfmt->state, tmp, sizeof(tmp));
+    }
+    sfmt->idx = 0;
+}
+
+static
+uint64_t next_state(F2LinRngGeneric* rng) {
+    F2LinRngSFMT* sfmt = (F2LinRngSFMT*) rng;
+    const unsigned int i = sfmt->idx;
+
+    regenerate(sfmt->state, i, i + 1);
+    sfmt->idx = i + 1 < N ? i + 1 : 0;
+
+    return sfmt->state[2 * i];
+}
+
+static
+uint64_t gen64(F2LinRngGeneric* rng) {
+    F2LinRngSFMT* sfmt = (F2LinRngSFMT*) rng;
+    size_t k;
+
+    if (!sfmt->pending) {
+        regenerate(sfmt->state, sfmt->idx, N);
+        sfmt->pending = 2 * (N - sfmt->idx);
+        sfmt->idx = 0;
+    }
+
+    // the pending numbers end right before idx
+    k = 2 * (sfmt->idx + N) - sfmt->pending--;
+    return sfmt->state[k < 2 * N ? k : k - 2 * N];
+}
+
+static
+void next_state_n(F2LinRngGeneric* rng, size_t n) {
+    F2LinRngSFMT* sfmt = (F2LinRngSFMT*) rng;
+
+    for (size_t i = 0, m; i < n; i += m) {
+        const size_t num = sfmt->idx;
+
+        m = N - num < n - i ? N - num : n - i;
+        regenerate(sfmt->state, num, num + m);
+        sfmt->idx = (num + m) % N;
+    }
+}
+
+static
+void gen_n_numbers(F2LinRngGeneric* rng, size_t n, uint64_t* buf) {
+    F2LinRngSFMT* sfmt = (F2LinRngSFMT*) rng;
+    size_t i = 0;
+
+    // the numbers regenerated ahead by gen64 come first
+    while (i < n && sfmt->pending) buf[i++] = gen64(rng);
+
+    // the numbers of whole words are the words themselves, so they are regenerated in
+    // place and copied out, up to the end of the state at a time
+    while (n - i >= 2) {
+        const size_t num = sfmt->idx;
+        const size_t words = (n - i) / 2;
+        const size_t m = N - num < words ? N - num : words;
+
+        regenerate(sfmt->state, num, num + m);
+        memcpy(&buf[i], &sfmt->state[2 * num], 2 * m * sizeof(uint64_t));
+        sfmt->idx = (num + m) % N;
+        i += 2 * m;
+    }
+
+    if (i < n) buf[i] = gen64(rng);
+}
+
+static
+void get_state(const F2LinRngGeneric* rng, uint64_t* words) {
+    // the raw ring buffer, idx and pending are not part of the words
+    memcpy(words, ((const F2LinRngSFMT*) rng)->state, 2 * N * sizeof(uint64_t));
+}
+
+static
+void set_state(F2LinRngGeneric* rng, const uint64_t* words) {
+    memcpy(((F2LinRngSFMT*) rng)->state, words, 2 * N * sizeof(uint64_t));
+}
+
+static
+int compare_state(const F2LinRngGeneric* lhs, const F2LinRngGeneric* rhs) {
+    // the same state can be stored with a different idx, and with more of it regenerated
+    // ahead. The one with fewer pending numbers is moved ahead by the difference on a copy
+    const F2LinRngSFMT* l = (const F2LinRngSFMT*) lhs;
+    const F2LinRngSFMT* r = (const F2LinRngSFMT*) rhs;
+    F2LinRngSFMT behind;
+
+    if ((l->pending ^ r->pending) & 1) return 0;
+    if (l->pending < r->pending) {
+        behind = *l;
+        next_state_n(&behind.base, (r->pending - l->pending) / 2);
+        l = &behind;
+    } else if (r->pending < l->pending) {
+        behind = *r;
+        next_state_n(&behind.base, (l->pending - r->pending) / 2);
+        r = &behind;
+    }
+
+    for (size_t k = 0; k < N; ++k) {
+        const size_t li = (l->idx + k) % N, ri = (r->idx + k) % N;
+
+        if (l->state[2 * li] != r->state[2 * ri]) return 0;
+        if (l->state[2 * li + 1] != r->state[2 * ri + 1]) return 0;
+    }
+    return 1;
+}
+
+const F2LinRngBackend f2lin_rng_backend_sfmt = {
+    .name = "sfmt19937",
+    .state_size = XOR64_RNG_STATE_SIZE,
+    .state_words = 2 * N,
+    .size = sizeof(F2LinRngSFMT),
+    .align = _Alignof(F2LinRngSFMT),
+    .min_poly = MIN_POLY,
+    .numbers_per_step = 2,
+    .init_zero = init_zero,
+    .init = init,
+    .init_seed = init_seed,
+    .copy = copy,
+    .add = add,
+    .normalize = normalize,
+    .gen64 = gen64,
+    .next_state = next_state,
+    .next_state_n = next_state_n,
+    .gen_n_numbers = gen_n_numbers,
+    .get_state = get_state,
+    .set_state = set_state,
+    .compare_state = compare_state,
+};
+
+/*
+ * Regenerates the words from to to - 1 with the recursion of SFMT19937, where word i
+ * depends on the words i, i + POS1, i - 2 and i - 1 of the ring buffer. The last two are
+ * kept in registers, and the loop is split where i + POS1 wraps around, like gen_rand_all()
+ * of the reference implementation.
+ */
+#ifdef __SSE2__
+static
+void regenerate(uint64_t* state, size_t from, size_t to) {
+    const __m128i mask = _mm_set_epi32(MSK4, MSK3, MSK2, MSK1);
+    __m128i* w = (__m128i*) state;
+    __m128i r1 = _mm_load_si128(&w[(from + N - 2) % N]);
+    __m128i r2 = _mm_load_si128(&w[(from + N - 1) % N]);
+    size_t i = from;
+
+// one word of the recursion, a is word i and b word i + POS1
+#define SFMT_SSE2_WORD(b) do {                                          \
+        const __m128i a = _mm_load_si128(&w[i]);                        \
+        __m128i z = _mm_xor_si128(_mm_srli_si128(r1, SR2), a);          \
+        z = _mm_xor_si128(z, _mm_slli_epi32(r2, SL1));                  \
+        z = _mm_xor_si128(z, _mm_slli_si128(a, SL2));                   \
+        z = _mm_xor_si128(z, _mm_and_si128(_mm_srli_epi32((b), SR1), mask)); \
+        _mm_store_si128(&w[i], z);                                      \
+        r1 = r2;                                                        \
+        r2 = z;                                                         \
+    } while (0)
+
+    for (; i < to && i < N - POS1; ++i) SFMT_SSE2_WORD(_mm_load_si128(&w[i + POS1]));
+    for (; i < to; ++i) SFMT_SSE2_WORD(_mm_load_si128(&w[i + POS1 - N]));
+#undef SFMT_SSE2_WORD
+}
+#else
+static
+void regenerate(uint64_t* state, size_t from, size_t to) {
+    uint64_t r1l = state[2 * ((from + N - 2) % N)], r1h = state[2 * ((from + N - 2) % N) + 1];
+    uint64_t r2l = state[2 * ((from + N - 1) % N)], r2h = state[2 * ((from + N - 1) % N) + 1];
+
+    for (size_t i = from; i < to; ++i) {
+        const size_t b = i < N - POS1 ? i + POS1 : i + POS1 - N;
+        const uint64_t al = state[2 * i], ah = state[2 * i + 1];
+        const uint64_t bl = state[2 * b], bh = state[2 * b + 1];
+        // the 128 bit shifts by SL2 and SR2 bytes, and the 32 bit shifts by SL1 and SR1
+        const uint64_t l = al ^ (al << (8 * SL2)) ^ ((bl >> SR1) & SR1_KEEP & MSK_LO) ^
+                           (r1l >> (8 * SR2)) ^ (r1h << (64 - 8 * SR2)) ^
+                           ((r2l << SL1) & SL1_KEEP);
+        const uint64_t h = ah ^ (ah << (8 * SL2)) ^ (al >> (64 - 8 * SL2)) ^
+                           ((bh >> SR1) & SR1_KEEP & MSK_HI) ^ (r1h >> (8 * SR2)) ^
+                           ((r2h << SL1) & SL1_KEEP);
+
+        state[2 * i] = l;
+        state[2 * i + 1] = h;
+        r1l = r2l;
+        r1h = r2h;
+        r2l = l;
+        r2h = h;
+    }
+}
+#endif
@@ -1,81 +1,172 @@
+#include <string.h>
 #include <stdio.h>
 
 #include "rng_generic.h"
 #include "lib/tinymt/tinymt.h"
-#ifndef CALC_MIN_POLY 
+#include "tinymtparams.h"
+#ifndef CALC_MIN_POLY
 #include "minpolytinymt.h"
+#else
+#define MIN_POLY 0
 #endif
 
-struct F2LinRngGeneric {
+typedef struct F2LinRngTinyMT F2LinRngTinyMT;
+
+struct F2LinRngTinyMT {
+    F2LinRngGeneric base;
     tinymt64_t tinymt64;
 };
 
-F2LinRngGeneric* f2lin_rng_generic_init_zero() {
+// the parameters tinymt always used, MIN_POLY belongs to them. Their characteristic 
+// polynomial is reducible, the sets of tinymtparams.h have a full period
+static const F2LinTinyMTParams default_params = { 0x65980cb3, 0xeb38facf, 0xcc3b75ff };
+
+static const F2LinTinyMTParams param_table[TINYMT_PARAM_SETS] = { TINYMT_PARAMS };
 
-    F2LinRngGeneric* rng = (F2LinRngGeneric*) calloc(1, sizeof(F2LinRngGeneric));
-    rng->tinymt64.mat1 = 0x65980cb3;
-    rng->tinymt64.mat2 = 0xeb38facf;
-    rng->tinymt64.tmat = 0xcc3b75ff;
-    return rng;
+static
+void set_params(F2LinRngGeneric* rng, const void* params) {
+    const F2LinTinyMTParams* p = params;
+    F2LinRngTinyMT* r = (F2LinRngTinyMT*) rng;
+
+    r->tinymt64.mat1 = p->mat1;
+    r->tinymt64.mat2 = p->mat2;
+    r->tinymt64.tmat = p->tmat;
 }
 
-F2LinRngGeneric* f2lin_rng_generic_init() {
-    F2LinRngGeneric* rng = f2lin_rng_generic_init_zero();
-    tinymt64_init(&rng->tinymt64, 2147482983);
-    return rng;
+static
+void get_params(const F2LinRngGeneric* rng, void* params) {
+    const F2LinRngTinyMT* r = (const F2LinRngTinyMT*) rng;
+
+    *(F2LinTinyMTParams*) params = (F2LinTinyMTParams) { 
+        .mat1 = r->tinymt64.mat1, 
+        .mat2 = r->tinymt64.mat2, 
+        .tmat = r->tinymt64.tmat,
+    };
 }
 
-F2LinRngGeneric* f2lin_rng_generic_init_seed(uint64_t seed) {
-    F2LinRngGeneric* rng = f2lin_rng_generic_init_zero();
-    tinymt64_init(&rng->tinymt64, seed);
-    return rng;
-    
+static
+void init_zero(F2LinRngGeneric* rng) {
+    set_params(rng, &default_params);
 }
 
-F2LinRngGeneric* f2lin_rng_generic_copy(F2LinRngGeneric* dest, const F2LinRngGeneric* source) {
-    dest->tinymt64.status[0] = source->tinymt64.status[0];
-    dest->tinymt64.status[1] = source->tinymt64.status[1];
-    dest->tinymt64.mat1 = source->tinymt64.mat1;
-    dest->tinymt64.mat2 = source->tinymt64.mat2;
-    dest->tinymt64.tmat = source->tinymt64.tmat;
+static
+void init(F2LinRngGeneric* rng) {
+    tinymt64_init(&((F2LinRngTinyMT*) rng)->tinymt64, 2147482983);
+}
 
-    return dest;
+static
+void init_seed(F2LinRngGeneric* rng, uint64_t seed) {
+    tinymt64_init(&((F2LinRngTinyMT*) rng)->tinymt64, seed);
 }
-F2LinRngGeneric* f2lin_rng_generic_add(F2LinRngGeneric* lhs, const F2LinRngGeneric* rhs) {
-    lhs->tinymt64.status[0] ^= rhs->tinymt64.status[0];
-    lhs->tinymt64.status[1] ^= rhs->tinymt64.status[1];
 
-    return lhs;
+static
+void copy(F2LinRngGeneric* dest, const F2LinRngGeneric* source) {
+    ((F2LinRngTinyMT*) dest)->tinymt64 = ((const F2LinRngTinyMT*) source)->tinymt64;
 }
 
-uint64_t f2lin_rng_generic_gen64(F2LinRngGeneric* rng) {
-    return tinymt64_generate_uint64(&rng->tinymt64);
+static
+void add(F2LinRngGeneric* lhs, const F2LinRngGeneric* rhs) {
+    tinymt64_t* l = &((F2LinRngTinyMT*) lhs)->tinymt64;
+    const tinymt64_t* r = &((const F2LinRngTinyMT*) rhs)->tinymt64;
+
+    l->status[0] ^= r->status[0];
+    l->status[1] ^= r->status[1];
 }
 
-void f2lin_rng_generic_gen_n_numbers(F2LinRngGeneric* rng, size_t N, uint64_t buf[N]) {
-    for (size_t i = 0; i < N; ++i) buf[i] = f2lin_rng_generic_gen64(rng);
+static
+void normalize(F2LinRngGeneric* rng) {
+    // the state is always stored the same way
 }
 
-uint64_t f2lin_rng_generic_next_state(F2LinRngGeneric* rng) {
-    tinymt64_next_state(&rng->tinymt64);
-    return rng->tinymt64.status[0];
+static
+uint64_t gen64(F2LinRngGeneric* rng) {
+    return tinymt64_generate_uint64(&((F2LinRngTinyMT*) rng)->tinymt64);
 }
 
-void f2lin_rng_generic_destroy(F2LinRngGeneric* rng) {
-    free(rng);
+static
+uint64_t next_state(F2LinRngGeneric* rng) {
+    F2LinRngTinyMT* r = (F2LinRngTinyMT*) rng;
+
+    tinymt64_next_state(&r->tinymt64);
+    return r->tinymt64.status[0];
 }
 
-long f2lin_rng_generic_state_size() {
-    return 127;
+static
+void next_state_n(F2LinRngGeneric* rng, size_t n) {
+    // like gen_n_numbers(), on a copy in registers
+    F2LinRngTinyMT* r = (F2LinRngTinyMT*) rng;
+    tinymt64_t t = r->tinymt64;
+
+    for (size_t i = 0; i < n; ++i) tinymt64_next_state(&t);
+    r->tinymt64 = t;
 }
 
-#ifndef CALC_MIN_POLY
-char* f2lin_rng_generic_min_poly() {
-    return MIN_POLY;
+static
+void gen_n_numbers(F2LinRngGeneric* rng, size_t N, uint64_t* buf) {
+    // work on a copy, so the state stays in registers instead of being reloaded after
+    // every store to buf
+    F2LinRngTinyMT* r = (F2LinRngTinyMT*) rng;
+    tinymt64_t t = r->tinymt64;
+
+    for (size_t i = 0; i < N; ++i) buf[i] = tinymt64_generate_uint64(&t);
+    r->tinymt64 = t;
+}
+
+static
+void get_state(const F2LinRngGeneric* rng, uint64_t* words) {
+    const F2LinRngTinyMT* r = (const F2LinRngTinyMT*) rng;
+
+    words[0] = r->tinymt64.status[0];
+    words[1] = r->tinymt64.status[1];
 }
-#endif
 
-int f2lin_rng_generic_compare_state(F2LinRngGeneric* lhs, F2LinRngGeneric* rhs) {
-    return lhs->tinymt64.status[0] == rhs->tinymt64.status[0] &&
-           lhs->tinymt64.status[1] == rhs->tinymt64.status[1];
+static
+void set_state(F2LinRngGeneric* rng, const uint64_t* words) {
+    F2LinRngTinyMT* r = (F2LinRngTinyMT*) rng;
+
+    r->tinymt64.status[0] = words[0];
+    r->tinymt64.status[1] = words[1];
+}
+
+static
+int compare_state(const F2LinRngGeneric* lhs, const F2LinRngGeneric* rhs) {
+    const tinymt64_t* l = &((const F2LinRngTinyMT*) lhs)->tinymt64;
+    const tinymt64_t* r = &((const F2LinRngTinyMT*) rhs)->tinymt64;
+
+    // the highest bit of status[0] is masked off by the next transition, so it never 
+    // changes the stream. jumps leave it arbitrary, as its direction is the kernel of the
+    // transition, which the minimal polynomial doesn't cover.
+    // generators with other parameters have another stream from the same state
+    return ((l->status[0] ^ r->status[0]) & TINYMT64_MASK) == 0 && 
+           l->status[1] == r->status[1] &&
+           l->mat1 == r->mat1 && l->mat2 == r->mat2 && l->tmat == r->tmat;
 }
+
+const F2LinRngBackend f2lin_rng_backend_tinymt = {
+    .name = "tinymt64",
+    .state_size = 127,
+    .state_words = 2,
+    .size = sizeof(F2LinRngTinyMT),
+    .align = _Alignof(F2LinRngTinyMT),
+    .min_poly = MIN_POLY,
+    .numbers_per_step = 1,
+    .init_zero = init_zero,
+    .init = init,
+    .init_seed = init_seed,
+    .copy = copy,
+    .add = add,
+    .normalize = normalize,
+    .gen64 = gen64,
+    .next_state = next_state,
+    .next_state_n = next_state_n,
+    .gen_n_numbers = gen_n_numbers,
+    .get_state = get_state,
+    .set_state = set_state,
+    .compare_state = compare_state,
+    .params_size = sizeof(F2LinTinyMTParams),
+    .default_params = &default_params,
+    .param_sets = TINYMT_PARAM_SETS,
+    .param_table = param_table,
+    .get_params = get_params,
+    .set_params = set_params,
+};
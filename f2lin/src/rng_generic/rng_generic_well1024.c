@@ -0,0 +1,190 @@
+#include <string.h>
+
+#include "rng_generic.h"
+
+#ifndef CALC_MIN_POLY
+#include "minpolywell1024.h"
+#else
+#define MIN_POLY 0
+#endif
+
+#define SEED 12323456
+#define XOR64_RNG_STATE_SIZE 1024
+
+/* number of 32 bit words of the state, and the offsets of WELL1024a */
+#define R 32
+#define M1 3
+#define M2 24
+#define M3 10
+
+typedef struct F2LinRngWELL1024 F2LinRngWELL1024;
+
+// the state is a ring buffer, word k of the state is stored at (i + k) % R
+struct F2LinRngWELL1024 {
+    F2LinRngGeneric base;
+    uint32_t state[R];
+    unsigned int i;
+};
+
+/*
+ * One step of WELL1024a on the ring buffer s at index i, which moves i back by one and
+ * returns the new word stored there.
+ */
+#define WELL1024_STEP(s, i, out) do {                                           \
+        const uint32_t z0 = (s)[((i) + 31) & (R - 1)];                          \
+        const uint32_t vm1 = (s)[((i) + M1) & (R - 1)];                         \
+        const uint32_t vm2 = (s)[((i) + M2) & (R - 1)];                         \
+        const uint32_t vm3 = (s)[((i) + M3) & (R - 1)];                         \
+        const uint32_t z1 = (s)[(i)] ^ (vm1 ^ (vm1 >> 8));                      \
+        const uint32_t z2 = (vm2 ^ (vm2 << 19)) ^ (vm3 ^ (vm3 << 14));          \
+        (s)[(i)] = z1 ^ z2;                                                     \
+        (i) = ((i) + 31) & (R - 1);                                             \
+        (s)[(i)] = (z0 ^ (z0 << 11)) ^ (z1 ^ (z1 << 7)) ^ (z2 ^ (z2 << 13));    \
+        (out) = (s)[(i)];                                                       \
+    } while (0)
+
+static
+void init_zero(F2LinRngGeneric* rng) {
+    // i = 0, there are no parameters
+}
+
+static
+void init_seed(F2LinRngGeneric* rng, uint64_t seed) {
+    F2LinRngWELL1024* w = (F2LinRngWELL1024*) rng;
+
+    // the initialization of MT19937 for 32 bit words, the upper half of the seed is mixed
+    // into the second word. The state can't be zero, as a zero word k - 1 makes word k = k.
+    w->state[0] = (uint32_t) seed;
+    for (unsigned int k = 1; k < R; ++k) {
+        w->state[k] = 1812433253u * (w->state[k - 1] ^ (w->state[k - 1] >> 30)) + k;
+        if (k == 1) w->state[k] ^= (uint32_t) (seed >> 32);
+    }
+    w->i = 0;
+}
+
+static
+void init(F2LinRngGeneric* rng) {
+    init_seed(rng, SEED);
+}
+
+static
+void copy(F2LinRngGeneric* dest, const F2LinRngGeneric* source) {
+    F2LinRngWELL1024* d = (F2LinRngWELL1024*) dest;
+    const F2LinRngWELL1024* s = (const F2LinRngWELL1024*) source;
+
+    memcpy(d->state, s->state, sizeof(d->state));
+    d->i = s->i;
+}
+
+static
+void add(F2LinRngGeneric* lhs, const F2LinRngGeneric* rhs) {
+    F2LinRngWELL1024* l = (F2LinRngWELL1024*) lhs;
+    const F2LinRngWELL1024* r = (const F2LinRngWELL1024*) rhs;
+
+    for (unsigned int k = 0; k < R; ++k) {
+        l->state[(l->i + k) & (R - 1)] ^= r->state[(r->i + k) & (R - 1)];
+    }
+}
+
+static
+void normalize(F2LinRngGeneric* rng) {
+    F2LinRngWELL1024* w = (F2LinRngWELL1024*) rng;
+    uint32_t tmp[R];
+
+    // rotate the state so it starts at i = 0
+    for (unsigned int k = 0; k < R; ++k) tmp[k] = w->state[(w->i + k) & (R - 1)];
+    memcpy(w->state, tmp, sizeof(tmp));
+    w->i = 0;
+}
+
+// two steps of WELL1024a, the first output is the upper half of the number
+static
+uint64_t next_state(F2LinRngGeneric* rng) {
+    F2LinRngWELL1024* w = (F2LinRngWELL1024*) rng;
+    unsigned int i = w->i;
+    uint32_t hi, lo;
+
+    WELL1024_STEP(w->state, i, hi);
+    WELL1024_STEP(w->state, i, lo);
+    w->i = i;
+
+    return ((uint64_t) hi << 32) | lo;
+}
+
+static
+uint64_t gen64(F2LinRngGeneric* rng) {
+    // WELL has no tempering
+    return next_state(rng);
+}
+
+static
+void next_state_n(F2LinRngGeneric* rng, size_t n) {
+    F2LinRngWELL1024* w = (F2LinRngWELL1024*) rng;
+    unsigned int i = w->i;
+    uint32_t out;
+
+    for (size_t k = 0; k < 2 * n; ++k) WELL1024_STEP(w->state, i, out);
+    (void) out;
+    w->i = i;
+}
+
+static
+void gen_n_numbers(F2LinRngGeneric* rng, size_t N, uint64_t* buf) {
+    F2LinRngWELL1024* w = (F2LinRngWELL1024*) rng;
+    unsigned int i = w->i;
+
+    for (size_t k = 0; k < N; ++k) {
+        uint32_t hi, lo;
+
+        WELL1024_STEP(w->state, i, hi);
+        WELL1024_STEP(w->state, i, lo);
+        buf[k] = ((uint64_t) hi << 32) | lo;
+    }
+    w->i = i;
+}
+
+static
+void get_state(const F2LinRngGeneric* rng, uint64_t* words) {
+    // the raw ring buffer, i is not part of the words
+    memcpy(words, ((const F2LinRngWELL1024*) rng)->state, R * sizeof(uint32_t));
+}
+
+static
+void set_state(F2LinRngGeneric* rng, const uint64_t* words) {
+    memcpy(((F2LinRngWELL1024*) rng)->state, words, R * sizeof(uint32_t));
+}
+
+static
+int compare_state(const F2LinRngGeneric* lhs, const F2LinRngGeneric* rhs) {
+    // the same state can be stored with a different i
+    const F2LinRngWELL1024* l = (const F2LinRngWELL1024*) lhs;
+    const F2LinRngWELL1024* r = (const F2LinRngWELL1024*) rhs;
+
+    for (unsigned int k = 0; k < R; ++k) {
+        if (l->state[(l->i + k) & (R - 1)] != r->state[(r->i + k) & (R - 1)]) return 0;
+    }
+    return 1;
+}
+
+const F2LinRngBackend f2lin_rng_backend_well1024 = {
+    .name = "well1024a",
+    .state_size = XOR64_RNG_STATE_SIZE,
+    .state_words = R / 2,
+    .size = sizeof(F2LinRngWELL1024),
+    .align = _Alignof(F2LinRngWELL1024),
+    .min_poly = MIN_POLY,
+    .numbers_per_step = 1,
+    .init_zero = init_zero,
+    .init = init,
+    .init_seed = init_seed,
+    .copy = copy,
+    .add = add,
+    .normalize = normalize,
+    .gen64 = gen64,
+    .next_state = next_state,
+    .next_state_n = next_state_n,
+    .gen_n_numbers = gen_n_numbers,
+    .get_state = get_state,
+    .set_state = set_state,
+    .compare_state = compare_state,
+};
@@ -0,0 +1,162 @@
+#include <string.h>
+
+#include "rng_generic.h"
+
+#ifndef CALC_MIN_POLY
+#include "minpolyxoroshiro.h"
+#else
+#define MIN_POLY 0
+#endif
+
+#define XOR64_RNG_STATE_SIZE 128
+
+typedef struct F2LinRngXoroshiro F2LinRngXoroshiro;
+
+struct F2LinRngXoroshiro {
+    F2LinRngGeneric base;
+    uint64_t state[2];
+};
+
+static inline uint64_t rotl(const uint64_t x, int k) {
+    return (x << k) | (x >> (64 - k));
+}
+
+// one step of xoroshiro128++, on the state in registers
+#define XOROSHIRO_STEP(out) do {                    \
+        (out) = rotl(s0 + s1, 17) + s0;             \
+        s1 ^= s0;                                   \
+        s0 = rotl(s0, 49) ^ s1 ^ (s1 << 21);        \
+        s1 = rotl(s1, 28);                          \
+    } while (0)
+
+static
+void init_zero(F2LinRngGeneric* rng) {
+    // there are no parameters
+}
+
+static
+void init(F2LinRngGeneric* rng) {
+    uint64_t* s = ((F2LinRngXoroshiro*) rng)->state;
+
+    s[0] = 12323456ull;
+    s[1] = 0xa02b4c7dull;
+}
+
+static
+void init_seed(F2LinRngGeneric* rng, uint64_t seed) {
+    uint64_t* s = ((F2LinRngXoroshiro*) rng)->state;
+
+    // the state must not be zero, so the second word is never cleared by the seed
+    s[0] = seed;
+    s[1] = 0x9e3779b97f4a7c15ull;
+}
+
+static
+void copy(F2LinRngGeneric* dest, const F2LinRngGeneric* source) {
+    memcpy(((F2LinRngXoroshiro*) dest)->state, ((const F2LinRngXoroshiro*) source)->state,
+           2 * sizeof(uint64_t));
+}
+
+static
+void add(F2LinRngGeneric* lhs, const F2LinRngGeneric* rhs) {
+    uint64_t* l = ((F2LinRngXoroshiro*) lhs)->state;
+    const uint64_t* r = ((const F2LinRngXoroshiro*) rhs)->state;
+
+    l[0] ^= r[0];
+    l[1] ^= r[1];
+}
+
+static
+void normalize(F2LinRngGeneric* rng) {
+    // the state is always stored the same way
+}
+
+static
+uint64_t next_state(F2LinRngGeneric* rng) {
+    uint64_t* s = ((F2LinRngXoroshiro*) rng)->state;
+    const uint64_t s1 = s[0] ^ s[1];
+
+    s[0] = rotl(s[0], 49) ^ s1 ^ (s1 << 21);
+    s[1] = rotl(s1, 28);
+
+    return s[1];
+}
+
+static
+uint64_t gen64(F2LinRngGeneric* rng) {
+    uint64_t* s = ((F2LinRngXoroshiro*) rng)->state;
+    const uint64_t result = rotl(s[0] + s[1], 17) + s[0];
+
+    next_state(rng);
+    return result;
+}
+
+static
+void next_state_n(F2LinRngGeneric* rng, size_t n) {
+    uint64_t* s = ((F2LinRngXoroshiro*) rng)->state;
+    uint64_t s0 = s[0], s1 = s[1], out;
+
+    // the output is unused, the compiler drops it
+    for (size_t i = 0; i < n; ++i) XOROSHIRO_STEP(out);
+    (void) out;
+
+    s[0] = s0;
+    s[1] = s1;
+}
+
+static
+void gen_n_numbers(F2LinRngGeneric* rng, size_t N, uint64_t* buf) {
+    uint64_t* s = ((F2LinRngXoroshiro*) rng)->state;
+    uint64_t s0 = s[0], s1 = s[1];
+    size_t i = 0;
+
+    for (; i + 4 <= N; i += 4) {
+        XOROSHIRO_STEP(buf[i]);
+        XOROSHIRO_STEP(buf[i + 1]);
+        XOROSHIRO_STEP(buf[i + 2]);
+        XOROSHIRO_STEP(buf[i + 3]);
+    }
+    for (; i < N; ++i) XOROSHIRO_STEP(buf[i]);
+
+    s[0] = s0;
+    s[1] = s1;
+}
+
+static
+void get_state(const F2LinRngGeneric* rng, uint64_t* words) {
+    memcpy(words, ((const F2LinRngXoroshiro*) rng)->state, 2 * sizeof(uint64_t));
+}
+
+static
+void set_state(F2LinRngGeneric* rng, const uint64_t* words) {
+    memcpy(((F2LinRngXoroshiro*) rng)->state, words, 2 * sizeof(uint64_t));
+}
+
+static
+int compare_state(const F2LinRngGeneric* lhs, const F2LinRngGeneric* rhs) {
+    return !memcmp(((const F2LinRngXoroshiro*) lhs)->state,
+                   ((const F2LinRngXoroshiro*) rhs)->state, 2 * sizeof(uint64_t));
+}
+
+const F2LinRngBackend f2lin_rng_backend_xoroshiro = {
+    .name = "xoroshiro128++",
+    .state_size = XOR64_RNG_STATE_SIZE,
+    .state_words = 2,
+    .size = sizeof(F2LinRngXoroshiro),
+    .align = _Alignof(F2LinRngXoroshiro),
+    .min_poly = MIN_POLY,
+    .numbers_per_step = 1,
+    .init_zero = init_zero,
+    .init = init,
+    .init_seed = init_seed,
+    .copy = copy,
+    .add = add,
+    .normalize = normalize,
+    .gen64 = gen64,
+    .next_state = next_state,
+    .next_state_n = next_state_n,
+    .gen_n_numbers = gen_n_numbers,
+    .get_state = get_state,
+    .set_state = set_state,
+    .compare_state = compare_state,
+};
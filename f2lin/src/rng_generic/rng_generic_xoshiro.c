@@ -1,14 +1,19 @@
+#include <string.h>
+
 #include "rng_generic.h"
 
 #ifndef CALC_MIN_POLY
 #include "minpolyxoshiro.h"
+#else
+#define MIN_POLY 0
 #endif
 
 #define XOR64_RNG_STATE_SIZE 256
 
-typedef struct F2LinRngGeneric F2LinRngGeneric;
+typedef struct F2LinRngXoshiro F2LinRngXoshiro;
 
-struct F2LinRngGeneric {
+struct F2LinRngXoshiro {
+    F2LinRngGeneric base;
     uint64_t state[4];
 };
 
@@ -16,46 +21,61 @@ static inline uint64_t rotl(const uint64_t x, int k) {
 	return (x << k) | (x >> (64 - k));
 }
 
-F2LinRngGeneric* f2lin_rng_generic_init_zero() {
-    return (F2LinRngGeneric*) calloc(1, sizeof(F2LinRngGeneric));
+// one step of xoshiro256++, on the state in registers
+#define XOSHIRO_STEP(out) do {                      \
+        const uint64_t t = s1 << 17;                \
+        (out) = rotl(s0 + s3, 23) + s0;             \
+        s2 ^= s0; s3 ^= s1; s1 ^= s2; s0 ^= s3;     \
+        s2 ^= t;                                    \
+        s3 = rotl(s3, 45);                          \
+    } while (0)
+
+static
+void init_zero(F2LinRngGeneric* rng) {
+    // there are no parameters
 }
 
-F2LinRngGeneric* f2lin_rng_generic_init() {
-    F2LinRngGeneric* rng = (F2LinRngGeneric* )calloc(1, sizeof(F2LinRngGeneric));
-    rng->state[0] = 12323456ull;
-    rng->state[1] = 54321ull;
-    rng->state[2] = 0xa02b4c7dull;
-    rng->state[3] = 0x94a3f7eeull;
-    return rng;
+static
+void init(F2LinRngGeneric* rng) {
+    uint64_t* s = ((F2LinRngXoshiro*) rng)->state;
+
+    s[0] = 12323456ull;
+    s[1] = 54321ull;
+    s[2] = 0xa02b4c7dull;
+    s[3] = 0x94a3f7eeull;
 }
 
-F2LinRngGeneric* f2lin_rng_generic_init_seed(uint64_t seed) {
-    F2LinRngGeneric* rng = f2lin_rng_generic_init_zero();
-    rng->state[0] = seed;
+static
+void init_seed(F2LinRngGeneric* rng, uint64_t seed) {
+    ((F2LinRngXoshiro*) rng)->state[0] = seed;
     // use splitmix?
-    return rng;
 }
 
-F2LinRngGeneric* f2lin_rng_generic_copy(F2LinRngGeneric *dest, 
-        const F2LinRngGeneric *source) {
-    dest->state[0] = source->state[0];
-    dest->state[1] = source->state[1];
-    dest->state[2] = source->state[2];
-    dest->state[3] = source->state[3];
-    return dest;
+static
+void copy(F2LinRngGeneric* dest, const F2LinRngGeneric* source) {
+    memcpy(((F2LinRngXoshiro*) dest)->state, ((const F2LinRngXoshiro*) source)->state,
+           4 * sizeof(uint64_t));
+}
+
+static
+void add(F2LinRngGeneric* lhs, const F2LinRngGeneric* rhs) {
+    uint64_t* l = ((F2LinRngXoshiro*) lhs)->state;
+    const uint64_t* r = ((const F2LinRngXoshiro*) rhs)->state;
+
+    l[0] ^= r[0];
+    l[1] ^= r[1];
+    l[2] ^= r[2];
+    l[3] ^= r[3];
 }
 
-F2LinRngGeneric* f2lin_rng_generic_add(F2LinRngGeneric* lhs, 
-        const F2LinRngGeneric* rhs) {
-    lhs->state[0] ^= rhs->state[0];
-    lhs->state[1] ^= rhs->state[1];
-    lhs->state[2] ^= rhs->state[2];
-    lhs->state[3] ^= rhs->state[3];
-    return lhs;
+static
+void normalize(F2LinRngGeneric* rng) {
+    // the state is always stored the same way
 }
 
-uint64_t f2lin_rng_generic_next_state(F2LinRngGeneric* rng) {
-    uint64_t* s = rng->state;
+static
+uint64_t next_state(F2LinRngGeneric* rng) {
+    uint64_t* s = ((F2LinRngXoshiro*) rng)->state;
 	const uint64_t t = s[1] << 17;
 
 	s[2] ^= s[0];
@@ -70,34 +90,86 @@ uint64_t f2lin_rng_generic_next_state(F2LinRngGeneric* rng) {
     return s[3];
 }
 
-uint64_t f2lin_rng_generic_gen64(F2LinRngGeneric* rng) {
-    uint64_t* s = rng->state;
+static
+uint64_t gen64(F2LinRngGeneric* rng) {
+    uint64_t* s = ((F2LinRngXoshiro*) rng)->state;
     const uint64_t result = rotl(s[0] + s[3], 23) + s[0];
-    f2lin_rng_generic_next_state(rng);
+
+    next_state(rng);
     return result;
 }
 
-void f2lin_rng_generic_gen_n_numbers(F2LinRngGeneric* rng, size_t N, uint64_t buf[N]) {
-    for (size_t i = 0; i < N; ++i) buf[i] = f2lin_rng_generic_gen64(rng);
+static
+void next_state_n(F2LinRngGeneric* rng, size_t n) {
+    uint64_t* s = ((F2LinRngXoshiro*) rng)->state;
+    uint64_t s0 = s[0], s1 = s[1], s2 = s[2], s3 = s[3], out;
+
+    // the output is unused, the compiler drops it
+    for (size_t i = 0; i < n; ++i) XOSHIRO_STEP(out);
+    (void) out;
+
+    s[0] = s0;
+    s[1] = s1;
+    s[2] = s2;
+    s[3] = s3;
 }
 
-long f2lin_rng_generic_state_size() {
-    return XOR64_RNG_STATE_SIZE;
+static
+void gen_n_numbers(F2LinRngGeneric* rng, size_t N, uint64_t* buf) {
+    uint64_t* s = ((F2LinRngXoshiro*) rng)->state;
+    uint64_t s0 = s[0], s1 = s[1], s2 = s[2], s3 = s[3];
+    size_t i = 0;
+
+    // the output only depends on s0 and s3, so it overlaps with the next step
+    for (; i + 4 <= N; i += 4) {
+        XOSHIRO_STEP(buf[i]);
+        XOSHIRO_STEP(buf[i + 1]);
+        XOSHIRO_STEP(buf[i + 2]);
+        XOSHIRO_STEP(buf[i + 3]);
+    }
+    for (; i < N; ++i) XOSHIRO_STEP(buf[i]);
+
+    s[0] = s0;
+    s[1] = s1;
+    s[2] = s2;
+    s[3] = s3;
 }
 
-void f2lin_rng_generic_destroy(F2LinRngGeneric* rng) {
-    free(rng);
+static
+void get_state(const F2LinRngGeneric* rng, uint64_t* words) {
+    memcpy(words, ((const F2LinRngXoshiro*) rng)->state, 4 * sizeof(uint64_t));
 }
 
-#ifndef CALC_MIN_POLY
-char* f2lin_rng_generic_min_poly() {
-    return MIN_POLY;
+static
+void set_state(F2LinRngGeneric* rng, const uint64_t* words) {
+    memcpy(((F2LinRngXoshiro*) rng)->state, words, 4 * sizeof(uint64_t));
 }
-#endif
 
-int f2lin_rng_generic_compare_state(F2LinRngGeneric* lhs, F2LinRngGeneric* rhs) {
-    return lhs->state[0] == rhs->state[0] &&
-           lhs->state[1] == rhs->state[1] && 
-           lhs->state[2] == rhs->state[2] &&   
-           lhs->state[3] == rhs->state[3]; 
+static
+int compare_state(const F2LinRngGeneric* lhs, const F2LinRngGeneric* rhs) {
+    return !memcmp(((const F2LinRngXoshiro*) lhs)->state,
+                   ((const F2LinRngXoshiro*) rhs)->state, 4 * sizeof(uint64_t));
 }
+
+const F2LinRngBackend f2lin_rng_backend_xoshiro = {
+    .name = "xoshiro256++",
+    .state_size = XOR64_RNG_STATE_SIZE,
+    .state_words = 4,
+    .size = sizeof(F2LinRngXoshiro),
+    .align = _Alignof(F2LinRngXoshiro),
+    .min_poly = MIN_POLY,
+    .numbers_per_step = 1,
+    .init_zero = init_zero,
+    .init = init,
+    .init_seed = init_seed,
+    .copy = copy,
+    .add = add,
+    .normalize = normalize,
+    .gen64 = gen64,
+    .next_state = next_state,
+    .next_state_n = next_state_n,
+    .gen_n_numbers = gen_n_numbers,
+    .get_state = get_state,
+    .set_state = set_state,
+    .compare_state = compare_state,
+};
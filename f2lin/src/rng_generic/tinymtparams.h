@@ -0,0 +1,1028 @@
+/* written by make tinymt_params, see src/tinymt_params.c. Every set has
+ * the maximal period and an optimal equidistribution (delta 0) */
+#define TINYMT_PARAM_SETS 1024
+#define TINYMT_PARAMS \
+    { 0xfa051f40, 0xffd0fff4, 0x58d02ffeffbfffbcull }, \
+    { 0x59837484, 0xceb13a9a, 0x2a613e5ebc594454ull }, \
+    { 0x5e9e9a73, 0xead92ff5, 0xb8baf2c5e1f809ceull }, \
+    { 0x83ab4b84, 0x3e119b0e, 0x0efa0a2cc816774aull }, \
+    { 0xae1afc49, 0xa3d8ff7a, 0xe5c82d9349a29060ull }, \
+    { 0xaa3bc5ed, 0x5e6ca7d4, 0x94550492688ac904ull }, \
+    { 0xde05c19c, 0x95f9935c, 0x78566d43f055935eull }, \
+    { 0xd3fa70b9, 0x14bde424, 0x796292a7500ded6aull }, \
+    { 0xddc07b8a, 0x79d6849b, 0x49f58b4c7f6cb760ull }, \
+    { 0x37a61f6a, 0x3557a002, 0xb2905b471c6d9b64ull }, \
+    { 0x6b393ba9, 0x7cd6e289, 0xcabe2fc694ff2d0aull }, \
+    { 0x47c0850c, 0x59c363a8, 0xc9d4cff6b6e3fdeaull }, \
+    { 0x38607c10, 0xe67bb411, 0xa2e158a3b437e620ull }, \
+    { 0xbda5c004, 0xe9f9d7dc, 0x287996c1a3ffd964ull }, \
+    { 0xe1eb48b4, 0x14f947e6, 0x74cafdf30abee694ull }, \
+    { 0x9cd84263, 0x46618f44, 0xde010e199d951f9aull }, \
+    { 0x9b51cd5f, 0xce32bf89, 0x466d32babad52064ull }, \
+    { 0x36edd6b4, 0xf83f4918, 0x668145c1ca73312cull }, \
+    { 0x8d3410ad, 0x09c5dabf, 0xcc2f1c2c71849a20ull }, \
+    { 0x09db7e83, 0x6bcd8814, 0x288fe4086dd95570ull }, \
+    { 0xfd996197, 0x2e438bac, 0x59a806b6896d3e9eull }, \
+    { 0x302ea9cc, 0x352ee1ad, 0x4a3989c5435816faull }, \
+    { 0xd98a5bbe, 0xd5e13577, 0x02b3a067ba826c2aull }, \
+    { 0x9f60c9dc, 0x7c625a33, 0xb68890d8d814526eull }, \
+    { 0x25ba97c5, 0x77765f33, 0x24459ac5b4c0dcc4ull }, \
+    { 0x0683495e, 0xffc8f594, 0x7a5e38e7bfa7f7c2ull }, \
+    { 0x003a98e9, 0x7b7dc7a9, 0x3737097e7c2ec742ull }, \
+    { 0xba8b89e2, 0xc349c24c, 0xf9d991846a6071d0ull }, \
+    { 0xa2267abe, 0x5b472896, 0x42ec2ad0c037a544ull }, \
+    { 0x8ac50b94, 0x015291fe, 0x745378c451c3ed34ull }, \
+    { 0x1c41ba78, 0x0a588fd7, 0xc5a6a6727538c574ull }, \
+    { 0x75d2a60f, 0x7e53fe75, 0x116af278d052d314ull }, \
+    { 0x9f2cb30a, 0x1040054f, 0xaa2d8aada2e293f0ull }, \
+    { 0x872d1a58, 0x6b6bf18d, 0x82069d8e76f0955cull }, \
+    { 0x2eca17c0, 0x32cd78b7, 0xd50ee1a38c94e89aull }, \
+    { 0x1f1e1617, 0x43af0131, 0xfd311d0c6b8bb51eull }, \
+    { 0x8f5b87bb, 0xe29cbb02, 0x563c33cbb91da1f6ull }, \
+    { 0xa976ed85, 0x76f3bf7f, 0x9db93a4e98f56592ull }, \
+    { 0xbab5dfd9, 0x9520bd49, 0xa56ec2c4e893ecc0ull }, \
+    { 0x4af7861f, 0x26ab08f6, 0x79d8e48e0734329aull }, \
+    { 0x8cdc7cd5, 0x5d22724e, 0xbb4fa10886f646a2ull }, \
+    { 0xe4c1e2e4, 0x9467d300, 0x54032d6a66c5683aull }, \
+    { 0x1532cf91, 0x647d48f6, 0x7571c34c45c9f21cull }, \
+    { 0xbfe46a94, 0xb353a42f, 0x1bed796ec3b85db6ull }, \
+    { 0xe24c1c60, 0xb630630d, 0xa837d70ad1cb36a2ull }, \
+    { 0x6c1ef06d, 0xb1c30eb8, 0x111248f13e8f7e9aull }, \
+    { 0xbb384549, 0x75b01d63, 0x6854468304957c0eull }, \
+    { 0x1f216344, 0xe4d7be5f, 0xeeb6d28cc5bafed4ull }, \
+    { 0xfc41bc76, 0x2383c9ac, 0x8089d4986c836bb0ull }, \
+    { 0x58623224, 0xb4f11f47, 0x5b13843c8209ce74ull }, \
+    { 0xd790db87, 0x3f4e1b4d, 0x8e78d32a28d33bd4ull }, \
+    { 0x6e42d14c, 0x1f669c35, 0xf006f73a57bc4d48ull }, \
+    { 0x68955993, 0x5ad9129a, 0xf35b2bdce2b4741aull }, \
+    { 0x00e7efb4, 0x1337de14, 0x180a9cbe3d6ad20aull }, \
+    { 0x3c0bcf54, 0xf68c4353, 0xc5ba506fdc85b38cull }, \
+    { 0x6b87d694, 0x7e3a722a, 0x29d9780bf3131816ull }, \
+    { 0x5d8bfce0, 0x625bffe3, 0xcc3e824b6c6859e4ull }, \
+    { 0xe80c7cea, 0xadd78339, 0xba62992d1998480eull }, \
+    { 0xb8c0c152, 0xc60448a0, 0x41dc4531a1ea6aeeull }, \
+    { 0xcb1dc0df, 0xdd40ddc8, 0xec18cfd08d92a902ull }, \
+    { 0x9fb3702d, 0xb04f4533, 0x5afd1ee5fc230044ull }, \
+    { 0xd533e245, 0x4e92e13a, 0xd42ab13f98aecc56ull }, \
+    { 0x2e8d58e2, 0xbd7ff12a, 0xba6f24781ccada1aull }, \
+    { 0x070c4456, 0x8c3228db, 0x8c0e9df7c1ec7c66ull }, \
+    { 0xe5981499, 0x4feeb385, 0xb82830c0c9d795a2ull }, \
+    { 0xd6b85383, 0xd3b6a908, 0x1cde4552c529d3d0ull }, \
+    { 0x340b32c2, 0x38dd03f7, 0x30651b8b67df8e1aull }, \
+    { 0x2a867f0a, 0xff3307b9, 0xb762ebb808cc642eull }, \
+    { 0x91545173, 0x55934351, 0xc3b7f719c33063f0ull }, \
+    { 0x382a29cc, 0xf70808ec, 0x0ef2836528f39280ull }, \
+    { 0xe01bd5d3, 0x4a581300, 0x23b97b74412fc9baull }, \
+    { 0xfd9ca4bd, 0xa191a1ba, 0x49d1e44f5037437eull }, \
+    { 0xe258a55f, 0x2f6177d1, 0x1bb883122d2be194ull }, \
+    { 0x3d7f57ad, 0x2b83bc54, 0xa5c9b4ee81e5a8acull }, \
+    { 0xd0a2cb8e, 0xa9c93035, 0x7f7218f9d1d3f3deull }, \
+    { 0x9c339e53, 0x369d4e8b, 0xecb48d39d623bd5eull }, \
+    { 0x511eeead, 0x90ce367f, 0x9d9be1c7860737e8ull }, \
+    { 0x2ee19c52, 0x9bbf42db, 0xf72750b12fd6a54aull }, \
+    { 0x8432f9a5, 0xb9d28d6b, 0x6f8a9a087cd868a0ull }, \
+    { 0x4ccf315a, 0x245955af, 0xad1f6106ba36dd64ull }, \
+    { 0xa9adce08, 0xbbedab06, 0x41a85b2433390f0eull }, \
+    { 0x5885c66e, 0xbd621708, 0x3621e46f98d9b3eaull }, \
+    { 0xa33c4517, 0xc786f0f6, 0x15ae6dcf8190cc8cull }, \
+    { 0x18bfd5b5, 0xb4b8ed86, 0xe934e4f5d965c9f2ull }, \
+    { 0x2bfb4421, 0x860f605c, 0x2f972c54b01b3ba0ull }, \
+    { 0x3a745839, 0x66f22d74, 0xd4b1e803cbf2e64eull }, \
+    { 0x9f509909, 0xf9c9a766, 0x169bbd583ae746e0ull }, \
+    { 0xc901413a, 0xf1d3228e, 0xa82381a778d15734ull }, \
+    { 0xff18eff9, 0xdced5063, 0x78b9c08a607c42e0ull }, \
+    { 0x842d5cc8, 0x850e4f9b, 0xe2bd6b537b6ef33aull }, \
+    { 0xb19da681, 0x2dbc5113, 0x333345aceb5ef248ull }, \
+    { 0x29bdcfed, 0x41097284, 0x0435fd9f30321ed8ull }, \
+    { 0x8dc8a16c, 0x15764fdc, 0xd7b30cc71c97ae66ull }, \
+    { 0x6d433e34, 0x0465b4d1, 0x49fbc18070e863eeull }, \
+    { 0xe63f01c9, 0x0c837adf, 0xa57c5f9ec8346d8eull }, \
+    { 0xc1b011fb, 0x25510975, 0xfb86a58fc9e40184ull }, \
+    { 0xbebbd6a9, 0x9d704fce, 0x761e2e751ac20772ull }, \
+    { 0x33936201, 0x5fb6c876, 0xb0c3acdefa75c8fcull }, \
+    { 0x4ead4336, 0x3f2b2913, 0x37d870729e40d31eull }, \
+    { 0xdd000410, 0x95d23a87, 0xc4b980503e6734e6ull }, \
+    { 0xf0fa9461, 0x892b7a46, 0xcf11406a5b77faceull }, \
+    { 0x11cf987c, 0x71202042, 0x626729f1aad30b14ull }, \
+    { 0x0da5e58e, 0x77a10f80, 0x5fd2aac5811d782aull }, \
+    { 0xdefdfe6f, 0x86ba3fb4, 0x1b0dee257b411c82ull }, \
+    { 0xb97069f9, 0xb4f8ec72, 0xb7be806a3d8d3e74ull }, \
+    { 0xc38b7fd0, 0xa573efe8, 0x050b8a2f2920136aull }, \
+    { 0xfcd98d9f, 0x3639d488, 0x29fc51b39d120b9eull }, \
+    { 0x36f599b5, 0x96466bb1, 0x0ae8b043e8eb6dccull }, \
+    { 0xd91608a7, 0xba33590d, 0x909dc695d00efd2cull }, \
+    { 0x276b74d6, 0x8c289e7b, 0x19819fc0b943f50eull }, \
+    { 0xe7042884, 0x701a3fea, 0xb7be262d3c1f003cull }, \
+    { 0xfe9e0247, 0x1e1495f7, 0xda6b3b2f4d6fa760ull }, \
+    { 0x34f2b203, 0x36c81b97, 0x6f9c1a67d5c5ae44ull }, \
+    { 0xd3e5482e, 0x15ef87f3, 0x2a31c313ae14062eull }, \
+    { 0x2fb28f93, 0x9f6b0357, 0xae9afce10429946eull }, \
+    { 0x0cf57a59, 0x83a7bf13, 0x676518ec1668871aull }, \
+    { 0xab520ed7, 0x82f02d19, 0x072dd6027b99ffcaull }, \
+    { 0xb5c4877a, 0x17c584f3, 0x32d42811dab20230ull }, \
+    { 0x8c071632, 0xb094962c, 0xb0c026f688e7ae66ull }, \
+    { 0x2f991ccb, 0x84772672, 0x9a274d0eaf5510b8ull }, \
+    { 0x0a4d36bc, 0xd2962c80, 0x7f208eee57f234b0ull }, \
+    { 0x53fd7a55, 0x771236a6, 0xdf7923e378aabd58ull }, \
+    { 0xfa932ae9, 0x39e9134e, 0xea76120de4c76e48ull }, \
+    { 0x70beb921, 0x3eae67e5, 0xc54e416f17f7fe76ull }, \
+    { 0xa82fc3d0, 0x3498eaea, 0x4d2262f6467e7c1eull }, \
+    { 0x76d27d3d, 0x38098c24, 0x70daacfdd3180d78ull }, \
+    { 0xa57a9f71, 0xd36a53dc, 0x1fcf60db3437b456ull }, \
+    { 0xbabfe587, 0x67ad3f59, 0xd8e51d64925fa984ull }, \
+    { 0x08d3544d, 0x009ebff4, 0xccb6cb9ee7b4d39aull }, \
+    { 0x1cb7f7e5, 0xe5ff78b2, 0xe26a84a9b363838eull }, \
+    { 0x02c09658, 0xab2e5a3a, 0x1d770ecef840cc96ull }, \
+    { 0x6df85ce1, 0xffd47ea3, 0x1ed8fa8bb4171cb8ull }, \
+    { 0x7e21e960, 0xe4b2952c, 0xaba8ff4dbf5798daull }, \
+    { 0xc7677948, 0xd1664229, 0x84beac74a0ec2f4cull }, \
+    { 0xc2153af3, 0xafbee741, 0xa9ae96716d88fc88ull }, \
+    { 0x4c58adad, 0x982bf048, 0xf1af3338737e1502ull }, \
+    { 0x1f1ad27f, 0x624a553d, 0x602e996b3b74c8aaull }, \
+    { 0x4d380fc1, 0x23fe35fb, 0xa96173c9d13c1822ull }, \
+    { 0x722e858c, 0xc27e123d, 0x206bc3a57bd538c8ull }, \
+    { 0x099b8bf5, 0xf8e7c5d8, 0x55917053bd8a95eaull }, \
+    { 0xde8c8890, 0x06bc3baa, 0x055cda4a50560fbcull }, \
+    { 0x86a62576, 0xca8a0cd7, 0x3ccf6ef2b60408ecull }, \
+    { 0xe9a0976c, 0xd2c100a2, 0xfa667747fd2fa65cull }, \
+    { 0x96431de8, 0x4bbc7688, 0xc7682337281c9164ull }, \
+    { 0x44ee4d3e, 0xe7ea8533, 0x8ae47b4cbd72125aull }, \
+    { 0x43321e91, 0x7f16c16c, 0xa4efa2bdab1adfaeull }, \
+    { 0x4e4b9548, 0x571b6caa, 0xfa510ddeda287e6aull }, \
+    { 0x281396fb, 0xaa96bbde, 0x122032162b64cddeull }, \
+    { 0x0dea1d36, 0x95679d7f, 0xff2e2193f07e7712ull }, \
+    { 0x7059ba37, 0xaef8b2c9, 0xff8626f32d15b030ull }, \
+    { 0xd6d3b01b, 0xd59b9207, 0xceb868dd0ac47f6eull }, \
+    { 0x353fdca9, 0x1ea5b0a8, 0xbfc56690ed5f7f02ull }, \
+    { 0xc03b3099, 0xb77aa9dd, 0x31e768d80e00e604ull }, \
+    { 0x6eb80597, 0x0b6e65af, 0x44b1562ff2f63e72ull }, \
+    { 0x6dbf6e69, 0x1bde5790, 0xe64fd2d0e96d95ecull }, \
+    { 0x36c1e29e, 0x78965755, 0xd43a2e2707bb96b8ull }, \
+    { 0x4fed5180, 0x5efde2cf, 0x973efda90ec64a78ull }, \
+    { 0xdec7f16c, 0xabe28f55, 0xdca463b98262533cull }, \
+    { 0x2e7efdd7, 0x3e26ecaa, 0xe3416eecfee9f0a4ull }, \
+    { 0x218cee32, 0x6506c985, 0x337f151fbdd99bf4ull }, \
+    { 0xdaebe7cc, 0x0766e0f4, 0xc780d62586f31abcull }, \
+    { 0xf0688eac, 0x4d3371da, 0xbddecde125e796f0ull }, \
+    { 0x11a6a38a, 0x45a9c216, 0x106701f3bc1f3742ull }, \
+    { 0x69c9e384, 0xb2fe0bae, 0xbe3d34d9fcf10732ull }, \
+    { 0x5f09a592, 0xf03acb91, 0xd9678ff4410e0b30ull }, \
+    { 0x52b7b485, 0x0f9b1731, 0x7db3e5b75e20514aull }, \
+    { 0xb9ea0dfc, 0xf46b36fe, 0x9ac23c630d5fe170ull }, \
+    { 0x58e8ce58, 0xb641bcac, 0xa70cd5bdb3abb53eull }, \
+    { 0x5e78d40f, 0x99ad00b3, 0xd48006eb79635edcull }, \
+    { 0xbfc63d30, 0x82b93d6c, 0xf0e42212c1b39a82ull }, \
+    { 0x69033f42, 0x6c5e30b2, 0x3718e5180d6d4530ull }, \
+    { 0xe9389219, 0x2de52f78, 0x52df746a9828e886ull }, \
+    { 0x6911619b, 0x7de16f8a, 0x40082529f9c05eb6ull }, \
+    { 0xb4e89e9a, 0xc0fd55b9, 0x49d4f7c42b0bc996ull }, \
+    { 0x84cc434e, 0xff4b8afd, 0x966d477fa3431fecull }, \
+    { 0xab2c66fa, 0xa1897d5c, 0xaba2212bf115dc34ull }, \
+    { 0xeb8411bc, 0x1ffabe7b, 0xef4ad0bb7a621d08ull }, \
+    { 0xfc8f9b4a, 0x28ca70f7, 0x3c626f6a247d318aull }, \
+    { 0x4f0073b2, 0x379de608, 0x034d033a306dc990ull }, \
+    { 0x665b6bd9, 0x219a28b4, 0xb54767e0ad44fdb2ull }, \
+    { 0x19c851ba, 0xef12c37a, 0xaa461cb95ed8ecacull }, \
+    { 0xa65296e1, 0x2efb3654, 0xfe3d127df878b1e0ull }, \
+    { 0x958f0792, 0x3096457f, 0x08f31673b92a8a9aull }, \
+    { 0x41df56a9, 0x841f96e9, 0xe3ffdcb54cad4790ull }, \
+    { 0x2ffd9273, 0x21c91bc5, 0x911b31bab57f79ceull }, \
+    { 0xd296c821, 0x4902f274, 0x5509492701f0e8f4ull }, \
+    { 0xd68edf46, 0x0d032ee4, 0xde02878c5d1f1890ull }, \
+    { 0x73f5a8e5, 0xfe9bbd8a, 0x9138f5179443409cull }, \
+    { 0xfdadcce0, 0x46279268, 0x8bcedbd4c4ba429eull }, \
+    { 0x6a260762, 0x1ef5c336, 0x2b9026f6023d1fc0ull }, \
+    { 0x5011e4af, 0x6ca3ab0d, 0x973b585d53abd17aull }, \
+    { 0x949f6ea1, 0xd63c888b, 0x6aea77f765b327a6ull }, \
+    { 0x6d5958b1, 0xbea48776, 0xec32ea1d24abfffcull }, \
+    { 0x266fea98, 0x86778e84, 0x2fd9ff444cf8a45cull }, \
+    { 0x9fe18782, 0x14bb6356, 0x1b2ceef03820c1d8ull }, \
+    { 0x1611a7a1, 0x28d26bba, 0xe8a06c0822e2aa22ull }, \
+    { 0x915c3e69, 0x89dd4e15, 0x5c44c0738e17d662ull }, \
+    { 0xf7ab83ca, 0x7a3aad9b, 0x0b04be1c1d1bf53cull }, \
+    { 0x400594f4, 0xe0c7d9a1, 0xd688eea35de8340aull }, \
+    { 0x2ce845c0, 0x17497c10, 0x4e49420ae5a9ce88ull }, \
+    { 0x82aa5b08, 0x81c52760, 0xc2a01695d918712cull }, \
+    { 0xe48f126e, 0xe96b3c14, 0x0acbe8e08c9c9730ull }, \
+    { 0x94e7f9e8, 0xea598bb1, 0x1a6f1512c34c7f88ull }, \
+    { 0x7b49a4c4, 0x9d0d548f, 0x703bdf156841a820ull }, \
+    { 0x4c01c030, 0xf07a879f, 0x050e35743135d512ull }, \
+    { 0xfcf2a43b, 0x86b6252d, 0xf68eb4e6505598beull }, \
+    { 0x4aee6e82, 0x6466f715, 0x9fb7ab69d96987a4ull }, \
+    { 0x75aada66, 0x58eeeee8, 0xd109899a3cc86412ull }, \
+    { 0xe1fef475, 0x53e62525, 0x85e8b6ae591307e4ull }, \
+    { 0xd591208b, 0xc7f4e0ca, 0x5851a50e0a079de0ull }, \
+    { 0x74008cc0, 0xa7f15a5d, 0x6e4799363433a2c0ull }, \
+    { 0x9bc0f448, 0x268a5313, 0x5ec5fb0d13cfde62ull }, \
+    { 0x009881d3, 0xc3534c14, 0x97a48520e71f491cull }, \
+    { 0x301d1f15, 0x49530813, 0x452832ddf072cf2eull }, \
+    { 0x41ff23af, 0x023d0390, 0x3686b07dfb3ba592ull }, \
+    { 0x9e326c75, 0xc2a37693, 0x9b0d4d09a4de98deull }, \
+    { 0x97bcb883, 0xd5a7535f, 0xdb8901b3577d7c78ull }, \
+    { 0x0093da77, 0xe0431a2e, 0xd911522ae350853aull }, \
+    { 0xb0c0adaa, 0x2215f540, 0xad08cb669f1c9d4aull }, \
+    { 0x2e6ff04c, 0x1ba19609, 0xcf882b625b4e24f6ull }, \
+    { 0x0e852866, 0xa28d8a23, 0xf863c534de5cf496ull }, \
+    { 0x7f901a3d, 0xe50a4452, 0xd20b52e67880507cull }, \
+    { 0x0f905f79, 0x9e8cf185, 0xbd524f3920470a8cull }, \
+    { 0x390310ee, 0xffb93a9b, 0xf36bb39fd733718eull }, \
+    { 0xf860bbd4, 0x6ead541c, 0x0ae08dd26e88ca2eull }, \
+    { 0x3606f8ec, 0x68d6f8b3, 0xfef43a9ef8e46634ull }, \
+    { 0xdea6e74a, 0xee23f9e7, 0xc02c4beb1e46ad6aull }, \
+    { 0xf135901d, 0xe291a0bc, 0x46011fcb3a3cd986ull }, \
+    { 0x0b16c8a5, 0xf3501aeb, 0xea04f953800cde96ull }, \
+    { 0xc66f4aaa, 0xe47b902d, 0x951d2d5e4522deeaull }, \
+    { 0x95869420, 0xe3233cfb, 0x6eeb963c383bb492ull }, \
+    { 0x9ee7ee38, 0x8640e0cd, 0x6c80ba8f3b69972cull }, \
+    { 0xf90c4436, 0xba360992, 0x36dbba5b690afcd0ull }, \
+    { 0x75047e36, 0x18d78de6, 0x6ffe8df4a50946f8ull }, \
+    { 0x80e68462, 0xe787bb02, 0xe0b6eeffcaf9c886ull }, \
+    { 0x32d5f75f, 0x196e301c, 0xc21d7048cb886c84ull }, \
+    { 0x650e1e2e, 0x8ce00b92, 0x1d8e2c4d42ef66f4ull }, \
+    { 0x7b142d2d, 0xb504e143, 0xeddeee958850bde2ull }, \
+    { 0x3d4929c0, 0x66e99e47, 0x2198833f0ce1f568ull }, \
+    { 0x403177cf, 0xff782b92, 0x0ee56e49f228e936ull }, \
+    { 0xf9a74024, 0xd56ee452, 0x5aab6bff67b2fd62ull }, \
+    { 0xc02c104c, 0x53a6e93a, 0xdda24cd4f819a6dcull }, \
+    { 0x553eef83, 0x5bf9675c, 0xde0e6cad2956ddd8ull }, \
+    { 0x04d5e715, 0x66d43a30, 0x6b641f88305b6400ull }, \
+    { 0xbb016412, 0x079fa56f, 0x041815732f432b82ull }, \
+    { 0xbabe459f, 0x037f6347, 0xf87aa1ed0e683baeull }, \
+    { 0x7a98888b, 0xd981458a, 0x1c6e14b4cc5fa802ull }, \
+    { 0xbb388a2d, 0x6b667e0c, 0x0df644c051904f66ull }, \
+    { 0x5ed3605b, 0x5e9e3ea9, 0x536c049178ff1ffcull }, \
+    { 0xb6ee1b86, 0x36d81272, 0x4b711d7944ce52c6ull }, \
+    { 0x64676580, 0xed11c2aa, 0x6986d1c21149f0d0ull }, \
+    { 0x210fbfbc, 0xf3847ebe, 0x5013a9190cf34ee0ull }, \
+    { 0xdd0b9b58, 0x2250918f, 0x3e5e2932a48e68ceull }, \
+    { 0x768fcc0e, 0xe92735cc, 0x4b11116f36cc3d44ull }, \
+    { 0x705a7805, 0xeb141a5a, 0xccb4e322a24a1a46ull }, \
+    { 0x72d773eb, 0x087ba41a, 0x294533e3e364998cull }, \
+    { 0xc8bb33d3, 0xd98cc062, 0x86a242170cacd99cull }, \
+    { 0x03ed5a00, 0x3a39434f, 0x697439c680bb6910ull }, \
+    { 0xfc217e42, 0x4d4276b5, 0xc2f927e9f88cf4a8ull }, \
+    { 0x71dedbeb, 0x6d10d175, 0x4cfc32a256869a64ull }, \
+    { 0x62cf9fbc, 0x3afd825b, 0x77e61b7648b0bd9eull }, \
+    { 0xa3ac4fb6, 0xe0b1b5cd, 0xfe931fcb009b425eull }, \
+    { 0x3317598f, 0x130e09bb, 0xa26b19a68d4a3184ull }, \
+    { 0x80738b0b, 0x50f4cec9, 0xd5f275b5871247fcull }, \
+    { 0xcfba3997, 0x74d91e75, 0xa72f3f257d538a82ull }, \
+    { 0x9e15acc1, 0x5bc9a08f, 0x33a2b33a3dcf1ab4ull }, \
+    { 0xce1da861, 0x85fa6438, 0xfd2c03253c649240ull }, \
+    { 0xadd5a679, 0x86a1e348, 0x1378a3024fc2e5ecull }, \
+    { 0x97d3336b, 0x5111f790, 0xc0414f37f32c63f0ull }, \
+    { 0xe47370cb, 0x5eca2cc3, 0x87cb4d08d8ab253eull }, \
+    { 0x7e60e760, 0xad7a61a7, 0x3d0c840f24eacb60ull }, \
+    { 0xeaa622fe, 0x7b364de1, 0x5d189aeb1808583aull }, \
+    { 0xe3a2e888, 0x6a9d42ff, 0x8a4be64d25a52a18ull }, \
+    { 0x92d16ffd, 0x1ab953c8, 0x66a10b614c3bbd1aull }, \
+    { 0xf37dfc9f, 0x608d2bb3, 0x44c40180b3a3faf4ull }, \
+    { 0x853d19e3, 0xaf555f37, 0x9442ab911fea7284ull }, \
+    { 0x14ac4816, 0x9986d26d, 0xa95ee8a9cf36c726ull }, \
+    { 0xc471bbb3, 0xf905583e, 0x0d778fbf3d7b73ceull }, \
+    { 0x9609c9dc, 0x2464e22d, 0xc48ab159e07d8288ull }, \
+    { 0xac07ac26, 0x3a413c62, 0x854d93a9e4ad388eull }, \
+    { 0xc565878a, 0x1fe1cfc3, 0x1fff1a725dfd7e7cull }, \
+    { 0x51ef36ca, 0xb62b15ff, 0x198a015fbfd8f95eull }, \
+    { 0x9d2fa49e, 0xca302693, 0x60268035e9280896ull }, \
+    { 0x24786a5b, 0xfeecd661, 0x31082ed62f7732fcull }, \
+    { 0x3b4c67fc, 0x941e5293, 0xf302aaf86b753d10ull }, \
+    { 0x1f05b86e, 0x81ddf78e, 0xe8cdc3f4e1488968ull }, \
+    { 0x310d77ae, 0x8d8b9be7, 0x15ceee294027b9eeull }, \
+    { 0x77a0919a, 0xf17b0d64, 0xd419f15d9c67ef34ull }, \
+    { 0x7494ec93, 0x12642bd0, 0x560dd46077dedc3cull }, \
+    { 0x8ed45517, 0xa65a52cc, 0x8a1d34dc0ddbd070ull }, \
+    { 0x472fd9f6, 0x53318c7d, 0xa09d294c04594004ull }, \
+    { 0x72a14b2e, 0x47e2f755, 0x99bda810ecceb566ull }, \
+    { 0x4e94607b, 0xfdb2878c, 0x05109e873806929cull }, \
+    { 0xa0bb2991, 0x6fbde09e, 0x957a781ae3ce9546ull }, \
+    { 0xef71b817, 0x93b1ce2b, 0xaff7d94aafc74d7aull }, \
+    { 0xab007202, 0x311bb7c3, 0x76526874cad7b518ull }, \
+    { 0x86529ae7, 0x3d15bacc, 0x916c2c04ec2c25aaull }, \
+    { 0x24663410, 0x3001242e, 0xa20413707588a1bcull }, \
+    { 0x9979a575, 0xf8f43b77, 0x4002c2d3ad50f7ceull }, \
+    { 0x8f2b20c8, 0x479cad23, 0xf96af31fa479684cull }, \
+    { 0xa6d6dfff, 0x4cf0f3eb, 0xa579a871612065aeull }, \
+    { 0xc0a814c8, 0xa389f375, 0xa5b3c30faa064164ull }, \
+    { 0x9f581c55, 0xec1f2c16, 0xe8ac2b91b16fc0deull }, \
+    { 0x8d7ab569, 0x4fb23de8, 0xb7d8d7a65d58ddb4ull }, \
+    { 0xc36c37d2, 0x19f81218, 0x96d35c92b865ea86ull }, \
+    { 0xd291cb81, 0x4218514d, 0x2a5701d10e89284aull }, \
+    { 0x8196eb47, 0x21cf4a6b, 0xaccbbd72ed46c4aaull }, \
+    { 0x03d9e6b9, 0xe5f04064, 0xb15fc6f096696dc8ull }, \
+    { 0xd278cf55, 0x1db78ce0, 0x9010fd1ae4a893a2ull }, \
+    { 0xf09778f1, 0x1675b34f, 0x54beba032c00e410ull }, \
+    { 0xaea5befa, 0xf841c294, 0x4c8d4cc1c0afc0b6ull }, \
+    { 0x60fe89a1, 0x878f6e73, 0x06c684e192946764ull }, \
+    { 0x4765d12e, 0x1ab493b3, 0x2d51acc7273df570ull }, \
+    { 0xaf0db592, 0x26df2188, 0x3ba9c17a6553ec8cull }, \
+    { 0xb5556fe1, 0x41a55fda, 0x0a58110861e56e86ull }, \
+    { 0x1ae3e8ba, 0x9f2d7697, 0x3b6f644a748ef95aull }, \
+    { 0x4f5518bb, 0x4e987fda, 0x88df2d5ad0859f66ull }, \
+    { 0x3d7b8f9f, 0x31cce5ad, 0x365f4cd568ffb694ull }, \
+    { 0xa98923de, 0x27d6b132, 0x74ad97ac3fce2108ull }, \
+    { 0x35236c14, 0x2dc31d2a, 0xe22bd1a45b8d31a0ull }, \
+    { 0x5cd6a2d5, 0x69a2c47f, 0xba2a28bf5afc8ac2ull }, \
+    { 0xcf320e71, 0x444bb3c7, 0x8ab7c6285b950a16ull }, \
+    { 0xc9166179, 0x415fa6ae, 0xbb4a6606b8914e98ull }, \
+    { 0x1e24e9ae, 0xbf4de33f, 0xaf9c948ecbbeb5d4ull }, \
+    { 0x18cbe3a6, 0x78a6d460, 0x1ff2a824428fb12cull }, \
+    { 0x32ac5f7c, 0xcd8157a7, 0xd3dd17ef67f34df8ull }, \
+    { 0xbbe21bc8, 0x707e6322, 0xe02ce85fb9e3e438ull }, \
+    { 0x5467bdc2, 0x4fbd1250, 0x36ccf84186edb052ull }, \
+    { 0xef18f70b, 0xc3b4b273, 0x431a608ad61dca96ull }, \
+    { 0xe977b993, 0xf223884a, 0xd3244f8729a5766eull }, \
+    { 0xda892a34, 0x49a67bf4, 0x747200a5d6e44d7cull }, \
+    { 0x6cf9f6e7, 0xe01342e6, 0xd6af8cb1fec1cd76ull }, \
+    { 0x37b91295, 0x36b809cd, 0xf01f3c55ff4c9d1aull }, \
+    { 0xc07e552b, 0x21365234, 0xbfd0023d37080f42ull }, \
+    { 0x657d2f41, 0x99593234, 0x76bfc452a11de390ull }, \
+    { 0xb7766285, 0xc19a36bf, 0x278b1ad42e6b6750ull }, \
+    { 0xebf329ab, 0x00da8c0e, 0x34a069bcf0b38a80ull }, \
+    { 0x10e75342, 0x88794071, 0x67fecdb460ff580cull }, \
+    { 0xc44ac9ce, 0x45cbaff0, 0x3f247efcece5fbdaull }, \
+    { 0x3a5f60e3, 0x55ea1f9e, 0xa94bb9b3501e1d34ull }, \
+    { 0x5ad7d401, 0x3d86dbc3, 0x94b92a572c88f34aull }, \
+    { 0xfbf9f6af, 0x8690869c, 0x921fdbca7e6f2faeull }, \
+    { 0x3867de22, 0xd5ad2f91, 0x6ba4d83ab922124cull }, \
+    { 0x2e730609, 0x16f8e4f3, 0x3104d989531be8c2ull }, \
+    { 0x29cdb61e, 0xbdf7202e, 0x2ecf65d8bff009aaull }, \
+    { 0xbe168c71, 0xeb3eab4a, 0xce5015ec99bd8d54ull }, \
+    { 0x04de435f, 0xd1ccc89c, 0x9e9785ccdbca4f44ull }, \
+    { 0xaaf70781, 0xe443c6ce, 0xfdb1cf40b9df1bd4ull }, \
+    { 0x5726b99c, 0x60e4d712, 0x40b8c56da665a9c2ull }, \
+    { 0xa52d0e92, 0xb910ca51, 0xfb82ac21064338beull }, \
+    { 0x697da9a5, 0x11d329aa, 0xd611439abca49af6ull }, \
+    { 0xa2667c8a, 0x76c4a913, 0x38f93291215ed55cull }, \
+    { 0xc1735d2d, 0xcf502c59, 0x7dbea725c9ccfd1cull }, \
+    { 0x6bcad308, 0x4fb8a2a1, 0x1e4a2ddcd9c26fbaull }, \
+    { 0xf96b95d6, 0x5a6f7412, 0x499167c76a2b4834ull }, \
+    { 0xc4d39827, 0x48f75882, 0x6e4820861b1c0eceull }, \
+    { 0x3c8b7a96, 0x3f9ea766, 0x63ffa744182195d6ull }, \
+    { 0x26f0bd39, 0x0f2b14e4, 0xb2144e419b0df1b8ull }, \
+    { 0x96c6ee7e, 0xa48e7261, 0xbc49eacbe1439620ull }, \
+    { 0x6a1cded1, 0x0ad45272, 0xf2a8544058ae1ac4ull }, \
+    { 0x28e8b782, 0x90e37f2e, 0x405e8971b8b61ec8ull }, \
+    { 0xaabfddb7, 0x42139612, 0xa9c058792709f2dcull }, \
+    { 0x970f74c0, 0xcaed91bf, 0x864b5500bd82b324ull }, \
+    { 0x3b5500cf, 0xd67c3623, 0xa2b175172e8e9594ull }, \
+    { 0x8607da06, 0xb7cec9fd, 0xebdf44f391e907b2ull }, \
+    { 0x5d481026, 0xb78a5aa3, 0x0515838c42f34a5cull }, \
+    { 0x768f59be, 0xe3d3c1ce, 0x1f1d60ce336af00eull }, \
+    { 0xdac591bc, 0x80cb9ce8, 0x4df642fd0c192e2eull }, \
+    { 0xd4a4b24e, 0xac667d0b, 0x97da980783343f30ull }, \
+    { 0xa62bc1f4, 0x5dc5ef2a, 0xecce7953422afa3aull }, \
+    { 0xd64e75be, 0x3bb51345, 0x70c0dccd0630190aull }, \
+    { 0xd054a423, 0xab4313a4, 0x3edd356f17ec5a8aull }, \
+    { 0xa92f9c1c, 0x6ff85132, 0x78521e4b3baa73ceull }, \
+    { 0x7f50de6d, 0x0398f210, 0xe15e440d0a35c0feull }, \
+    { 0x9de32b54, 0x9697ae99, 0x6ea2a556f75f5018ull }, \
+    { 0x211aae0f, 0xf66efb5c, 0x4f34ee711b146f1aull }, \
+    { 0x7ec97140, 0x2d39fc85, 0x18a6ab4833552ae6ull }, \
+    { 0xcfacd3aa, 0x5a015030, 0x3fe5048f314c1eb2ull }, \
+    { 0xab1c4561, 0xc342444c, 0x77da04d83c9b69c8ull }, \
+    { 0x55bbad05, 0x693be960, 0xb136e1e28f2ae2f0ull }, \
+    { 0x1b7b9541, 0x3dde52e5, 0xe7a4c92acf3c0ae2ull }, \
+    { 0x8d7bf27d, 0x08d4f5e6, 0xc95eb76f2ca1bcc0ull }, \
+    { 0x589144b7, 0x20f2ad86, 0x224af5545101625aull }, \
+    { 0xde21615e, 0x35e29eed, 0xea45dc2b57559a12ull }, \
+    { 0x5ab6f811, 0x524b49ef, 0xe8d07e1c52ced6ecull }, \
+    { 0xbf2d984a, 0xacebecf2, 0x360edc54ed6189e6ull }, \
+    { 0x93cd4f66, 0x521c2c66, 0x14c8904f1108a23eull }, \
+    { 0x53f9021d, 0x245600dd, 0xaab9a178a7ecf0e2ull }, \
+    { 0xd66ba89c, 0x8fb40e7b, 0x6eb9db8652a800b2ull }, \
+    { 0x696dffa0, 0xdf044437, 0x19524d22e0d4f212ull }, \
+    { 0x48d18c33, 0x8cebcda1, 0x81b2c9888fd005f6ull }, \
+    { 0xbf9bdd87, 0x03112ad7, 0x7c08049e6a21c324ull }, \
+    { 0xd7f6710d, 0xe7a39432, 0xd9b445137f718938ull }, \
+    { 0xb342ce1c, 0x57d19e5f, 0x15e24a7d54956a18ull }, \
+    { 0x8106a19c, 0x86acea40, 0xe882d2863ef957c8ull }, \
+    { 0x410d96b8, 0xc63093e3, 0x4b70385083bbda8aull }, \
+    { 0x5f417ea2, 0x9cd97a29, 0xaec56e1c20cfdfeeull }, \
+    { 0x58683096, 0x44af5d38, 0x0b8bad542f776d26ull }, \
+    { 0x95be41b5, 0x4c30a688, 0x84b85d00be6707f4ull }, \
+    { 0x06369fff, 0x308b41b5, 0xc2a945a26bb14464ull }, \
+    { 0x903ec1f1, 0xf89d13bd, 0xfe96a5d21ca4f728ull }, \
+    { 0xc1706eff, 0x9a5af796, 0x5a76f22684b16e2aull }, \
+    { 0xe83a8a61, 0x235d0c4a, 0xb8c6dd40f576ba80ull }, \
+    { 0x2464af70, 0x7c9eed1c, 0x22ae9fdb81d680bcull }, \
+    { 0xf71e82af, 0x8d589059, 0xe1d5f2dc170869b6ull }, \
+    { 0xf2c2ab50, 0x41a3b072, 0xd354962e016def22ull }, \
+    { 0xb6b6fa0f, 0xb120e0fe, 0xb92888fc0c048032ull }, \
+    { 0xe6a4b794, 0xaa21b747, 0x298a6ba3c6197d62ull }, \
+    { 0x4494aec3, 0x7bba8eab, 0x3a321c474f410864ull }, \
+    { 0x05acd752, 0x1b22a7c8, 0x1053a1fd26b2e19cull }, \
+    { 0xcb12758f, 0xf4ee9d5d, 0xd5a5db6f14fdd646ull }, \
+    { 0x2c5eb727, 0x6609285b, 0x4519d121f3b9ed08ull }, \
+    { 0x651dfa91, 0x05ea3ec9, 0x677ea8c8fe87f59cull }, \
+    { 0x438587da, 0x68aab479, 0xb0823d9632e3eeb0ull }, \
+    { 0x301c5c27, 0x28451255, 0x6a7ef8bba05484f6ull }, \
+    { 0xb660667a, 0x7f840c4d, 0xb69f857de93c4972ull }, \
+    { 0x6111b679, 0x3f2b7fc5, 0xf05b3ad373c97ae2ull }, \
+    { 0xa0679e56, 0x5e32eeba, 0x76429d357f50f0a8ull }, \
+    { 0x7783b7b0, 0x8dc25787, 0x7d875f480b819ad2ull }, \
+    { 0x8a487bee, 0xbc054ce9, 0x6c27c15c299c089aull }, \
+    { 0x397e14bd, 0xc35b6eb9, 0x4e5affae8c1ea380ull }, \
+    { 0xd50bc29a, 0xb016ee62, 0xff7cfd982e23754eull }, \
+    { 0x9d1127fb, 0xf3dc27b2, 0xcf0c10ba024fbe82ull }, \
+    { 0xc44e6d84, 0xee7da801, 0x111d243700af6c2eull }, \
+    { 0xf1f37d23, 0x5ca30092, 0xe50bbc6d37625c10ull }, \
+    { 0x6dbd9641, 0xce0958b1, 0x9fc0f61e709ebfe8ull }, \
+    { 0x442bf33e, 0xd28abb19, 0xe035842d61c25094ull }, \
+    { 0xce6e67d8, 0xdc04d982, 0xaa623b65996732b6ull }, \
+    { 0xb8af77d6, 0xfcce39ce, 0x5e5eef9689efa7a0ull }, \
+    { 0xa9de5b87, 0x114428bf, 0xf031243dc95bad32ull }, \
+    { 0x42b14885, 0x35c08845, 0x81aee8f7c762a754ull }, \
+    { 0x5cfac28d, 0xd150daea, 0xd4cf8114c82a8174ull }, \
+    { 0xa4c9ad74, 0x93509418, 0x1967111a8386e348ull }, \
+    { 0x8ef1933f, 0x5d438d80, 0x437fec80126d833eull }, \
+    { 0x4fc34454, 0x3c8af2ed, 0xf6bea18b5a72a888ull }, \
+    { 0xc26219fc, 0xcdec961b, 0x0fd81fa79a12728eull }, \
+    { 0x0f717d21, 0xa8fc95b9, 0xb1ca8f34a439a4d6ull }, \
+    { 0x898aca46, 0xc5271ab6, 0xa54f74b1248be762ull }, \
+    { 0x5e51d8f1, 0x02d10628, 0x25223f7a169b5fa6ull }, \
+    { 0xdd194141, 0x2bccbd95, 0xb3783fd3e156b69aull }, \
+    { 0x5f55de95, 0x1d6c80dd, 0xf7ab6ba07d30153aull }, \
+    { 0xb9543ef7, 0xecd58d03, 0xc2688e3f39416e02ull }, \
+    { 0xb7854142, 0x1178856c, 0x78cd8ff159bb5022ull }, \
+    { 0x3b968e89, 0xbf748fa5, 0x066d566ce93305daull }, \
+    { 0x8cdafa0b, 0x874b949f, 0x66948828c5c33c9aull }, \
+    { 0x584389dc, 0x2d3238f9, 0x7884c603597c7bcaull }, \
+    { 0x7f660f4a, 0xa88bf7d8, 0x9b1dcdd6ab84664eull }, \
+    { 0x2fb85ef5, 0xc5e784a0, 0xf953acb8c8d97f60ull }, \
+    { 0x90aae20c, 0xcfff6b13, 0x0e38d69ac354a0a8ull }, \
+    { 0xbbad6074, 0x2d2d6348, 0x7f0ba4ade042f9e0ull }, \
+    { 0x8f313e41, 0xab0cec09, 0xe2a2a0fd44d6de00ull }, \
+    { 0x26552d23, 0x937f0c04, 0x3932cfcbaba86eaaull }, \
+    { 0xe7f955c7, 0xe55d84e3, 0x123a485cfbf549dcull }, \
+    { 0x120d67fe, 0xe062e1e1, 0x75e08134af0eb3f0ull }, \
+    { 0xf0e1da0e, 0xe7546038, 0x9be4937959e17bd0ull }, \
+    { 0x8054ca7d, 0x107d099d, 0x5f63c2f87e9c4b00ull }, \
+    { 0x393318f3, 0x2b63021d, 0x117df9a75da55f9aull }, \
+    { 0xcb1be499, 0x1cef2e03, 0x11d008b76610bdfeull }, \
+    { 0x49ca1720, 0x91b3c764, 0x414810431f327076ull }, \
+    { 0xacd040b1, 0xbba12483, 0xe34fb74a04550836ull }, \
+    { 0x07dfae85, 0x79d17d9b, 0xc5a11fca83e47b58ull }, \
+    { 0x1cd6c66f, 0x249f125f, 0x52d86e130cc2a938ull }, \
+    { 0xb55f69a5, 0x1a62f405, 0xc56579e4d778b72cull }, \
+    { 0xbd22b410, 0x6729fd19, 0xdcc714e18e70d18eull }, \
+    { 0xff322c23, 0x83ae99a4, 0xa705edfc1a49e394ull }, \
+    { 0x38017cda, 0x74f0973c, 0xbf6adab4e54a2b46ull }, \
+    { 0x34f51e85, 0xd8b981ac, 0xb51607d21570c8d2ull }, \
+    { 0x810c43ce, 0x9a9f216e, 0x10e32535cfbaa7dcull }, \
+    { 0x8e806ea2, 0xea7d4bae, 0x541548d5116326deull }, \
+    { 0xb0fb64a5, 0x48328b4e, 0x3ce3725293bf9144ull }, \
+    { 0xd78eb72e, 0x88e6c594, 0xaebd37f60236aa1eull }, \
+    { 0xd9664138, 0x3a3a697a, 0x30913036f50a239aull }, \
+    { 0x79684494, 0xac019c88, 0x23efd67280fbb528ull }, \
+    { 0x839af01d, 0xee42f9ad, 0x9947d70b0482d8e6ull }, \
+    { 0x9ca8ae50, 0x538d43b7, 0x1754a1ab86fd7a1cull }, \
+    { 0xd4d9fb25, 0xc190c040, 0xadc85dd916bf63faull }, \
+    { 0x4b76d675, 0x31f7b175, 0xf5f4aa1255e9f270ull }, \
+    { 0x7da6195e, 0x825b0973, 0x0793f7f7b1765748ull }, \
+    { 0x6eea61ce, 0x83f217aa, 0x6c696f8a5e004d38ull }, \
+    { 0xdc8d46e8, 0xd1db4f1e, 0x2921a1ddad29ee8eull }, \
+    { 0x5aee006c, 0xccb9b2d9, 0x441324567d209686ull }, \
+    { 0x1f66d3ba, 0x37bb11c6, 0x55e30acd23c868baull }, \
+    { 0x5d3fb43b, 0xbba5d92c, 0x20b814175d1f21ccull }, \
+    { 0x7963e506, 0x71e464da, 0x95f242f41efad8feull }, \
+    { 0x29d3c3e3, 0x336f60f7, 0x4473b829616ba07cull }, \
+    { 0xd16c7466, 0x4aa2d028, 0x77dfdf2c6dfff4baull }, \
+    { 0xd4e52518, 0xb0d00419, 0xeb522cf03f19fb1eull }, \
+    { 0x5591e33d, 0x39c6c933, 0x442d4703df10449eull }, \
+    { 0x70fbdd3f, 0xebe44a03, 0x8ad444436d48b680ull }, \
+    { 0x7abcc929, 0x624685b4, 0x83794c09243ce1d8ull }, \
+    { 0x48f13b43, 0x9bf1b2ed, 0xc29c58c77c06130aull }, \
+    { 0x958a6d9a, 0xf717ed3c, 0x3d732cff91a1742eull }, \
+    { 0x5afb4abb, 0xfa9b4b3a, 0x5fe7c0a4f2ec5108ull }, \
+    { 0xc75e2f27, 0x2e9329a9, 0x6072c627b1696810ull }, \
+    { 0x255d32ef, 0xa1e77d35, 0xacedbc2130d1b116ull }, \
+    { 0xa226a0f4, 0x88e96d3a, 0x4e64686654b5bc94ull }, \
+    { 0x96602808, 0xfc5d50be, 0x454c321429cd8296ull }, \
+    { 0x9054fcc9, 0xbaec3740, 0x848b227f55aa9d00ull }, \
+    { 0xfa1454f3, 0x28a36ad5, 0x12af38cf2b8e5842ull }, \
+    { 0x2db8e307, 0x67dca49e, 0xef059dd23ac77dd4ull }, \
+    { 0x04ff2b11, 0xa5ad3810, 0x7812b605e119fa7cull }, \
+    { 0xceae44ce, 0x37ea379d, 0xb74b0ad005cb0734ull }, \
+    { 0xa8719391, 0x5b9dac2d, 0x2a129c242f9e5426ull }, \
+    { 0xb74a2f34, 0x6e12d6c2, 0xb384b20c5f558d18ull }, \
+    { 0xfb603b30, 0x23f21c3b, 0x2ae6555e326aa52aull }, \
+    { 0x9c98679d, 0x2a9c3807, 0x357706f1fb779ba4ull }, \
+    { 0x9354ddb3, 0x12679e00, 0xe9d025adb1cb596aull }, \
+    { 0xb147d678, 0xda89d41e, 0x6159af18bd6ee77cull }, \
+    { 0x66c97a70, 0x67058367, 0x47be38d9c8fac774ull }, \
+    { 0xdb6c3de6, 0x2fe1b2ca, 0x09bc796fb2536364ull }, \
+    { 0x530313cc, 0x72cb5302, 0xc6bebc268df6bca0ull }, \
+    { 0xa6892fe8, 0x1a9d1cce, 0x951555d875664e88ull }, \
+    { 0xc5cb2554, 0xa15fbda7, 0x87bcadd13dfae922ull }, \
+    { 0x921c32d5, 0x5a81e1cc, 0x91119c6bbefbcbc6ull }, \
+    { 0xd570504b, 0x6dc4b479, 0xc779809968f15f3eull }, \
+    { 0x965ab0dd, 0x54d9b7ec, 0xfb007bb1af7e9c5aull }, \
+    { 0xde16a781, 0x7d979508, 0x265f0efed1a4bdfeull }, \
+    { 0xc13187c1, 0x256924ff, 0x5baee76a353778c8ull }, \
+    { 0x78f0d16d, 0x88be54b0, 0x644b5d664207e11aull }, \
+    { 0x09161111, 0xb08e89d4, 0xddf47158a9b48962ull }, \
+    { 0x40d8106b, 0x29581756, 0xecfd61f59ff21b12ull }, \
+    { 0xe2acb80e, 0x138758d2, 0xd22739bbb9645942ull }, \
+    { 0x4bcf6178, 0x42113744, 0x85aa744c10037adeull }, \
+    { 0xbeafa47e, 0xfd3b4f50, 0x5e0994b3f808d30eull }, \
+    { 0xfdf82d19, 0x00fcb6f8, 0x946cc3bfe1e567ceull }, \
+    { 0xa475b9f5, 0x32a29fa9, 0x72d71829162deca2ull }, \
+    { 0x7a81188a, 0x113b4e15, 0x049f2fca3786ca02ull }, \
+    { 0x8d177a17, 0x70576d33, 0x8e421dcaea07d260ull }, \
+    { 0x0ce7ba16, 0xb7bc1c06, 0x2116128d6c87f9d4ull }, \
+    { 0xe2196f67, 0x0b6ea674, 0x149c182a96fd863cull }, \
+    { 0x2c2f3792, 0xea025935, 0x7ee3e5b49949877eull }, \
+    { 0x3bbec877, 0x03e0bb7f, 0xe52eb6a2bf060408ull }, \
+    { 0xc2604d1a, 0xbf09d848, 0xb6cc86d906bd00a2ull }, \
+    { 0xa670f433, 0xe759dfc5, 0x190fc4c0edff07d6ull }, \
+    { 0xbbb5eccb, 0x7cd5a9b9, 0xbe46a5ef6274d9e2ull }, \
+    { 0xfbbb3fa9, 0x632f98e5, 0x9011cceb3e9b23baull }, \
+    { 0x038c06f4, 0xeb4f5fde, 0xce08ac216c06ac6aull }, \
+    { 0x3482b174, 0x9f5cfd90, 0xeace91cf6bd42fcaull }, \
+    { 0x13a848b4, 0x8bc5594a, 0x0d941ad5e73d85e0ull }, \
+    { 0x2112b3ef, 0xb9c9f356, 0x74f10e684e3966b0ull }, \
+    { 0x50a40f76, 0xe0f47f0e, 0xf7585483bf8b4e8cull }, \
+    { 0x507c9a55, 0x1f4c44d9, 0xfd39e1d15cfd26eeull }, \
+    { 0xafc7b02a, 0x3f9db7cd, 0x05e8d8809862080cull }, \
+    { 0xc718f235, 0x435ff8f6, 0xa658a150ac07508cull }, \
+    { 0x85b665c1, 0xb3094cd0, 0x9f8e6083af0987d6ull }, \
+    { 0x164ad138, 0xba310553, 0xce870ffe5dcbaa0eull }, \
+    { 0xc4b9c0b5, 0x95ac6131, 0x9e96122b0330639aull }, \
+    { 0xc16deb26, 0x8ef416d7, 0x61f496dc78027e54ull }, \
+    { 0x83fdb211, 0x748f261b, 0x9229ba3b9aa6dbf8ull }, \
+    { 0x11e96920, 0x9326ba0d, 0xcafb0056e0c36502ull }, \
+    { 0x9b13281d, 0xc6299225, 0x60ca457a9390f3a2ull }, \
+    { 0xe2a581b4, 0xdb3c895e, 0x5f1a893ed6e006b8ull }, \
+    { 0xde7c7609, 0x458abe21, 0xd30449f37fe9957aull }, \
+    { 0xb9e930d6, 0xab346caa, 0xc6ad5b7f47025664ull }, \
+    { 0xbf1a674b, 0x65610cce, 0x1962b3481f64e22aull }, \
+    { 0x18f3ceff, 0x9a772e20, 0xe2ba73f7ee2ae0deull }, \
+    { 0xd2ace088, 0x9c430f3f, 0x6bac265fb2e6752cull }, \
+    { 0x8e370865, 0x4d256c2e, 0x54f351167341ea38ull }, \
+    { 0xb89d0591, 0xe0894b12, 0xb549dec6d9d3309cull }, \
+    { 0x2b7e77f3, 0x044fa75c, 0xac9766194a94c864ull }, \
+    { 0xb69ae101, 0x607b169a, 0xa4def26ea31fc70aull }, \
+    { 0xdbad6636, 0x68c46fb9, 0xbc7ff7768aef36c0ull }, \
+    { 0xdcd71647, 0xcbc2fe81, 0x39fa182a552f1d72ull }, \
+    { 0x60bc2899, 0xf7e067ae, 0x7c4657b3f7d24ed4ull }, \
+    { 0x60c1536a, 0x1524e72f, 0x4c4d0c5d7de20198ull }, \
+    { 0xa0ddf87f, 0x21c7d72d, 0x12f6163f7f65a084ull }, \
+    { 0x37e24be6, 0xd3ac6e7d, 0xbd2b343be9a14cb2ull }, \
+    { 0xe38867e8, 0xa6a6f709, 0x61defb6a5f44d2b0ull }, \
+    { 0xd3b448db, 0x9d985e2d, 0x996637f2605992fcull }, \
+    { 0x5cf2eeb5, 0x6e76888f, 0xea2831ec231eefb6ull }, \
+    { 0x123cdda9, 0x9eab77ed, 0xc800fea5ff4c9870ull }, \
+    { 0xa4507f75, 0xbed11a00, 0xa2cdb2da25024204ull }, \
+    { 0x619486ab, 0x62cfaf1f, 0x58fd24d06680f0f8ull }, \
+    { 0x091cd0f3, 0x695b8f8b, 0x38776924a1bf25a4ull }, \
+    { 0x22c0fd8a, 0x5ddd23a4, 0x8073bcc43f2781beull }, \
+    { 0xfd4b48fa, 0x24f0beb3, 0x49823f07fabb3394ull }, \
+    { 0x02fd5797, 0xe663c1d0, 0x5714ec9785d1f1b4ull }, \
+    { 0xad66a5c0, 0x8903ba00, 0x2a20324cafcb3278ull }, \
+    { 0xc11081f3, 0xe4b42695, 0xdb15473513553774ull }, \
+    { 0x900152a2, 0xde9cab35, 0x6c661db4b4f7bca6ull }, \
+    { 0x3eefcec0, 0x38457ff9, 0xb87e3bbe5faca11aull }, \
+    { 0x072059fa, 0x3156e2af, 0xada34c07e5b6e704ull }, \
+    { 0xa18599be, 0xc07a7221, 0x4e2d92f60031857aull }, \
+    { 0x30b9f76b, 0xff1c0247, 0x3bff8281860faa14ull }, \
+    { 0xafb049df, 0xbbbb37cf, 0xa7311da2176046a8ull }, \
+    { 0xa141935e, 0x11032f34, 0x2bbb9a5549cf3a6cull }, \
+    { 0xa8f089e9, 0x5e638903, 0x0a3194627b339230ull }, \
+    { 0xfd969f13, 0x0a0de08f, 0x3aa402eb57383efeull }, \
+    { 0x46bed92b, 0x6fc8fd52, 0xca834cb7ca86d2ccull }, \
+    { 0x533c5545, 0xd49127f8, 0x38c23d4a38e0d412ull }, \
+    { 0x08179937, 0x1863c92c, 0x74309acafb4f4a12ull }, \
+    { 0xb1103d17, 0x4d858d00, 0xad28811132e2aca6ull }, \
+    { 0xb2e793a2, 0x021ba22b, 0xbcb2587b9cae34baull }, \
+    { 0x1514f513, 0xb413004e, 0x313b62924a61509aull }, \
+    { 0x748e31cc, 0x896b70f7, 0x775de5c5cd6f1936ull }, \
+    { 0xc669897e, 0x7ec510e0, 0xe302ae6ccd05c380ull }, \
+    { 0x8752e831, 0x3e4d47dd, 0xc63fa6d1e0a9a2aeull }, \
+    { 0xe5a18162, 0xbd199c44, 0xf5b2e15f64a07416ull }, \
+    { 0x5e92a67b, 0x06978afe, 0xc0409be621eb6540ull }, \
+    { 0xd8c48aac, 0xc7c6a068, 0x3cf461d3471b414aull }, \
+    { 0x5b4fe134, 0x0b876a7a, 0x2028d1159eb936d8ull }, \
+    { 0xef577d3d, 0x0b3335c2, 0xa4926d302bdff03aull }, \
+    { 0x76680118, 0xefd4989b, 0xc572fe37757a40e6ull }, \
+    { 0x8858c7e1, 0x02780ef3, 0xbb95cf2ca8f32996ull }, \
+    { 0x3089b46a, 0x1d02deb9, 0xd19bb84204ac20d2ull }, \
+    { 0x51fda981, 0xf4f44bbf, 0x4594e326b4ef65b4ull }, \
+    { 0xf4f6f967, 0x7593d106, 0x1689fa395a6b4efaull }, \
+    { 0xccc39390, 0xee1fcc9c, 0xee592e42cf7e0894ull }, \
+    { 0x15d7755f, 0xf87f7ab3, 0x57186a96d3d37fe0ull }, \
+    { 0xb3a7cafe, 0xeef7d152, 0x296aab530ea72cf8ull }, \
+    { 0x3543cb18, 0xc0899dd0, 0x0d6f4c1ae3dece10ull }, \
+    { 0x5391f243, 0x01772db4, 0xdd293b0678fe9568ull }, \
+    { 0x1a88970a, 0x86dca601, 0x09871a044a239692ull }, \
+    { 0x5bd5dc6d, 0x69e0cdb0, 0xffeb49647e35fdd0ull }, \
+    { 0xb6eea548, 0xe120f347, 0xcd605ee5aa4c19deull }, \
+    { 0xa5f509af, 0x6e86b07a, 0xe162a919f1e9cf10ull }, \
+    { 0x763a7ae9, 0xc57ba256, 0xa0cf19c7c2e05238ull }, \
+    { 0x0bb62d57, 0x3e19fb36, 0x542ffedf69f4e9c4ull }, \
+    { 0x7bb375c7, 0x709cb38d, 0x408010313ee46a3eull }, \
+    { 0xa0716b67, 0xf8c0cab8, 0xb5b8401674488858ull }, \
+    { 0xdfeda42c, 0xc3379756, 0x5a46cc3b1af12088ull }, \
+    { 0xf8ac986a, 0xed8afd03, 0xb6e0337e2e96dac4ull }, \
+    { 0x422e8172, 0x835769b1, 0xb42294f92746d3bcull }, \
+    { 0x9ecde26c, 0x8db584a9, 0x99b1ac455a0d97a6ull }, \
+    { 0xb5fd7605, 0x9192ae03, 0x6d761c3c26609fc4ull }, \
+    { 0x3ac41958, 0x159f8823, 0x3bc345106b954fa0ull }, \
+    { 0x4c4d21fe, 0x3c2a2429, 0x29810a5f5f8a0c92ull }, \
+    { 0xc458b619, 0xbf8a3d0d, 0x53c9550982908d24ull }, \
+    { 0x3685979c, 0x3b951cc7, 0x02c4417e04319820ull }, \
+    { 0xef70fa65, 0x8685836a, 0xc60050ff77c6b244ull }, \
+    { 0x65543539, 0x7a106e73, 0x16fa7089564664b0ull }, \
+    { 0x8ca51112, 0x2b6a05d7, 0x0ffd2ac5094a40d4ull }, \
+    { 0xce4d9d7e, 0x11d51a87, 0xaf1cb5d78f21cf08ull }, \
+    { 0x46d2619f, 0x18c4d284, 0x0589a8a5d4c6600eull }, \
+    { 0x36818280, 0x0c567d71, 0x46ef1e723228832eull }, \
+    { 0xbaaf75a4, 0x9fd4dad4, 0x321ccec1961012b6ull }, \
+    { 0x0f3a5a2f, 0x3ed489ea, 0xf161f8ac6ce3101aull }, \
+    { 0x186c64a8, 0x1ab0f656, 0xc70f6112a3d1c200ull }, \
+    { 0xf3b01b35, 0xee4eec68, 0x57e26d93172dfcdaull }, \
+    { 0x30d72b3f, 0xd49d13c2, 0x32177982b7a28beaull }, \
+    { 0x3accaef4, 0x9f25901f, 0x97f73e218182568cull }, \
+    { 0x380bc488, 0x3dbe120b, 0x3fa3926d52dd4698ull }, \
+    { 0xdc68b52a, 0x70ddb13a, 0xda4449568f65ca7cull }, \
+    { 0x2bf8270b, 0x873075ad, 0x0261e682fc292d0aull }, \
+    { 0x3f846da6, 0x5780a778, 0xf5ad63455481469aull }, \
+    { 0x0dc77258, 0xde95b62f, 0xd5c7ca27e0b5c490ull }, \
+    { 0x06e03344, 0x641a1161, 0xcdb199c255afb7feull }, \
+    { 0x608929e4, 0xb4aad298, 0x5dc715d82c9b91b8ull }, \
+    { 0x97a3b91a, 0x0f45b144, 0x9fbf3cc6842dc90eull }, \
+    { 0xf8352115, 0x2cc0dd1f, 0xacaf20ac790d86aaull }, \
+    { 0xb6077f26, 0x277e6c17, 0x0f36b5cdf3d8b188ull }, \
+    { 0xb9315641, 0xe71cdaa1, 0x040a32c9aeac9fb6ull }, \
+    { 0x4a48b760, 0x68e80da4, 0xc7eacd38b72789a4ull }, \
+    { 0x89f7bbf9, 0xe148001b, 0xec64958ad045370eull }, \
+    { 0x8e023f2c, 0x6048c6c9, 0x141963908ee5c12cull }, \
+    { 0x2d18e08b, 0x15a29c19, 0xee232f36635a7250ull }, \
+    { 0x682af3c6, 0x754f596d, 0x6322da0303d6b3deull }, \
+    { 0x4977aedb, 0x2671ad81, 0x6935c41893b54ef6ull }, \
+    { 0x33dfe8f3, 0x69089a46, 0xec1613dd1f2dc506ull }, \
+    { 0x2376d98b, 0x58da87d5, 0x0bf91fac8e06ecd8ull }, \
+    { 0x16a09e8e, 0xa82c7fd9, 0x8c09744400e33094ull }, \
+    { 0xef2cd3e4, 0xbc8abfda, 0x3d626f297fa202caull }, \
+    { 0xc5412d0e, 0x309e2306, 0x3832b4386b578676ull }, \
+    { 0xc52c2cfc, 0xd74e8a28, 0x7d1066592085e796ull }, \
+    { 0x0cded67b, 0x5b468b24, 0xe64c46a086026150ull }, \
+    { 0x4f63c108, 0x88f46032, 0x50a84b680b96c9aaull }, \
+    { 0x13cc03b8, 0x41d7bef3, 0x33f8dd9dce85cfc8ull }, \
+    { 0xfaec47ea, 0xb93a32b8, 0x5e9917dd3136d840ull }, \
+    { 0x5664b55e, 0x5336892c, 0xc652bb927b6adad4ull }, \
+    { 0xd2722c79, 0x84cc323f, 0x59c7eccf59a60930ull }, \
+    { 0xc019249f, 0xa38e9e74, 0x8e12ae479dfa7cd4ull }, \
+    { 0x636ec160, 0x6bd4cb7c, 0xe4f3871b2574886aull }, \
+    { 0xbc868dca, 0xa0a3cfce, 0x946a87f8e90f5782ull }, \
+    { 0xc6a89a3e, 0xc76d26c4, 0xa006e46977aaee48ull }, \
+    { 0xc1a38ff8, 0xb0115d8b, 0xfe1b5a683065e922ull }, \
+    { 0x0bcb64e2, 0xbc0ea0b3, 0xc77017c9ec31a48aull }, \
+    { 0x81be3ef1, 0x3a96e5fb, 0x778445aae5c17a30ull }, \
+    { 0x97de9f49, 0xbeebe21c, 0xf5cd0b96f285f7daull }, \
+    { 0x610c5c5a, 0x17a53b30, 0xcbcd834b1a56ff18ull }, \
+    { 0xe272ff13, 0x9d6bc57e, 0xc7a18890fa765bc0ull }, \
+    { 0x082f56bc, 0xb4c12922, 0x95a2047bc245edccull }, \
+    { 0x0c85b1b6, 0xc82356b8, 0x3e9af6b0b8841594ull }, \
+    { 0xd5f9a375, 0xa1701c90, 0xaea6918d085c253aull }, \
+    { 0x4f6a8342, 0x2dcfc886, 0xf1ccc4dc497f0632ull }, \
+    { 0x5b1f74fd, 0x3e9b0d2a, 0x50226c5f040a0b28ull }, \
+    { 0xd1a99138, 0xe041391e, 0xff080a1fb74c793cull }, \
+    { 0x73ac9a1a, 0x06eff965, 0x8474a0dfc9e92e04ull }, \
+    { 0xc61838f5, 0x2be52af7, 0x264bed1f30108990ull }, \
+    { 0x7fe0ca34, 0x656181fd, 0xde20f83f9672e0faull }, \
+    { 0xb02c39c0, 0x94763ecc, 0x459a01b0dd4091daull }, \
+    { 0x98000848, 0x4f54aea4, 0xd6aa7bf3eba5abccull }, \
+    { 0x58f8081f, 0x73bd5cda, 0xf0ada0d2d8edb988ull }, \
+    { 0xf91cc2d3, 0x92b6ead7, 0x41d90c3952253a28ull }, \
+    { 0xe666a0b8, 0x0706c3ab, 0x521b8ef92dd6308aull }, \
+    { 0x0c20042c, 0x518e0a26, 0xceaeb6fbdc41ff8eull }, \
+    { 0xc50bcc0c, 0x5df832ec, 0x8db1b7c0114ef242ull }, \
+    { 0xae92ff05, 0x67cb24e2, 0xdb4889b4e76cc72aull }, \
+    { 0x1a5943ad, 0x42e3c077, 0x0affe2932f82c30eull }, \
+    { 0x5fbc229f, 0xa9656c27, 0x176d564c57b18f74ull }, \
+    { 0x8297625d, 0xa6ad12a7, 0xf5422536f4c44e14ull }, \
+    { 0x7f5d0701, 0x3a0cad78, 0xd14be5aaf54e4e96ull }, \
+    { 0xde1349a1, 0xbccd3e6e, 0xfb3c5d69256d07a8ull }, \
+    { 0xb0727585, 0x35bd3d8f, 0x0e33cce616c2f58cull }, \
+    { 0xeabb6b99, 0x84d10fb2, 0xa0c11a9a33722080ull }, \
+    { 0x42db8e9b, 0xea2b3071, 0x3fa8e98b95bc9b76ull }, \
+    { 0xe77a8eb5, 0x13693aee, 0xdc98990ef2a752dcull }, \
+    { 0x56a79d54, 0x31414948, 0xd3aa717624524dd4ull }, \
+    { 0x3a50c561, 0x950652df, 0x9fa6293331cf1506ull }, \
+    { 0xd40eb6bc, 0x629a490f, 0xffc33f30a7bbe1a0ull }, \
+    { 0x2722187c, 0xdbbbb30b, 0xbc930723edd7c1beull }, \
+    { 0x25a8d9c2, 0xf16405b9, 0x9e716b9d5f7e269aull }, \
+    { 0xe53fe619, 0x69964d4e, 0xbe57c16585b8d0ccull }, \
+    { 0xe0e55084, 0x84082dea, 0x7d73ae8115dc973aull }, \
+    { 0x4b62b47a, 0x36e33455, 0x29e9b2bd486d2c52ull }, \
+    { 0xc44836c4, 0x86959c8d, 0xf57a11c4425dd6deull }, \
+    { 0x3763874e, 0x666f8586, 0x87a9b676f4f29bdcull }, \
+    { 0x4978976d, 0xea301387, 0xe9db25091f7d8276ull }, \
+    { 0x75013822, 0xb161426c, 0xb77203f770e8de82ull }, \
+    { 0x91ed86c6, 0x3c1f80e9, 0x18b5fa7ee34f864cull }, \
+    { 0x6cd11bf1, 0x3556c6b3, 0x5c6939c4d99e6936ull }, \
+    { 0x55f22e1b, 0x0a473694, 0x340933bf1aa2b122ull }, \
+    { 0x79508b23, 0xa73239df, 0xacc8644cb6c63658ull }, \
+    { 0x1a2da37e, 0xb4012e59, 0xc68a57154c48ce5eull }, \
+    { 0x52fb7e89, 0xdc3493fd, 0x1e3f3fcdfdfc15d2ull }, \
+    { 0x9e15a857, 0x4ee932d4, 0xdadca48856ce701eull }, \
+    { 0xb8cacf76, 0x2e943f6e, 0xb7a034b6320d4a06ull }, \
+    { 0x2cf5d121, 0x961130b3, 0x41223460064e2e26ull }, \
+    { 0x66a1eef0, 0x73011182, 0x137007e2c83b3770ull }, \
+    { 0x7c4c27f4, 0xba982c13, 0x800cabf5442d96ccull }, \
+    { 0x884a66a2, 0xb86b3caa, 0xb7ac7013993a1f32ull }, \
+    { 0xc1df3e3b, 0x3d400232, 0xcae4111ecfb76482ull }, \
+    { 0x58d2b545, 0xee6f418a, 0x11120ccb4028b21cull }, \
+    { 0x7b0b40fa, 0x8292b0ad, 0x192ce3bac60437a6ull }, \
+    { 0xb6c52168, 0x99a12fd6, 0xf770dff56912d45eull }, \
+    { 0xa93b541f, 0xa6a90512, 0x1e1e965294d365aaull }, \
+    { 0x689bc435, 0xe482fce8, 0x882423a467029e18ull }, \
+    { 0x473ae5f5, 0xa94c1177, 0xe3190465728b28d2ull }, \
+    { 0xbc386ae3, 0xb296af70, 0xad8808a6b47d21d8ull }, \
+    { 0x55e04e46, 0xf2a21121, 0x9bc29b63c31d2d66ull }, \
+    { 0xc8c800d6, 0x17cf2c1d, 0x2332e953ba5304daull }, \
+    { 0x88b5d0b7, 0xf4faf051, 0x34bc047ac1f47aceull }, \
+    { 0xdfa20966, 0x75ee9062, 0xab5fbff860737c60ull }, \
+    { 0x00ff5215, 0xf5f00bcf, 0x96c5d41cc854f7b8ull }, \
+    { 0x824648ec, 0x078f07d0, 0xd773b9ff80a1c168ull }, \
+    { 0x5c6f64a6, 0xfc4ff08e, 0x5c88291e7ca9dd30ull }, \
+    { 0xc5bd4c55, 0xf7451a65, 0xcf455d4e6ada8192ull }, \
+    { 0x7e91dfc5, 0x316bd86d, 0x59bff359ae400530ull }, \
+    { 0x9ff42d4f, 0xf2be19cf, 0x0e46ee7c6ee7def6ull }, \
+    { 0xaca30316, 0x5aea255d, 0x36245f809bafb820ull }, \
+    { 0xe6e85c48, 0x9d44ad1a, 0x37e94a373eaa467cull }, \
+    { 0xaacb03aa, 0x10dde63d, 0x77e69f5d24d3570aull }, \
+    { 0xe63876f5, 0x74664efe, 0x818b5e93eae82ec6ull }, \
+    { 0x49874e8a, 0x164212a4, 0x70851c512697481eull }, \
+    { 0x441dfe9f, 0xea03b4d3, 0xef287cd018297064ull }, \
+    { 0xfbcf458e, 0x32575aa8, 0x729873f40a5d628aull }, \
+    { 0x1ede1cab, 0xe3182e66, 0x406a644f224d8178ull }, \
+    { 0xc7d17285, 0xa0adf331, 0x85b3ba89e3ca73b8ull }, \
+    { 0x64dbb813, 0xe13adb87, 0xf31da429269bf4eaull }, \
+    { 0xec00927c, 0x44d55493, 0x46c721ce507e7d7eull }, \
+    { 0x312eac58, 0x32792799, 0x611a62063c7ec03aull }, \
+    { 0xc3812f32, 0x3d74367e, 0x93826001fe738296ull }, \
+    { 0x0601d1f4, 0x2e7ccba0, 0x93a4ebf0976097b0ull }, \
+    { 0x07ad7190, 0x1cf44e61, 0x10373afef5c13698ull }, \
+    { 0x672cbc40, 0x2cbeb5bc, 0x04fa62f75c92bbf0ull }, \
+    { 0x27d10c8b, 0x056a03f4, 0x53d874fb7021be8eull }, \
+    { 0x05749679, 0xaf1f0066, 0xbeae5f72b40264c2ull }, \
+    { 0xe1b1379b, 0x4d804858, 0xe62155590cfbd9e0ull }, \
+    { 0x09cbfd96, 0xe607ccc8, 0x2f7e3723d79bda4aull }, \
+    { 0x00f56ca9, 0x95a841e9, 0x1c6afe0e9180e804ull }, \
+    { 0x389f620d, 0x0d064542, 0x2c2b45d46b91750cull }, \
+    { 0x5c538873, 0x42d8aba6, 0xa33f16e9ea077de8ull }, \
+    { 0x4504d12a, 0x94dde232, 0x5e8d8f0df335c480ull }, \
+    { 0x1a54538f, 0x460d246e, 0x4d65d854b54c13dcull }, \
+    { 0x7969cfca, 0x94dbdb98, 0x42cb09b4c610e90eull }, \
+    { 0x1447316c, 0xefb6d64b, 0x9cfe8bd85f755774ull }, \
+    { 0xec565add, 0xea047bef, 0xc2193cc7f7a1f196ull }, \
+    { 0x8969b4d6, 0x2fece27f, 0xe18568a5ab6f9ba6ull }, \
+    { 0x7b6bc87c, 0xdf0e7872, 0x3d238bfb831d86a0ull }, \
+    { 0x7ffedd7f, 0x13648d5f, 0xaba0dd157966db56ull }, \
+    { 0x1f704b87, 0xa833ee4d, 0x3e1ee0a25f68038aull }, \
+    { 0xe95d7f13, 0x84b0a1f8, 0x668114f954ad46b4ull }, \
+    { 0x6e57527d, 0x2352dbee, 0xc87d5990fa276744ull }, \
+    { 0xb507d898, 0x5a277937, 0xcac7de77c02712f2ull }, \
+    { 0xc257e5e7, 0x116c3c8e, 0x31697df4a7dd6abeull }, \
+    { 0x4d83405a, 0x41f05019, 0xeff99f9510570200ull }, \
+    { 0x55f7ff93, 0xfc48b194, 0xe4f9017c46afb388ull }, \
+    { 0xc9427658, 0x0bf138d3, 0x8530ac322e4ca0d4ull }, \
+    { 0xa84ab8f2, 0x1193688c, 0xe7976c947b3b46a4ull }, \
+    { 0xe0e93a1e, 0x11b32877, 0xdbaba21ee79c7488ull }, \
+    { 0xf5660eba, 0xd1e4d1ab, 0x92fdc0321285a500ull }, \
+    { 0xd3249c6e, 0x738611c4, 0x62d75e599406d290ull }, \
+    { 0xae33b503, 0xaa9a2851, 0xdd9c5de74e624740ull }, \
+    { 0xe62762d0, 0xa205c6d5, 0x234d47100f856d2eull }, \
+    { 0xf01ce07d, 0x401911c1, 0x33a390b540e970ecull }, \
+    { 0xa0205eca, 0x1fa7c0ba, 0x1eb29d4162edba18ull }, \
+    { 0xd54914e2, 0xbc9397db, 0x29005d69fcf01244ull }, \
+    { 0xc79114ad, 0x0e4190e0, 0x237efa4fe2fc04dcull }, \
+    { 0xe914137d, 0xc0787867, 0xc8efbb6e05a0dc58ull }, \
+    { 0x16d93493, 0xc8a5734d, 0xdd23ca24954e3b42ull }, \
+    { 0x3c1a4e13, 0xacf69418, 0x15f36584eb1cf760ull }, \
+    { 0xfa4c1aa8, 0x828fdd3f, 0xaad339813e3ca56cull }, \
+    { 0xe751db77, 0x8deba0f5, 0xb9b27eeed0d47c70ull }, \
+    { 0xbd079a34, 0x1d33737f, 0xb0334312b137acc4ull }, \
+    { 0x1accdd7e, 0x8e1ae100, 0xb09d0fa77aa5ce46ull }, \
+    { 0x99538ded, 0x98573db0, 0xb3e2f1790ab75bfeull }, \
+    { 0x04255f60, 0x67830faf, 0x0e527c61c3b46312ull }, \
+    { 0x63dc7327, 0x0bd2d51c, 0x97d5bf7c04be0902ull }, \
+    { 0x5415aa37, 0x77e01a44, 0xf5ffd66ccd8f34c8ull }, \
+    { 0x37dcaf99, 0xb1b07f7b, 0xd7a90acdd4d838feull }, \
+    { 0x9a691290, 0x8ea232fb, 0x22125f38f9f57f1eull }, \
+    { 0x4cafeaae, 0x654ae1c3, 0xf5abf993643f660cull }, \
+    { 0xd0f45d15, 0xb79af2f9, 0x5a5af9056a24aeceull }, \
+    { 0x67186e0d, 0x13f1b2bf, 0xc0b067cffd6ecbe8ull }, \
+    { 0x90cbc0d6, 0x0c08ccc3, 0x5d95575b8ed9b99eull }, \
+    { 0xeacf1c3a, 0x2cc7cbfb, 0x3403cd3152cca5c8ull }, \
+    { 0x4be1c822, 0x775fd7d3, 0xc75fdd9d2b0ba048ull }, \
+    { 0x14348f43, 0x88b18b16, 0x97e5e902838fc496ull }, \
+    { 0x43013e12, 0x51627724, 0xb89d62ea4ef1801aull }, \
+    { 0x891b415f, 0xaf75fedb, 0xbf030f86c7e31572ull }, \
+    { 0x55cb24b2, 0x0922e336, 0x50cc4d55239081f4ull }, \
+    { 0x720f9e6e, 0x1baa9741, 0xe5225bda55e288c2ull }, \
+    { 0x356fa040, 0x09b3b823, 0xb06393d873cfc262ull }, \
+    { 0x7659d165, 0x3cda37ce, 0x564dcb44cb04daeeull }, \
+    { 0x83842b3c, 0x53fb5ff6, 0x9d6cb69a01540adeull }, \
+    { 0x7f46cb80, 0x0d3cee39, 0x413930d9be0cc64aull }, \
+    { 0x70c7cc48, 0xaea0db3a, 0xfb465de426226534ull }, \
+    { 0x37a07758, 0xad97e547, 0x2eacd624f0ccd9ceull }, \
+    { 0x2045d960, 0x0e61c08c, 0xa5c8e203fe1f9f18ull }, \
+    { 0xe8075558, 0x8e801be5, 0x9057ed86786e9406ull }, \
+    { 0xad88900e, 0x8f1ecaff, 0x555f64d2462e6bfaull }, \
+    { 0xb10ddd00, 0x4362dc2b, 0x45a61aafcab5ab9cull }, \
+    { 0x4c2ab41c, 0xbef96fa2, 0xc001e9a157de3484ull }, \
+    { 0x3261eb06, 0x923d49e8, 0x3dce466dc55df4feull }, \
+    { 0x7a03d9f8, 0x2682cc65, 0xcbad9a9e565a2d06ull }, \
+    { 0x84be895b, 0xf6f88673, 0x2e2961aeb9e141fcull }, \
+    { 0x366edb1c, 0x1f5e150c, 0x189c09f57f07a934ull }, \
+    { 0xec92b819, 0x2408559a, 0x103ad0ce927013feull }, \
+    { 0xd8b526a1, 0xdf381226, 0x5a73b1b64904e6feull }, \
+    { 0xb976f587, 0x13e6c17b, 0xfacb45f398cefd82ull }, \
+    { 0xc2292c68, 0x9a3ba6c2, 0x1bb066aa58df13c0ull }, \
+    { 0xd582cdd4, 0x5150e6d7, 0x85c9d8d8a3cb18f2ull }, \
+    { 0x23651c0c, 0x2f6cd918, 0x1f6d16da99a52510ull }, \
+    { 0xaf444bf0, 0xfc950f1d, 0x69c989aef1e9af0cull }, \
+    { 0x897362bf, 0x83836f1a, 0x9fa1ec3a021c0cbeull }, \
+    { 0x88b92caf, 0x02682f50, 0x4e78757c11b042a2ull }, \
+    { 0x98633af6, 0xbd73d56a, 0x681e83665e0201c8ull }, \
+    { 0x13384377, 0x7a7d2869, 0x22bf79eadcb4ec04ull }, \
+    { 0x8a8dbf52, 0xc5c5f84a, 0x5853a50d94425ac4ull }, \
+    { 0x4d0baf12, 0xdd99b633, 0x40c2f5545f9e8e42ull }, \
+    { 0xaa02d822, 0x99ed7b2c, 0x47bf322685eab8caull }, \
+    { 0x80a66ab8, 0xff4a3869, 0xce0d3d36a32bb78aull }, \
+    { 0x9237a3cb, 0x41bf6161, 0x9bea97c6a22f00faull }, \
+    { 0x7da0ab20, 0x3ce1de5a, 0x51abad53bebbf51cull }, \
+    { 0x22ffeea1, 0x5aa76fa9, 0x8303b10d1004b36cull }, \
+    { 0x96d4026b, 0x1ffcb7de, 0x90ccbad4c6807decull }, \
+    { 0x1e9fb7f9, 0x37ab7455, 0xdc8e0813f65266f2ull }, \
+    { 0x7fd32699, 0x13cf7c6b, 0x5a18bf7bb7892fc2ull }, \
+    { 0x120312e2, 0x5143dbdd, 0x76c72e85249e4a20ull }, \
+    { 0x35976723, 0xee4e071c, 0xaa2358a03f462b98ull }, \
+    { 0xc879eb7f, 0xfe3be1ab, 0xd99a68a970f0e0c2ull }, \
+    { 0xd5d1d7fd, 0xaab3ee7e, 0x0ff0e3fa494ca71eull }, \
+    { 0x408791a0, 0xa02317eb, 0xe399b800ff5ffd88ull }, \
+    { 0x17cf11dc, 0x3da7adb5, 0xf0d7360a17d6158eull }, \
+    { 0x144dcd3a, 0x825c7d04, 0x66dc9fa9a61482feull }, \
+    { 0x1c5312d9, 0x14b02625, 0x23ede68ca665ac7eull }, \
+    { 0x7aff4281, 0x6a4fd1dc, 0xeab71f06eccfa3d4ull }, \
+    { 0x31afbcca, 0xaa3d88aa, 0xae323843fe7b028aull }, \
+    { 0x51a9cd2e, 0x9f8f2f8b, 0x34aab4679b135432ull }, \
+    { 0xb0f15a9f, 0x3c6adf41, 0x92eec8403ed68036ull }, \
+    { 0xfacbcb42, 0x573f731e, 0xec6908aa957e7a88ull }, \
+    { 0xf6a1247c, 0xcef05766, 0x6d2f5da7b2fd5aacull }, \
+    { 0xb3228be0, 0x8dca6a24, 0x5eca89996f5d35acull }, \
+    { 0x3c846cbe, 0xc08d6c0f, 0x9751edc44dab8db0ull }, \
+    { 0xe50ead04, 0xe3c6d463, 0x3d443d753bffa8a0ull }, \
+    { 0xca072040, 0xf96267f0, 0x1f42d44c303a1facull }, \
+    { 0x74ad4492, 0x247316e3, 0xe01739f8d0a443d2ull }, \
+    { 0xc66e0a84, 0x8ae155bb, 0x13dee4041722d73cull }, \
+    { 0x40d8df15, 0xef095720, 0x4ae50b171595e60aull }, \
+    { 0x04410428, 0x283c0f0c, 0x26a3d383ded4e248ull }, \
+    { 0xcfda4d53, 0xd64a5475, 0x2a3dec3b3eb7edc4ull }, \
+    { 0x56c89638, 0x09635fad, 0x1ed1ca758b3ec13cull }, \
+    { 0x58ac2efc, 0x115cf057, 0xaa726a8a75780388ull }, \
+    { 0x8c6343c2, 0x6d605b73, 0xdd9ed79a5b04b29aull }, \
+    { 0x8d78e9ff, 0x72c1f27f, 0x34012eec8ec28724ull }, \
+    { 0xb15073b9, 0x5de225d3, 0xe6ea2e584fef187eull }, \
+    { 0xd53e8ba7, 0x0da12769, 0x44be004af870d1d6ull }, \
+    { 0x037b19dd, 0xe85fbfd1, 0x55b61a1e570f255aull }, \
+    { 0x167ab5f9, 0x9777ba46, 0x0cd561594184a36aull }, \
+    { 0x68600bd2, 0xc918d769, 0x21d860fcd898b17cull }, \
+    { 0x1e7422af, 0xcf0e46bd, 0xf9e06d75f271732cull }, \
+    { 0xaa57d5f3, 0x4386e5e2, 0x1e66e3875b03eb6eull }, \
+    { 0xb39d76dd, 0xb8411909, 0x7ac75048baa37f36ull }, \
+    { 0x36d861f9, 0x10d94ef4, 0x9b63cb2a73c37becull }, \
+    { 0x8a3a6a81, 0xc76f1df1, 0x63cae3e910ee1ca8ull }, \
+    { 0xe8559409, 0x87788239, 0x861e365d574ddef0ull }, \
+    { 0x18346f6b, 0xc43d2cf5, 0x42e92776235bbbccull }, \
+    { 0x10e4d0c0, 0xaf456433, 0xe13c2db269332e22ull }, \
+    { 0xe6c0d09e, 0xd206b29e, 0x05d60b5cec6096a0ull }, \
+    { 0x50ba57c5, 0xf16c1fdf, 0x82ed9b318e0ad8eaull }, \
+    { 0xc3161aaf, 0x83356b25, 0x2a7b0d697065a71cull }, \
+    { 0x3f39e29b, 0x41811b86, 0x130d5954b8c15510ull }, \
+    { 0xbabd81c1, 0x850b359e, 0xe1bc14bf332b7820ull }, \
+    { 0x0547c8e0, 0x349de2a7, 0x52c6843616508d0cull }, \
+    { 0x66da791f, 0xcd641921, 0x1bdd7f43e939f426ull }, \
+    { 0x33b826a7, 0xb26d02f8, 0xcd40c0f9bbf48ac6ull }, \
+    { 0x9bb83401, 0x9afbe61b, 0xcd1dee5a79c2f758ull }, \
+    { 0xbbea0566, 0x28e85265, 0xe71fb0db15cd3f46ull }, \
+    { 0xe141dede, 0x3ccd0195, 0xd73cbfbfa5ba1cb0ull }, \
+    { 0x829782d5, 0x722cc608, 0x2259f1ccdc154e42ull }, \
+    { 0x20004320, 0x2cc41600, 0xffcbf35fa683c674ull }, \
+    { 0xd3bfadab, 0xd04c1fde, 0xb57464639659b788ull }, \
+    { 0x0722579a, 0x4f1db4b7, 0xb9ce3308603f9ce6ull }, \
+    { 0x33e8e9b6, 0x0c51901e, 0x1e4001da88a56832ull }, \
+    { 0xf37c82f3, 0x1abb9a0e, 0x8a30de9a0c6e4f96ull }, \
+    { 0xe36bc93c, 0xdbac34cd, 0x8b7bea67fe3e529cull }, \
+    { 0x4c8434ec, 0x1c609ffe, 0xc1a0d7ecd8688276ull }, \
+    { 0x49b2b41d, 0xd47819dd, 0xbb70d38dc3137484ull }, \
+    { 0x9e4f050c, 0x4fb516e5, 0x6da78ff940be4aacull }, \
+    { 0x38f17421, 0x8de0cd9f, 0x4a34f61ea67e1212ull }, \
+    { 0xf99b8afb, 0xeff613b4, 0xd3e0e5cee1b0e74cull }, \
+    { 0x5a9a6b1d, 0x35a8dc3b, 0x62f83b6270a924b2ull }, \
+    { 0x627d61c1, 0x67792b6e, 0x36ee6d1ca8590f42ull }, \
+    { 0x1eb8bca5, 0x5c8b04d1, 0x0d2fc7d151b4f78cull }, \
+    { 0x53ae5626, 0x07ca8f9d, 0x2e29845299d3b9b4ull }, \
+    { 0x9e263180, 0x104a92eb, 0xb811746ad5db6f62ull }, \
+    { 0x0bf9b2a7, 0x273decda, 0xa0059e9be616e926ull }, \
+    { 0x969c6989, 0xcab761a0, 0xc458f47a18ffda7aull }, \
+    { 0x19c8c5d0, 0xde628197, 0x29cd2466cd169438ull }, \
+    { 0xfb4e896a, 0xb0963de8, 0x81be3c24c64a22beull }, \
+    { 0x81c2e124, 0xe7448ceb, 0xd6fbe3d398923facull }, \
+    { 0xb3738067, 0xdcea933a, 0xb578e6d0f148e46aull }, \
+    { 0x4cef7aa4, 0xc30d3461, 0xe1d40bfaa69380a8ull }, \
+    { 0x7c877e86, 0x1ccacac8, 0x361a82dc04019e80ull }, \
+    { 0x977ef195, 0x4aa180e1, 0xf1041d77e7abe6f8ull }, \
+    { 0x63fbe4e1, 0xb2be2fe7, 0xb51f30a237e8bf64ull }, \
+    { 0xd8768fcd, 0xc33b9c70, 0xb82da4f1eaa86d26ull }, \
+    { 0x0824a276, 0xd5eba5ef, 0x7bb5d293b54d7c42ull }, \
+    { 0x9c965f8f, 0x35d4d648, 0xe5b306b7f9c1673cull }, \
+    { 0x8029a352, 0x7ff92478, 0x4f1d699d5cb5605cull }, \
+    { 0x8e3bd9eb, 0xe69cc22f, 0xc56b3ed587539320ull }, \
+    { 0xb42d902a, 0xb8eab9e6, 0xbb79ab1c50ecce6cull }, \
+    { 0x836c6680, 0xe6d83c56, 0x707cf081695e9662ull }, \
+    { 0x184007b4, 0xfc3210d7, 0x435db470ee11c4d8ull }, \
+    { 0xe251025d, 0x0d4d0e78, 0x2e7f6acda4534ed2ull }, \
+    { 0x61fe53d9, 0xd0e075bf, 0xe31f20ffcfdabeb4ull }, \
+    { 0x368df902, 0xa973e545, 0x11c088dfeac49872ull }, \
+    { 0x79cf0124, 0x63ff3378, 0xaaee2a25ec815904ull }, \
+    { 0x9e457478, 0x63bd3351, 0x602f5db01172fe24ull }, \
+    { 0x8e800370, 0x49946aee, 0xa3b359811812646aull }, \
+    { 0x2138dc5d, 0x8da6c1d7, 0xe5a7ca3f97659cccull }, \
+    { 0x1093e82f, 0xd17e6709, 0xa5084f1abd56790aull }, \
+    { 0xcfb4ae91, 0x98132b49, 0xa8143f97fa65939eull }, \
+    { 0x7adc14e9, 0x9f62031b, 0x7bd02a47d0d5adaeull }, \
+    { 0x8d0ee948, 0x29af1374, 0xc651b350e698efb0ull }, \
+    { 0x2c6566a0, 0xbb5c45dd, 0x2222b33cb2f59c68ull }, \
+    { 0xeaa7a534, 0x07c052dd, 0x3ae55ba90495ad14ull }, \
+    { 0xd3a21d76, 0x8727b89f, 0xbc03651408bd3514ull }, \
+    { 0xd9068450, 0x1f0f651e, 0x3211adc9cedd1922ull }, \
+    { 0x776cdabe, 0xe8aaaa60, 0xb8882437dace4014ull }, \
+    { 0x322d3b04, 0xd2c73d73, 0x48f783ce6d92ca64ull }, \
+    { 0x7b24045c, 0xd085ddef, 0xcc41a4058172ba62ull }, \
+    { 0x7df1d42f, 0xc320084d, 0xf13ff85681943adeull }, \
+    { 0x13f82895, 0x96f11008, 0x7cdf1634bda21fdcull }, \
+    { 0x39214472, 0x7fbdf5cf, 0x8f7bf45ad46e3948ull }, \
+    { 0xf8b1c1c7, 0x20e5b630, 0xb352b25b5e0d1372ull }, \
+    { 0x591074cd, 0xa204cc0e, 0x8b4ad6598f7fcc98ull }, \
+    { 0xd564d020, 0xf2f70eeb, 0x63b3c3293f928a50ull }, \
+    { 0x5087943e, 0xa52f664c, 0x866a8ace4b887602ull }, \
+    { 0xee6e13c6, 0x86e4adbe, 0x5b9d353c5d97f6beull }, \
+    { 0x126e9622, 0x2b34645e, 0x3e2de9e6d234a0b8ull }, \
+    { 0xdd562f29, 0xee3c5ee6, 0x0510ca2d36548e32ull }, \
+    { 0x5673f4df, 0x9c3a59c5, 0x0f9b9d9ac9d6c312ull }, \
+    { 0x44324297, 0x829f106c, 0x1a75b349cae5fe4cull }, \
+    { 0xdb68dfd0, 0xfbaf40c7, 0x97ea05bf5e9c511eull }, \
+    { 0xf165cefa, 0x94ec90b7, 0xb0d6d9ae286cc97aull }, \
+    { 0x80b865ad, 0xaedfcfd5, 0xd6b2cc39a08f1e9cull }, \
+    { 0x4a37712d, 0x7c9da80c, 0x199a0dbd0b3d5f64ull }, \
+    { 0x9f700d85, 0xee77f80d, 0xb3b90fe143d915e8ull }, \
+    { 0xf7f98051, 0xd43ef471, 0xa80582e90193974eull }, \
+    { 0x29c0cbc8, 0x2baf0308, 0x2d51e3eb07dfe61aull }, \
+    { 0x69a1cdfc, 0xa18c8f03, 0xb38c5b2561265304ull }, \
+    { 0xc4f66861, 0x579233fb, 0x3d3b03e3a9d2010eull }, \
+    { 0xd18af318, 0x3b8bb7ca, 0x7556214fa0cc912cull }, \
+    { 0x99e48138, 0xac24e7f8, 0xfb175fb6cde5a698ull }, \
+    { 0x3ff42157, 0x53a27c43, 0x3a1eb822e1e99d60ull }, \
+    { 0x325001f3, 0xb262b143, 0xb891a0995b34d61aull }, \
+    { 0x5385f95c, 0x4397a803, 0x7f3a672427d0d6b6ull }, \
+    { 0x18a48f78, 0x632b6b22, 0x0a18b78a80709d9eull }, \
+    { 0xf6c5e080, 0x2d4f5deb, 0x441b22044d3d103eull }, \
+    { 0x32561f47, 0x119da1be, 0xe8249dae5ec44424ull }, \
+    { 0x271dda25, 0x64c8c06e, 0x4af7a1b3c2824726ull }, \
+    { 0x664e3614, 0xdf153f10, 0x863b18342cefd594ull }, \
+    { 0x1ea1bc5e, 0x21c5c503, 0xdde300b6ce572742ull }, \
+    { 0x2440e5de, 0xab3ca755, 0xb2c7638031d718f6ull }, \
+    { 0xbeb26faf, 0xd996d5f4, 0x93a8f90cf25b2ee8ull }, \
+    { 0x2bf72a0f, 0x38a7f829, 0x8a8b0e8896bfa5d6ull }, \
+    { 0xbc99ed79, 0xe2811808, 0x039b26b1310d9f50ull }, \
+    { 0xc8d9610b, 0x1a267b15, 0x54572ba7b4dc0e54ull }, \
+    { 0x59920489, 0xd5bff0c8, 0xff501c3fe34b39c4ull }, \
+    { 0x66dde867, 0xbf1f18d9, 0xd217076814a80450ull }, \
+    { 0xe84e80a0, 0xa5e5e33b, 0xbda5b8697db4f5a8ull }, \
+    { 0xe71b5665, 0x24fa4b1a, 0x0d4bfe824a3e323eull }, \
+    { 0x11e35ec8, 0x3c81a33e, 0x5d1806f9821623b4ull }, \
+    { 0x5c1561a9, 0x48da537e, 0x0a058f40664d4f10ull }, \
+    { 0x9fd3350b, 0xadd5843c, 0x1113522b0dc2d614ull }, \
+    { 0xca84e7e4, 0x4ed8e8ee, 0x442e5a71d54fbd0aull }, \
+    { 0x734e91a4, 0x51243668, 0xaf9e091e0efa54aeull }, \
+    { 0xb46e3f5a, 0xe00316aa, 0xa59cae13f4d86ce8ull }, \
+    { 0x89d4f847, 0x34f7eafd, 0x05b808c42af840aeull }, \
+    { 0x6073bb69, 0xa731c611, 0x6cb8e358007aafeaull }, \
+    { 0x1e4e0db0, 0xa64c6fbd, 0xb9a1d5e12567f54eull }, \
+    { 0x0de09afc, 0x86ebec75, 0xeb9e750e551df548ull }, \
+    { 0xc900e528, 0xffba3860, 0x845cef52cda0a384ull }, \
+    { 0x8e86958a, 0x243bca01, 0x2bf5320b572b89daull }, \
+    { 0x6db2c347, 0x6f7b3fc6, 0xb7fbc9e78419d026ull }, \
+    { 0xa90bde04, 0x774b1c5d, 0xa8f7f44207d471dcull }, \
+    { 0x454ae68c, 0x2438fae9, 0xf0720470b5b6e878ull }, \
+    { 0x224cd768, 0xb495b74f, 0x2280360111b33322ull }, \
+    { 0x9509deb4, 0x85cd4766, 0xeb091995b041471cull }, \
+    { 0x2e7a61a7, 0x3be2bdeb, 0x2c6727cea37a4292ull }, \
+    { 0x9679b309, 0xfa1be0f8, 0x8f2b5aa03bf6a13cull }, \
+    { 0x4f3c9fcd, 0xc335731a, 0x98a9a697bda189daull }, \
+    { 0x15cacef8, 0x6eb84114, 0x8b160c4c1a993a64ull }, \
+    { 0x47c78efe, 0x17224fda, 0x9307610eb360abd2ull },
@@ -0,0 +1,612 @@
+#include <string.h>
+#include <pthread.h>
+
+#include "simd.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define SIMD_X86
+#endif
+
+/* the tempering of MT19937-64, see lib/mt/mt.c */
+#define MT_TEMPER_1 0x5555555555555555ULL
+#define MT_TEMPER_2 0x71D67FFFEDA60000ULL
+#define MT_TEMPER_3 0xFFF7EEE000000000ULL
+
+/* 
+ * Integers below 2^52 are converted to double by putting them into the mantissa of 2^52,
+ * and subtracting 2^52 again, which is exact and works without AVX-512DQ.
+ */
+#define EXP_2_52 0x4330000000000000ULL
+#define TWO_52 4503599627370496.0
+#define TWO_32 4294967296.0
+#define TWO_M52 (1.0 / 4503599627370496.0)
+#define TWO_M53 (1.0 / 9007199254740992.0)
+#define TWO_M24 (1.0f / 16777216.0f)
+
+typedef void xor_fn(uint64_t* dst, const uint64_t* src, size_t n);
+typedef void temper_fn(uint64_t* dst, const uint64_t* src, size_t n);
+typedef void to_double_fn(double* dst, const uint64_t* src, size_t n);
+typedef void to_float_fn(float* dst, const uint64_t* src, size_t n);
+typedef void xoshiro_lanes_fn(uint64_t* state, size_t lanes, size_t steps, uint64_t* out,
+                              int by_lane);
+
+/*------------------------------------------------------
+ * Forward Declarations                                |
+ /----------------------------------------------------*/
+
+static
+void xor_portable(uint64_t* dst, const uint64_t* src, size_t n);
+
+static
+void temper_portable(uint64_t* dst, const uint64_t* src, size_t n);
+
+static
+void to_double_portable(double* dst, const uint64_t* src, size_t n);
+
+static
+void to_double_open_portable(double* dst, const uint64_t* src, size_t n);
+
+static
+void to_float_portable(float* dst, const uint64_t* src, size_t n);
+
+static
+void xoshiro_lanes_portable(uint64_t* state, size_t lanes, size_t steps, uint64_t* out,
+                            int by_lane);
+
+#ifdef SIMD_X86
+static
+void xor_avx2(uint64_t* dst, const uint64_t* src, size_t n);
+
+static
+void xor_avx512(uint64_t* dst, const uint64_t* src, size_t n);
+
+static
+void temper_avx2(uint64_t* dst, const uint64_t* src, size_t n);
+
+static
+void temper_avx512(uint64_t* dst, const uint64_t* src, size_t n);
+
+static
+void to_double_avx2(double* dst, const uint64_t* src, size_t n);
+
+static
+void to_double_open_avx2(double* dst, const uint64_t* src, size_t n);
+
+static
+void to_float_avx2(float* dst, const uint64_t* src, size_t n);
+
+static
+void to_double_avx512(double* dst, const uint64_t* src, size_t n);
+
+static
+void to_double_open_avx512(double* dst, const uint64_t* src, size_t n);
+
+static
+void to_float_avx512(float* dst, const uint64_t* src, size_t n);
+
+static
+void xoshiro_lanes_avx2(uint64_t* state, size_t lanes, size_t steps, uint64_t* out,
+                        int by_lane);
+
+static
+void xoshiro_lanes_avx512(uint64_t* state, size_t lanes, size_t steps, uint64_t* out,
+                          int by_lane);
+#endif
+
+static
+void select_kernels();
+
+static
+int supported(enum F2LinSimdLevel level);
+
+static
+void use_kernels(enum F2LinSimdLevel level);
+
+// chosen once depending on the cpu, see select_kernels()
+static enum F2LinSimdLevel kernel_level = SIMD_PORTABLE;
+static xor_fn* xor_words = 0;
+static temper_fn* temper_mt64 = 0;
+static to_double_fn* to_double = 0;
+static to_double_fn* to_double_open = 0;
+static to_float_fn* to_float = 0;
+static xoshiro_lanes_fn* xoshiro_lanes = 0;
+static size_t xoshiro_width = 4;
+static pthread_once_t kernels_once = PTHREAD_ONCE_INIT;
+
+/*------------------------------------------------------
+ * Header Implementations                              |
+ /----------------------------------------------------*/
+
+void* f2lin_simd_alloc(size_t bytes) {
+    // aligned_alloc needs a multiple of the alignment
+    const size_t size = (bytes + SIMD_ALIGN - 1) / SIMD_ALIGN * SIMD_ALIGN;
+    void* p = aligned_alloc(SIMD_ALIGN, size ? size : SIMD_ALIGN);
+
+    if (p) memset(p, 0, size);
+    return p;
+}
+
+void f2lin_simd_xor(uint64_t* dst, const uint64_t* src, size_t n) {
+    pthread_once(&kernels_once, select_kernels);
+    xor_words(dst, src, n);
+}
+
+void f2lin_simd_temper_mt64(uint64_t* dst, const uint64_t* src, size_t n) {
+    pthread_once(&kernels_once, select_kernels);
+    temper_mt64(dst, src, n);
+}
+
+void f2lin_simd_u64_to_double(double* dst, const uint64_t* src, size_t n) {
+    pthread_once(&kernels_once, select_kernels);
+    to_double(dst, src, n);
+}
+
+void f2lin_simd_u64_to_double_open(double* dst, const uint64_t* src, size_t n) {
+    pthread_once(&kernels_once, select_kernels);
+    to_double_open(dst, src, n);
+}
+
+void f2lin_simd_u64_to_float(float* dst, const uint64_t* src, size_t n) {
+    pthread_once(&kernels_once, select_kernels);
+    to_float(dst, src, n);
+}
+
+void f2lin_simd_xoshiro_lanes(uint64_t* state, size_t lanes, size_t steps, uint64_t* out,
+                              int by_lane) {
+    pthread_once(&kernels_once, select_kernels);
+
+    // the vector kernels need whole vectors of lanes
+    if (lanes % xoshiro_width) xoshiro_lanes_portable(state, lanes, steps, out, by_lane);
+    else xoshiro_lanes(state, lanes, steps, out, by_lane);
+}
+
+size_t f2lin_simd_xoshiro_width() {
+    pthread_once(&kernels_once, select_kernels);
+    return xoshiro_width;
+}
+
+int f2lin_simd_select(enum F2LinSimdLevel level) {
+    // selected first, so the choice isn't overwritten by a later first call
+    pthread_once(&kernels_once, select_kernels);
+
+    if (level < SIMD_PORTABLE || level > SIMD_AVX512 || !supported(level)) return -1;
+    use_kernels(level);
+    return 0;
+}
+
+enum F2LinSimdLevel f2lin_simd_level() {
+    pthread_once(&kernels_once, select_kernels);
+    return kernel_level;
+}
+
+/*------------------------------------------------------
+ * Internal Implementations                            |
+ /----------------------------------------------------*/
+
+static
+void xor_portable(uint64_t* dst, const uint64_t* src, size_t n) {
+    for (size_t i = 0; i < n; ++i) dst[i] ^= src[i];
+}
+
+static
+void temper_portable(uint64_t* dst, const uint64_t* src, size_t n) {
+    for (size_t i = 0; i < n; ++i) {
+        uint64_t x = src[i];
+
+        x ^= (x >> 29) & MT_TEMPER_1;
+        x ^= (x << 17) & MT_TEMPER_2;
+        x ^= (x << 37) & MT_TEMPER_3;
+        dst[i] = x ^ (x >> 43);
+    }
+}
+
+static
+void to_double_portable(double* dst, const uint64_t* src, size_t n) {
+    for (size_t i = 0; i < n; ++i) dst[i] = (src[i] >> 11) * TWO_M53;
+}
+
+static
+void to_double_open_portable(double* dst, const uint64_t* src, size_t n) {
+    for (size_t i = 0; i < n; ++i) dst[i] = ((src[i] >> 12) + 0.5) * TWO_M52;
+}
+
+static
+void to_float_portable(float* dst, const uint64_t* src, size_t n) {
+    for (size_t i = 0; i < n; ++i) {
+        dst[2 * i] = ((uint32_t) src[i] >> 8) * TWO_M24;
+        dst[2 * i + 1] = (uint32_t) (src[i] >> 40) * TWO_M24;
+    }
+}
+
+static
+void xoshiro_lanes_portable(uint64_t* state, size_t lanes, size_t steps, uint64_t* out,
+                            int by_lane) {
+    uint64_t* s0 = state;
+    uint64_t* s1 = &state[lanes];
+    uint64_t* s2 = &state[2 * lanes];
+    uint64_t* s3 = &state[3 * lanes];
+
+    for (size_t k = 0; k < steps; ++k) {
+        for (size_t i = 0; i < lanes; ++i) {
+            const uint64_t t = s1[i] << 17;
+            const uint64_t r = s0[i] + s3[i];
+
+            out[by_lane ? i * steps + k : k * lanes + i] = ((r << 23) | (r >> 41)) + s0[i];
+            s2[i] ^= s0[i];
+            s3[i] ^= s1[i];
+            s1[i] ^= s2[i];
+            s0[i] ^= s3[i];
+            s2[i] ^= t;
+            s3[i] = (s3[i] << 45) | (s3[i] >> 19);
+        }
+    }
+}
+
+#ifdef SIMD_X86
+__attribute__((target("avx2")))
+static
+void xor_avx2(uint64_t* dst, const uint64_t* src, size_t n) {
+    size_t i = 0;
+
+    for (; i + 4 <= n; i += 4) {
+        __m256i* d = (__m256i*) &dst[i];
+        __m256i s = _mm256_loadu_si256((const __m256i*) &src[i]);
+        _mm256_storeu_si256(d, _mm256_xor_si256(_mm256_loadu_si256(d), s));
+    }
+    for (; i < n; ++i) dst[i] ^= src[i];
+}
+
+__attribute__((target("avx512f")))
+static
+void xor_avx512(uint64_t* dst, const uint64_t* src, size_t n) {
+    size_t i = 0;
+
+    for (; i + 8 <= n; i += 8) {
+        __m512i s = _mm512_loadu_si512(&src[i]);
+        _mm512_storeu_si512(&dst[i], _mm512_xor_si512(_mm512_loadu_si512(&dst[i]), s));
+    }
+
+    // the rest with a mask, so it doesn't need a scalar loop
+    if (i < n) {
+        const __mmask8 m = (__mmask8) ((1u << (n - i)) - 1);
+        __m512i s = _mm512_maskz_loadu_epi64(m, &src[i]);
+        __m512i d = _mm512_maskz_loadu_epi64(m, &dst[i]);
+        _mm512_mask_storeu_epi64(&dst[i], m, _mm512_xor_si512(d, s));
+    }
+}
+
+__attribute__((target("avx2")))
+static
+void temper_avx2(uint64_t* dst, const uint64_t* src, size_t n) {
+    const __m256i m1 = _mm256_set1_epi64x(MT_TEMPER_1);
+    const __m256i m2 = _mm256_set1_epi64x(MT_TEMPER_2);
+    const __m256i m3 = _mm256_set1_epi64x(MT_TEMPER_3);
+    size_t i = 0;
+
+    for (; i + 4 <= n; i += 4) {
+        __m256i x = _mm256_loadu_si256((const __m256i*) &src[i]);
+
+        x = _mm256_xor_si256(x, _mm256_and_si256(_mm256_srli_epi64(x, 29), m1));
+        x = _mm256_xor_si256(x, _mm256_and_si256(_mm256_slli_epi64(x, 17), m2));
+        x = _mm256_xor_si256(x, _mm256_and_si256(_mm256_slli_epi64(x, 37), m3));
+        x = _mm256_xor_si256(x, _mm256_srli_epi64(x, 43));
+        _mm256_storeu_si256((__m256i*) &dst[i], x);
+    }
+    temper_portable(&dst[i], &src[i], n - i);
+}
+
+__attribute__((target("avx512f")))
+static
+void temper_avx512(uint64_t* dst, const uint64_t* src, size_t n) {
+    const __m512i m1 = _mm512_set1_epi64(MT_TEMPER_1);
+    const __m512i m2 = _mm512_set1_epi64(MT_TEMPER_2);
+    const __m512i m3 = _mm512_set1_epi64(MT_TEMPER_3);
+
+    for (size_t i = 0; i < n; i += 8) {
+        const __mmask8 m = n - i >= 8 ? 0xff : (__mmask8) ((1u << (n - i)) - 1);
+        __m512i x = _mm512_maskz_loadu_epi64(m, &src[i]);
+
+        x = _mm512_xor_si512(x, _mm512_and_si512(_mm512_srli_epi64(x, 29), m1));
+        x = _mm512_xor_si512(x, _mm512_and_si512(_mm512_slli_epi64(x, 17), m2));
+        x = _mm512_xor_si512(x, _mm512_and_si512(_mm512_slli_epi64(x, 37), m3));
+        x = _mm512_xor_si512(x, _mm512_srli_epi64(x, 43));
+        _mm512_mask_storeu_epi64(&dst[i], m, x);
+    }
+}
+
+// the upper 53 bits as double, in two parts below 2^52
+__attribute__((target("avx2")))
+static inline
+__m256d upper53_avx2(__m256i x) {
+    const __m256i exp = _mm256_set1_epi64x(EXP_2_52);
+    const __m256d two_52 = _mm256_set1_pd(TWO_52);
+    __m256i lo = _mm256_srli_epi64(_mm256_slli_epi64(x, 21), 32);
+    __m256i hi = _mm256_srli_epi64(x, 43);
+    __m256d dlo = _mm256_sub_pd(_mm256_castsi256_pd(_mm256_or_si256(lo, exp)), two_52);
+    __m256d dhi = _mm256_sub_pd(_mm256_castsi256_pd(_mm256_or_si256(hi, exp)), two_52);
+
+    return _mm256_add_pd(_mm256_mul_pd(dhi, _mm256_set1_pd(TWO_32)), dlo);
+}
+
+__attribute__((target("avx2")))
+static
+void to_double_avx2(double* dst, const uint64_t* src, size_t n) {
+    const __m256d scale = _mm256_set1_pd(TWO_M53);
+    size_t i = 0;
+
+    for (; i + 4 <= n; i += 4) {
+        __m256i x = _mm256_loadu_si256((const __m256i*) &src[i]);
+        _mm256_storeu_pd(&dst[i], _mm256_mul_pd(upper53_avx2(x), scale));
+    }
+    to_double_portable(&dst[i], &src[i], n - i);
+}
+
+__attribute__((target("avx2")))
+static
+void to_double_open_avx2(double* dst, const uint64_t* src, size_t n) {
+    const __m256i exp = _mm256_set1_epi64x(EXP_2_52);
+    const __m256d two_52 = _mm256_set1_pd(TWO_52);
+    const __m256d half = _mm256_set1_pd(0.5);
+    const __m256d scale = _mm256_set1_pd(TWO_M52);
+    size_t i = 0;
+
+    for (; i + 4 <= n; i += 4) {
+        __m256i x = _mm256_srli_epi64(_mm256_loadu_si256((const __m256i*) &src[i]), 12);
+        __m256d d = _mm256_sub_pd(_mm256_castsi256_pd(_mm256_or_si256(x, exp)), two_52);
+        _mm256_storeu_pd(&dst[i], _mm256_mul_pd(_mm256_add_pd(d, half), scale));
+    }
+    to_double_open_portable(&dst[i], &src[i], n - i);
+}
+
+// the 32 bit halves of the words are next to each other in memory, low half first
+__attribute__((target("avx2")))
+static
+void to_float_avx2(float* dst, const uint64_t* src, size_t n) {
+    const __m256 scale = _mm256_set1_ps(TWO_M24);
+    size_t i = 0;
+
+    for (; i + 4 <= n; i += 4) {
+        __m256i x = _mm256_srli_epi32(_mm256_loadu_si256((const __m256i*) &src[i]), 8);
+        _mm256_storeu_ps(&dst[2 * i], _mm256_mul_ps(_mm256_cvtepi32_ps(x), scale));
+    }
+    to_float_portable(&dst[2 * i], &src[i], n - i);
+}
+
+__attribute__((target("avx512f")))
+static
+void to_double_avx512(double* dst, const uint64_t* src, size_t n) {
+    const __m512i exp = _mm512_set1_epi64(EXP_2_52);
+    const __m512d two_52 = _mm512_set1_pd(TWO_52);
+    const __m512d two_32 = _mm512_set1_pd(TWO_32);
+    const __m512d scale = _mm512_set1_pd(TWO_M53);
+
+    for (size_t i = 0; i < n; i += 8) {
+        const __mmask8 m = n - i >= 8 ? 0xff : (__mmask8) ((1u << (n - i)) - 1);
+        __m512i x = _mm512_maskz_loadu_epi64(m, &src[i]);
+        __m512i lo = _mm512_srli_epi64(_mm512_slli_epi64(x, 21), 32);
+        __m512i hi = _mm512_srli_epi64(x, 43);
+        __m512d dlo = _mm512_sub_pd(_mm512_castsi512_pd(_mm512_or_si512(lo, exp)), two_52);
+        __m512d dhi = _mm512_sub_pd(_mm512_castsi512_pd(_mm512_or_si512(hi, exp)), two_52);
+        __m512d d = _mm512_add_pd(_mm512_mul_pd(dhi, two_32), dlo);
+
+        _mm512_mask_storeu_pd(&dst[i], m, _mm512_mul_pd(d, scale));
+    }
+}
+
+__attribute__((target("avx512f")))
+static
+void to_double_open_avx512(double* dst, const uint64_t* src, size_t n) {
+    const __m512i exp = _mm512_set1_epi64(EXP_2_52);
+    const __m512d two_52 = _mm512_set1_pd(TWO_52);
+    const __m512d half = _mm512_set1_pd(0.5);
+    const __m512d scale = _mm512_set1_pd(TWO_M52);
+
+    for (size_t i = 0; i < n; i += 8) {
+        const __mmask8 m = n - i >= 8 ? 0xff : (__mmask8) ((1u << (n - i)) - 1);
+        __m512i x = _mm512_srli_epi64(_mm512_maskz_loadu_epi64(m, &src[i]), 12);
+        __m512d d = _mm512_sub_pd(_mm512_castsi512_pd(_mm512_or_si512(x, exp)), two_52);
+
+        _mm512_mask_storeu_pd(&dst[i], m, _mm512_mul_pd(_mm512_add_pd(d, half), scale));
+    }
+}
+
+__attribute__((target("avx512f")))
+static
+void to_float_avx512(float* dst, const uint64_t* src, size_t n) {
+    const __m512 scale = _mm512_set1_ps(TWO_M24);
+
+    for (size_t i = 0; i < n; i += 8) {
+        const __mmask16 m = n - i >= 8 ? 0xffff : (__mmask16) ((1u << (2 * (n - i))) - 1);
+        __m512i x = _mm512_srli_epi32(_mm512_maskz_loadu_epi32(m, &src[i]), 8);
+
+        _mm512_mask_storeu_ps(&dst[2 * i], m, _mm512_mul_ps(_mm512_cvtepi32_ps(x), scale));
+    }
+}
+
+// one step of 4 lanes of xoshiro256++, returns the output
+__attribute__((target("avx2")))
+static inline
+__m256i xoshiro_step_avx2(__m256i* s0, __m256i* s1, __m256i* s2, __m256i* s3) {
+    const __m256i t = _mm256_slli_epi64(*s1, 17);
+    const __m256i r = _mm256_add_epi64(*s0, *s3);
+    const __m256i out = _mm256_add_epi64(
+        _mm256_or_si256(_mm256_slli_epi64(r, 23), _mm256_srli_epi64(r, 41)), *s0);
+
+    *s2 = _mm256_xor_si256(*s2, *s0);
+    *s3 = _mm256_xor_si256(*s3, *s1);
+    *s1 = _mm256_xor_si256(*s1, *s2);
+    *s0 = _mm256_xor_si256(*s0, *s3);
+    *s2 = _mm256_xor_si256(*s2, t);
+    *s3 = _mm256_or_si256(_mm256_slli_epi64(*s3, 45), _mm256_srli_epi64(*s3, 19));
+    return out;
+}
+
+/*
+ * by_lane: 4 steps are transposed in registers, so every lane gets 4 consecutive numbers 
+ * with one store. The steps which don't fill a whole 4x4 tile are stored one by one.
+ */
+__attribute__((target("avx2")))
+static
+void xoshiro_lanes_avx2(uint64_t* state, size_t lanes, size_t steps, uint64_t* out,
+                        int by_lane) {
+    for (size_t g = 0; g < lanes; g += 4) {
+        __m256i s0 = _mm256_loadu_si256((const __m256i*) &state[g]);
+        __m256i s1 = _mm256_loadu_si256((const __m256i*) &state[lanes + g]);
+        __m256i s2 = _mm256_loadu_si256((const __m256i*) &state[2 * lanes + g]);
+        __m256i s3 = _mm256_loadu_si256((const __m256i*) &state[3 * lanes + g]);
+        size_t k = 0;
+
+        if (by_lane) {
+            for (; k + 4 <= steps; k += 4) {
+                __m256i r0 = xoshiro_step_avx2(&s0, &s1, &s2, &s3);
+                __m256i r1 = xoshiro_step_avx2(&s0, &s1, &s2, &s3);
+                __m256i r2 = xoshiro_step_avx2(&s0, &s1, &s2, &s3);
+                __m256i r3 = xoshiro_step_avx2(&s0, &s1, &s2, &s3);
+                __m256i t0 = _mm256_unpacklo_epi64(r0, r1);
+                __m256i t1 = _mm256_unpackhi_epi64(r0, r1);
+                __m256i t2 = _mm256_unpacklo_epi64(r2, r3);
+                __m256i t3 = _mm256_unpackhi_epi64(r2, r3);
+
+                _mm256_storeu_si256((__m256i*) &out[g * steps + k], _mm256_permute2x128_si256(t0, t2, 0x20));
+                _mm256_storeu_si256((__m256i*) &out[(g + 1) * steps + k], _mm256_permute2x128_si256(t1, t3, 0x20));
+                _mm256_storeu_si256((__m256i*) &out[(g + 2) * steps + k], _mm256_permute2x128_si256(t0, t2, 0x31));
+                _mm256_storeu_si256((__m256i*) &out[(g + 3) * steps + k], _mm256_permute2x128_si256(t1, t3, 0x31));
+            }
+        } else {
+            for (; k < steps; ++k) {
+                _mm256_storeu_si256((__m256i*) &out[k * lanes + g], xoshiro_step_avx2(&s0, &s1, &s2, &s3));
+            }
+        }
+        for (; k < steps; ++k) {
+            uint64_t r[4];
+
+            _mm256_storeu_si256((__m256i*) r, xoshiro_step_avx2(&s0, &s1, &s2, &s3));
+            for (size_t i = 0; i < 4; ++i) out[(g + i) * steps + k] = r[i];
+        }
+
+        _mm256_storeu_si256((__m256i*) &state[g], s0);
+        _mm256_storeu_si256((__m256i*) &state[lanes + g], s1);
+        _mm256_storeu_si256((__m256i*) &state[2 * lanes + g], s2);
+        _mm256_storeu_si256((__m256i*) &state[3 * lanes + g], s3);
+    }
+}
+
+// one step of 8 lanes of xoshiro256++, returns the output
+__attribute__((target("avx512f")))
+static inline
+__m512i xoshiro_step_avx512(__m512i* s0, __m512i* s1, __m512i* s2, __m512i* s3) {
+    const __m512i t = _mm512_slli_epi64(*s1, 17);
+    const __m512i out = _mm512_add_epi64(_mm512_rol_epi64(_mm512_add_epi64(*s0, *s3), 23), *s0);
+
+    *s2 = _mm512_xor_si512(*s2, *s0);
+    *s3 = _mm512_xor_si512(*s3, *s1);
+    *s1 = _mm512_xor_si512(*s1, *s2);
+    *s0 = _mm512_xor_si512(*s0, *s3);
+    *s2 = _mm512_xor_si512(*s2, t);
+    *s3 = _mm512_rol_epi64(*s3, 45);
+    return out;
+}
+
+// like xoshiro_lanes_avx2(), with 8x8 tiles when storing by lane
+__attribute__((target("avx512f")))
+static
+void xoshiro_lanes_avx512(uint64_t* state, size_t lanes, size_t steps, uint64_t* out,
+                          int by_lane) {
+    for (size_t g = 0; g < lanes; g += 8) {
+        __m512i s0 = _mm512_loadu_si512(&state[g]);
+        __m512i s1 = _mm512_loadu_si512(&state[lanes + g]);
+        __m512i s2 = _mm512_loadu_si512(&state[2 * lanes + g]);
+        __m512i s3 = _mm512_loadu_si512(&state[3 * lanes + g]);
+        size_t k = 0;
+
+        if (by_lane) {
+            for (; k + 8 <= steps; k += 8) {
+                __m512i r[8], t[8], u[8];
+
+                for (size_t j = 0; j < 8; ++j) r[j] = xoshiro_step_avx512(&s0, &s1, &s2, &s3);
+
+                // pairs of rows, then 128 bit blocks of 4 rows, then of all 8 rows
+                for (size_t j = 0; j < 8; j += 2) {
+                    t[j] = _mm512_unpacklo_epi64(r[j], r[j + 1]);
+                    t[j + 1] = _mm512_unpackhi_epi64(r[j], r[j + 1]);
+                }
+                for (size_t j = 0; j < 8; j += 4) {
+                    u[j] = _mm512_shuffle_i64x2(t[j], t[j + 2], 0x88);
+                    u[j + 1] = _mm512_shuffle_i64x2(t[j + 1], t[j + 3], 0x88);
+                    u[j + 2] = _mm512_shuffle_i64x2(t[j], t[j + 2], 0xdd);
+                    u[j + 3] = _mm512_shuffle_i64x2(t[j + 1], t[j + 3], 0xdd);
+                }
+                for (size_t j = 0; j < 4; ++j) {
+                    _mm512_storeu_si512(&out[(g + j) * steps + k], _mm512_shuffle_i64x2(u[j], u[j + 4], 0x88));
+                    _mm512_storeu_si512(&out[(g + j + 4) * steps + k], _mm512_shuffle_i64x2(u[j], u[j + 4], 0xdd));
+                }
+            }
+        } else {
+            for (; k < steps; ++k) {
+                _mm512_storeu_si512(&out[k * lanes + g], xoshiro_step_avx512(&s0, &s1, &s2, &s3));
+            }
+        }
+        for (; k < steps; ++k) {
+            uint64_t r[8];
+
+            _mm512_storeu_si512(r, xoshiro_step_avx512(&s0, &s1, &s2, &s3));
+            for (size_t i = 0; i < 8; ++i) out[(g + i) * steps + k] = r[i];
+        }
+
+        _mm512_storeu_si512(&state[g], s0);
+        _mm512_storeu_si512(&state[lanes + g], s1);
+        _mm512_storeu_si512(&state[2 * lanes + g], s2);
+        _mm512_storeu_si512(&state[3 * lanes + g], s3);
+    }
+}
+#endif
+
+// the widest kernels the cpu supports
+static
+void select_kernels() {
+    enum F2LinSimdLevel level = SIMD_AVX512;
+
+    while (!supported(level)) --level;
+    use_kernels(level);
+}
+
+static
+int supported(enum F2LinSimdLevel level) {
+#ifdef SIMD_X86
+    __builtin_cpu_init();
+    if (level == SIMD_AVX512) return __builtin_cpu_supports("avx512f");
+    if (level == SIMD_AVX2) return __builtin_cpu_supports("avx2");
+#endif
+    return level == SIMD_PORTABLE;
+}
+
+static
+void use_kernels(enum F2LinSimdLevel level) {
+    kernel_level = level;
+    xor_words = xor_portable;
+    temper_mt64 = temper_portable;
+    to_double = to_double_portable;
+    to_double_open = to_double_open_portable;
+    to_float = to_float_portable;
+    xoshiro_lanes = xoshiro_lanes_portable;
+    xoshiro_width = 4;
+#ifdef SIMD_X86
+    if (level == SIMD_AVX512) {
+        xor_words = xor_avx512;
+        temper_mt64 = temper_avx512;
+        to_double = to_double_avx512;
+        to_double_open = to_double_open_avx512;
+        to_float = to_float_avx512;
+        xoshiro_lanes = xoshiro_lanes_avx512;
+        xoshiro_width = 8;
+    } else if (level == SIMD_AVX2) {
+        xor_words = xor_avx2;
+        temper_mt64 = temper_avx2;
+        to_double = to_double_avx2;
+        to_double_open = to_double_open_avx2;
+        to_float = to_float_avx2;
+        xoshiro_lanes = xoshiro_lanes_avx2;
+    }
+#endif
+}
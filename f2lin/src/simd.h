@@ -0,0 +1,84 @@
+#ifndef SIMD_H
+#define SIMD_H
+
+#include <stdlib.h>
+#include <stdint.h>
+#include <inttypes.h>
+
+/* alignment of memory returned by f2lin_simd_alloc(), one cache line */
+#define SIMD_ALIGN 64
+
+/**
+ * Returns @param bytes of zeroed memory aligned to SIMD_ALIGN, which can be freed with free().
+ */
+void* f2lin_simd_alloc(size_t bytes);
+
+/**
+ * dst[i] ^= src[i] for all i < @param n. 
+ * Uses AVX-512 or AVX2 if the cpu supports it, which is detected on the first call.
+ */
+void f2lin_simd_xor(uint64_t* dst, const uint64_t* src, size_t n);
+
+/**
+ * Applies the output tempering of MT19937-64 to the @param n state words in src and writes
+ * the results to dst, which may be the same as src. 
+ */
+void f2lin_simd_temper_mt64(uint64_t* dst, const uint64_t* src, size_t n);
+
+/**
+ * Converts the @param n words in src to doubles in [0, 1) from their upper 53 bits, which 
+ * is the same as f2lin_next_double().
+ */
+void f2lin_simd_u64_to_double(double* dst, const uint64_t* src, size_t n);
+
+/**
+ * Converts the @param n words in src to doubles in (0, 1) from their upper 52 bits, 
+ * by adding half of the smallest step.
+ */
+void f2lin_simd_u64_to_double_open(double* dst, const uint64_t* src, size_t n);
+
+/**
+ * Converts the @param n words in src to 2n floats in [0, 1), from the upper 24 bits of 
+ * each 32 bit half. dst[2i] is made from the lower half of src[i], dst[2i + 1] from the 
+ * upper half.
+ */
+void f2lin_simd_u64_to_float(float* dst, const uint64_t* src, size_t n);
+
+/**
+ * Advances @param lanes independent xoshiro256++ generators by @param steps in lockstep.
+ * The state is stored as structure of arrays, word w of lane i is state[w * lanes + i].
+ * The k-th output of lane i is written to out[k * lanes + i], or to out[i * steps + k]
+ * if @param by_lane is set.
+ *
+ * Uses AVX-512 or AVX2 if @param lanes is a multiple of f2lin_simd_xoshiro_width().
+ */
+void f2lin_simd_xoshiro_lanes(uint64_t* state, size_t lanes, size_t steps, uint64_t* out,
+                              int by_lane);
+
+/**
+ * Number of lanes advanced by one vector in f2lin_simd_xoshiro_lanes(), 8 with AVX-512
+ * and 4 otherwise.
+ */
+size_t f2lin_simd_xoshiro_width();
+
+/**
+ * The instruction sets the kernels are written for. On the first call of a function in 
+ * this header, the kernels of the widest one the cpu supports are chosen.
+ */
+enum F2LinSimdLevel {
+    SIMD_PORTABLE = 0, SIMD_AVX2 = 1, SIMD_AVX512 = 2,
+};
+
+/**
+ * Uses the kernels of @param level from now on, e.g. to compare all of them in the tests.
+ * Returns -1 and keeps the kernels in use if the cpu doesn't support @param level.
+ * Must not be called while other threads use the functions of this header.
+ */
+int f2lin_simd_select(enum F2LinSimdLevel level);
+
+/**
+ * The level of the kernels in use.
+ */
+enum F2LinSimdLevel f2lin_simd_level();
+
+#endif
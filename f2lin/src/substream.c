@@ -0,0 +1,131 @@
+#include <limits.h>
+#include <stdio.h>
+
+#include "substream.h"
+#include "advance.h"
+#include "jump_ahead.h"
+#include "jump_matrix.h"
+#include "position.h"
+#include "rng_generic/rng_generic.h"
+
+/*------------------------------------------------------
+ * Forward Declarations                                |
+ /----------------------------------------------------*/
+
+static
+void next_substream(const F2LinSubstreamTable* table, F2LinRngGeneric* rng);
+
+/*------------------------------------------------------
+ * Header Implementations                              |
+ /----------------------------------------------------*/
+
+F2LinSubstreamTable* f2lin_substream_table_init(const F2LinRngGeneric* base, size_t stride,
+                                                size_t ids, F2LinConfig* cfg) {
+    const enum F2LinRngType type = f2lin_rng_generic_type(base);
+    F2LinConfig matrix = { .q = Q_DEFAULT, .algorithm = MATRIX };
+    F2LinSubstreamTable* table;
+
+    if (!stride || !ids) {
+        fprintf(stderr, "Substreams need a stride and ids larger than 0\n");
+        return 0;
+    }
+    if (ids - 1 > SIZE_MAX / stride) {
+        fprintf(stderr, "Offset of substream %zu with stride %zu is too large\n",
+                ids - 1, stride);
+        return 0;
+    }
+
+    // the jumps are used for every substream, so the more expensive MATRIX pays off
+    if (!cfg && f2lin_jump_matrix_supported(type)) cfg = &matrix;
+
+    table = calloc(1, sizeof(F2LinSubstreamTable));
+    table->base = f2lin_rng_generic_init_zero(type);
+    f2lin_rng_generic_copy(table->base, base);
+    table->stride = stride;
+    table->ids = ids;
+    table->iterate = stride < f2lin_advance_cost(type).cached_min;
+    if (base->tracked) table->origin = f2lin_position_track(base)->pos;
+
+    // enough jumps to represent the largest id
+    while ((ids - 1) >> table->n) ++table->n;
+    table->jumps = calloc(table->n ? table->n : 1, sizeof(F2LinJump*));
+    for (size_t k = 0; k < table->n; ++k) {
+        table->jumps[k] = f2lin_jump_ahead_init_rng(base, stride << k, cfg);
+    }
+
+    return table;
+}
+
+F2LinRngGeneric* f2lin_substream_table_position(const F2LinSubstreamTable* table, size_t id,
+                                                F2LinRngGeneric* out) {
+    const enum F2LinRngType type = f2lin_rng_generic_type(table->base);
+
+    if (id >= table->ids) {
+        fprintf(stderr, "Invalid substream %zu, there are %zu substreams\n", id, table->ids);
+        return 0;
+    }
+    if (f2lin_rng_generic_type(out) != type) {
+        fprintf(stderr, "Trying to position a generator of type %s on a substream of %s\n",
+                f2lin_rng_generic_name(f2lin_rng_generic_type(out)),
+                f2lin_rng_generic_name(type));
+        return 0;
+    }
+
+    f2lin_rng_generic_copy(out, table->base);
+    if (out->tracked) f2lin_position_reset(out, table->base, table->origin);
+
+    for (size_t k = 0; k < table->n; ++k) {
+        if ((id >> k) & 1) f2lin_jump_ahead_jump(table->jumps[k], out);
+    }
+    f2lin_position_count(out, id * table->stride);
+    return out;
+}
+
+int f2lin_substream_table_range(const F2LinSubstreamTable* table, size_t first, size_t n,
+                                void* mem) {
+    const enum F2LinRngType type = f2lin_rng_generic_type(table->base);
+    const size_t size = f2lin_rng_generic_sizeof(type);
+    F2LinRngGeneric* prev;
+
+    if (first >= table->ids || n > table->ids - first) {
+        fprintf(stderr, "Invalid substreams %zu..%zu, there are %zu substreams\n",
+                first, first + n - 1, table->ids);
+        return -1;
+    }
+    if (!n) return 0;
+
+    prev = f2lin_rng_generic_init_zero_at(type, mem);
+    f2lin_substream_table_position(table, first, prev);
+
+    for (size_t i = 1; i < n; ++i) {
+        F2LinRngGeneric* rng = f2lin_rng_generic_init_zero_at(type, (char*) mem + i * size);
+
+        f2lin_rng_generic_copy(rng, prev);
+        next_substream(table, rng);
+        prev = rng;
+    }
+    return 0;
+}
+
+void f2lin_substream_table_destroy(F2LinSubstreamTable* table) {
+    if (!table) return;
+
+    for (size_t k = 0; k < table->n; ++k) f2lin_jump_ahead_destroy(table->jumps[k]);
+    free(table->jumps);
+    f2lin_rng_generic_destroy(table->base);
+    free(table);
+}
+
+/*------------------------------------------------------
+ * Internal Implementations                            |
+ /----------------------------------------------------*/
+
+// moves rng from the start of its substream to the start of the next one
+static
+void next_substream(const F2LinSubstreamTable* table, F2LinRngGeneric* rng) {
+    if (table->iterate) {
+        f2lin_rng_generic_skip(rng, table->stride);
+    } else {
+        f2lin_jump_ahead_jump(table->jumps[0], rng);
+    }
+}
@@ -0,0 +1,70 @@
+#ifndef SUBSTREAM_H
+#define SUBSTREAM_H
+
+#include <stdlib.h>
+#include <stdint.h>
+#include <inttypes.h>
+
+#include "config.h"
+
+typedef struct F2LinJump F2LinJump;
+typedef struct F2LinRngGeneric F2LinRngGeneric;
+
+/**
+ * The substreams of a base generator, substream id starts id * stride numbers after base.
+ * jumps[k] jumps by stride * 2^k, so any substream is reached with one jump per set bit of
+ * its id, and n is the number of bits of the largest id.
+ *
+ * If iterate is set, stepping over stride numbers is cheaper than jumping over them (see
+ * f2lin_advance_cost()), which is used for consecutive substreams. origin is the position
+ * of base if it was tracked, and 0 otherwise, see position.h.
+ */
+typedef struct F2LinSubstreamTable F2LinSubstreamTable;
+struct F2LinSubstreamTable {
+    F2LinRngGeneric* base;
+    size_t stride;
+    size_t ids;
+    size_t n;
+    int iterate;
+    F2LinPosition origin;
+    F2LinJump** jumps;
+};
+
+/**
+ * Initializes the jumps for the substreams 0..@param ids - 1 of @param base, which are
+ * @param stride numbers apart. The jumps are for the type and parameters of @param base,
+ * with MATRIX if @param cfg is 0 and the state of @param base is small enough for it.
+ *
+ * Returns 0 if @param stride or @param ids is 0, or if the offset of the last substream
+ * doesn't fit into size_t.
+ */
+F2LinSubstreamTable* f2lin_substream_table_init(const F2LinRngGeneric* base, size_t stride,
+                                                size_t ids, F2LinConfig* cfg);
+
+/**
+ * Sets @param out to the start of substream @param id, which costs one jump per set bit
+ * of @param id. @param out has to be a generator of the type of the base generator.
+ * The table is not modified, so threads can position generators with one table at once.
+ *
+ * A tracked @param out is positioned at origin + id * stride, with base as its checkpoint.
+ *
+ * Returns 0 and leaves @param out unchanged if @param id or the type of @param out is
+ * invalid.
+ */
+F2LinRngGeneric* f2lin_substream_table_position(const F2LinSubstreamTable* table, size_t id,
+                                                F2LinRngGeneric* out);
+
+/**
+ * Initializes the generators of the substreams @param first..@param first + @param n - 1
+ * in place in @param mem (see f2lin_rng_generic_init_zero_at()), one after another with a
+ * stride of f2lin_rng_generic_sizeof(). Only the first one is positioned by its id, every
+ * other one is its predecessor moved by one stride.
+ *
+ * Returns -1 if the range isn't within the substreams of @param table, and 0 otherwise.
+ */
+int f2lin_substream_table_range(const F2LinSubstreamTable* table, size_t first, size_t n,
+                                void* mem);
+
+void f2lin_substream_table_destroy(F2LinSubstreamTable* table);
+
+#endif
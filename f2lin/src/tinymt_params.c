@@ -0,0 +1,253 @@
+// tinymt64_temper() with xor instead of the addition, whose output is F2-linear
+#define LINEARITY_CHECK
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <limits.h>
+
+#include "rng_generic/rng_generic.h"
+#include "lib/tinymt/tinymt.h"
+#include "min_poly.h"
+
+#define F_NAME "tinymtparams.h"
+
+/* number of parameter sets written, which is the number of tinymt streams */
+#define PARAM_SETS 1024
+
+/* the candidates are drawn with splitmix64 from this seed, so the table is reproducible */
+#define SEARCH_SEED 0x5eed7a3b1c2d4e5full
+
+/* the random restarts of the search for tmat are drawn with splitmix64 from this seed */
+#define TMAT_SEED 0x7a3b5eed1c2d4e5full
+
+/* mat1 and mat2 are dropped if no tmat is found with this many restarts */
+#define TMAT_RESTARTS 64
+
+/* the sequence of seed 1 is used for the minimal polynomial, like minpoly.cpp does */
+#define SEED 1
+
+/* bits of the state of tinymt, without the masked highest bit of status[0] */
+#define STATE_BITS 127
+
+/*
+ * the first set is the one of check64.out.txt in the reference implementation of tinymt,
+ * so stream 0 can be checked against its output
+ */
+static const F2LinTinyMTParams reference = { 0xfa051f40, 0xffd0fff4, 0x58d02ffeffbfffbcull };
+
+/*------------------------------------------------------
+ * Forward Declarations                                |
+ /----------------------------------------------------*/
+
+static
+int full_period(const F2LinTinyMTParams* params);
+
+static
+int duplicate(const F2LinTinyMTParams* sets, size_t n, const F2LinTinyMTParams* params);
+
+static
+int search_tmat(F2LinTinyMTParams* params, uint64_t* x);
+
+static
+int delta(const F2LinTinyMTParams* params, int bound);
+
+static
+int independent(uint64_t basis[][2], const uint64_t v[2]);
+
+static
+uint64_t splitmix64(uint64_t* x);
+
+/*------------------------------------------------------
+ * Search                                              |
+ /----------------------------------------------------*/
+
+// searches parameter sets whose transition has an irreducible characteristic polynomial
+// of degree 127, i.e. the maximal period 2^127 - 1 as 2^127 - 1 is prime. Like the 
+// dynamic creator of tinymt, the tempering parameter tmat of every set is then searched 
+// for, until the output is optimally equidistributed, see delta().
+int main(void) {
+    F2LinTinyMTParams* sets = calloc(PARAM_SETS, sizeof(F2LinTinyMTParams));
+    uint64_t x = SEARCH_SEED, y = TMAT_SEED;
+    size_t n = 0, tried = 0;
+    FILE* file;
+
+    if (!full_period(&reference) || delta(&reference, INT_MAX)) {
+        fprintf(stderr, "The reference parameters aren't optimal\n");
+        return EXIT_FAILURE;
+    }
+    sets[n++] = reference;
+
+    while (n < PARAM_SETS) {
+        const uint64_t r = splitmix64(&x);
+        F2LinTinyMTParams params = {
+            .mat1 = (uint32_t) r,
+            .mat2 = (uint32_t) (r >> 32),
+            .tmat = splitmix64(&x),
+        };
+
+        ++tried;
+        // every stream needs its own transition, which only depends on mat1 and mat2
+        if (full_period(&params) && !duplicate(sets, n, &params) && search_tmat(&params, &y)) {
+            sets[n++] = params;
+            if (n % 64 == 0) fprintf(stderr, "%zu parameter sets\n", n);
+        }
+    }
+    printf("%zu parameter sets out of %zu candidates\n", n, tried);
+
+    file = fopen(F_NAME, "w");
+    if (!file) {
+        printf("unable to open file");
+        return EXIT_FAILURE;
+    }
+
+    fprintf(file, "/* written by make tinymt_params, see src/tinymt_params.c. Every set has\n"
+                  " * the maximal period and an optimal equidistribution (delta 0) */\n");
+    fprintf(file, "#define TINYMT_PARAM_SETS %d\n", PARAM_SETS);
+    fprintf(file, "#define TINYMT_PARAMS \\\n");
+    for (size_t i = 0; i < n; ++i) {
+        fprintf(file, "    { 0x%08" PRIx32 ", 0x%08" PRIx32 ", 0x%016" PRIx64 "ull },%s\n",
+                sets[i].mat1, sets[i].mat2, sets[i].tmat, i + 1 < n ? " \\" : "");
+    }
+    fclose(file);
+
+    free(sets);
+    return EXIT_SUCCESS;
+}
+
+/*------------------------------------------------------
+ * Internal Implementations                            |
+ /----------------------------------------------------*/
+
+static
+int full_period(const F2LinTinyMTParams* params) {
+    const long state_size = f2lin_rng_generic_state_size(F2LIN_TINYMT64);
+    F2LinRngGeneric* rng = f2lin_rng_generic_init_zero(F2LIN_TINYMT64);
+    F2LinPoly* p;
+    int full;
+
+    // seeding depends on the parameters, so they are set first
+    f2lin_rng_generic_set_params(rng, params);
+    f2lin_rng_backend_tinymt.init_seed(rng, SEED);
+
+    p = f2lin_min_poly_compute(rng);
+    full = f2lin_poly_deg(p) == state_size && f2lin_min_poly_irreducible(p) == 1;
+
+    f2lin_poly_destroy(p);
+    f2lin_rng_generic_destroy(rng);
+    return full;
+}
+
+static
+int duplicate(const F2LinTinyMTParams* sets, size_t n, const F2LinTinyMTParams* params) {
+    for (size_t i = 0; i < n; ++i) {
+        if (sets[i].mat1 == params->mat1 && sets[i].mat2 == params->mat2) return 1;
+    }
+    return 0;
+}
+
+// flips single bits of tmat while that lowers delta(), starting from params->tmat, and 
+// restarts from a tmat drawn from x when no bit does. Sets a tmat with delta 0 and returns
+// 1, or returns 0 if none was found
+static
+int search_tmat(F2LinTinyMTParams* params, uint64_t* x) {
+    F2LinTinyMTParams p = *params;
+    int d = delta(&p, INT_MAX);
+
+    for (int restarts = 0; d && restarts < TMAT_RESTARTS; ) {
+        int improved = 0;
+
+        for (int b = 0; b < 64 && d; ++b) {
+            F2LinTinyMTParams c = p;
+            int e;
+
+            c.tmat ^= 1ull << b;
+            e = delta(&c, d - 1);
+            if (e < d) {
+                p = c;
+                d = e;
+                improved = 1;
+            }
+        }
+
+        if (!improved && d) {
+            p.tmat = splitmix64(x);
+            d = delta(&p, INT_MAX);
+            ++restarts;
+        }
+    }
+
+    if (d) return 0;
+    params->tmat = p.tmat;
+    return 1;
+}
+
+// the total dimension defect of the equidistribution of the F2-linearized output, the 
+// sum over v = 1..64 of floor(127 / v) - k(v), where k(v) is the largest k for which the 
+// upper v bits of k consecutive outputs take every value equally often over the period.
+// That is the case if they are k * v linearly independent functions of the state. Stops
+// counting once the sum exceeds bound
+static
+int delta(const F2LinTinyMTParams* params, int bound) {
+    // bit j of f[i][b] is bit b of output i for the state with only bit j set
+    static uint64_t f[STATE_BITS][64][2];
+    static uint64_t basis[128][2];
+    int d = 0;
+
+    memset(f, 0, sizeof(f));
+    for (int j = 0; j < STATE_BITS; ++j) {
+        tinymt64_t t = { .mat1 = params->mat1, .mat2 = params->mat2, .tmat = params->tmat };
+
+        // bit 63 of status[0] is masked by tinymt64_next_state()
+        if (j < 63) t.status[0] = 1ull << j;
+        else t.status[1] = 1ull << (j - 63);
+
+        for (int i = 0; i < STATE_BITS; ++i) {
+            tinymt64_next_state(&t);
+            for (uint64_t o = tinymt64_temper(&t); o; o &= o - 1) {
+                f[i][__builtin_ctzll(o)][j / 64] |= 1ull << (j % 64);
+            }
+        }
+    }
+
+    for (int v = 1; v <= 64 && d <= bound; ++v) {
+        int k = 0;
+
+        memset(basis, 0, sizeof(basis));
+        for (int ok = 1; ok && k < STATE_BITS / v; k += ok) {
+            for (int b = 63; b >= 64 - v && ok; --b) ok = independent(basis, f[k][b]);
+        }
+        d += STATE_BITS / v - k;
+    }
+
+    return d > bound ? bound + 1 : d;
+}
+
+// reduces v by the echelon basis, whose vector basis[i] has its highest bit at i. Adds it
+// and returns 1 if it is independent of the basis
+static
+int independent(uint64_t basis[][2], const uint64_t v[2]) {
+    uint64_t r[2] = { v[0], v[1] };
+
+    while (r[0] || r[1]) {
+        const int i = r[1] ? 127 - __builtin_clzll(r[1]) : 63 - __builtin_clzll(r[0]);
+
+        if (!basis[i][0] && !basis[i][1]) {
+            basis[i][0] = r[0];
+            basis[i][1] = r[1];
+            return 1;
+        }
+        r[0] ^= basis[i][0];
+        r[1] ^= basis[i][1];
+    }
+    return 0;
+}
+
+static
+uint64_t splitmix64(uint64_t* x) {
+    uint64_t z = (*x += 0x9e3779b97f4a7c15ull);
+
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+    return z ^ (z >> 31);
+}
@@ -0,0 +1,326 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <float.h>
+#include <time.h>
+#include <pthread.h>
+
+#include "tune.h"
+#include "jump_ahead.h"
+#include "jump_file.h"
+#include "rng_generic/rng_generic.h"
+
+/* every configuration is measured this many times, the fastest run counts */
+#define TUNE_REPETITIONS 3
+
+/*------------------------------------------------------
+ * Forward Declarations                                |
+ /----------------------------------------------------*/
+
+static
+double time_config(enum F2LinRngType type, size_t jump_size, const F2LinConfig* cfg, 
+                   double min_time);
+
+static
+void measure_bucket(enum F2LinRngType type, int bits, double min_time, 
+                    F2LinTuneEntry* entry);
+
+static
+int find_type(const F2LinTuneProfile* profile, enum F2LinRngType* type);
+
+static
+size_t bucket_jump_size(int bits);
+
+static
+int bit_length(size_t n);
+
+static
+void load_env();
+
+static
+double now();
+
+/*------------------------------------------------------
+ * Loaded Profile                                      |
+ /----------------------------------------------------*/
+
+// protects everything below
+static pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_once_t env_once = PTHREAD_ONCE_INIT;
+
+static F2LinTuneProfile* loaded[F2LIN_RNG_TYPES] = { 0 };
+// set once a profile was loaded or unloaded explicitly, which takes precedence over the env
+static int loaded_explicitly = 0;
+
+/*------------------------------------------------------
+ * Header Implementations                              |
+ /----------------------------------------------------*/
+
+F2LinTuneProfile* f2lin_tune_profile_measure(enum F2LinRngType type, double min_time) {
+    F2LinTuneProfile* profile = calloc(1, sizeof(F2LinTuneProfile));
+    const int measured = bit_length(f2lin_rng_generic_state_size(type)) + 1;
+
+    profile->type = type;
+    profile->state_size = f2lin_rng_generic_state_size(type);
+    profile->checksum = f2lin_jump_file_checksum(type);
+
+    for (int b = 0; b < TUNE_BUCKETS; ++b) {
+        if (b <= measured) measure_bucket(type, b, min_time, &profile->entries[b]);
+        else profile->entries[b] = profile->entries[measured];
+    }
+
+    return profile;
+}
+
+int f2lin_tune_profile_write(const F2LinTuneProfile* profile, const char* path) {
+    char* tmp_path = malloc(strlen(path) + 5);
+    FILE* f;
+    int ok;
+
+    // like jump files, the profile is never seen half written
+    sprintf(tmp_path, "%s.tmp", path);
+    f = fopen(tmp_path, "w");
+    if (!f) {
+        fprintf(stderr, "Unable to open %s for writing the tuning profile\n", tmp_path);
+        free(tmp_path);
+        return -1;
+    }
+
+    ok = fprintf(f, "%s %d\n", TUNE_FILE_MAGIC, TUNE_FILE_VERSION) > 0;
+    ok = ok && fprintf(f, "state_size %ld\n", profile->state_size) > 0;
+    ok = ok && fprintf(f, "checksum %" PRIu64 "\n", profile->checksum) > 0;
+    ok = ok && fprintf(f, "bits algorithm q seconds\n") > 0;
+
+    for (int b = 0; ok && b < TUNE_BUCKETS; ++b) {
+        const F2LinTuneEntry* e = &profile->entries[b];
+        ok = fprintf(f, "%d %d %d %.3e\n", b, e->algorithm, e->q, e->seconds) > 0;
+    }
+
+    ok = !fclose(f) && ok;
+    ok = ok && !rename(tmp_path, path);
+
+    if (!ok) {
+        fprintf(stderr, "Unable to write the tuning profile to %s\n", path);
+        remove(tmp_path);
+    }
+
+    free(tmp_path);
+    return ok ? 0 : -1;
+}
+
+F2LinTuneProfile* f2lin_tune_profile_read(const char* path) {
+    F2LinTuneProfile* profile;
+    char magic[16];
+    int version;
+    FILE* f = fopen(path, "r");
+
+    if (!f) {
+        fprintf(stderr, "Unable to open tuning profile %s\n", path);
+        return 0;
+    }
+
+    profile = calloc(1, sizeof(F2LinTuneProfile));
+
+    if (fscanf(f, "%15s %d", magic, &version) != 2 || strcmp(magic, TUNE_FILE_MAGIC)
+        || version != TUNE_FILE_VERSION) {
+        fprintf(stderr, "%s is not a tuning profile of this version\n", path);
+        goto error;
+    }
+
+    if (fscanf(f, " state_size %ld checksum %" SCNu64 " bits algorithm q seconds",
+               &profile->state_size, &profile->checksum) != 2) {
+        fprintf(stderr, "Invalid header in tuning profile %s\n", path);
+        goto error;
+    }
+
+    if (!find_type(profile, &profile->type)) {
+        fprintf(stderr, "Tuning profile %s was measured for an unknown generator\n", path);
+        goto error;
+    }
+
+    for (int b = 0; b < TUNE_BUCKETS; ++b) {
+        F2LinTuneEntry* e = &profile->entries[b];
+        int bits, algorithm;
+
+        if (fscanf(f, "%d %d %d %lf", &bits, &algorithm, &e->q, &e->seconds) != 4
+            || bits != b || algorithm < HORNER || algorithm > MATRIX
+            || (e->q < 1 && e->q != Q_AUTO) || e->q > Q_MAX) {
+            fprintf(stderr, "Invalid entry for %d bits in tuning profile %s\n", b, path);
+            goto error;
+        }
+        e->algorithm = algorithm;
+    }
+
+    fclose(f);
+    return profile;
+
+error:
+    fclose(f);
+    free(profile);
+    return 0;
+}
+
+void f2lin_tune_profile_destroy(F2LinTuneProfile* profile) {
+    free(profile);
+}
+
+int f2lin_tune_profile_load(const char* path) {
+    F2LinTuneProfile* profile = 0;
+
+    if (path && !(profile = f2lin_tune_profile_read(path))) return -1;
+
+    pthread_mutex_lock(&lock);
+    if (profile) {
+        f2lin_tune_profile_destroy(loaded[profile->type]);
+        loaded[profile->type] = profile;
+    } else {
+        for (int t = 0; t < F2LIN_RNG_TYPES; ++t) {
+            f2lin_tune_profile_destroy(loaded[t]);
+            loaded[t] = 0;
+        }
+    }
+    loaded_explicitly = 1;
+    pthread_mutex_unlock(&lock);
+
+    return 0;
+}
+
+int f2lin_tune_config(enum F2LinRngType type, size_t jump_size, F2LinConfig* cfg) {
+    int found = 0;
+
+    pthread_once(&env_once, load_env);
+
+    pthread_mutex_lock(&lock);
+    if (loaded[type]) {
+        const F2LinTuneEntry* e = &loaded[type]->entries[bit_length(jump_size)];
+        cfg->algorithm = e->algorithm;
+        cfg->q = e->q;
+        found = 1;
+    }
+    pthread_mutex_unlock(&lock);
+
+    return found;
+}
+
+/*------------------------------------------------------
+ * Internal Implementations                            |
+ /----------------------------------------------------*/
+
+// average time per jump of the fastest repetition
+static
+double time_config(enum F2LinRngType type, size_t jump_size, const F2LinConfig* cfg, 
+                   double min_time) {
+    F2LinConfig c = *cfg;
+    F2LinRngGeneric* rng = f2lin_rng_generic_init(type);
+    F2LinJump* jump = f2lin_jump_ahead_init(type, jump_size, &c);
+    double best = DBL_MAX;
+
+    for (int rep = 0; rep < TUNE_REPETITIONS; ++rep) {
+        const double start = now();
+        double elapsed;
+        size_t n = 0;
+
+        do {
+            f2lin_jump_ahead_jump(jump, rng);
+            ++n;
+        } while ((elapsed = now() - start) < min_time);
+
+        if (elapsed / n < best) best = elapsed / n;
+    }
+
+    f2lin_jump_ahead_destroy(jump);
+    f2lin_rng_generic_destroy(rng);
+    return best;
+}
+
+static
+void measure_bucket(enum F2LinRngType type, int bits, double min_time, 
+                    F2LinTuneEntry* entry) {
+    const size_t jump_size = bucket_jump_size(bits);
+    const enum F2LinJumpAlgorithm windowed[] = { SLIDING_WINDOW, SLIDING_WINDOW_DECOMP };
+    F2LinConfig cfg = { .algorithm = HORNER, .q = Q_AUTO, .poly_method = POWER_MOD };
+
+    // q has no effect on horner
+    entry->algorithm = HORNER;
+    entry->q = Q_AUTO;
+    entry->seconds = time_config(type, jump_size, &cfg, min_time);
+
+    for (size_t i = 0; i < sizeof(windowed) / sizeof(windowed[0]); ++i) {
+        for (int q = TUNE_Q_MIN; q <= Q_MAX; ++q) {
+            double seconds;
+
+            cfg.algorithm = windowed[i];
+            cfg.q = q;
+            seconds = time_config(type, jump_size, &cfg, min_time);
+
+            if (seconds < entry->seconds) {
+                entry->algorithm = windowed[i];
+                entry->q = q;
+                entry->seconds = seconds;
+            }
+        }
+    }
+}
+
+// a jump size with a bit length of bits, with a mix of set and unset lower bits
+static
+size_t bucket_jump_size(int bits) {
+    size_t top;
+
+    if (bits == 0) return 0;
+
+    top = (size_t) 1 << (bits - 1);
+    return top | (0x9e3779b97f4a7c15ull & (top - 1));
+}
+
+static
+int find_type(const F2LinTuneProfile* profile, enum F2LinRngType* type) {
+    for (int t = 0; t < F2LIN_RNG_TYPES; ++t) {
+        if (profile->state_size == f2lin_rng_generic_state_size(t) &&
+            profile->checksum == f2lin_jump_file_checksum(t)) {
+            *type = t;
+            return 1;
+        }
+    }
+    return 0;
+}
+
+static
+int bit_length(size_t n) {
+    return n ? 64 - __builtin_clzll(n) : 0;
+}
+
+static
+void load_env() {
+    const char* env = getenv(TUNE_PROFILE_ENV);
+    char* paths;
+
+    if (!env || !*env) return;
+
+    // one profile per path, separated by ':' 
+    paths = strdup(env);
+    for (char* save = 0, *path = strtok_r(paths, ":", &save); path; 
+         path = strtok_r(0, ":", &save)) {
+        // a missing or invalid profile is reported, and the defaults are used
+        F2LinTuneProfile* profile = f2lin_tune_profile_read(path);
+
+        if (!profile) continue;
+
+        pthread_mutex_lock(&lock);
+        if (!loaded_explicitly && !loaded[profile->type]) {
+            loaded[profile->type] = profile;
+            profile = 0;
+        }
+        pthread_mutex_unlock(&lock);
+
+        f2lin_tune_profile_destroy(profile);
+    }
+    free(paths);
+}
+
+static
+double now() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
@@ -0,0 +1,90 @@
+#ifndef TUNE_H
+#define TUNE_H
+
+#include <stdlib.h>
+#include <stdint.h>
+#include <inttypes.h>
+
+#include "config.h"
+
+#define TUNE_FILE_MAGIC "f2lin-tune"
+#define TUNE_FILE_VERSION 1
+#define TUNE_PROFILE_ENV "F2LIN_TUNE_PROFILE"
+
+/* one entry for every bit length of the jump size, 0 - 64 */
+#define TUNE_BUCKETS 65
+#define TUNE_Q_MIN 2
+
+/* minimum time a configuration is measured for, in seconds */
+#define TUNE_MIN_TIME_DEFAULT 2e-3
+
+/**
+ * The fastest configuration for jump sizes of one bit length, and the time it took per jump.
+ */
+typedef struct F2LinTuneEntry F2LinTuneEntry;
+struct F2LinTuneEntry {
+    enum F2LinJumpAlgorithm algorithm;
+    int q;
+    double seconds;
+};
+
+/**
+ * Tuning profile of one type of generator, identified like in jump files by its state size
+ * and the checksum of its minimal polynomial (see jump_file.h).
+ *
+ * entries[b] is used for jump sizes with a bit length of b. All jump sizes larger than the
+ * state size have a dense jump polynomial and cost the same, so only the bit lengths up to
+ * one above the one of the state size are measured, and the larger ones are copied.
+ */
+typedef struct F2LinTuneProfile F2LinTuneProfile;
+struct F2LinTuneProfile {
+    enum F2LinRngType type;
+    long state_size;
+    uint64_t checksum;
+    F2LinTuneEntry entries[TUNE_BUCKETS];
+};
+
+/**
+ * Measures the jump of HORNER, and of SLIDING_WINDOW and SLIDING_WINDOW_DECOMP for q in
+ * TUNE_Q_MIN - Q_MAX for generators of @param type. Every configuration is timed for at 
+ * least @param min_time seconds per jump size.
+ */
+F2LinTuneProfile* f2lin_tune_profile_measure(enum F2LinRngType type, double min_time);
+
+/**
+ * Writes @param profile as text to the file at @param path, replacing it.
+ * Returns 0 on success and -1 on failure.
+ */
+int f2lin_tune_profile_write(const F2LinTuneProfile* profile, const char* path);
+
+/**
+ * Reads a profile written by f2lin_tune_profile_write(), and sets its type to the generator
+ * it was measured for. Returns 0 if the file can't be read, or if it was measured for a 
+ * generator which isn't part of the library.
+ */
+F2LinTuneProfile* f2lin_tune_profile_read(const char* path);
+
+void f2lin_tune_profile_destroy(F2LinTuneProfile* profile);
+
+/**
+ * Loads the profile at @param path and uses it for jumps of the generator it was measured 
+ * for which are initialized without a config, replacing a previously loaded one of the 
+ * same generator. If @param path is 0, all profiles are unloaded and the defaults from 
+ * config.h are used again.
+ *
+ * If no profile was loaded explicitly, the ones at $F2LIN_TUNE_PROFILE are loaded on the
+ * first jump initialized without a config. It can contain several paths separated by ':',
+ * e.g. one profile for every generator used.
+ *
+ * Returns 0 on success and -1 if the profile can't be read.
+ */
+int f2lin_tune_profile_load(const char* path);
+
+/**
+ * Sets algorithm and q of @param cfg to the fastest configuration for @param jump_size
+ * of the profile loaded for @param type. Returns 1 if a profile is loaded, otherwise 0 
+ * and @param cfg is left unchanged.
+ */
+int f2lin_tune_config(enum F2LinRngType type, size_t jump_size, F2LinConfig* cfg);
+
+#endif
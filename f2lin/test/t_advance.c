@@ -0,0 +1,129 @@
+#define TEST
+#include <stdio.h>
+#include "minunit.h"
+#include "config.h"
+#include "f2lin.h"
+#include "advance.h"
+#include "jump_ahead.h"
+#include "jump_cache.h"
+#include "rng_generic/rng_generic.h"
+
+#define SEED 12323456
+
+int tests_run = 0;
+
+static int test_advance(size_t n) {
+    int ret;
+    F2LinRngGeneric* rng = f2lin_rng_init_type(RNG_TYPE, SEED);
+    F2LinRngGeneric* iter = f2lin_rng_init_type(RNG_TYPE, SEED);
+
+    f2lin_advance(rng, n);
+    for (size_t i = 0; i < n; ++i) f2lin_next_unsigned(iter);
+    ret = f2lin_rng_generic_compare_state(rng, iter) &&
+          f2lin_next_unsigned(rng) == f2lin_next_unsigned(iter);
+
+    f2lin_rng_destroy(rng);
+    f2lin_rng_destroy(iter);
+    return ret;
+}
+
+static char* test_advance_equals_iteration() {
+    // around the state sizes and above the thresholds of the measured cost models
+    const size_t sizes[] = { 0, 1, 63, 64, 65, 127, 256, 1000, 19937, 123457, 2000000 };
+    printf("Testing advancing against iterating\n");
+
+    for (size_t i = 0; i < sizeof(sizes) / sizeof(sizes[0]); ++i) {
+        mu_assert("Wrong result when advancing", test_advance(sizes[i]));
+        // the second time the jump parameters may be cached
+        mu_assert("Wrong result when advancing again", test_advance(sizes[i]));
+    }
+    return 0;
+}
+
+static char* test_methods() {
+    const F2LinAdvanceCost cost = { .step = 1e-9, .apply = 1e-6, .init = 1e-4 };
+    const size_t state_size = f2lin_rng_generic_state_size(RNG_TYPE);
+    F2LinRngGeneric* rng = f2lin_rng_init_type(RNG_TYPE, SEED);
+    F2LinAdvanceCost c;
+    F2LinJump* jump;
+    size_t between, above;
+    printf("Testing the choice of the method\n");
+
+    f2lin_jump_cache_clear();
+    f2lin_advance_set_cost(RNG_TYPE, &cost);
+    c = f2lin_advance_cost(RNG_TYPE);
+    // apply / step = 1000 and (init + apply) / step = 101000, up to rounding
+    mu_assert("Wrong threshold for cached jumps",
+              c.cached_min == state_size || (state_size <= 1000 && c.cached_min - 1000 <= 1));
+    mu_assert("Wrong threshold for fresh jumps", c.fresh_min - 101000 <= 1);
+
+    between = c.cached_min + 12345;
+    above = c.fresh_min + 12345;
+    mu_assert("Short distances have to be iterated",
+              f2lin_advance_method(rng, 10) == ADVANCE_ITERATE);
+    mu_assert("Uncached distances below fresh_min have to be iterated",
+              f2lin_advance_method(rng, between) == ADVANCE_ITERATE);
+    mu_assert("Long distances have to be jumped",
+              f2lin_advance_method(rng, above) == ADVANCE_FRESH_JUMP);
+
+    // the first fresh jump by a distance isn't cached, the second one fills the cache, 
+    // and a jump held by the caller can be reused
+    mu_assert("Wrong result after a fresh jump", test_advance(above));
+    mu_assert("A distance jumped once shouldn't be cached",
+              f2lin_advance_method(rng, above) == ADVANCE_FRESH_JUMP);
+    mu_assert("Wrong result after a repeated fresh jump", test_advance(above));
+    mu_assert("Advancing again should use the cache",
+              f2lin_advance_method(rng, above) == ADVANCE_CACHED_JUMP);
+    jump = f2lin_jump_ahead_init(RNG_TYPE, between, 0);
+    mu_assert("Cached distances above cached_min should be jumped",
+              f2lin_advance_method(rng, between) == ADVANCE_CACHED_JUMP);
+    mu_assert("Wrong result after a cached jump", test_advance(between));
+    f2lin_jump_ahead_destroy(jump);
+
+    // without a cache every jump is fresh
+    f2lin_jump_cache_set_limit(0);
+    mu_assert("Used a cached jump with a disabled cache",
+              f2lin_advance_method(rng, between) == ADVANCE_ITERATE);
+    mu_assert("Wrong result without a cache", test_advance(above));
+    f2lin_jump_cache_set_limit(JUMP_CACHE_LIMIT_DEFAULT);
+
+    f2lin_advance_set_cost(RNG_TYPE, 0);
+    f2lin_rng_destroy(rng);
+    return 0;
+}
+
+static char* test_calibration() {
+    const size_t state_size = f2lin_rng_generic_state_size(RNG_TYPE);
+    F2LinAdvanceCost c;
+    printf("Testing the measured cost model\n");
+
+    c = f2lin_advance_cost(RNG_TYPE);
+    mu_assert("Costs have to be measured", c.step > 0 && c.apply > 0 && c.init > 0);
+    mu_assert("Jumps below the state size can't be cheaper", c.cached_min >= state_size);
+    mu_assert("Fresh jumps can't be cheaper than cached ones", c.fresh_min >= c.cached_min);
+    printf("step: %5.2e s, apply: %5.2e s, init: %5.2e s, cached_min: %zu, fresh_min: %zu\n",
+           c.step, c.apply, c.init, c.cached_min, c.fresh_min);
+    return 0;
+}
+
+static char* all_tests() {
+    mu_run_test(test_advance_equals_iteration);
+    mu_run_test(test_methods);
+    mu_run_test(test_calibration);
+
+    return 0;
+}
+
+int main(void) {
+    char* result = all_tests();
+
+    if (result != 0) {
+        printf("%s\n", result);
+    } else {
+        printf("ALL TESTS PASSED\n");
+    }
+
+    printf("Tests run: %d\n", tests_run);
+
+    return result == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,131 @@
+#define TEST
+#include <stdio.h>
+#include <string.h>
+#include <random>
+#include "minunit.h"
+#include "config.h"
+#include "f2lin.h"
+#include "f2lin.hpp"
+#include "rng_generic/rng_generic.h"
+
+// minunit returns the messages as char*
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+
+#define SEED 12323456
+
+int tests_run = 0;
+
+static_assert(f2lin::xorshift64_engine::min() == 0, "min() has to be constexpr");
+static_assert(f2lin::mt19937_64_engine::max() == UINT64_MAX, "max() has to be constexpr");
+static_assert(f2lin::tinymt64::type == F2LIN_TINYMT64, "the type has to be constexpr");
+
+// the engine has to produce the same stream as the generator of the library
+template <class Backend>
+static int same_stream(enum F2LinRngType type) {
+    f2lin::engine<Backend> seeded(SEED), init;
+    F2LinRngGeneric* rng = f2lin_rng_init_type(type, SEED);
+    F2LinRngGeneric* generic = f2lin_rng_generic_init(type);
+    int equal = 1;
+
+    for (size_t i = 0; i < 1000; ++i) {
+        equal = equal && seeded() == f2lin_next_unsigned(rng);
+        equal = equal && init() == f2lin_rng_generic_gen64(generic);
+    }
+
+    f2lin_rng_destroy(rng);
+    f2lin_rng_generic_destroy(generic);
+    return equal;
+}
+
+template <class Backend>
+static int discard_equals_iteration() {
+    const unsigned long long sizes[] = { 0, 1, 17, 1000, 123457, 2000000 };
+
+    for (size_t i = 0; i < sizeof(sizes) / sizeof(sizes[0]); ++i) {
+        f2lin::engine<Backend> jump(SEED), iter(SEED);
+
+        // the position of mt within its state is arbitrary before the jump
+        jump();
+        iter();
+        jump.discard(sizes[i]);
+        for (unsigned long long k = 0; k < sizes[i]; ++k) iter();
+        if (jump != iter || jump() != iter()) return 0;
+    }
+    return 1;
+}
+
+static char* test_streams() {
+    printf("Testing the streams of the engines\n");
+
+    mu_assert("Wrong stream for xorshift64", same_stream<f2lin::xorshift64>(F2LIN_XORSHIFT64));
+    mu_assert("Wrong stream for mt19937-64", same_stream<f2lin::mt19937_64>(F2LIN_MT19937));
+    mu_assert("Wrong stream for tinymt64", same_stream<f2lin::tinymt64>(F2LIN_TINYMT64));
+    mu_assert("Wrong stream for xoshiro256++",
+              same_stream<f2lin::xoshiro256pp>(F2LIN_XOSHIRO256PP));
+    return 0;
+}
+
+static char* test_discard() {
+    printf("Testing discard\n");
+
+    mu_assert("Wrong discard for xorshift64", discard_equals_iteration<f2lin::xorshift64>());
+    mu_assert("Wrong discard for mt19937-64", discard_equals_iteration<f2lin::mt19937_64>());
+    mu_assert("Wrong discard for tinymt64", discard_equals_iteration<f2lin::tinymt64>());
+    mu_assert("Wrong discard for xoshiro256++", discard_equals_iteration<f2lin::xoshiro256pp>());
+    return 0;
+}
+
+static char* test_discard_cached() {
+    f2lin::mt19937_64_engine a(SEED), b(SEED);
+    F2LinJumpCacheStats stats;
+    printf("Testing discard with the jump cache\n");
+
+    f2lin_cache_clear();
+    a.discard(2000000);
+    b.discard(2000000);
+    f2lin_cache_stats(&stats);
+    mu_assert("Discarding the same distance again should hit the cache",
+              stats.misses == 1 && stats.hits == 1);
+    mu_assert("Wrong discard with a cached jump polynomial", a == b && a() == b());
+    return 0;
+}
+
+static char* test_distribution() {
+    f2lin::mt19937_64_engine a(SEED), b(SEED);
+    std::uniform_int_distribution<int> dice(1, 6);
+    std::uniform_real_distribution<double> unit;
+    printf("Testing the engines with distributions of <random>\n");
+
+    for (size_t i = 0; i < 1000; ++i) {
+        const int x = dice(a);
+        const double u = unit(a);
+
+        mu_assert("Wrong range of a uniform_int_distribution", x >= 1 && x <= 6);
+        mu_assert("Wrong range of a uniform_real_distribution", u >= 0.0 && u < 1.0);
+        mu_assert("Distribution isn't deterministic", x == dice(b) && u == unit(b));
+    }
+    return 0;
+}
+
+static char* all_tests() {
+    mu_run_test(test_streams);
+    mu_run_test(test_discard);
+    mu_run_test(test_discard_cached);
+    mu_run_test(test_distribution);
+
+    return 0;
+}
+
+int main(void) {
+    char* result = all_tests();
+
+    if (result != 0) {
+        printf("%s\n", result);
+    } else {
+        printf("ALL TESTS PASSED\n");
+    }
+
+    printf("Tests run: %d\n", tests_run);
+
+    return result == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,248 @@
+#define TEST
+#include <stdio.h>
+#include <string.h>
+#include "minunit.h"
+#include "f2poly.h"
+
+int tests_run = 0;
+
+static uint64_t s = 88172645463325252ull;
+
+static uint64_t next() {
+    s ^= s << 13;
+    s ^= s >> 7;
+    s ^= s << 17;
+    return s;
+}
+
+static F2LinPoly* rand_poly(long deg) {
+    F2LinPoly* p = f2lin_poly_init();
+    for (long i = 0; i < deg; ++i) f2lin_poly_set_coeff(p, i, next() & 1);
+    f2lin_poly_set_coeff(p, deg, 1);
+    return p;
+}
+
+// r = a * b mod f, one coefficient at a time
+static void naive_mul_mod(F2LinPoly* r, const F2LinPoly* a, const F2LinPoly* b,
+                          const F2LinPoly* f) {
+    const long n = f2lin_poly_deg(f);
+    F2LinPoly* acc = f2lin_poly_init();
+    F2LinPoly* xa = f2lin_poly_copy(f2lin_poly_init(), a);
+
+    for (long i = 0; i <= f2lin_poly_deg(b); ++i) {
+        F2LinPoly* t = f2lin_poly_init();
+
+        if (f2lin_poly_coeff(b, i)) f2lin_poly_add(acc, acc, xa);
+
+        // xa = xa * x mod f
+        for (long j = 0; j <= f2lin_poly_deg(xa); ++j) {
+            if (f2lin_poly_coeff(xa, j)) f2lin_poly_set_coeff(t, j + 1, 1);
+        }
+        if (f2lin_poly_coeff(t, n)) f2lin_poly_add(t, t, f);
+        f2lin_poly_copy(xa, t);
+        f2lin_poly_destroy(t);
+    }
+
+    f2lin_poly_copy(r, acc);
+    f2lin_poly_destroy(acc);
+    f2lin_poly_destroy(xa);
+}
+
+static char* test_arithmetic() {
+    // degrees around word boundaries, and large enough to use karatsuba
+    long degs[] = { 2, 5, 63, 64, 65, 127, 128, 256, 700, 1500, 3000 };
+
+    for (size_t k = 0; k < sizeof(degs) / sizeof(degs[0]); ++k) {
+        const long n = degs[k];
+        F2LinPoly* f = rand_poly(n);
+        F2LinPolyMod* F = f2lin_poly_mod_init(f);
+        F2LinPoly* r = f2lin_poly_init();
+        F2LinPoly* expected = f2lin_poly_init();
+
+        for (int t = 0; t < 4; ++t) {
+            F2LinPoly* a = rand_poly(next() % n);
+            F2LinPoly* b = rand_poly(next() % n);
+            F2LinPoly* x = f2lin_poly_init();
+            uint64_t e = next() % 100000;
+
+            f2lin_poly_mul_mod(r, a, b, F);
+            naive_mul_mod(expected, a, b, f);
+            mu_assert("Wrong result for f2lin_poly_mul_mod", f2lin_poly_equal(r, expected));
+
+            f2lin_poly_sqr_mod(r, a, F);
+            naive_mul_mod(expected, a, a, f);
+            mu_assert("Wrong result for f2lin_poly_sqr_mod", f2lin_poly_equal(r, expected));
+
+            // reducing a polynomial of degree > 2n needs to fall back to long division
+            f2lin_poly_mul(r, a, b);
+            f2lin_poly_mul(r, r, a);
+            f2lin_poly_sqr(r, r);
+            f2lin_poly_rem(r, r, F);
+            naive_mul_mod(expected, a, b, f);
+            naive_mul_mod(expected, expected, a, f);
+            naive_mul_mod(expected, expected, expected, f);
+            mu_assert("Wrong result for f2lin_poly_rem", f2lin_poly_equal(r, expected));
+
+            f2lin_poly_set_coeff(x, 1, 1);
+            f2lin_poly_power_x_mod(r, e, F);
+            f2lin_poly_power_mod(expected, x, e, F);
+            mu_assert("f2lin_poly_power_x_mod differs from f2lin_poly_power_mod",
+                      f2lin_poly_equal(r, expected));
+
+            f2lin_poly_destroy(a);
+            f2lin_poly_destroy(b);
+            f2lin_poly_destroy(x);
+        }
+
+        f2lin_poly_destroy(r);
+        f2lin_poly_destroy(expected);
+        f2lin_poly_destroy(f);
+        f2lin_poly_mod_destroy(F);
+    }
+
+    return 0;
+}
+
+static char* test_power_x_mod() {
+    // x^(2^k) mod (x^2 + x + 1) cycles through x and x + 1
+    F2LinPoly* f = f2lin_poly_init_from_string("111");
+    F2LinPolyMod* F = f2lin_poly_mod_init(f);
+    F2LinPoly* r = f2lin_poly_init();
+
+    f2lin_poly_power_x_mod(r, 0, F);
+    mu_assert("x^0 should be 1", f2lin_poly_deg(r) == 0);
+    f2lin_poly_power_x_mod(r, 3, F);
+    mu_assert("x^3 should be 1", f2lin_poly_deg(r) == 0);
+    f2lin_poly_power_x_mod(r, 1ull << 63, F);
+    mu_assert("x^(2^63) should be x + 1", f2lin_poly_deg(r) == 1 && f2lin_poly_coeff(r, 0));
+
+    f2lin_poly_destroy(r);
+    f2lin_poly_destroy(f);
+    f2lin_poly_mod_destroy(F);
+
+    return 0;
+}
+
+static char* test_window() {
+    F2LinPoly* p = rand_poly(300);
+
+    for (long lo = 0; lo < 300; lo += 7) {
+        for (int q = 0; q <= 10; ++q) {
+            uint64_t expected = 0;
+            for (int j = q - 1; j >= 0; --j) expected = (expected << 1) | f2lin_poly_coeff(p, lo + j);
+            mu_assert("Wrong window", f2lin_poly_window(p, lo, q) == expected);
+        }
+    }
+
+    for (long i = -1; i < 400; ++i) {
+        long expected = i < 300 ? i : 300;
+        while (expected >= 0 && !f2lin_poly_coeff(p, expected)) --expected;
+        mu_assert("Wrong previous nonzero coefficient", f2lin_poly_prev_set(p, i) == expected);
+    }
+
+    f2lin_poly_destroy(p);
+
+    return 0;
+}
+
+// fills n bits of the sequence s_(k + deg) = sum f_i * s_(k + i), starting from random bits
+static void recurrence(uint64_t* seq, size_t n, const F2LinPoly* f) {
+    const long deg = f2lin_poly_deg(f);
+
+    for (size_t k = 0; k < n; ++k) {
+        int bit = 0;
+
+        if (k < (size_t) deg) {
+            bit = next() & 1;
+        } else {
+            for (long i = 0; i < deg; ++i) {
+                bit ^= f2lin_poly_coeff(f, i) & (int) (seq[(k - deg + i) >> 6] >> ((k - deg + i) & 63));
+            }
+        }
+        if (bit) seq[k >> 6] |= 1ull << (k & 63);
+    }
+}
+
+static int annihilates(const F2LinPoly* g, const uint64_t* seq, size_t n) {
+    const long deg = f2lin_poly_deg(g);
+
+    for (size_t k = 0; k + deg < n; ++k) {
+        int sum = 0;
+
+        for (long i = 0; i <= deg; ++i) {
+            sum ^= f2lin_poly_coeff(g, i) & (int) (seq[(k + i) >> 6] >> ((k + i) & 63));
+        }
+        if (sum) return 0;
+    }
+    return 1;
+}
+
+static char* test_min_poly_seq() {
+    const long degrees[] = { 1, 4, 63, 64, 65, 200 };
+    // s_(k + 4) = s_(k + 1) + s_k from 1, 0, 0, 0, which gives 1, 0, 0, 0, 1, 0, 0, 1. 
+    // x^4 + x + 1 is primitive, so every nonzero start has it as minimal polynomial
+    uint64_t lfsr[1] = { 0x91 };
+    F2LinPoly* g;
+    F2LinPoly* parsed;
+    char* str;
+
+    g = f2lin_poly_min_poly_seq(lfsr, 8);
+    str = f2lin_poly_to_string(g);
+    mu_assert("Wrong minimal polynomial of x^4 + x + 1", !strcmp(str, "11001"));
+    free(str);
+    f2lin_poly_destroy(g);
+
+    g = f2lin_poly_min_poly_seq((uint64_t[2]) { 0 }, 100);
+    mu_assert("The zero sequence has the minimal polynomial 1", f2lin_poly_deg(g) == 0);
+    f2lin_poly_destroy(g);
+
+    for (size_t i = 0; i < sizeof(degrees) / sizeof(degrees[0]); ++i) {
+        const long deg = degrees[i];
+        const size_t n = 4 * deg;
+        uint64_t* seq = calloc(n / 64 + 1, sizeof(uint64_t));
+        F2LinPoly* f = rand_poly(deg);
+
+        f2lin_poly_set_coeff(f, 0, 1);
+        recurrence(seq, n, f);
+
+        // only the first 2 * deg bits are used, but the result has to hold for all of them
+        g = f2lin_poly_min_poly_seq(seq, 2 * deg);
+        mu_assert("Minimal polynomial has a too large degree", f2lin_poly_deg(g) <= deg);
+        mu_assert("Minimal polynomial doesn't annihilate the sequence", annihilates(g, seq, n));
+
+        str = f2lin_poly_to_string(f);
+        parsed = f2lin_poly_init_from_string(str);
+        mu_assert("Wrong string of a polynomial", f2lin_poly_equal(parsed, f));
+        f2lin_poly_destroy(parsed);
+        free(str);
+
+        f2lin_poly_destroy(g);
+        f2lin_poly_destroy(f);
+        free(seq);
+    }
+
+    return 0;
+}
+
+static char* all_tests() {
+    mu_run_test(test_arithmetic);
+    mu_run_test(test_power_x_mod);
+    mu_run_test(test_window);
+    mu_run_test(test_min_poly_seq);
+
+    return 0;
+}
+
+int main(void) {
+    char* result = all_tests();
+
+    if (result != 0) {
+        printf("%s\n", result);
+    } else {
+        printf("ALL TESTS PASSED\n");
+    }
+
+    printf("Tests run: %d\n", tests_run);
+
+    return result == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,93 @@
+#define TEST
+#include <stdio.h>
+#include "minunit.h"
+#include "config.h"
+#include "f2lin.h"
+
+#define BUF_SIZE 1500
+#define SEED 12323456
+
+int tests_run = 0;
+
+static char* test_fill() {
+    // around the block size of the conversion, and odd for the floats
+    size_t lengths[] = { 0, 1, 2, 3, 511, 512, 513, 1025, 1500 };
+    static uint64_t u[BUF_SIZE];
+    static double d[BUF_SIZE];
+    static float f[BUF_SIZE];
+    F2LinRngGeneric* rng = f2lin_rng_init_type(RNG_TYPE, SEED);
+    F2LinRngGeneric* seq = f2lin_rng_init_type(RNG_TYPE, SEED);
+    printf("Testing the fill functions against the scalar ones\n");
+
+    for (size_t k = 0; k < sizeof(lengths) / sizeof(lengths[0]); ++k) {
+        const size_t n = lengths[k];
+
+        f2lin_fill_u64(rng, n, u);
+        for (size_t i = 0; i < n; ++i) mu_assert("Wrong result for f2lin_fill_u64", u[i] == f2lin_next_unsigned(seq));
+
+        f2lin_fill_double(rng, n, d);
+        for (size_t i = 0; i < n; ++i) mu_assert("Wrong result for f2lin_fill_double", d[i] == f2lin_next_double(seq));
+
+        f2lin_fill_double_open(rng, n, d);
+        for (size_t i = 0; i < n; ++i) {
+            uint64_t x = f2lin_next_unsigned(seq);
+            mu_assert("Wrong result for f2lin_fill_double_open", 
+                      d[i] == ((x >> 12) + 0.5) * (1.0 / 4503599627370496.0));
+        }
+
+        // the last number is used up, even if only one of its floats is used
+        f2lin_fill_float(rng, n, f);
+        for (size_t i = 0; i < n; i += 2) {
+            uint64_t x = f2lin_next_unsigned(seq);
+            mu_assert("Wrong first float for f2lin_fill_float", f[i] == ((uint32_t) x >> 8) * (1.0f / 16777216.0f));
+            if (i + 1 < n) mu_assert("Wrong second float for f2lin_fill_float", f[i + 1] == (uint32_t) (x >> 40) * (1.0f / 16777216.0f));
+        }
+
+        mu_assert("Stream position differs after filling", f2lin_next_unsigned(rng) == f2lin_next_unsigned(seq));
+    }
+
+    f2lin_rng_destroy(rng);
+    f2lin_rng_destroy(seq);
+    return 0;
+}
+
+static char* test_jump_after_fill() {
+    F2LinConfig c = { .q = 4, .algorithm = SLIDING_WINDOW_DECOMP };
+    static double d[BUF_SIZE];
+    F2LinRngGeneric* rng = f2lin_rng_init_type(RNG_TYPE, SEED);
+    F2LinRngGeneric* seq = f2lin_rng_init_type(RNG_TYPE, SEED);
+    F2LinJump* jump = f2lin_jump_init_type(RNG_TYPE, 1000, &c);
+    printf("Testing jumping after filling\n");
+
+    f2lin_fill_double(rng, 777, d);
+    f2lin_jump(rng, jump);
+    for (size_t i = 0; i < 1777; ++i) f2lin_next_unsigned(seq);
+
+    mu_assert("Wrong result when jumping after filling", f2lin_next_unsigned(rng) == f2lin_next_unsigned(seq));
+
+    f2lin_jump_destroy(jump);
+    f2lin_rng_destroy(rng);
+    f2lin_rng_destroy(seq);
+    return 0;
+}
+
+static char* all_tests() {
+    mu_run_test(test_fill);
+    mu_run_test(test_jump_after_fill);
+
+    return 0;
+}
+
+int main(void) {
+    char* result = all_tests();
+
+    if (result != 0) {
+        printf("%s\n", result);
+    } else {
+        printf("ALL TESTS PASSED\n");
+    }
+
+    printf("Tests run: %d\n", tests_run);
+
+    return result == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,81 @@
+#define TEST
+#include <stdio.h>
+#include "minunit.h"
+#include "config.h"
+#include "jump_ahead.h"
+#include "rng_generic/rng_generic.h"
+
+#define BUF_SIZE 2000
+
+int tests_run = 0;
+
+// the bulk generation has to produce the same numbers as gen64, and leave the same state
+static int compare_bulk(F2LinRngGeneric* rng, size_t n) {
+    static uint64_t bulk[BUF_SIZE];
+    F2LinRngGeneric* scalar = f2lin_rng_generic_init_zero(RNG_TYPE);
+    int equal = 1;
+
+    f2lin_rng_generic_copy(scalar, rng);
+    f2lin_rng_generic_gen_n_numbers(rng, n, bulk);
+
+    for (size_t i = 0; i < n; ++i) equal = equal && bulk[i] == f2lin_rng_generic_gen64(scalar);
+    equal = equal && f2lin_rng_generic_gen64(rng) == f2lin_rng_generic_gen64(scalar);
+
+    f2lin_rng_generic_destroy(scalar);
+    return equal;
+}
+
+static char* test_lengths() {
+    // lengths around the unrolling and the 312 words of MT, which leave the 
+    // position in the state at different offsets for the next call
+    size_t lengths[] = { 0, 1, 2, 3, 4, 5, 7, 155, 156, 157, 311, 312, 313, 624, 1000, 2000 };
+    F2LinRngGeneric* rng = f2lin_rng_generic_init(RNG_TYPE);
+    printf("Testing bulk generation with different lengths\n");
+
+    for (size_t i = 0; i < sizeof(lengths) / sizeof(lengths[0]); ++i) {
+        mu_assert("Bulk generation differs from gen64", compare_bulk(rng, lengths[i]));
+    }
+
+    f2lin_rng_generic_destroy(rng);
+    return 0;
+}
+
+static char* test_after_jump() {
+    // a jump leaves the position anywhere in the state
+    size_t jump_sizes[] = { 1, 17, 100, 1000, 12345 };
+    F2LinConfig c = { .q = 4, .algorithm = SLIDING_WINDOW_DECOMP };
+    F2LinRngGeneric* rng = f2lin_rng_generic_init(RNG_TYPE);
+    printf("Testing bulk generation after jumping\n");
+
+    for (size_t i = 0; i < sizeof(jump_sizes) / sizeof(jump_sizes[0]); ++i) {
+        F2LinJump* jump = f2lin_jump_ahead_init(RNG_TYPE, jump_sizes[i], &c);
+
+        f2lin_jump_ahead_jump(jump, rng);
+        mu_assert("Bulk generation differs from gen64 after a jump", compare_bulk(rng, 500));
+        f2lin_jump_ahead_destroy(jump);
+    }
+
+    f2lin_rng_generic_destroy(rng);
+    return 0;
+}
+
+static char* all_tests() {
+    mu_run_test(test_lengths);
+    mu_run_test(test_after_jump);
+
+    return 0;
+}
+
+int main(void) {
+    char* result = all_tests();
+
+    if (result != 0) {
+        printf("%s\n", result);
+    } else {
+        printf("ALL TESTS PASSED\n");
+    }
+
+    printf("Tests run: %d\n", tests_run);
+
+    return result == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
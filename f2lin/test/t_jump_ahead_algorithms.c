@@ -1,23 +1,37 @@
 #define TEST
 #include <stdio.h>
+#include <pthread.h>
 #include "minunit.h"
 #include "config.h"
 #include "jump_ahead.h"
+#include "jump_cache.h"
+#include "jump_poly.h"
 #include "rng_generic/rng_generic.h"
 
+/* threads sharing one jump, and the jumps every thread does with it */
+#define THREADS 4
+#define THREAD_JUMPS 3
+
 int tests_run = 0;
 
+/* a generator of a thread, which is jumped with a jump shared by all threads */
+typedef struct ThreadJump ThreadJump;
+struct ThreadJump {
+    const F2LinJump* jump;
+    F2LinRngGeneric* rng;
+};
+
 static void do_n_steps(size_t n, F2LinRngGeneric* rng) {
     for (size_t i = 0; i < n; ++i) f2lin_rng_generic_gen64(rng); 
 }
 
 static int test_jump(size_t jump_size, F2LinConfig* c) {
     int ret;
-    F2LinRngGeneric* jump = f2lin_rng_generic_init();
-    F2LinRngGeneric* iter = f2lin_rng_generic_init();
+    F2LinRngGeneric* jump = f2lin_rng_generic_init(RNG_TYPE);
+    F2LinRngGeneric* iter = f2lin_rng_generic_init(RNG_TYPE);
     uint64_t actual, expected;
 
-    F2LinJump* params = f2lin_jump_ahead_init(jump_size, c);
+    F2LinJump* params = f2lin_jump_ahead_init(RNG_TYPE, jump_size, c);
     do_n_steps(jump_size, iter);
     f2lin_jump_ahead_jump(params, jump);
     actual = f2lin_rng_generic_gen64(jump); 
@@ -62,10 +76,140 @@ static char* test_sliding_window_decomp() {
     return test_algorithm(4, SLIDING_WINDOW_DECOMP);
 }
 
+static char* test_matrix() {
+    // generators with a too large state fall back to SLIDING_WINDOW_DECOMP
+    printf("Testing algorithm MATRIX\n");
+    mu_assert("Wrong result with jump_size 0", test_jump(0, &(F2LinConfig) { .q = 4, .algorithm = MATRIX }));
+    return test_algorithm(4, MATRIX);
+}
+
+static char* test_auto_q() {
+    const int q = f2lin_jump_ahead_auto_q(RNG_TYPE);
+    F2LinConfig c = { .q = Q_AUTO, .algorithm = SLIDING_WINDOW_DECOMP };
+    printf("Testing q = Q_AUTO (%d)\n", q);
+
+    mu_assert("Automatic q out of range", q >= 1 && q <= Q_MAX);
+    mu_assert("Wrong result with jump_size 100000 using Q_AUTO", test_jump(100000, &c));
+    mu_assert("Q_AUTO not replaced by the chosen q", c.q == q);
+
+    c = (F2LinConfig) { .q = Q_AUTO, .algorithm = SLIDING_WINDOW };
+    mu_assert("Wrong result with jump_size 100000 using Q_AUTO", test_jump(100000, &c));
+
+    // a zero-initialized config doesn't ask for the automatic q
+    c = (F2LinConfig) { 0 };
+    mu_assert("Wrong result with a zero-initialized config", test_jump(100000, &c));
+    mu_assert("q = 0 not replaced by Q_DEFAULT", c.q == Q_DEFAULT);
+
+    return 0;
+}
+
+static char* test_pow2_table() {
+    F2LinConfig c = { .q = 4, .algorithm = SLIDING_WINDOW_DECOMP, .poly_method = POW2_TABLE };
+    size_t jump_sizes[] = { 0, 1, 2, 3, 1000, 1ull << 40, (1ull << 40) * 7 + 12345, SIZE_MAX };
+    const char* min_poly = f2lin_rng_generic_min_poly(RNG_TYPE);
+    const GF2XModulus* F = f2lin_jump_cache_modulus(min_poly);
+    const F2LinPow2Table* table = f2lin_jump_cache_pow2_table(min_poly);
+    printf("Testing jump polynomial method POW2_TABLE\n");
+
+    for (size_t i = 0; i < sizeof(jump_sizes) / sizeof(jump_sizes[0]); ++i) {
+        GF2X* expected = f2lin_jump_poly_power_mod(F, jump_sizes[i]);
+        GF2X* actual = f2lin_jump_poly_compose(table, jump_sizes[i]);
+        int equal = GF2X_deg(expected) == GF2X_deg(actual);
+
+        for (long j = 0; equal && j <= GF2X_deg(expected); ++j) {
+            equal = GF2X_coeff(expected, j) == GF2X_coeff(actual, j);
+        }
+
+        GF2X_zero_destroy(expected);
+        GF2X_zero_destroy(actual);
+        mu_assert("Composed jump polynomial differs from PowerMod", equal);
+    }
+
+    // make sure the jump polynomials aren't taken from the cache 
+    f2lin_jump_cache_clear();
+    mu_assert("Wrong result with jump_size 1 using POW2_TABLE", test_jump(1, &c));
+    mu_assert("Wrong result with jump_size 1000 using POW2_TABLE", test_jump(1000, &c));
+    mu_assert("Wrong result with jump_size 1000000 using POW2_TABLE", test_jump(1000000, &c));
+
+    return 0;
+}
+
+static void* jump_thread(void* arg) {
+    ThreadJump* t = arg;
+
+    for (size_t i = 0; i < THREAD_JUMPS; ++i) f2lin_jump_ahead_jump(t->jump, t->rng);
+    return 0;
+}
+
+static char* test_shared_jump() {
+    const enum F2LinJumpAlgorithm algorithms[] = {
+        HORNER, SLIDING_WINDOW, SLIDING_WINDOW_DECOMP, MATRIX
+    };
+    printf("Testing one jump shared by %d threads\n", THREADS);
+
+    for (size_t a = 0; a < sizeof(algorithms) / sizeof(algorithms[0]); ++a) {
+        F2LinConfig c = { .q = 6, .algorithm = algorithms[a] };
+        F2LinJump* jump = f2lin_jump_ahead_init(RNG_TYPE, 123457, &c);
+        F2LinJumpWork* work = f2lin_jump_ahead_work_init(RNG_TYPE, f2lin_jump_ahead_work_q(jump));
+        pthread_t threads[THREADS];
+        ThreadJump t[THREADS];
+
+        for (size_t i = 0; i < THREADS; ++i) {
+            t[i] = (ThreadJump) { jump, f2lin_rng_generic_init_seed(RNG_TYPE, i + 1) };
+            pthread_create(&threads[i], 0, jump_thread, &t[i]);
+        }
+        for (size_t i = 0; i < THREADS; ++i) {
+            F2LinRngGeneric* expected = f2lin_rng_generic_init_seed(RNG_TYPE, i + 1);
+
+            // the same jumps in one thread, with a workspace of its own
+            for (size_t k = 0; k < THREAD_JUMPS; ++k) {
+                f2lin_jump_ahead_jump_work(jump, expected, work);
+            }
+            pthread_join(threads[i], 0);
+
+            mu_assert("Wrong result of a jump shared by threads", 
+                      f2lin_rng_generic_compare_state(t[i].rng, expected));
+            f2lin_rng_generic_destroy(t[i].rng);
+            f2lin_rng_generic_destroy(expected);
+        }
+
+        f2lin_jump_ahead_work_destroy(work);
+        f2lin_jump_ahead_destroy(jump);
+    }
+    return 0;
+}
+
+static char* test_work_mismatch() {
+    F2LinConfig c = { .q = 6, .algorithm = SLIDING_WINDOW_DECOMP };
+    F2LinJump* jump = f2lin_jump_ahead_init(RNG_TYPE, 1000, &c);
+    F2LinJumpWork* small = f2lin_jump_ahead_work_init(RNG_TYPE, 5);
+    F2LinJumpWork* other = f2lin_jump_ahead_work_init((RNG_TYPE + 1) % F2LIN_RNG_TYPES, 6);
+    F2LinRngGeneric* rng = f2lin_rng_generic_init(RNG_TYPE);
+    F2LinRngGeneric* copy = f2lin_rng_generic_init(RNG_TYPE);
+    printf("Testing workspaces which don't fit the jump, expecting two errors\n");
+
+    f2lin_jump_ahead_jump_work(jump, rng, small);
+    f2lin_jump_ahead_jump_work(jump, rng, other);
+    mu_assert("Jumped with a workspace which doesn't fit", 
+              f2lin_rng_generic_compare_state(rng, copy));
+
+    f2lin_jump_ahead_work_destroy(small);
+    f2lin_jump_ahead_work_destroy(other);
+    f2lin_jump_ahead_destroy(jump);
+    f2lin_rng_generic_destroy(rng);
+    f2lin_rng_generic_destroy(copy);
+    return 0;
+}
+
 static char* all_tests() {
     mu_run_test(test_horner);
     mu_run_test(test_sliding_window);
     mu_run_test(test_sliding_window_decomp);
+    mu_run_test(test_matrix);
+    mu_run_test(test_auto_q);
+    mu_run_test(test_pow2_table);
+    mu_run_test(test_shared_jump);
+    mu_run_test(test_work_mismatch);
 
     return 0;
 }
@@ -16,13 +16,13 @@ static char* test_first_100k() {
     size_t START = 19934;
     size_t MAX = 20600;
     F2LinConfig c = { .q = 4, .algorithm = SLIDING_WINDOW_DECOMP };
-    F2LinRngGeneric* iter= f2lin_rng_generic_init();
+    F2LinRngGeneric* iter= f2lin_rng_generic_init(RNG_TYPE);
     do_n_steps(START + 1, iter);
     //printf("%llu\n", f2lin_rng_generic_gen64(iter));
     
     for (size_t i = START + 1; i < MAX; ++i) {
-        F2LinRngGeneric* jump = f2lin_rng_generic_init();
-        F2LinJump* params = f2lin_jump_ahead_init(i, &c);
+        F2LinRngGeneric* jump = f2lin_rng_generic_init(RNG_TYPE);
+        F2LinJump* params = f2lin_jump_ahead_init(RNG_TYPE, i, &c);
         f2lin_jump_ahead_jump(params, jump);
         f2lin_rng_generic_gen64(iter);
         f2lin_rng_generic_gen64(jump);
@@ -0,0 +1,172 @@
+#define TEST
+#include <stdio.h>
+#include "minunit.h"
+#include "config.h"
+#include "jump_ahead.h"
+#include "jump_cache.h"
+#include "rng_generic/rng_generic.h"
+
+int tests_run = 0;
+
+static void do_n_steps(size_t n, F2LinRngGeneric* rng) {
+    for (size_t i = 0; i < n; ++i) f2lin_rng_generic_gen64(rng);
+}
+
+static int test_jump(F2LinJump* params, size_t jump_size) {
+    int ret;
+    F2LinRngGeneric* jump = f2lin_rng_generic_init(RNG_TYPE);
+    F2LinRngGeneric* iter = f2lin_rng_generic_init(RNG_TYPE);
+
+    do_n_steps(jump_size, iter);
+    f2lin_jump_ahead_jump(params, jump);
+    ret = f2lin_rng_generic_compare_state(jump, iter);
+
+    f2lin_rng_generic_destroy(jump);
+    f2lin_rng_generic_destroy(iter);
+    return ret;
+}
+
+static char* test_hit_and_miss() {
+    F2LinJumpCacheStats stats;
+    F2LinConfig c = { .q = 4, .algorithm = SLIDING_WINDOW_DECOMP };
+
+    f2lin_jump_cache_clear();
+
+    // the first jump misses both the decomposition and the jump polynomial
+    F2LinJump* a = f2lin_jump_ahead_init(RNG_TYPE, 1000, &c);
+    f2lin_jump_cache_stats(&stats);
+    mu_assert("First init should miss", stats.hits == 0 && stats.misses == 2);
+    mu_assert("First init should insert two entries", stats.entries == 2);
+
+    F2LinJump* b = f2lin_jump_ahead_init(RNG_TYPE, 1000, &c);
+    f2lin_jump_cache_stats(&stats);
+    mu_assert("Second init should hit", stats.hits == 1 && stats.misses == 2);
+    mu_assert("Jumps should share the decomposition", a->jp.swd.pd == b->jp.swd.pd);
+
+    // horner and sliding window can reuse the jump polynomial, which is already cached
+    c.algorithm = HORNER;
+    F2LinJump* h = f2lin_jump_ahead_init(RNG_TYPE, 1000, &c);
+    c.algorithm = SLIDING_WINDOW;
+    F2LinJump* sw = f2lin_jump_ahead_init(RNG_TYPE, 1000, &c);
+    f2lin_jump_cache_stats(&stats);
+    mu_assert("Jump polynomial should be shared", stats.hits == 3 && stats.entries == 2);
+    mu_assert("Horner and sliding window should share the polynomial", h->jp.horner == sw->jp.sw.jp);
+
+    mu_assert("Wrong result for cached SLIDING_WINDOW_DECOMP", test_jump(b, 1000));
+    mu_assert("Wrong result for cached HORNER", test_jump(h, 1000));
+    mu_assert("Wrong result for cached SLIDING_WINDOW", test_jump(sw, 1000));
+
+    f2lin_jump_ahead_destroy(a);
+    f2lin_jump_ahead_destroy(b);
+    f2lin_jump_ahead_destroy(h);
+    f2lin_jump_ahead_destroy(sw);
+
+    // entries stay cached after all jumps using them are destroyed
+    f2lin_jump_cache_stats(&stats);
+    mu_assert("Entries should stay cached", stats.entries == 2 && stats.bytes > 0);
+
+    return 0;
+}
+
+static char* test_limit() {
+    F2LinJumpCacheStats stats;
+    F2LinConfig c = { .q = 4, .algorithm = HORNER };
+
+    f2lin_jump_cache_clear();
+    f2lin_jump_cache_set_limit(1);
+
+    // an entry in use is never evicted, only once it is released
+    F2LinJump* a = f2lin_jump_ahead_init(RNG_TYPE, 10000, &c);
+    f2lin_jump_cache_stats(&stats);
+    mu_assert("Entry in use shouldn't be evicted", stats.entries == 1 && stats.evictions == 0);
+    mu_assert("Wrong result with limited cache", test_jump(a, 10000));
+
+    f2lin_jump_ahead_destroy(a);
+    f2lin_jump_cache_stats(&stats);
+    mu_assert("Released entry should be evicted", stats.entries == 0 && stats.evictions == 1);
+    mu_assert("Bytes should be zero after eviction", stats.bytes == 0);
+
+    f2lin_jump_cache_set_limit(JUMP_CACHE_LIMIT_DEFAULT);
+
+    return 0;
+}
+
+static char* test_entry_limit() {
+    F2LinJumpCacheStats stats;
+    F2LinConfig c = { .q = 4, .algorithm = HORNER };
+
+    f2lin_jump_cache_clear();
+    f2lin_jump_cache_set_entry_limit(16);
+
+    // only the 16 most recently used of the distinct jump sizes stay cached
+    for (size_t i = 1; i <= 40; ++i) {
+        f2lin_jump_ahead_destroy(f2lin_jump_ahead_init(RNG_TYPE, i, &c));
+    }
+    f2lin_jump_cache_stats(&stats);
+    mu_assert("Entry limit should be kept", stats.entries == 16 && stats.evictions == 24);
+
+    f2lin_jump_ahead_destroy(f2lin_jump_ahead_init(RNG_TYPE, 40, &c));
+    f2lin_jump_ahead_destroy(f2lin_jump_ahead_init(RNG_TYPE, 1, &c));
+    f2lin_jump_cache_stats(&stats);
+    mu_assert("Recently used entry should hit", stats.hits == 1);
+    mu_assert("Least recently used entry should be evicted", stats.misses == 41);
+
+    f2lin_jump_cache_set_entry_limit(JUMP_CACHE_ENTRIES_DEFAULT);
+
+    // more entries than the initial buckets of the hash table
+    f2lin_jump_cache_clear();
+    for (size_t i = 1; i <= 500; ++i) {
+        f2lin_jump_ahead_destroy(f2lin_jump_ahead_init(RNG_TYPE, i, &c));
+    }
+    F2LinJump* a = f2lin_jump_ahead_init(RNG_TYPE, 123, &c);
+    f2lin_jump_cache_stats(&stats);
+    mu_assert("All distinct jump sizes should be cached", stats.entries == 500 && stats.hits == 1);
+    mu_assert("Wrong result after growing the cache", test_jump(a, 123));
+    f2lin_jump_ahead_destroy(a);
+
+    return 0;
+}
+
+static char* test_disabled() {
+    F2LinJumpCacheStats stats;
+    F2LinConfig c = { .q = 4, .algorithm = SLIDING_WINDOW_DECOMP };
+
+    f2lin_jump_cache_clear();
+    f2lin_jump_cache_set_limit(0);
+
+    F2LinJump* a = f2lin_jump_ahead_init(RNG_TYPE, 100000, &c);
+    F2LinJump* b = f2lin_jump_ahead_init(RNG_TYPE, 100000, &c);
+    f2lin_jump_cache_stats(&stats);
+    mu_assert("Disabled cache shouldn't be used", stats.hits == 0 && stats.misses == 0);
+    mu_assert("Jumps should own their parameters", !a->release && a->jp.swd.pd != b->jp.swd.pd);
+    mu_assert("Wrong result with disabled cache", test_jump(a, 100000));
+
+    f2lin_jump_ahead_destroy(a);
+    f2lin_jump_ahead_destroy(b);
+    f2lin_jump_cache_set_limit(JUMP_CACHE_LIMIT_DEFAULT);
+
+    return 0;
+}
+
+static char* all_tests() {
+    mu_run_test(test_hit_and_miss);
+    mu_run_test(test_limit);
+    mu_run_test(test_entry_limit);
+    mu_run_test(test_disabled);
+
+    return 0;
+}
+
+int main(void) {
+    char* result = all_tests();
+
+    if (result != 0) {
+        printf("%s\n", result);
+    } else {
+        printf("ALL TESTS PASSED\n");
+    }
+
+    printf("Tests run: %d\n", tests_run);
+
+    return result == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,179 @@
+#define TEST
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include "minunit.h"
+#include "config.h"
+#include "jump_ahead.h"
+#include "jump_cache.h"
+#include "jump_file.h"
+#include "rng_generic/rng_generic.h"
+
+#define PATH "t_jump_file.jmp"
+
+int tests_run = 0;
+
+static void do_n_steps(size_t n, F2LinRngGeneric* rng) {
+    for (size_t i = 0; i < n; ++i) f2lin_rng_generic_gen64(rng);
+}
+
+static int test_jump(F2LinJump* params, size_t jump_size) {
+    int ret;
+    F2LinRngGeneric* jump = f2lin_rng_generic_init(RNG_TYPE);
+    F2LinRngGeneric* iter = f2lin_rng_generic_init(RNG_TYPE);
+
+    do_n_steps(jump_size, iter);
+    f2lin_jump_ahead_jump(params, jump);
+    f2lin_jump_ahead_jump(params, jump);
+    do_n_steps(jump_size, iter);
+    ret = f2lin_rng_generic_compare_state(jump, iter);
+
+    f2lin_rng_generic_destroy(jump);
+    f2lin_rng_generic_destroy(iter);
+    return ret;
+}
+
+static char* test_round_trip() {
+    enum F2LinJumpAlgorithm algorithms[] = { 
+        HORNER, SLIDING_WINDOW, SLIDING_WINDOW_DECOMP, MATRIX 
+    };
+    size_t jump_sizes[] = { 1, 1000, 123457 };
+
+    for (size_t a = 0; a < 4; ++a) {
+        for (size_t j = 0; j < 3; ++j) {
+            F2LinConfig c = { .q = 5, .algorithm = algorithms[a] };
+            F2LinJump* written = f2lin_jump_ahead_init(RNG_TYPE, jump_sizes[j], &c);
+
+            mu_assert("Writing jump parameters failed", !f2lin_jump_file_write(written, PATH));
+            f2lin_jump_ahead_destroy(written);
+
+            F2LinJump* read = f2lin_jump_file_read(PATH);
+            mu_assert("Reading jump parameters failed", read);
+            mu_assert("Read wrong algorithm", read->algorithm == c.algorithm);
+            mu_assert("Read wrong jump size", read->jump_size == jump_sizes[j]);
+            mu_assert("Wrong result for read jump parameters", test_jump(read, jump_sizes[j]));
+            f2lin_jump_ahead_destroy(read);
+        }
+    }
+
+    unlink(PATH);
+    return 0;
+}
+
+static int rejected(const void* buf, size_t len) {
+    F2LinJump* jump = f2lin_jump_file_attach(buf, len, 0, 0);
+
+    if (jump) f2lin_jump_ahead_destroy(jump);
+    return !jump;
+}
+
+// corrupts the sliding window decomposition in buf one field at a time
+static int corrupt_rejected(uint64_t* buf, size_t len) {
+    F2LinJumpFileHeader* header = (F2LinJumpFileHeader*) buf;
+    uint64_t* d = (uint64_t*) ((char*) buf + header->d_offset);
+    uint16_t* h = (uint16_t*) ((char*) buf + header->h_offset);
+    const uint64_t d_offset = header->d_offset, h_offset = header->h_offset, n = header->n;
+    const uint64_t d0 = d[0], d1 = d[1];
+    const uint16_t h1 = h[1];
+    int ok = 1;
+
+    // windows outside of the table of 2^q states
+    h[1] = 1 << header->q;
+    ok = ok && rejected(buf, len);
+    h[1] = h1;
+
+    // distances which aren't decreasing, or exceed the state
+    d[1] = d0;
+    ok = ok && rejected(buf, len);
+    d[1] = d0 + 1;
+    ok = ok && rejected(buf, len);
+    d[1] = d1;
+    d[0] = header->state_size;
+    ok = ok && rejected(buf, len);
+    d[0] = d0;
+
+    // offsets and lengths which wrap around when added up
+    header->d_offset = UINT64_MAX - 7;
+    ok = ok && rejected(buf, len);
+    header->d_offset = d_offset;
+    header->h_offset = UINT64_MAX - 1;
+    ok = ok && rejected(buf, len);
+    header->h_offset = h_offset;
+    header->n = (UINT64_MAX >> 3) + 2;
+    ok = ok && rejected(buf, len);
+    header->n = n;
+
+    return ok && !rejected(buf, len);
+}
+
+static char* test_invalid() {
+    F2LinConfig c = { .q = 4, .algorithm = SLIDING_WINDOW_DECOMP };
+    // larger than the state, so the jump polynomial is reduced into several windows
+    F2LinJump* jump = f2lin_jump_ahead_init(RNG_TYPE, 123457, &c);
+    const size_t len = f2lin_jump_file_size(jump);
+    uint64_t* buf = malloc(len);
+    F2LinJumpFileHeader* header = (F2LinJumpFileHeader*) buf;
+    F2LinJump* attached;
+
+    f2lin_jump_file_serialize(jump, buf);
+    attached = f2lin_jump_file_attach(buf, len, 0, 0);
+    mu_assert("Attaching serialized parameters failed", attached && test_jump(attached, 123457));
+    f2lin_jump_ahead_destroy(attached);
+
+    mu_assert("Truncated parameters shouldn't be accepted", 
+              !f2lin_jump_file_attach(buf, sizeof(F2LinJumpFileHeader) + 8, 0, 0));
+
+    header->min_poly_checksum ^= 1;
+    mu_assert("Parameters for other generators shouldn't be accepted", 
+              !f2lin_jump_file_attach(buf, len, 0, 0));
+    header->min_poly_checksum ^= 1;
+
+    mu_assert("Jump needs at least two windows", header->n >= 2);
+    mu_assert("Corrupted parameters shouldn't be accepted", corrupt_rejected(buf, len));
+
+    header->magic[0] = 'X';
+    mu_assert("Wrong magic shouldn't be accepted", !f2lin_jump_file_attach(buf, len, 0, 0));
+
+    mu_assert("Missing files shouldn't be accepted", !f2lin_jump_file_read("does/not/exist"));
+
+    free(buf);
+    f2lin_jump_ahead_destroy(jump);
+
+    // a polynomial whose offset wraps around the end of the buffer
+    c.algorithm = HORNER;
+    jump = f2lin_jump_ahead_init(RNG_TYPE, 1000, &c);
+    buf = malloc(f2lin_jump_file_size(jump));
+    f2lin_jump_file_serialize(jump, buf);
+    header = (F2LinJumpFileHeader*) buf;
+    header->poly_offset = UINT64_MAX - 7;
+    mu_assert("Wrapping offsets shouldn't be accepted",
+              rejected(buf, f2lin_jump_file_size(jump)));
+
+    free(buf);
+    f2lin_jump_ahead_destroy(jump);
+    return 0;
+}
+
+static char* all_tests() {
+    // make sure the parameters are owned by the jumps
+    f2lin_jump_cache_set_limit(0);
+
+    mu_run_test(test_round_trip);
+    mu_run_test(test_invalid);
+
+    return 0;
+}
+
+int main(void) {
+    char* result = all_tests();
+
+    if (result != 0) {
+        printf("%s\n", result);
+    } else {
+        printf("ALL TESTS PASSED\n");
+    }
+
+    printf("Tests run: %d\n", tests_run);
+
+    return result == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,113 @@
+#define TEST
+#include <stdio.h>
+#include "minunit.h"
+#include "config.h"
+#include "f2lin_lanes.h"
+#include "jump_ahead.h"
+#include "rng_generic/rng_generic.h"
+
+#define BUF_SIZE 20000
+
+int tests_run = 0;
+
+static uint64_t buf[BUF_SIZE];
+
+static char* test_interleaved() {
+    // chunks which don't line up with the blocks of the lanes
+    size_t chunks[] = { 1, 3, 1000, 1024, 5000, 7, 4096, 8865 };
+    size_t lanes[] = { 0, 1, 4, 6, 8 };
+    printf("Testing interleaved lanes against the sequential stream\n");
+
+    for (size_t k = 0; k < sizeof(lanes) / sizeof(lanes[0]); ++k) {
+        F2LinRngGeneric* base = f2lin_rng_generic_init(F2LIN_XOSHIRO256PP);
+        F2LinRngGeneric* seq = f2lin_rng_generic_init(F2LIN_XOSHIRO256PP);
+        F2LinLanes* l = f2lin_lanes_init(base, lanes[k], INTERLEAVED, 0);
+
+        mu_assert("Unable to initialize the lanes", l);
+
+        for (size_t c = 0; c < sizeof(chunks) / sizeof(chunks[0]); ++c) {
+            f2lin_lanes_fill_u64(l, chunks[c], buf);
+            for (size_t i = 0; i < chunks[c]; ++i) {
+                mu_assert("Interleaved lanes differ from the sequential stream", 
+                          buf[i] == f2lin_rng_generic_gen64(seq));
+            }
+        }
+
+        f2lin_lanes_destroy(l);
+        f2lin_rng_generic_destroy(base);
+        f2lin_rng_generic_destroy(seq);
+    }
+
+    return 0;
+}
+
+static char* test_substreams() {
+    const size_t substream_size = 1000000, n = 3000;
+    F2LinConfig c = { .q = 4, .algorithm = SLIDING_WINDOW_DECOMP };
+    F2LinRngGeneric* base = f2lin_rng_generic_init(F2LIN_XOSHIRO256PP);
+    F2LinRngGeneric* lane = f2lin_rng_generic_init(F2LIN_XOSHIRO256PP);
+    F2LinJump* jump = f2lin_jump_ahead_init(F2LIN_XOSHIRO256PP, substream_size, &c);
+    F2LinLanes* l = f2lin_lanes_init(base, 8, SUBSTREAMS, substream_size);
+    printf("Testing lanes on jumped substreams\n");
+
+    mu_assert("Wrong number of lanes", f2lin_lanes_count(l) == 8);
+
+    // in two parts, to continue from the state of the lanes
+    f2lin_lanes_fill_u64(l, n / 2, buf);
+    f2lin_lanes_fill_u64(l, n - n / 2, &buf[n / 2]);
+
+    // lane i is the base generator jumped by i * substream_size
+    for (size_t i = 0; i < 8; ++i) {
+        F2LinRngGeneric* seq = f2lin_rng_generic_copy(f2lin_rng_generic_init_zero(F2LIN_XOSHIRO256PP), lane);
+
+        for (size_t k = i; k < n; k += 8) {
+            mu_assert("Lane differs from the jumped substream", buf[k] == f2lin_rng_generic_gen64(seq));
+        }
+        f2lin_rng_generic_destroy(seq);
+        f2lin_jump_ahead_jump(jump, lane);
+    }
+
+    f2lin_lanes_destroy(l);
+    f2lin_jump_ahead_destroy(jump);
+    f2lin_rng_generic_destroy(base);
+    f2lin_rng_generic_destroy(lane);
+    return 0;
+}
+
+static char* test_invalid() {
+    F2LinRngGeneric* base = f2lin_rng_generic_init(F2LIN_XOSHIRO256PP);
+    F2LinRngGeneric* mt = f2lin_rng_generic_init(F2LIN_MT19937);
+    printf("Testing invalid lanes, expecting three errors\n");
+
+    mu_assert("Lanes of an empty substream shouldn't be initialized", 
+              !f2lin_lanes_init(base, 4, SUBSTREAMS, 0));
+    mu_assert("Lanes of mt shouldn't be initialized", !f2lin_lanes_init(mt, 4, INTERLEAVED, 0));
+    mu_assert("Lanes with an invalid mode shouldn't be initialized", 
+              !f2lin_lanes_init(base, 4, (enum F2LinLanesMode) 2, 1000));
+
+    f2lin_rng_generic_destroy(base);
+    f2lin_rng_generic_destroy(mt);
+    return 0;
+}
+
+static char* all_tests() {
+    mu_run_test(test_interleaved);
+    mu_run_test(test_substreams);
+    mu_run_test(test_invalid);
+
+    return 0;
+}
+
+int main(void) {
+    char* result = all_tests();
+
+    if (result != 0) {
+        printf("%s\n", result);
+    } else {
+        printf("ALL TESTS PASSED\n");
+    }
+
+    printf("Tests run: %d\n", tests_run);
+
+    return result == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,81 @@
+#define TEST
+#include <stdio.h>
+#include <string.h>
+#include "minunit.h"
+#include "config.h"
+#include "min_poly.h"
+#include "jump_cache.h"
+#include "rng_generic/rng_generic.h"
+
+#define SEED 12323456
+
+int tests_run = 0;
+
+static char* test_compute() {
+    F2LinRngGeneric* rng = f2lin_rng_generic_init_seed(RNG_TYPE, SEED);
+    F2LinRngGeneric* copy = f2lin_rng_generic_init_seed(RNG_TYPE, SEED);
+    char* computed;
+    printf("Testing computing the minimal polynomial at runtime\n");
+
+    computed = f2lin_min_poly_compute_string(rng);
+    mu_assert("Computed polynomial differs from the header",
+              !strcmp(computed, f2lin_rng_generic_min_poly(RNG_TYPE)));
+    mu_assert("Wrong degree of the computed polynomial",
+              strlen(computed) == f2lin_rng_generic_state_size(RNG_TYPE) + 1);
+    mu_assert("Generator changed by computing its polynomial",
+              f2lin_rng_generic_compare_state(rng, copy));
+
+    free(computed);
+    f2lin_rng_generic_destroy(rng);
+    f2lin_rng_generic_destroy(copy);
+    return 0;
+}
+
+static char* test_cache() {
+    const uint64_t params[2] = { 1, 2 };
+    const uint64_t other[2] = { 1, 3 };
+    F2LinRngGeneric* rng = f2lin_rng_generic_init_seed(RNG_TYPE, SEED);
+    const char* a;
+    const char* b;
+    printf("Testing caching computed minimal polynomials\n");
+
+    a = f2lin_jump_cache_min_poly(rng, params, sizeof(params));
+    mu_assert("Wrong cached polynomial", !strcmp(a, f2lin_rng_generic_min_poly(RNG_TYPE)));
+    mu_assert("Polynomial computed twice for the same parameters",
+              f2lin_jump_cache_min_poly(rng, params, sizeof(params)) == a);
+
+    // other parameters are another generator, even if they have the same polynomial
+    b = f2lin_jump_cache_min_poly(rng, other, sizeof(other));
+    mu_assert("Same entry for other parameters", a != b && !strcmp(a, b));
+    mu_assert("Same entry for parameters of another length", 
+              f2lin_jump_cache_min_poly(rng, params, sizeof(params[0])) != a);
+
+    // the computed polynomials identify generators, so clearing the cache keeps them
+    f2lin_jump_cache_clear();
+    mu_assert("Polynomial lost by clearing the cache",
+              f2lin_jump_cache_min_poly(rng, params, sizeof(params)) == a);
+
+    f2lin_rng_generic_destroy(rng);
+    return 0;
+}
+
+static char* all_tests() {
+    mu_run_test(test_compute);
+    mu_run_test(test_cache);
+
+    return 0;
+}
+
+int main(void) {
+    char* result = all_tests();
+
+    if (result != 0) {
+        printf("%s\n", result);
+    } else {
+        printf("ALL TESTS PASSED\n");
+    }
+
+    printf("Tests run: %d\n", tests_run);
+
+    return result == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
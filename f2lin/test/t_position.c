@@ -0,0 +1,251 @@
+#define TEST
+#include <stdio.h>
+#include <string.h>
+#include "minunit.h"
+#include "config.h"
+#include "f2lin.h"
+#include "position.h"
+#include "rng_generic/rng_generic.h"
+
+#define SEED 12323456
+
+int tests_run = 0;
+
+static int at_position(const F2LinRngGeneric* rng, uint64_t hi, uint64_t lo) {
+    F2LinPosition pos;
+
+    return !f2lin_position(rng, &pos) && pos.hi == hi && pos.lo == lo;
+}
+
+// the generator seeded with SEED and moved ahead by n numbers
+static F2LinRngGeneric* expected_at(size_t n) {
+    F2LinRngGeneric* rng = f2lin_rng_init_type(RNG_TYPE, SEED);
+
+    f2lin_advance(rng, n);
+    return rng;
+}
+
+static int same_stream(F2LinRngGeneric* rng, F2LinRngGeneric* expected) {
+    return f2lin_rng_generic_compare_state(rng, expected) &&
+           f2lin_next_unsigned(rng) == f2lin_next_unsigned(expected);
+}
+
+static char* test_counting() {
+    F2LinRngGeneric* rng = f2lin_rng_init_tracked(RNG_TYPE, SEED);
+    F2LinRngGeneric* plain = f2lin_rng_init_type(RNG_TYPE, SEED);
+    F2LinJump* jump = f2lin_jump_init_rng(rng, 12345, 0);
+    uint64_t u64[100];
+    double d[50];
+    float f[7];
+    printf("Testing the counting of numbers\n");
+
+    mu_assert("Tracked generator doesn't start at 0", at_position(rng, 0, 0));
+
+    for (size_t i = 0; i < 3; ++i) f2lin_next_unsigned(rng);
+    f2lin_next_signed(rng);
+    f2lin_next_double(rng);
+    mu_assert("Wrong position after single numbers", at_position(rng, 0, 5));
+
+    f2lin_fill_u64(rng, 100, u64);
+    f2lin_fill_double(rng, 50, d);
+    f2lin_fill_double_open(rng, 50, d);
+    f2lin_fill_float(rng, 7, f);
+    mu_assert("Wrong position after filling", at_position(rng, 0, 209));
+
+    f2lin_advance(rng, 1000);
+    f2lin_jump(rng, jump);
+    mu_assert("Wrong position after advancing and jumping", at_position(rng, 0, 13554));
+
+    // the position counts the numbers the state moved, like an untracked generator
+    f2lin_advance(plain, 13554);
+    mu_assert("Tracked generator is in another state",
+              f2lin_rng_generic_compare_state(rng, plain));
+
+    f2lin_jump_destroy(jump);
+    f2lin_rng_destroy(rng);
+    f2lin_rng_destroy(plain);
+    return 0;
+}
+
+static char* test_seek() {
+    const size_t targets[] = { 1000, 70000, 70000, 5, 0, 123457 };
+    F2LinRngGeneric* rng = f2lin_rng_init_tracked(RNG_TYPE, SEED);
+    printf("Testing seeking forward and backward\n");
+
+    for (size_t i = 0; i < sizeof(targets) / sizeof(targets[0]); ++i) {
+        F2LinRngGeneric* expected = expected_at(targets[i]);
+
+        mu_assert("Unable to seek", !f2lin_seek_abs(rng, (F2LinPosition) { 0, targets[i] }));
+        mu_assert("Wrong position after seeking", at_position(rng, 0, targets[i]));
+        mu_assert("Wrong state after seeking", f2lin_rng_generic_compare_state(rng, expected));
+        f2lin_rng_destroy(expected);
+    }
+
+    f2lin_rng_destroy(rng);
+    return 0;
+}
+
+static char* test_checkpoint() {
+    F2LinRngGeneric* rng = f2lin_rng_init_tracked(RNG_TYPE, SEED);
+    F2LinRngGeneric* expected = expected_at(5500);
+    printf("Testing checkpoints, expecting one error\n");
+
+    f2lin_advance(rng, 5000);
+    mu_assert("Unable to set a checkpoint", !f2lin_checkpoint(rng));
+    f2lin_advance(rng, 2000);
+
+    mu_assert("Unable to seek to the checkpoint",
+              !f2lin_seek_abs(rng, (F2LinPosition) { 0, 5500 }));
+    mu_assert("Wrong state after seeking from the checkpoint", same_stream(rng, expected));
+    mu_assert("Seeked before the checkpoint", f2lin_seek_abs(rng, (F2LinPosition) { 0, 4000 }));
+    mu_assert("Moved by an invalid seek", at_position(rng, 0, 5501));
+
+    f2lin_rng_destroy(rng);
+    f2lin_rng_destroy(expected);
+    return 0;
+}
+
+static char* test_seek_high() {
+    F2LinRngGeneric* rng = f2lin_rng_init_tracked(RNG_TYPE, SEED);
+    F2LinRngGeneric* expected = f2lin_rng_init_type(RNG_TYPE, SEED);
+    F2LinJump* jump = f2lin_jump_init_rng(expected, 1ull << 62, 0);
+    printf("Testing seeking beyond 2^64\n");
+
+    // 2^64 + 3 = 4 * 2^62 + 3
+    for (size_t i = 0; i < 4; ++i) f2lin_jump(expected, jump);
+    f2lin_advance(expected, 3);
+
+    mu_assert("Unable to seek beyond 2^64", !f2lin_seek_abs(rng, (F2LinPosition) { 1, 3 }));
+    mu_assert("Wrong position beyond 2^64", at_position(rng, 1, 3));
+    mu_assert("Wrong state beyond 2^64", same_stream(rng, expected));
+
+    f2lin_jump(rng, jump);
+    mu_assert("Wrong position after jumping beyond 2^64",
+              at_position(rng, 1, (1ull << 62) + 4));
+
+    f2lin_jump_destroy(jump);
+    f2lin_rng_destroy(rng);
+    f2lin_rng_destroy(expected);
+    return 0;
+}
+
+static char* test_track_at() {
+    const size_t size = f2lin_rng_tracked_size(RNG_TYPE);
+    const size_t align = f2lin_rng_state_align(RNG_TYPE);
+    F2LinRngGeneric* rng = f2lin_rng_init_type(RNG_TYPE, SEED);
+    F2LinRngGeneric* expected = expected_at(100);
+    char* mem = aligned_alloc(align, 2 * size);
+    F2LinRngGeneric* tracked;
+    F2LinRngGeneric* copy;
+    printf("Testing tracked copies, expecting two errors\n");
+
+    mu_assert("Tracked generator isn't larger", size > f2lin_rng_state_size(RNG_TYPE));
+
+    // an untracked generator starts at 0 where it is
+    f2lin_advance(rng, 50);
+    tracked = f2lin_rng_track_at(rng, mem);
+    mu_assert("Tracked copy doesn't start at 0", at_position(tracked, 0, 0));
+    f2lin_advance(tracked, 50);
+
+    // a tracked generator is copied with its position and checkpoint
+    copy = f2lin_rng_track_at(tracked, mem + size);
+    mu_assert("Tracked copy has another position", at_position(copy, 0, 50));
+    mu_assert("Unable to seek the copy to its checkpoint",
+              !f2lin_seek_abs(copy, (F2LinPosition) { 0, 0 }));
+    mu_assert("Wrong checkpoint of a copy", f2lin_rng_generic_compare_state(copy, rng));
+    mu_assert("Copy changed the original", same_stream(tracked, expected));
+
+    mu_assert("Seeked an untracked generator", f2lin_seek_abs(rng, (F2LinPosition) { 0, 0 }));
+    mu_assert("Checkpoint of an untracked generator", f2lin_checkpoint(rng));
+
+    free(mem);
+    f2lin_rng_destroy(rng);
+    f2lin_rng_destroy(expected);
+    return 0;
+}
+
+static char* test_substream() {
+    F2LinRngGeneric* base = f2lin_rng_init_tracked(RNG_TYPE, SEED);
+    F2LinRngGeneric* out = f2lin_rng_init_tracked(RNG_TYPE, 1);
+    F2LinRngGeneric* expected = expected_at(100);
+    F2LinSubstreamTable* table;
+    printf("Testing tracked substreams\n");
+
+    f2lin_advance(base, 100);
+    table = f2lin_substreams_init(base, 1000, 10, 0);
+
+    f2lin_substream(table, 3, out);
+    mu_assert("Wrong position of a substream", at_position(out, 0, 3100));
+    mu_assert("Unable to seek to the base", !f2lin_seek_abs(out, (F2LinPosition) { 0, 100 }));
+    mu_assert("Base isn't the checkpoint of a substream", same_stream(out, expected));
+
+    f2lin_substreams_destroy(table);
+    f2lin_rng_destroy(base);
+    f2lin_rng_destroy(out);
+    f2lin_rng_destroy(expected);
+    return 0;
+}
+
+// tracking is a property of the positioned generator, not of the base generator
+static char* test_substream_mixed() {
+    const size_t size = f2lin_rng_state_size(RNG_TYPE);
+    F2LinRngGeneric* tracked_base = f2lin_rng_init_tracked(RNG_TYPE, SEED);
+    F2LinRngGeneric* plain_base = f2lin_rng_init_type(RNG_TYPE, SEED);
+    F2LinRngGeneric* tracked_out = f2lin_rng_init_tracked(RNG_TYPE, 1);
+    F2LinRngGeneric* expected = expected_at(3000);
+    char* mem = aligned_alloc(f2lin_rng_state_align(RNG_TYPE), 2 * size);
+    F2LinRngGeneric* plain_out = f2lin_rng_init_at(RNG_TYPE, 1, mem);
+    F2LinSubstreamTable* tracked_table = f2lin_substreams_init(tracked_base, 1000, 10, 0);
+    F2LinSubstreamTable* plain_table = f2lin_substreams_init(plain_base, 1000, 10, 0);
+    printf("Testing substreams of tracked and untracked generators\n");
+
+    f2lin_substream(tracked_table, 3, plain_out);
+    mu_assert("Substream of a tracked base is tracked", !plain_out->tracked);
+    mu_assert("Wrong substream of a tracked base",
+              f2lin_rng_generic_compare_state(plain_out, expected));
+
+    f2lin_substream(plain_table, 3, tracked_out);
+    mu_assert("Wrong position of a substream of an untracked base",
+              at_position(tracked_out, 0, 3000));
+    mu_assert("Wrong substream of an untracked base",
+              f2lin_rng_generic_compare_state(tracked_out, expected));
+
+    mu_assert("Unable to initialize a range", !f2lin_substream_range(tracked_table, 2, 2, mem));
+    mu_assert("Range of a tracked base is tracked",
+              !((F2LinRngGeneric*) mem)->tracked && !((F2LinRngGeneric*) (mem + size))->tracked);
+
+    free(mem);
+    f2lin_substreams_destroy(tracked_table);
+    f2lin_substreams_destroy(plain_table);
+    f2lin_rng_destroy(tracked_base);
+    f2lin_rng_destroy(plain_base);
+    f2lin_rng_destroy(tracked_out);
+    f2lin_rng_destroy(expected);
+    return 0;
+}
+
+static char* all_tests() {
+    mu_run_test(test_counting);
+    mu_run_test(test_seek);
+    mu_run_test(test_checkpoint);
+    mu_run_test(test_seek_high);
+    mu_run_test(test_track_at);
+    mu_run_test(test_substream);
+    mu_run_test(test_substream_mixed);
+
+    return 0;
+}
+
+int main(void) {
+    char* result = all_tests();
+
+    if (result != 0) {
+        printf("%s\n", result);
+    } else {
+        printf("ALL TESTS PASSED\n");
+    }
+
+    printf("Tests run: %d\n", tests_run);
+
+    return result == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
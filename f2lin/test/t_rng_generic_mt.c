@@ -4,7 +4,7 @@
 #include "minunit.h"
 #include "rng_generic/rng_generic_mt.c"
 
-typedef F2LinRngGeneric Rng;
+typedef F2LinRngMT Rng;
 int tests_run = 0;
 
 static void fill_mt(Rng* mt, uint64_t shift) {
@@ -23,10 +23,10 @@ static char* test_add_zeros() {
 
     fill_mt(&src, 0);
 
-    f2lin_rng_generic_add(&dest, &src);
+    add(&dest.base, &src.base);
 
     mu_assert("Adding to all 0s gives wrong result", 
-            f2lin_rng_generic_compare_state(&dest, &src));
+            compare_state(&dest.base, &src.base));
     
     return 0;
 }
@@ -53,7 +53,7 @@ static char* test_add_both_init() {
     print_state(&src);
     print_state(&dest);
 
-    f2lin_rng_generic_add(&dest, &src);
+    add(&dest.base, &src.base);
 
     print_state(&dest);
 
@@ -0,0 +1,428 @@
+#define TEST
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include <unistd.h>
+#include "minunit.h"
+#include "config.h"
+#include "f2lin.h"
+#include "rng_generic/rng_generic.h"
+
+#define PATH "t_rng_types.jmp"
+#define SEED 12323456
+
+int tests_run = 0;
+
+static int test_jump(F2LinJump* jump, enum F2LinRngType type, size_t jump_size) {
+    int ret;
+    F2LinRngGeneric* rng = f2lin_rng_init_type(type, SEED);
+    F2LinRngGeneric* iter = f2lin_rng_init_type(type, SEED);
+
+    f2lin_jump(rng, jump);
+    for (size_t i = 0; i < jump_size; ++i) f2lin_next_unsigned(iter);
+    ret = f2lin_rng_generic_compare_state(rng, iter);
+
+    f2lin_rng_destroy(rng);
+    f2lin_rng_destroy(iter);
+    return ret;
+}
+
+static char* test_init_type() {
+    printf("Testing initializing generators of every type\n");
+
+    for (int t = 0; t < F2LIN_RNG_TYPES; ++t) {
+        F2LinRngGeneric* rng = f2lin_rng_init_type(t, SEED);
+        F2LinRngGeneric* generic = f2lin_rng_generic_init_seed(t, SEED);
+
+        mu_assert("Wrong type of generator", f2lin_rng_type(rng) == t);
+        mu_assert("Missing name of generator", f2lin_rng_type_name(t));
+        for (int u = 0; u < t; ++u) {
+            mu_assert("Same name for two generators",
+                      strcmp(f2lin_rng_type_name(t), f2lin_rng_type_name(u)));
+        }
+        for (size_t i = 0; i < 1000; ++i) {
+            mu_assert("Stream differs from the backend",
+                      f2lin_next_unsigned(rng) == f2lin_rng_generic_gen64(generic));
+        }
+
+        f2lin_rng_destroy(rng);
+        f2lin_rng_generic_destroy(generic);
+    }
+
+    mu_assert("Initialized an invalid type", !f2lin_rng_init_type(F2LIN_RNG_TYPES, SEED));
+    mu_assert("Initialized an invalid type", !f2lin_rng_init_type(-1, SEED));
+    mu_assert("Name for an invalid type", !f2lin_rng_type_name(F2LIN_RNG_TYPES));
+    return 0;
+}
+
+static char* test_seed_mt() {
+    F2LinRngGeneric* a = f2lin_rng_init_type(F2LIN_MT19937, 5489);
+    F2LinRngGeneric* b = f2lin_rng_init_type(F2LIN_MT19937, 5490);
+    printf("Testing seeding the mersenne twister\n");
+
+    // first number of the reference implementation of MT19937-64 for its default seed
+    mu_assert("Wrong first number for seed 5489",
+              f2lin_next_unsigned(a) == 14514284786278117030ull);
+    mu_assert("Same stream for different seeds",
+              f2lin_next_unsigned(a) != f2lin_next_unsigned(b));
+
+    f2lin_rng_destroy(a);
+    f2lin_rng_destroy(b);
+    return 0;
+}
+
+static char* test_seed_sfmt() {
+    // the outputs of init_gen_rand(1234) as 32 bit numbers, and of init_gen_rand(4321) as
+    // 64 bit numbers, in SFMT.19937.out.txt of the reference implementation
+    const uint32_t check32[] = { 3440181298u, 1564997079u, 1510669302u, 2930277156u };
+    const uint64_t check64[] = { 16924766246869039260ull, 8201438687333352714ull };
+    F2LinRngGeneric* a = f2lin_rng_init_type(F2LIN_SFMT19937, 1234);
+    F2LinRngGeneric* b = f2lin_rng_init_type(F2LIN_SFMT19937, 4321);
+    printf("Testing seeding SFMT\n");
+
+    for (size_t i = 0; i < 4; i += 2) {
+        const uint64_t x = f2lin_next_unsigned(a);
+
+        mu_assert("Wrong 32 bit numbers for seed 1234",
+                  (uint32_t) x == check32[i] && (uint32_t) (x >> 32) == check32[i + 1]);
+    }
+    for (size_t i = 0; i < 2; ++i) {
+        mu_assert("Wrong 64 bit number for seed 4321", f2lin_next_unsigned(b) == check64[i]);
+    }
+
+    f2lin_rng_destroy(a);
+    f2lin_rng_destroy(b);
+    return 0;
+}
+
+static char* test_seed_dsfmt() {
+    // the first numbers in [1, 2) of dsfmt_init_gen_rand(0) of the reference implementation
+    const double check[] = { 1.030581026769374, 1.213140320067012, 1.299002525016001 };
+    F2LinRngGeneric* rng = f2lin_rng_init_type(F2LIN_DSFMT19937, 0);
+    printf("Testing seeding dSFMT\n");
+
+    // f2lin_next_double() is the number of dSFMT minus one, which is exact
+    for (size_t i = 0; i < 3; ++i) {
+        mu_assert("Wrong double for seed 0", fabs(f2lin_next_double(rng) + 1 - check[i]) < 1e-15);
+    }
+
+    f2lin_rng_destroy(rng);
+    return 0;
+}
+
+static char* test_seed_well() {
+    // the outputs of WELLRNG512a() and WELLRNG1024a() of the reference implementation as
+    // 32 bit numbers, after InitWELLRNG512a() and InitWELLRNG1024a() with the words of the
+    // 32 bit MT19937 initialization for 5489, which is how the generators are seeded
+    const uint32_t check512[] = { 0xd035c5d6u, 0x9d781d97u, 0x8b1315fcu, 0x29697eceu };
+    const uint32_t check1024[] = { 0x0f5af10bu, 0x264efc19u, 0x1033f4e3u, 0x678c71feu };
+    const enum F2LinRngType types[] = { F2LIN_WELL512A, F2LIN_WELL1024A };
+    const uint32_t* checks[] = { check512, check1024 };
+    // the 1000th number, two outputs joined like the first ones
+    const uint64_t check1000[] = { 12309817748255664194ull, 14696798511060446822ull };
+    printf("Testing seeding WELL512a and WELL1024a\n");
+
+    for (size_t t = 0; t < 2; ++t) {
+        F2LinRngGeneric* rng = f2lin_rng_init_type(types[t], 5489);
+        uint64_t x;
+
+        // the first output is the upper half of a number
+        for (size_t i = 0; i < 4; i += 2) {
+            x = f2lin_next_unsigned(rng);
+            mu_assert("Wrong 32 bit numbers for seed 5489",
+                      (uint32_t) (x >> 32) == checks[t][i] && (uint32_t) x == checks[t][i + 1]);
+        }
+        for (size_t i = 2; i < 1000; ++i) x = f2lin_next_unsigned(rng);
+        mu_assert("Wrong 1000th number for seed 5489", x == check1000[t]);
+
+        f2lin_rng_destroy(rng);
+    }
+    return 0;
+}
+
+static char* test_jump_xoroshiro() {
+    // jump() of the reference implementation of xoroshiro128++, which jumps 2^64 steps
+    const uint64_t reference[] = { 0x2bd7a6a6e99c2ddcull, 0x0992ccaf6a6fca05ull };
+    F2LinConfig c = { .q = 4, .algorithm = MATRIX };
+    F2LinJump* jump = f2lin_jump_init_type(F2LIN_XOROSHIRO128PP, 1ull << 63, &c);
+    F2LinRngGeneric* rng = f2lin_rng_init_type(F2LIN_XOROSHIRO128PP, SEED);
+    F2LinRngGeneric* iter = f2lin_rng_init_type(F2LIN_XOROSHIRO128PP, SEED);
+    F2LinRngGeneric* tmp = f2lin_rng_init_type(F2LIN_XOROSHIRO128PP, SEED);
+    uint64_t s[2] = { 0, 0 }, t[2];
+    printf("Testing jumps of xoroshiro128++ against the reference\n");
+
+    for (int i = 0; i < 2; ++i) {
+        for (int b = 0; b < 64; ++b) {
+            if (reference[i] & (1ull << b)) {
+                f2lin_rng_generic_get_state(tmp, t);
+                s[0] ^= t[0];
+                s[1] ^= t[1];
+            }
+            f2lin_rng_generic_next_state(tmp);
+        }
+    }
+    f2lin_rng_generic_set_state(iter, s);
+
+    // 2^64 is larger than every jump size, so it is jumped by 2^63 twice
+    f2lin_jump(rng, jump);
+    f2lin_jump(rng, jump);
+    mu_assert("Jump differs from the reference", f2lin_rng_generic_compare_state(rng, iter));
+
+    f2lin_jump_destroy(jump);
+    f2lin_rng_destroy(rng);
+    f2lin_rng_destroy(iter);
+    f2lin_rng_destroy(tmp);
+    return 0;
+}
+
+static char* test_odd_jumps() {
+    // SFMT and dSFMT return two numbers per step, jumps by an odd number of them and jumps
+    // of generators with a pending upper half have to step one number in addition
+    const enum F2LinRngType types[] = { F2LIN_SFMT19937, F2LIN_DSFMT19937 };
+    const size_t jump_sizes[] = { 1, 2, 999, 123457 };
+    F2LinConfig c = { .q = 4, .algorithm = SLIDING_WINDOW_DECOMP };
+    printf("Testing odd jumps of generators with two numbers per step\n");
+
+    for (size_t t = 0; t < 2; ++t) {
+        mu_assert("Wrong numbers per step", f2lin_rng_generic_numbers_per_step(types[t]) == 2);
+
+        for (size_t i = 0; i < sizeof(jump_sizes) / sizeof(jump_sizes[0]); ++i) {
+            F2LinJump* jump = f2lin_jump_init_type(types[t], jump_sizes[i], &c);
+
+            for (size_t offset = 0; offset < 2; ++offset) {
+                F2LinRngGeneric* rng = f2lin_rng_init_type(types[t], SEED);
+                F2LinRngGeneric* iter = f2lin_rng_init_type(types[t], SEED);
+
+                for (size_t k = 0; k < offset; ++k) {
+                    f2lin_next_unsigned(rng);
+                    f2lin_next_unsigned(iter);
+                }
+                f2lin_jump(rng, jump);
+                for (size_t k = 0; k < jump_sizes[i]; ++k) f2lin_next_unsigned(iter);
+
+                mu_assert("Wrong result of an odd jump", f2lin_rng_generic_compare_state(rng, iter));
+                mu_assert("Wrong number after an odd jump",
+                          f2lin_next_unsigned(rng) == f2lin_next_unsigned(iter));
+                f2lin_rng_destroy(rng);
+                f2lin_rng_destroy(iter);
+            }
+            f2lin_jump_destroy(jump);
+        }
+    }
+    return 0;
+}
+
+static char* test_jump_types() {
+    F2LinConfig c = { .q = 4, .algorithm = SLIDING_WINDOW_DECOMP };
+    F2LinJump* jumps[F2LIN_RNG_TYPES];
+    printf("Testing jumps of every type in one process\n");
+
+    // all jumps exist at the same time, so parameters of different types can't be confused
+    for (int t = 0; t < F2LIN_RNG_TYPES; ++t) jumps[t] = f2lin_jump_init_type(t, 1000, &c);
+    for (int t = 0; t < F2LIN_RNG_TYPES; ++t) {
+        mu_assert("Wrong result when jumping", test_jump(jumps[t], t, 1000));
+    }
+    for (int t = 0; t < F2LIN_RNG_TYPES; ++t) f2lin_jump_destroy(jumps[t]);
+
+    mu_assert("Initialized a jump for an invalid type",
+              !f2lin_jump_init_type(F2LIN_RNG_TYPES, 1000, &c));
+    return 0;
+}
+
+static char* test_jump_mismatch() {
+    F2LinConfig c = { .q = 4, .algorithm = HORNER };
+    F2LinJump* jump = f2lin_jump_init_type(F2LIN_XORSHIFT64, 1000, &c);
+    F2LinRngGeneric* rng = f2lin_rng_init_type(F2LIN_TINYMT64, SEED);
+    F2LinRngGeneric* copy = f2lin_rng_init_type(F2LIN_TINYMT64, SEED);
+    printf("Testing jumping with parameters of another type\n");
+
+    f2lin_jump(rng, jump);
+    mu_assert("Generator changed by a jump of another type",
+              f2lin_rng_generic_compare_state(rng, copy));
+
+    f2lin_jump_destroy(jump);
+    f2lin_rng_destroy(rng);
+    f2lin_rng_destroy(copy);
+    return 0;
+}
+
+static char* test_jump_arena() {
+    F2LinConfig c = { .q = 5, .algorithm = SLIDING_WINDOW_DECOMP };
+    F2LinJump* jumps[F2LIN_RNG_TYPES];
+    F2LinJumpWork* work[F2LIN_RNG_TYPES];
+    size_t offsets[F2LIN_RNG_TYPES + 1] = { 0 };
+    char* arena;
+    printf("Testing jumps with workspaces in an arena, expecting one error\n");
+
+    // the workspaces of every type are placed next to each other in one block of memory
+    for (int t = 0; t < F2LIN_RNG_TYPES; ++t) {
+        const size_t align = F2LIN_JUMP_WORK_ALIGN;
+
+        jumps[t] = f2lin_jump_init_type(t, 1001, &c);
+        offsets[t + 1] = offsets[t] + (f2lin_jump_work_size(jumps[t]) + align - 1) / align * align;
+    }
+    arena = aligned_alloc(F2LIN_JUMP_WORK_ALIGN, offsets[F2LIN_RNG_TYPES]);
+
+    mu_assert("Initialized a workspace in unaligned memory", 
+              !f2lin_jump_work_init_at(jumps[0], arena + 8));
+    for (int t = 0; t < F2LIN_RNG_TYPES; ++t) {
+        work[t] = f2lin_jump_work_init_at(jumps[t], arena + offsets[t]);
+        mu_assert("Unable to initialize a workspace in the arena", work[t]);
+    }
+
+    for (int t = 0; t < F2LIN_RNG_TYPES; ++t) {
+        F2LinRngGeneric* rng = f2lin_rng_init_type(t, SEED);
+        F2LinRngGeneric* expected = f2lin_rng_init_type(t, SEED);
+
+        for (int k = 0; k < 3; ++k) {
+            f2lin_jump_with_work(rng, jumps[t], work[t]);
+            f2lin_jump(expected, jumps[t]);
+        }
+        mu_assert("Wrong result when jumping with a workspace in an arena",
+                  f2lin_rng_generic_compare_state(rng, expected));
+
+        f2lin_rng_destroy(rng);
+        f2lin_rng_destroy(expected);
+    }
+
+    for (int t = 0; t < F2LIN_RNG_TYPES; ++t) f2lin_jump_destroy(jumps[t]);
+    free(arena);
+    return 0;
+}
+
+static char* test_init_at() {
+    const size_t n = 100;
+    printf("Testing generators in memory of the caller, expecting two errors\n");
+
+    for (int t = 0; t < F2LIN_RNG_TYPES; ++t) {
+        const size_t size = f2lin_rng_state_size(t), align = f2lin_rng_state_align(t);
+        char* array = aligned_alloc(align, n * size);
+        char* moved = aligned_alloc(align, size);
+
+        mu_assert("Size isn't a multiple of the alignment", size && align && size % align == 0);
+
+        // one stream per entity, all in one array
+        for (size_t i = 0; i < n; ++i) {
+            mu_assert("Unable to initialize a generator in place", 
+                      f2lin_rng_init_at(t, SEED + i, array + i * size));
+        }
+        for (size_t i = 0; i < n; ++i) {
+            F2LinRngGeneric* rng = f2lin_rng_init_type(t, SEED + i);
+            F2LinRngGeneric* at = (F2LinRngGeneric*) (array + i * size);
+
+            mu_assert("Wrong number of a generator in place", 
+                      f2lin_next_unsigned(at) == f2lin_next_unsigned(rng));
+            f2lin_rng_destroy(rng);
+        }
+
+        // generators are values, a moved generator continues where the original stopped
+        memcpy(moved, array, size);
+        mu_assert("Moved generator differs", 
+                  f2lin_next_unsigned((F2LinRngGeneric*) moved) == 
+                  f2lin_next_unsigned((F2LinRngGeneric*) array));
+
+        free(array);
+        free(moved);
+    }
+
+    mu_assert("Sizes of an invalid type", 
+              !f2lin_rng_state_size(F2LIN_RNG_TYPES) && !f2lin_rng_state_align(-1));
+    mu_assert("Initialized an invalid type in place", 
+              !f2lin_rng_init_at(F2LIN_RNG_TYPES, SEED, &(uint64_t) { 0 }));
+    if (f2lin_rng_state_align(F2LIN_SFMT19937) > 1) {
+        char* mem = aligned_alloc(f2lin_rng_state_align(F2LIN_SFMT19937), 
+                                  2 * f2lin_rng_state_size(F2LIN_SFMT19937));
+        mu_assert("Initialized a generator in unaligned memory", 
+                  !f2lin_rng_init_at(F2LIN_SFMT19937, SEED, mem + 1));
+        free(mem);
+    }
+    return 0;
+}
+
+static char* test_stream_at() {
+    F2LinConfig c = { .q = 4, .algorithm = SLIDING_WINDOW_DECOMP };
+    const size_t size = f2lin_rng_state_size(F2LIN_TINYMT64);
+    const size_t align = f2lin_rng_state_align(F2LIN_TINYMT64);
+    char* rngs = aligned_alloc(align, 2 * size);
+    F2LinRngGeneric* rng = f2lin_rng_init_stream(F2LIN_TINYMT64, 5, SEED);
+    F2LinRngGeneric* at = f2lin_rng_init_stream_at(F2LIN_TINYMT64, 5, SEED, rngs);
+    F2LinJump* jump = f2lin_jump_init_rng(rng, 12345, &c);
+    char* work_mem = aligned_alloc(F2LIN_JUMP_WORK_ALIGN, 
+                                   (f2lin_jump_work_size(jump) + F2LIN_JUMP_WORK_ALIGN - 1) / 
+                                   F2LIN_JUMP_WORK_ALIGN * F2LIN_JUMP_WORK_ALIGN);
+    printf("Testing streams in memory of the caller, expecting one error\n");
+
+    mu_assert("Initialized a stream out of range in place",
+              !f2lin_rng_init_stream_at(F2LIN_TINYMT64, f2lin_rng_streams(F2LIN_TINYMT64), SEED,
+                                        rngs + size));
+
+    // jumping in place without allocating
+    f2lin_jump(rng, jump);
+    f2lin_jump_with_work(at, jump, f2lin_jump_work_init_at(jump, work_mem));
+    mu_assert("Wrong jump of a stream in place", f2lin_rng_generic_compare_state(rng, at));
+    mu_assert("Wrong number after a jump in place", 
+              f2lin_next_unsigned(rng) == f2lin_next_unsigned(at));
+
+    f2lin_jump_destroy(jump);
+    f2lin_rng_destroy(rng);
+    free(work_mem);
+    free(rngs);
+    return 0;
+}
+
+static char* test_file_type() {
+    F2LinConfig c = { .q = 4, .algorithm = SLIDING_WINDOW };
+    F2LinJump* written = f2lin_jump_init_type(F2LIN_TINYMT64, 12345, &c);
+    F2LinJump* read;
+    F2LinRngGeneric* other = f2lin_rng_init_type(F2LIN_XOSHIRO256PP, SEED);
+    F2LinRngGeneric* copy = f2lin_rng_init_type(F2LIN_XOSHIRO256PP, SEED);
+    printf("Testing the type of jumps read from a file\n");
+
+    mu_assert("Unable to write the jump", !f2lin_jump_write(written, PATH));
+    read = f2lin_jump_read(PATH);
+    mu_assert("Unable to read the jump", read);
+    mu_assert("Wrong result when jumping with a read jump",
+              test_jump(read, F2LIN_TINYMT64, 12345));
+
+    f2lin_jump(other, read);
+    mu_assert("Read jump used for another type", f2lin_rng_generic_compare_state(other, copy));
+
+    unlink(PATH);
+    f2lin_jump_destroy(written);
+    f2lin_jump_destroy(read);
+    f2lin_rng_destroy(other);
+    f2lin_rng_destroy(copy);
+    return 0;
+}
+
+static char* all_tests() {
+    mu_run_test(test_init_type);
+    mu_run_test(test_seed_mt);
+    mu_run_test(test_seed_sfmt);
+    mu_run_test(test_seed_dsfmt);
+    mu_run_test(test_seed_well);
+    mu_run_test(test_jump_xoroshiro);
+    mu_run_test(test_odd_jumps);
+    mu_run_test(test_jump_types);
+    mu_run_test(test_jump_mismatch);
+    mu_run_test(test_jump_arena);
+    mu_run_test(test_init_at);
+    mu_run_test(test_stream_at);
+    mu_run_test(test_file_type);
+
+    return 0;
+}
+
+int main(void) {
+    char* result = all_tests();
+
+    if (result != 0) {
+        printf("%s\n", result);
+    } else {
+        printf("ALL TESTS PASSED\n");
+    }
+
+    printf("Tests run: %d\n", tests_run);
+
+    return result == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
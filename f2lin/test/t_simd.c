@@ -0,0 +1,195 @@
+#define TEST
+#include <stdio.h>
+#include "minunit.h"
+#include "simd.h"
+
+int tests_run = 0;
+
+static uint64_t s = 88172645463325252ull;
+
+static uint64_t next() {
+    s ^= s << 13;
+    s ^= s >> 7;
+    s ^= s << 17;
+    return s;
+}
+
+static char* test_xor() {
+    uint64_t a[64], b[64], expected[64];
+
+    // all lengths and offsets, to cover the vector loop and the rest
+    for (size_t off = 0; off < 8; ++off) {
+        for (size_t n = 0; n + off <= 64; ++n) {
+            for (size_t i = 0; i < 64; ++i) {
+                a[i] = next();
+                b[i] = next();
+                expected[i] = a[i] ^ (i >= off && i < off + n ? b[i] : 0);
+            }
+
+            f2lin_simd_xor(&a[off], &b[off], n);
+            for (size_t i = 0; i < 64; ++i) mu_assert("Wrong result for f2lin_simd_xor", a[i] == expected[i]);
+        }
+    }
+
+    return 0;
+}
+
+static char* test_temper_mt64() {
+    uint64_t a[64], expected[64];
+
+    for (size_t off = 0; off < 8; ++off) {
+        for (size_t n = 0; n + off <= 64; ++n) {
+            for (size_t i = 0; i < 64; ++i) {
+                uint64_t x = a[i] = next();
+
+                // tempering as in mt_genrand64_int64()
+                x ^= (x >> 29) & 0x5555555555555555ULL;
+                x ^= (x << 17) & 0x71D67FFFEDA60000ULL;
+                x ^= (x << 37) & 0xFFF7EEE000000000ULL;
+                x ^= (x >> 43);
+                expected[i] = i >= off && i < off + n ? x : a[i];
+            }
+
+            // dst may be the same as src
+            f2lin_simd_temper_mt64(&a[off], &a[off], n);
+            for (size_t i = 0; i < 64; ++i) mu_assert("Wrong result for f2lin_simd_temper_mt64", a[i] == expected[i]);
+        }
+    }
+
+    return 0;
+}
+
+static char* test_convert() {
+    uint64_t a[64];
+    double d[64];
+    float f[128];
+
+    // all lengths, against the scalar conversions
+    for (size_t n = 0; n <= 64; ++n) {
+        for (size_t i = 0; i < 64; ++i) a[i] = next();
+        // the extremes have to stay inside of the ranges
+        a[0] = 0;
+        a[n / 2] = UINT64_MAX;
+
+        f2lin_simd_u64_to_double(d, a, n);
+        for (size_t i = 0; i < n; ++i) {
+            mu_assert("Wrong result for f2lin_simd_u64_to_double", 
+                      d[i] == (a[i] >> 11) * (1.0 / 9007199254740992.0) && d[i] < 1.0);
+        }
+
+        f2lin_simd_u64_to_double_open(d, a, n);
+        for (size_t i = 0; i < n; ++i) {
+            mu_assert("Wrong result for f2lin_simd_u64_to_double_open", 
+                      d[i] == ((a[i] >> 12) + 0.5) * (1.0 / 4503599627370496.0) 
+                      && d[i] > 0.0 && d[i] < 1.0);
+        }
+
+        f2lin_simd_u64_to_float(f, a, n);
+        for (size_t i = 0; i < n; ++i) {
+            mu_assert("Wrong result for f2lin_simd_u64_to_float", 
+                      f[2 * i] == ((uint32_t) a[i] >> 8) * (1.0f / 16777216.0f)
+                      && f[2 * i + 1] == (uint32_t) (a[i] >> 40) * (1.0f / 16777216.0f)
+                      && f[2 * i] < 1.0f && f[2 * i + 1] < 1.0f);
+        }
+    }
+
+    return 0;
+}
+
+// xoshiro256++ on one lane, like f2lin_rng_generic_gen64()
+static uint64_t next_xoshiro(uint64_t* s0, uint64_t* s1, uint64_t* s2, uint64_t* s3) {
+    const uint64_t r = *s0 + *s3, t = *s1 << 17;
+    const uint64_t out = ((r << 23) | (r >> 41)) + *s0;
+
+    *s2 ^= *s0;
+    *s3 ^= *s1;
+    *s1 ^= *s2;
+    *s0 ^= *s3;
+    *s2 ^= t;
+    *s3 = (*s3 << 45) | (*s3 >> 19);
+    return out;
+}
+
+static char* test_xoshiro_lanes() {
+    // whole vectors of 4 and 8 lanes, and lanes left over for the portable kernel
+    const size_t lanes[] = { 4, 8, 16, 6 };
+    uint64_t state[4 * 16], expected[4 * 16], out[16 * 9];
+
+    for (size_t l = 0; l < sizeof(lanes) / sizeof(lanes[0]); ++l) {
+        const size_t n = lanes[l];
+
+        for (int by_lane = 0; by_lane < 2; ++by_lane) {
+            for (size_t steps = 0; steps < 10; steps += 3) {
+                for (size_t i = 0; i < 4 * n; ++i) state[i] = expected[i] = next();
+
+                f2lin_simd_xoshiro_lanes(state, n, steps, out, by_lane);
+                for (size_t i = 0; i < n; ++i) {
+                    for (size_t k = 0; k < steps; ++k) {
+                        const uint64_t x = next_xoshiro(&expected[i], &expected[n + i],
+                                                        &expected[2 * n + i], 
+                                                        &expected[3 * n + i]);
+                        mu_assert("Wrong number of f2lin_simd_xoshiro_lanes",
+                                  out[by_lane ? i * steps + k : k * n + i] == x);
+                    }
+                }
+                for (size_t i = 0; i < 4 * n; ++i) {
+                    mu_assert("Wrong state after f2lin_simd_xoshiro_lanes", 
+                              state[i] == expected[i]);
+                }
+            }
+        }
+    }
+
+    return 0;
+}
+
+static char* test_alloc() {
+    for (size_t bytes = 0; bytes < 300; bytes += 7) {
+        unsigned char* p = f2lin_simd_alloc(bytes);
+        mu_assert("Memory isn't aligned", ((uintptr_t) p) % SIMD_ALIGN == 0);
+        for (size_t i = 0; i < bytes; ++i) mu_assert("Memory isn't zeroed", p[i] == 0);
+        free(p);
+    }
+
+    return 0;
+}
+
+static char* all_tests() {
+    const char* names[] = { "portable", "AVX2", "AVX-512" };
+    const enum F2LinSimdLevel widest = f2lin_simd_level();
+
+    // every kernel the cpu supports, not only the ones chosen for it
+    for (int level = SIMD_PORTABLE; level <= SIMD_AVX512; ++level) {
+        if (f2lin_simd_select(level)) {
+            printf("Skipping the %s kernels, the cpu doesn't support them\n", names[level]);
+            continue;
+        }
+        printf("Testing the %s kernels\n", names[level]);
+        mu_assert("Wrong kernels selected", f2lin_simd_level() == level);
+
+        mu_run_test(test_xor);
+        mu_run_test(test_temper_mt64);
+        mu_run_test(test_convert);
+        mu_run_test(test_xoshiro_lanes);
+    }
+
+    mu_assert("Selected unknown kernels", f2lin_simd_select(SIMD_AVX512 + 1));
+    mu_assert("Unable to select the widest kernels again", !f2lin_simd_select(widest));
+    mu_run_test(test_alloc);
+
+    return 0;
+}
+
+int main(void) {
+    char* result = all_tests();
+
+    if (result != 0) {
+        printf("%s\n", result);
+    } else {
+        printf("ALL TESTS PASSED\n");
+    }
+
+    printf("Tests run: %d\n", tests_run);
+
+    return result == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
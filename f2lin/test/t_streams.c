@@ -0,0 +1,211 @@
+#define TEST
+#include <stdio.h>
+#include <string.h>
+#include "minunit.h"
+#include "config.h"
+#include "f2lin.h"
+#include "jump_ahead.h"
+#include "jump_cache.h"
+#include "min_poly.h"
+#include "rng_generic/rng_generic.h"
+#include "tinymtparams.h"
+
+#define SEED 12323456
+
+/* the streams whose jumps are tested, the first and the last one among them */
+#define STREAMS 4
+
+int tests_run = 0;
+
+// the first numbers of check64.out.txt of the reference implementation of tinymt
+static const uint64_t check64[] = {
+    15503804787016557143ull, 17280942441431881838ull, 2177846447079362065ull,
+    10087979609567186558ull, 8925138365609588954ull, 13030236470185662861ull,
+};
+
+static const size_t streams[STREAMS] = { 0, 1, 511, 1023 };
+
+static int test_jump(F2LinJump* jump, size_t stream, size_t jump_size) {
+    int ret;
+    F2LinRngGeneric* rng = f2lin_rng_init_stream(F2LIN_TINYMT64, stream, SEED);
+    F2LinRngGeneric* iter = f2lin_rng_init_stream(F2LIN_TINYMT64, stream, SEED);
+
+    f2lin_jump(rng, jump);
+    for (size_t i = 0; i < jump_size; ++i) f2lin_next_unsigned(iter);
+    ret = f2lin_rng_generic_compare_state(rng, iter) &&
+          f2lin_next_unsigned(rng) == f2lin_next_unsigned(iter);
+
+    f2lin_rng_destroy(rng);
+    f2lin_rng_destroy(iter);
+    return ret;
+}
+
+static char* test_reference() {
+    F2LinRngGeneric* rng = f2lin_rng_init_stream(F2LIN_TINYMT64, 0, 1);
+    printf("Testing stream 0 against the reference implementation\n");
+
+    for (size_t i = 0; i < sizeof(check64) / sizeof(check64[0]); ++i) {
+        mu_assert("Wrong number on stream 0", f2lin_next_unsigned(rng) == check64[i]);
+    }
+
+    f2lin_rng_destroy(rng);
+    return 0;
+}
+
+static char* test_init_stream() {
+    const size_t n = f2lin_rng_streams(F2LIN_TINYMT64);
+    F2LinRngGeneric* a = f2lin_rng_init_stream(F2LIN_TINYMT64, 1, SEED);
+    F2LinRngGeneric* b = f2lin_rng_init_stream(F2LIN_TINYMT64, 2, SEED);
+    printf("Testing initializing streams, expecting two errors\n");
+
+    mu_assert("Missing streams of tinymt", n == TINYMT_PARAM_SETS);
+    mu_assert("Only tinymt has streams", !f2lin_rng_streams(F2LIN_XORSHIFT64) &&
+                                         !f2lin_rng_streams(F2LIN_MT19937) &&
+                                         !f2lin_rng_streams(F2LIN_XOSHIRO256PP));
+    mu_assert("Initialized a stream out of range", !f2lin_rng_init_stream(F2LIN_TINYMT64, n, 1));
+    mu_assert("Initialized a stream of xorshift", !f2lin_rng_init_stream(F2LIN_XORSHIFT64, 0, 1));
+
+    mu_assert("Streams have to have their own parameters", !f2lin_rng_generic_compare_state(a, b));
+    mu_assert("Streams with the same seed have to differ",
+              f2lin_next_unsigned(a) != f2lin_next_unsigned(b));
+
+    f2lin_rng_destroy(a);
+    f2lin_rng_destroy(b);
+    return 0;
+}
+
+static char* test_full_period() {
+    F2LinPoly* p = f2lin_poly_init_from_string(f2lin_rng_generic_min_poly(F2LIN_TINYMT64));
+    printf("Testing the period of every stream\n");
+
+    // the parameters used without a stream have a reducible polynomial
+    mu_assert("The default parameters have a full period", f2lin_min_poly_irreducible(p) == 0);
+    f2lin_poly_destroy(p);
+
+    for (size_t s = 0; s < f2lin_rng_streams(F2LIN_TINYMT64); ++s) {
+        F2LinRngGeneric* rng = f2lin_rng_init_stream(F2LIN_TINYMT64, s, 1);
+
+        p = f2lin_min_poly_compute(rng);
+        mu_assert("Stream without a polynomial of degree 127", f2lin_poly_deg(p) == 127);
+        mu_assert("Stream without a full period", f2lin_min_poly_irreducible(p) == 1);
+
+        f2lin_poly_destroy(p);
+        f2lin_rng_destroy(rng);
+    }
+    return 0;
+}
+
+static char* test_jump_streams() {
+    const size_t jump_sizes[] = { 0, 1, 2, 3, 127, 1000, 123457 };
+    const enum F2LinJumpAlgorithm algorithms[] = {
+        HORNER, SLIDING_WINDOW, SLIDING_WINDOW_DECOMP, MATRIX
+    };
+    printf("Testing jumps on streams\n");
+
+    for (size_t s = 0; s < STREAMS; ++s) {
+        F2LinRngGeneric* rng = f2lin_rng_init_stream(F2LIN_TINYMT64, streams[s], SEED);
+
+        for (size_t a = 0; a < sizeof(algorithms) / sizeof(algorithms[0]); ++a) {
+            for (size_t i = 0; i < sizeof(jump_sizes) / sizeof(jump_sizes[0]); ++i) {
+                // small jump polynomials have fewer coefficients than the window
+                F2LinConfig c = { .q = 4, .algorithm = algorithms[a] };
+                F2LinJump* jump = f2lin_jump_init_rng(rng, jump_sizes[i], &c);
+
+                mu_assert("Wrong jump on a stream", test_jump(jump, streams[s], jump_sizes[i]));
+                f2lin_jump_destroy(jump);
+            }
+        }
+        f2lin_rng_destroy(rng);
+    }
+    return 0;
+}
+
+static char* test_jump_other_stream() {
+    F2LinRngGeneric* a = f2lin_rng_init_stream(F2LIN_TINYMT64, 1, SEED);
+    F2LinRngGeneric* b = f2lin_rng_init_stream(F2LIN_TINYMT64, 2, SEED);
+    F2LinRngGeneric* copy = f2lin_rng_init_stream(F2LIN_TINYMT64, 2, SEED);
+    F2LinJump* jump = f2lin_jump_init_rng(a, 1000, 0);
+    F2LinJump* default_jump = f2lin_jump_init_type(F2LIN_TINYMT64, 1000, 0);
+    printf("Testing jumps for another stream, expecting two errors\n");
+
+    f2lin_jump(b, jump);
+    mu_assert("Jumped a generator on another stream", f2lin_rng_generic_compare_state(b, copy));
+    f2lin_jump(b, default_jump);
+    mu_assert("Jumped a stream with the default parameters",
+              f2lin_rng_generic_compare_state(b, copy));
+
+    f2lin_jump_destroy(jump);
+    f2lin_jump_destroy(default_jump);
+    f2lin_rng_destroy(a);
+    f2lin_rng_destroy(b);
+    f2lin_rng_destroy(copy);
+    return 0;
+}
+
+static char* test_min_poly_cache() {
+    F2LinRngGeneric* a = f2lin_rng_init_stream(F2LIN_TINYMT64, 3, SEED);
+    F2LinRngGeneric* b = f2lin_rng_init_stream(F2LIN_TINYMT64, 3, SEED + 1);
+    F2LinRngGeneric* c = f2lin_rng_init_stream(F2LIN_TINYMT64, 4, SEED);
+    F2LinRngGeneric* d = f2lin_rng_init_type(F2LIN_TINYMT64, SEED);
+    printf("Testing the minimal polynomials of streams\n");
+
+    mu_assert("Stream with the default minimal polynomial",
+              f2lin_jump_cache_rng_min_poly(a) != f2lin_rng_generic_min_poly(F2LIN_TINYMT64));
+    mu_assert("Minimal polynomial of a stream computed twice",
+              f2lin_jump_cache_rng_min_poly(a) == f2lin_jump_cache_rng_min_poly(b));
+    mu_assert("Two streams with the same minimal polynomial",
+              strcmp(f2lin_jump_cache_rng_min_poly(a), f2lin_jump_cache_rng_min_poly(c)));
+    mu_assert("Default parameters have to use the header",
+              f2lin_jump_cache_rng_min_poly(d) == f2lin_rng_generic_min_poly(F2LIN_TINYMT64));
+
+    f2lin_rng_destroy(a);
+    f2lin_rng_destroy(b);
+    f2lin_rng_destroy(c);
+    f2lin_rng_destroy(d);
+    return 0;
+}
+
+static char* test_advance_stream() {
+    const size_t sizes[] = { 100, 123457, 2000000 };
+    printf("Testing advancing streams\n");
+
+    for (size_t i = 0; i < sizeof(sizes) / sizeof(sizes[0]); ++i) {
+        F2LinRngGeneric* rng = f2lin_rng_init_stream(F2LIN_TINYMT64, 7, SEED);
+        F2LinRngGeneric* iter = f2lin_rng_init_stream(F2LIN_TINYMT64, 7, SEED);
+
+        f2lin_advance(rng, sizes[i]);
+        for (size_t k = 0; k < sizes[i]; ++k) f2lin_next_unsigned(iter);
+        mu_assert("Wrong result when advancing a stream",
+                  f2lin_rng_generic_compare_state(rng, iter));
+
+        f2lin_rng_destroy(rng);
+        f2lin_rng_destroy(iter);
+    }
+    return 0;
+}
+
+static char* all_tests() {
+    mu_run_test(test_reference);
+    mu_run_test(test_init_stream);
+    mu_run_test(test_full_period);
+    mu_run_test(test_jump_streams);
+    mu_run_test(test_jump_other_stream);
+    mu_run_test(test_min_poly_cache);
+    mu_run_test(test_advance_stream);
+
+    return 0;
+}
+
+int main(void) {
+    char* result = all_tests();
+
+    if (result != 0) {
+        printf("%s\n", result);
+    } else {
+        printf("ALL TESTS PASSED\n");
+    }
+
+    printf("Tests run: %d\n", tests_run);
+
+    return result == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,173 @@
+#define TEST
+#include <stdio.h>
+#include <string.h>
+#include "minunit.h"
+#include "config.h"
+#include "f2lin.h"
+#include "substream.h"
+#include "rng_generic/rng_generic.h"
+
+#define SEED 12323456
+
+/* substreams of the tables tested, the stride of the small one is stepped through */
+#define IDS 300
+#define SMALL_STRIDE 1001
+#define LARGE_STRIDE (1ull << 40)
+
+int tests_run = 0;
+
+// the start of substream id, by stepping or advancing over id * stride numbers
+static F2LinRngGeneric* expected_substream(size_t id, size_t stride) {
+    F2LinRngGeneric* rng = f2lin_rng_init_type(RNG_TYPE, SEED);
+
+    f2lin_advance(rng, id * stride);
+    return rng;
+}
+
+static char* test_position(size_t stride, F2LinConfig* cfg) {
+    const size_t ids[] = { 0, 1, 2, 3, 127, 128, 255, IDS - 1 };
+    F2LinRngGeneric* base = f2lin_rng_init_type(RNG_TYPE, SEED);
+    F2LinRngGeneric* out = f2lin_rng_init_type(RNG_TYPE, 1);
+    F2LinSubstreamTable* table = f2lin_substreams_init(base, stride, IDS, cfg);
+
+    mu_assert("Unable to initialize the substreams", table);
+    for (size_t i = 0; i < sizeof(ids) / sizeof(ids[0]); ++i) {
+        F2LinRngGeneric* expected = expected_substream(ids[i], stride);
+
+        mu_assert("Unable to position a substream", f2lin_substream(table, ids[i], out) == out);
+        mu_assert("Wrong start of a substream", f2lin_rng_generic_compare_state(out, expected));
+        mu_assert("Wrong number of a substream",
+                  f2lin_next_unsigned(out) == f2lin_next_unsigned(expected));
+        f2lin_rng_destroy(expected);
+    }
+
+    f2lin_substreams_destroy(table);
+    f2lin_rng_destroy(base);
+    f2lin_rng_destroy(out);
+    return 0;
+}
+
+static char* test_small_stride() {
+    F2LinConfig c = { .q = 4, .algorithm = SLIDING_WINDOW_DECOMP };
+    printf("Testing substreams with a stride of %d\n", SMALL_STRIDE);
+
+    mu_assert("Wrong substreams with the default config", !test_position(SMALL_STRIDE, 0));
+    mu_assert("Wrong substreams with SLIDING_WINDOW_DECOMP", !test_position(SMALL_STRIDE, &c));
+    return 0;
+}
+
+static char* test_large_stride() {
+    printf("Testing substreams with a stride of 2^40\n");
+    return test_position(LARGE_STRIDE, 0);
+}
+
+static char* test_range() {
+    const size_t strides[] = { SMALL_STRIDE, LARGE_STRIDE };
+    const size_t size = f2lin_rng_state_size(RNG_TYPE), first = 100, n = 40;
+    printf("Testing ranges of substreams\n");
+
+    for (size_t s = 0; s < 2; ++s) {
+        F2LinRngGeneric* base = f2lin_rng_init_type(RNG_TYPE, SEED);
+        F2LinRngGeneric* out = f2lin_rng_init_type(RNG_TYPE, SEED);
+        F2LinSubstreamTable* table = f2lin_substreams_init(base, strides[s], IDS, 0);
+        char* mem = aligned_alloc(f2lin_rng_state_align(RNG_TYPE), n * size);
+
+        mu_assert("Unable to initialize a range", !f2lin_substream_range(table, first, n, mem));
+        for (size_t i = 0; i < n; ++i) {
+            F2LinRngGeneric* rng = (F2LinRngGeneric*) (mem + i * size);
+
+            f2lin_substream(table, first + i, out);
+            mu_assert("Wrong substream in a range", f2lin_rng_generic_compare_state(rng, out));
+            mu_assert("Wrong number of a substream in a range",
+                      f2lin_next_unsigned(rng) == f2lin_next_unsigned(out));
+        }
+
+        free(mem);
+        f2lin_substreams_destroy(table);
+        f2lin_rng_destroy(base);
+        f2lin_rng_destroy(out);
+    }
+    return 0;
+}
+
+// substreams of a tracked base are plain generators, see t_position for tracked ones
+static char* test_tracked_base() {
+    const size_t size = f2lin_rng_state_size(RNG_TYPE);
+    F2LinRngGeneric* base = f2lin_rng_init_tracked(RNG_TYPE, SEED);
+    char* mem = aligned_alloc(f2lin_rng_state_align(RNG_TYPE), 3 * size);
+    F2LinRngGeneric* out = f2lin_rng_init_at(RNG_TYPE, 1, mem);
+    F2LinSubstreamTable* table = f2lin_substreams_init(base, SMALL_STRIDE, IDS, 0);
+    F2LinRngGeneric* expected = expected_substream(5, SMALL_STRIDE);
+    printf("Testing substreams of a tracked generator\n");
+
+    mu_assert("Unable to position a substream", f2lin_substream(table, 5, out) == out);
+    mu_assert("Substream of a tracked base is tracked", !out->tracked);
+    mu_assert("Wrong substream of a tracked base", f2lin_rng_generic_compare_state(out, expected));
+
+    mu_assert("Unable to initialize a range", !f2lin_substream_range(table, 5, 2, mem + size));
+    for (size_t i = 1; i < 3; ++i) {
+        mu_assert("Range of a tracked base is tracked",
+                  !((F2LinRngGeneric*) (mem + i * size))->tracked);
+    }
+    mu_assert("Wrong range of a tracked base",
+              f2lin_rng_generic_compare_state((F2LinRngGeneric*) (mem + size), expected));
+
+    free(mem);
+    f2lin_substreams_destroy(table);
+    f2lin_rng_destroy(base);
+    f2lin_rng_destroy(expected);
+    return 0;
+}
+
+static char* test_invalid() {
+    const size_t size = f2lin_rng_state_size(RNG_TYPE);
+    F2LinRngGeneric* base = f2lin_rng_init_type(RNG_TYPE, SEED);
+    F2LinRngGeneric* other = f2lin_rng_init_type((RNG_TYPE + 1) % F2LIN_RNG_TYPES, SEED);
+    F2LinRngGeneric* out = f2lin_rng_init_type(RNG_TYPE, 1);
+    F2LinRngGeneric* copy = f2lin_rng_init_type(RNG_TYPE, 1);
+    F2LinSubstreamTable* table = f2lin_substreams_init(base, SMALL_STRIDE, IDS, 0);
+    char* mem = aligned_alloc(f2lin_rng_state_align(RNG_TYPE), 2 * size);
+    printf("Testing invalid substreams, expecting five errors\n");
+
+    mu_assert("Substreams with stride 0", !f2lin_substreams_init(base, 0, IDS, 0));
+    mu_assert("Substreams with an offset larger than size_t",
+              !f2lin_substreams_init(base, LARGE_STRIDE, (1ull << 24) + 1, 0));
+
+    mu_assert("Positioned a substream out of range", !f2lin_substream(table, IDS, out));
+    mu_assert("Positioned a generator of another type", !f2lin_substream(table, 0, other));
+    mu_assert("Changed a generator by an invalid substream",
+              f2lin_rng_generic_compare_state(out, copy));
+    mu_assert("Initialized a range out of range", f2lin_substream_range(table, IDS - 1, 2, mem));
+
+    free(mem);
+    f2lin_substreams_destroy(table);
+    f2lin_rng_destroy(base);
+    f2lin_rng_destroy(other);
+    f2lin_rng_destroy(out);
+    f2lin_rng_destroy(copy);
+    return 0;
+}
+
+static char* all_tests() {
+    mu_run_test(test_small_stride);
+    mu_run_test(test_large_stride);
+    mu_run_test(test_range);
+    mu_run_test(test_tracked_base);
+    mu_run_test(test_invalid);
+
+    return 0;
+}
+
+int main(void) {
+    char* result = all_tests();
+
+    if (result != 0) {
+        printf("%s\n", result);
+    } else {
+        printf("ALL TESTS PASSED\n");
+    }
+
+    printf("Tests run: %d\n", tests_run);
+
+    return result == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,122 @@
+#define TEST
+#include <stdio.h>
+#include <string.h>
+#include "minunit.h"
+#include "config.h"
+#include "f2lin.h"
+#include "jump_ahead.h"
+#include "tune.h"
+#include "rng_generic/rng_generic.h"
+
+#define PROFILE_PATH "t_tune.profile"
+#define SEED 12323456
+
+int tests_run = 0;
+
+static int test_jump(size_t jump_size, F2LinJump* params) {
+    F2LinRngGeneric* jump = f2lin_rng_generic_init(RNG_TYPE);
+    F2LinRngGeneric* iter = f2lin_rng_generic_init(RNG_TYPE);
+    uint64_t actual, expected;
+
+    for (size_t i = 0; i < jump_size; ++i) f2lin_rng_generic_gen64(iter);
+    f2lin_jump_ahead_jump(params, jump);
+    actual = f2lin_rng_generic_gen64(jump);
+    expected = f2lin_rng_generic_gen64(iter);
+
+    f2lin_rng_generic_destroy(jump);
+    f2lin_rng_generic_destroy(iter);
+    return actual == expected;
+}
+
+static char* test_profile() {
+    size_t jump_sizes[] = { 0, 1, 100, 100000, 1ull << 40 };
+    F2LinTuneProfile* profile;
+    F2LinTuneProfile* read;
+    printf("Testing measuring, writing and loading a tuning profile\n");
+
+    // measure as short as possible, only the format and lookup are tested
+    profile = f2lin_tune_profile_measure(RNG_TYPE, 0);
+    for (int b = 0; b < TUNE_BUCKETS; ++b) {
+        const F2LinTuneEntry* e = &profile->entries[b];
+        mu_assert("Invalid algorithm in profile", e->algorithm <= SLIDING_WINDOW_DECOMP);
+        mu_assert("Invalid q in profile", e->algorithm == HORNER 
+                  || (e->q >= TUNE_Q_MIN && e->q <= Q_MAX));
+    }
+
+    mu_assert("Unable to write the profile", !f2lin_tune_profile_write(profile, PROFILE_PATH));
+    read = f2lin_tune_profile_read(PROFILE_PATH);
+    mu_assert("Unable to read the profile", read);
+
+    for (int b = 0; b < TUNE_BUCKETS; ++b) {
+        mu_assert("Read profile differs", read->entries[b].algorithm == profile->entries[b].algorithm
+                  && read->entries[b].q == profile->entries[b].q);
+    }
+
+    // jumps without a config use the entry for the bit length of the jump size
+    mu_assert("Unable to load the profile", !f2lin_tune_load(PROFILE_PATH));
+    for (size_t i = 0; i < sizeof(jump_sizes) / sizeof(jump_sizes[0]); ++i) {
+        const F2LinTuneEntry* e = &profile->entries[jump_sizes[i] ? 64 - __builtin_clzll(jump_sizes[i]) : 0];
+        F2LinJump* jump = f2lin_jump_init_type(RNG_TYPE, jump_sizes[i], 0);
+
+        mu_assert("Profile not used without a config", jump->algorithm == e->algorithm);
+        if (jump->algorithm == SLIDING_WINDOW) mu_assert("Wrong q", jump->jp.sw.q == e->q);
+        if (jump->algorithm == SLIDING_WINDOW_DECOMP) mu_assert("Wrong q", jump->jp.swd.q == e->q);
+        if (jump_sizes[i] <= 100000) mu_assert("Wrong result using the profile", test_jump(jump_sizes[i], jump));
+
+        f2lin_jump_destroy(jump);
+    }
+
+    // unloading goes back to the defaults
+    mu_assert("Unable to unload the profile", !f2lin_tune_load(0));
+    F2LinJump* jump = f2lin_jump_init_type(RNG_TYPE, 100000, 0);
+    mu_assert("Defaults not used after unloading", jump->algorithm == ALGORITHM_DEFAULT
+              && jump->jp.swd.q == Q_DEFAULT);
+    f2lin_jump_destroy(jump);
+
+    f2lin_tune_profile_destroy(profile);
+    f2lin_tune_profile_destroy(read);
+    remove(PROFILE_PATH);
+
+    return 0;
+}
+
+static char* test_invalid() {
+    F2LinTuneProfile profile = { .state_size = f2lin_rng_generic_state_size(RNG_TYPE) + 1 };
+    FILE* f;
+    printf("Testing invalid tuning profiles\n");
+
+    mu_assert("Loaded a missing profile", f2lin_tune_load("t_tune.missing") == -1);
+
+    // measured for a different generator
+    mu_assert("Unable to write the profile", !f2lin_tune_profile_write(&profile, PROFILE_PATH));
+    mu_assert("Loaded a profile of another generator", f2lin_tune_load(PROFILE_PATH) == -1);
+
+    f = fopen(PROFILE_PATH, "w");
+    fprintf(f, "f2lin-tune 1\nstate_size %ld\n", f2lin_rng_generic_state_size(RNG_TYPE));
+    fclose(f);
+    mu_assert("Loaded a truncated profile", f2lin_tune_load(PROFILE_PATH) == -1);
+
+    remove(PROFILE_PATH);
+    return 0;
+}
+
+static char* all_tests() {
+    mu_run_test(test_profile);
+    mu_run_test(test_invalid);
+
+    return 0;
+}
+
+int main(void) {
+    char* result = all_tests();
+
+    if (result != 0) {
+        printf("%s\n", result);
+    } else {
+        printf("ALL TESTS PASSED\n");
+    }
+
+    printf("Tests run: %d\n", tests_run);
+
+    return result == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
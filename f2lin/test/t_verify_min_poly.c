@@ -7,7 +7,7 @@
 int tests_run = 0;
 
 static F2LinRngGeneric* horner(F2LinRngGeneric* rng, GF2X* jump_poly) {
-    F2LinRngGeneric* tmp = f2lin_rng_generic_init_zero();  
+    F2LinRngGeneric* tmp = f2lin_rng_generic_init_zero(RNG_TYPE);  
     size_t i = GF2X_deg(jump_poly);
 
     f2lin_rng_generic_copy(tmp, rng);
@@ -29,7 +29,7 @@ static F2LinRngGeneric* horner(F2LinRngGeneric* rng, GF2X* jump_poly) {
 
 static GF2X* load_min_poly() {
     GF2X* min_poly = GF2X_zero_init();
-    char* min_poly_string = f2lin_rng_generic_min_poly();
+    const char* min_poly_string = f2lin_rng_generic_min_poly(RNG_TYPE);
     for (size_t i = 0; min_poly_string[i] != 0; ++i) {
         GF2X_SetCoeff(min_poly, i, min_poly_string[i] == '1' ? 1 : 0);
     }
@@ -38,7 +38,7 @@ static GF2X* load_min_poly() {
 
 char* test_verify_min_poly(void) {
     GF2X* min_poly = load_min_poly();
-    F2LinRngGeneric* rng = f2lin_rng_generic_init();
+    F2LinRngGeneric* rng = f2lin_rng_generic_init(RNG_TYPE);
     // the minimal polynomial p(x) has to uphold the following condition:
     // p(A) == 0, meaning if we evaluate the p with the input as the transition
     // matrix, it has to be zero. Therefore p(A) * x == 0
@@ -58,8 +58,26 @@ char* test_verify_min_poly(void) {
     return EXIT_SUCCESS;
 }
 
+char* test_verify_min_poly_seeded(void) {
+    // the polynomial has to annihilate every state, not only the one of the default seed
+    const uint64_t seeds[] = { 1, 12323456, 0x9e3779b97f4a7c15ull };
+    GF2X* min_poly = load_min_poly();
+
+    for (size_t i = 0; i < sizeof(seeds) / sizeof(seeds[0]); ++i) {
+        F2LinRngGeneric* rng = f2lin_rng_generic_init_seed(RNG_TYPE, seeds[i]);
+
+        horner(rng, min_poly);
+        mu_assert("p(A) * x is not zero for a seeded generator, the minimal polynomial is wrong",
+                   !f2lin_rng_generic_gen64(rng));
+        f2lin_rng_generic_destroy(rng);
+    }
+
+    return EXIT_SUCCESS;
+}
+
 static char* all_tests() {
     mu_run_test(test_verify_min_poly);
+    mu_run_test(test_verify_min_poly_seeded);
 
     return 0;
 }